@@ -0,0 +1,316 @@
+#include "storm-parsers/parser/BinaryModelParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace binary = storm::exporter::binary;
+
+namespace {
+
+/*!
+ * Reads items of the binary format from a memory region.
+ */
+class BinaryReader {
+   public:
+    BinaryReader(char const* begin, char const* end) : current(begin), end(end) {
+        // Intentionally left empty.
+    }
+
+    uint32_t readUint32() {
+        uint32_t result;
+        readBytes(reinterpret_cast<char*>(&result), sizeof(result));
+        return result;
+    }
+
+    uint64_t readUint64() {
+        uint64_t result;
+        readBytes(reinterpret_cast<char*>(&result), sizeof(result));
+        return result;
+    }
+
+    std::string readString() {
+        uint64_t size = readUint64();
+        checkAvailable(size);
+        std::string result(current, size);
+        skip(size + (8 - size % 8) % 8);
+        return result;
+    }
+
+    storm::storage::BitVector readBitVector() {
+        uint64_t size = readUint64();
+        checkAvailable(((size + 63) / 64) * sizeof(uint64_t));
+        storm::storage::BitVector result(size);
+        for (uint64_t bucketStart = 0; bucketStart < size; bucketStart += 64) {
+            result.setFromInt(bucketStart, std::min<uint64_t>(64, size - bucketStart), readUint64());
+        }
+        return result;
+    }
+
+    template<typename T>
+    std::vector<T> readArray(uint64_t size) {
+        static_assert(sizeof(T) == sizeof(uint64_t), "Only arrays of 64-bit values are stored.");
+        checkAvailable(size * sizeof(T));
+        std::vector<T> result(size);
+        readBytes(reinterpret_cast<char*>(result.data()), size * sizeof(T));
+        return result;
+    }
+
+    std::vector<double> readDoubleVector(uint64_t expectedSize) {
+        uint64_t size = readUint64();
+        STORM_LOG_THROW(size == expectedSize, storm::exceptions::WrongFormatException,
+                        "Vector has size " << size << " but " << expectedSize << " was expected.");
+        return readArray<double>(size);
+    }
+
+    storm::storage::SparseMatrix<double> readMatrix() {
+        uint64_t const rowCount = readUint64();
+        uint64_t const columnCount = readUint64();
+        uint64_t const entryCount = readUint64();
+        uint64_t const rowGroupCount = readUint64();
+
+        std::vector<uint64_t> rowIndications = readArray<uint64_t>(rowCount + 1);
+        STORM_LOG_THROW(rowIndications.front() == 0 && rowIndications.back() == entryCount && std::is_sorted(rowIndications.begin(), rowIndications.end()),
+                        storm::exceptions::WrongFormatException, "Inconsistent row indications.");
+        boost::optional<std::vector<uint64_t>> rowGroupIndices;
+        if (rowGroupCount > 0) {
+            rowGroupIndices = readArray<uint64_t>(rowGroupCount + 1);
+            STORM_LOG_THROW(rowGroupIndices->front() == 0 && rowGroupIndices->back() == rowCount &&
+                                std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()),
+                            storm::exceptions::WrongFormatException, "Inconsistent row group indices.");
+        }
+
+        // The entries are stored as pairs of column and value, which is exactly the layout of the matrix entries.
+        static_assert(sizeof(storm::storage::MatrixEntry<uint64_t, double>) == 2 * sizeof(uint64_t), "Unexpected layout of matrix entries.");
+        checkAvailable(entryCount * 2 * sizeof(uint64_t));
+        std::vector<storm::storage::MatrixEntry<uint64_t, double>> columnsAndValues(entryCount);
+        readBytes(reinterpret_cast<char*>(columnsAndValues.data()), entryCount * 2 * sizeof(uint64_t));
+        for (auto const& entry : columnsAndValues) {
+            STORM_LOG_THROW(entry.getColumn() < columnCount, storm::exceptions::WrongFormatException,
+                            "Column index " << entry.getColumn() << " is out of range.");
+        }
+        return storm::storage::SparseMatrix<double>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    }
+
+    void skip(uint64_t size) {
+        checkAvailable(size);
+        current += size;
+    }
+
+    char const* getPosition() const {
+        return current;
+    }
+
+    uint64_t getRemainingSize() const {
+        return static_cast<uint64_t>(end - current);
+    }
+
+   private:
+    void checkAvailable(uint64_t size) const {
+        STORM_LOG_THROW(getRemainingSize() >= size, storm::exceptions::WrongFormatException, "Unexpected end of file.");
+    }
+
+    void readBytes(char* destination, uint64_t size) {
+        checkAvailable(size);
+        std::memcpy(destination, current, size);
+        current += size;
+    }
+
+    char const* current;
+    char const* end;
+};
+
+void readLabeling(BinaryReader& reader, storm::models::sparse::ItemLabeling& labeling, uint64_t numberOfItems) {
+    uint64_t numberOfLabels = reader.readUint64();
+    for (uint64_t label = 0; label < numberOfLabels; ++label) {
+        std::string name = reader.readString();
+        storm::storage::BitVector items = reader.readBitVector();
+        STORM_LOG_THROW(items.size() == numberOfItems, storm::exceptions::WrongFormatException, "Label '" << name << "' has an unexpected size.");
+        labeling.addLabel(name, std::move(items));
+    }
+}
+
+storm::storage::sparse::StateValuations readStateValuations(BinaryReader& reader) {
+    // The variables only refer to their manager, so the valuations (and thereby the model) own it.
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.setExpressionManager(manager);
+
+    std::vector<binary::VariableKind> variableKinds;
+    uint64_t numberOfVariables = reader.readUint64();
+    for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+        auto kind = static_cast<binary::VariableKind>(reader.readUint64());
+        std::string name = reader.readString();
+        switch (kind) {
+            case binary::VariableKind::Boolean:
+                builder.addVariable(manager->declareBooleanVariable(name));
+                break;
+            case binary::VariableKind::Integer:
+                builder.addVariable(manager->declareIntegerVariable(name));
+                break;
+            case binary::VariableKind::Rational:
+                builder.addVariable(manager->declareRationalVariable(name));
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown type of variable '" << name << "'.");
+        }
+        variableKinds.push_back(kind);
+    }
+    uint64_t numberOfLabels = reader.readUint64();
+    for (uint64_t label = 0; label < numberOfLabels; ++label) {
+        builder.addObservationLabel(reader.readString());
+    }
+
+    uint64_t numberOfStates = reader.readUint64();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (reader.readUint64() == 0) {
+            builder.addState(state);
+            continue;
+        }
+        std::vector<bool> booleanValues;
+        std::vector<int64_t> integerValues;
+        std::vector<storm::RationalNumber> rationalValues;
+        std::vector<int64_t> labelValues;
+        for (auto const& kind : variableKinds) {
+            if (kind == binary::VariableKind::Boolean) {
+                booleanValues.push_back(reader.readUint64() != 0);
+            } else if (kind == binary::VariableKind::Integer) {
+                integerValues.push_back(static_cast<int64_t>(reader.readUint64()));
+            } else {
+                rationalValues.push_back(storm::utility::convertNumber<storm::RationalNumber>(reader.readString()));
+            }
+        }
+        for (uint64_t label = 0; label < numberOfLabels; ++label) {
+            labelValues.push_back(static_cast<int64_t>(reader.readUint64()));
+        }
+        builder.addState(state, std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(labelValues));
+    }
+    return builder.build(numberOfStates);
+}
+
+}  // namespace
+
+std::shared_ptr<storm::models::sparse::Model<double>> BinaryModelParser::parseModel(std::string const& filename) {
+    uint16_t const endiannessTest = 1;
+    STORM_LOG_THROW(*reinterpret_cast<uint8_t const*>(&endiannessTest) == 1, storm::exceptions::NotSupportedException,
+                    "The binary model format is only supported on little endian machines.");
+
+    MappedFile file(filename.c_str());
+    BinaryReader reader(file.getData(), file.getDataEnd());
+
+    // Parse header
+    uint64_t magicNumber;
+    std::memcpy(&magicNumber, binary::magicNumber, sizeof(magicNumber));
+    STORM_LOG_THROW(reader.readUint64() == magicNumber, storm::exceptions::WrongFormatException, "The file " << filename << " is not a binary model.");
+    uint32_t version = reader.readUint32();
+    STORM_LOG_THROW(version == binary::formatVersion, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " has version " << version << " of the binary model format, but only version " << binary::formatVersion
+                                << " is supported.");
+    STORM_LOG_THROW(static_cast<binary::ValueKind>(reader.readUint32()) == binary::ValueKind::Double, storm::exceptions::NotSupportedException,
+                    "The values of the model in file " << filename << " are not supported.");
+    storm::models::ModelType type = storm::models::getModelType(reader.readString());
+    uint64_t const numberOfStates = reader.readUint64();
+    uint64_t const numberOfChoices = reader.readUint64();
+    STORM_LOG_TRACE("Model type: " << type << " with " << numberOfStates << " states and " << numberOfChoices << " choices.");
+
+    storm::storage::sparse::ModelComponents<double> components;
+    components.stateLabeling = storm::models::sparse::StateLabeling(numberOfStates);
+    components.rateTransitions = (type == storm::models::ModelType::Ctmc);
+    bool sawTransitionMatrix = false;
+
+    // Parse sections
+    while (true) {
+        auto kind = static_cast<binary::SectionKind>(reader.readUint32());
+        // The reserved field is ignored so that later versions can use it without breaking older readers.
+        reader.readUint32();
+        uint64_t size = reader.readUint64();
+        if (kind == binary::SectionKind::End) {
+            break;
+        }
+        STORM_LOG_THROW(size <= reader.getRemainingSize(), storm::exceptions::WrongFormatException,
+                        "Section " << static_cast<uint64_t>(kind) << " exceeds the end of the file.");
+        char const* sectionEnd = reader.getPosition() + size;
+        switch (kind) {
+            case binary::SectionKind::TransitionMatrix:
+                components.transitionMatrix = reader.readMatrix();
+                STORM_LOG_THROW(components.transitionMatrix.getRowGroupCount() == numberOfStates &&
+                                    components.transitionMatrix.getRowCount() == numberOfChoices,
+                                storm::exceptions::WrongFormatException, "The transition matrix does not match the number of states and choices.");
+                sawTransitionMatrix = true;
+                break;
+            case binary::SectionKind::StateLabeling:
+                readLabeling(reader, components.stateLabeling, numberOfStates);
+                break;
+            case binary::SectionKind::ChoiceLabeling:
+                components.choiceLabeling = storm::models::sparse::ChoiceLabeling(numberOfChoices);
+                readLabeling(reader, components.choiceLabeling.value(), numberOfChoices);
+                break;
+            case binary::SectionKind::RewardModel: {
+                std::string name = reader.readString();
+                uint64_t presentComponents = reader.readUint64();
+                std::optional<std::vector<double>> stateRewards, stateActionRewards;
+                std::optional<storm::storage::SparseMatrix<double>> transitionRewards;
+                if (presentComponents & 1) {
+                    stateRewards = reader.readDoubleVector(numberOfStates);
+                }
+                if (presentComponents & 2) {
+                    stateActionRewards = reader.readDoubleVector(numberOfChoices);
+                }
+                if (presentComponents & 4) {
+                    transitionRewards = reader.readMatrix();
+                }
+                components.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards), std::move(stateActionRewards),
+                                                                                                         std::move(transitionRewards)));
+                break;
+            }
+            case binary::SectionKind::ExitRates:
+                components.exitRates = reader.readDoubleVector(numberOfStates);
+                break;
+            case binary::SectionKind::MarkovianStates:
+                components.markovianStates = reader.readBitVector();
+                break;
+            case binary::SectionKind::Observations: {
+                uint64_t size = reader.readUint64();
+                STORM_LOG_THROW(size == numberOfStates, storm::exceptions::WrongFormatException, "Unexpected number of observations.");
+                std::vector<uint32_t> observations;
+                observations.reserve(size);
+                for (uint64_t state = 0; state < size; ++state) {
+                    observations.push_back(static_cast<uint32_t>(reader.readUint64()));
+                }
+                components.observabilityClasses = std::move(observations);
+                break;
+            }
+            case binary::SectionKind::StateValuations:
+                components.stateValuations = readStateValuations(reader);
+                break;
+            case binary::SectionKind::ObservationValuations:
+                components.observationValuations = readStateValuations(reader);
+                break;
+            default:
+                STORM_LOG_WARN("Skipping unknown section " << static_cast<uint64_t>(kind) << " in binary model.");
+                reader.skip(size);
+        }
+        STORM_LOG_THROW(reader.getPosition() == sectionEnd, storm::exceptions::WrongFormatException, "Unexpected size of section.");
+    }
+    STORM_LOG_THROW(sawTransitionMatrix, storm::exceptions::WrongFormatException, "The file " << filename << " does not contain a transition matrix.");
+
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ *	Parser for models in the binary drb format (see storm/io/BinaryModelFormat.h).
+ */
+class BinaryModelParser {
+   public:
+    /*!
+     * Load a model in the binary drb format from a file and create the model. The file is mapped to memory and the arrays of the model are copied
+     * directly from the mapped file.
+     *
+     * @param filename The drb file to be loaded.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(std::string const& filename);
+};
+
+}  // namespace parser
+}  // namespace storm
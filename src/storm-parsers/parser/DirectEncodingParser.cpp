@@ -2,10 +2,18 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <regex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
 
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -30,6 +38,413 @@
 namespace storm {
 namespace parser {
 
+namespace {
+
+// The number of chunks per thread. Using more chunks than threads balances the load if the states have different sizes.
+uint64_t const chunksPerThread = 4;
+
+template<typename ValueType>
+struct ValueTraits {
+    // Values of type double are parsed directly while parsing the chunks. All other values are kept as strings and are only parsed when the chunks
+    // are stitched together (sequentially and only once for each distinct string).
+    static bool const parseEagerly = std::is_same<ValueType, double>::value;
+    using Token = std::conditional_t<parseEagerly, ValueType, std::string_view>;
+};
+
+bool startsWith(std::string_view const& str, std::string_view const& prefix) {
+    return str.substr(0, prefix.size()) == prefix;
+}
+
+bool isWhitespace(char c) {
+    return std::isspace(static_cast<unsigned char>(c));
+}
+
+std::string_view trimLeft(std::string_view str) {
+    while (!str.empty() && isWhitespace(str.front())) {
+        str.remove_prefix(1);
+    }
+    return str;
+}
+
+std::string_view trim(std::string_view str) {
+    str = trimLeft(str);
+    while (!str.empty() && isWhitespace(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+/*!
+ * Removes the first whitespace-separated token from the given string and returns it.
+ */
+std::string_view nextToken(std::string_view& str) {
+    str = trimLeft(str);
+    size_t posEnd = str.find_first_of(" \t");
+    std::string_view token = str.substr(0, posEnd);
+    str = posEnd == std::string_view::npos ? std::string_view() : str.substr(posEnd);
+    return token;
+}
+
+uint64_t parseIndex(std::string_view const& str, uint64_t lineNumber) {
+    STORM_LOG_THROW(!str.empty() && str.size() < 20, storm::exceptions::WrongFormatException,
+                    "Could not parse index '" << str << "' in line " << lineNumber << ".");
+    uint64_t result = 0;
+    for (char c : str) {
+        STORM_LOG_THROW(c >= '0' && c <= '9', storm::exceptions::WrongFormatException, "Could not parse index '" << str << "' in line " << lineNumber << ".");
+        result = result * 10 + (c - '0');
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType parseValueString(std::string const& valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
+                           ValueParser<ValueType> const& valueParser) {
+    if (boost::starts_with(valueStr, "$")) {
+        auto it = placeholders.find(valueStr.substr(1));
+        STORM_LOG_THROW(it != placeholders.end(), storm::exceptions::WrongFormatException, "Placeholder " << valueStr << " unknown.");
+        return it->second;
+    } else {
+        // Use default value parser
+        return valueParser.parseValue(valueStr);
+    }
+}
+
+/*!
+ * Turns tokens into values. Values that are not parsed eagerly are cached such that each distinct string is parsed only once.
+ */
+template<typename ValueType>
+class ValueResolver {
+   public:
+    using Token = typename ValueTraits<ValueType>::Token;
+
+    ValueResolver(std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser)
+        : placeholders(placeholders), valueParser(valueParser) {
+        // Intentionally left empty.
+    }
+
+    Token makeToken(std::string_view const& str) const {
+        if constexpr (ValueTraits<ValueType>::parseEagerly) {
+            return parseValueString<ValueType>(std::string(str), placeholders, valueParser);
+        } else {
+            return str;
+        }
+    }
+
+    ValueType resolve(Token const& token) {
+        if constexpr (ValueTraits<ValueType>::parseEagerly) {
+            return token;
+        } else {
+            auto findRes = cache.find(token);
+            if (findRes == cache.end()) {
+                findRes = cache.emplace(token, parseValueString<ValueType>(std::string(token), placeholders, valueParser)).first;
+            }
+            return findRes->second;
+        }
+    }
+
+   private:
+    std::unordered_map<std::string, ValueType> const& placeholders;
+    ValueParser<ValueType> const& valueParser;
+    std::unordered_map<std::string_view, ValueType> cache;
+};
+
+/*!
+ * The items (states or choices) of a chunk with their labels. The labels are kept in the order of their first occurrence.
+ */
+struct ChunkLabels {
+    std::vector<std::string> names;
+    std::vector<std::vector<uint64_t>> items;
+    std::unordered_map<std::string, uint64_t> indices;
+
+    void add(std::string const& label, uint64_t item) {
+        auto insertionRes = indices.emplace(label, names.size());
+        if (insertionRes.second) {
+            names.push_back(label);
+            items.emplace_back();
+        }
+        items[insertionRes.first->second].push_back(item);
+    }
+};
+
+/*!
+ * A part of the state section of a DRN file that starts with a state declaration together with the information parsed from it.
+ * States and rows are numbered relative to the first state (row) of the chunk.
+ */
+template<typename ValueType>
+struct StateChunk {
+    using Token = typename ValueTraits<ValueType>::Token;
+
+    char const* begin;
+    char const* end;
+    // The number of lines (in the state section) before this chunk.
+    uint64_t firstLineNumber = 0;
+    uint64_t firstState = 0;
+    uint64_t firstStateLineNumber = 0;
+    std::vector<uint64_t> rowGroupSizes;
+    std::vector<uint64_t> rowSizes;
+    std::vector<std::pair<uint64_t, Token>> entries;
+    // True if some row has entries whose columns are not strictly increasing.
+    bool hasUnorderedRows = false;
+    std::vector<Token> exitRates;
+    std::vector<uint32_t> observations;
+    // Triples of local state (or row), reward model index and reward.
+    std::vector<std::tuple<uint64_t, uint64_t, Token>> stateRewards;
+    std::vector<std::tuple<uint64_t, uint64_t, Token>> actionRewards;
+    uint64_t numberOfStateRewardModels = 0;
+    uint64_t numberOfActionRewardModels = 0;
+    ChunkLabels stateLabels;
+    ChunkLabels choiceLabels;
+};
+
+/*!
+ * Returns the beginning of the first line at or after the given line beginning that declares a state (or end if there is no such line).
+ */
+char const* findStateDeclaration(char const* position, char const* end) {
+    while (position < end) {
+        char const* lineBegin = position;
+        while (position < end && (*position == ' ' || *position == '\t')) {
+            ++position;
+        }
+        if (end - position >= 6 && std::memcmp(position, "state ", 6) == 0) {
+            return lineBegin;
+        }
+        position = static_cast<char const*>(std::memchr(position, '\n', end - position));
+        if (position == nullptr) {
+            return end;
+        }
+        ++position;
+    }
+    return end;
+}
+
+/*!
+ * Splits the given state section into (at most) the given number of chunks of (roughly) at least the given size. Each chunk but the first one starts
+ * with a state declaration.
+ */
+template<typename ValueType>
+std::vector<StateChunk<ValueType>> splitIntoChunks(char const* begin, char const* end, uint64_t numberOfChunks, uint64_t minimalChunkSize) {
+    uint64_t const size = end - begin;
+    numberOfChunks = std::max<uint64_t>(1, std::min(numberOfChunks, size / std::max<uint64_t>(1, minimalChunkSize)));
+    std::vector<StateChunk<ValueType>> chunks;
+    char const* chunkBegin = begin;
+    for (uint64_t chunk = 1; chunk <= numberOfChunks && chunkBegin < end; ++chunk) {
+        char const* chunkEnd = end;
+        if (chunk < numberOfChunks) {
+            char const* position = begin + size * chunk / numberOfChunks;
+            if (position <= chunkBegin) {
+                continue;
+            }
+            // Move to the beginning of the next line and from there to the next state declaration.
+            position = static_cast<char const*>(std::memchr(position - 1, '\n', end - position + 1));
+            chunkEnd = position == nullptr ? end : findStateDeclaration(position + 1, end);
+        }
+        if (chunkEnd > chunkBegin) {
+            chunks.emplace_back();
+            chunks.back().begin = chunkBegin;
+            chunks.back().end = chunkEnd;
+            chunkBegin = chunkEnd;
+        }
+    }
+    return chunks;
+}
+
+/*!
+ * Calls the given function for all chunk indices. Uses the given number of threads (0 uses all available cores) if Storm is built with Intel TBB.
+ */
+template<typename Function>
+void forEachChunk(uint64_t numberOfChunks, uint64_t numberOfThreads, Function const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfThreads != 1 && numberOfChunks > 1) {
+        auto run = [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                    function(chunk);
+                }
+            });
+        };
+        if (numberOfThreads == 0) {
+            run();
+        } else {
+            tbb::task_arena arena(static_cast<int>(numberOfThreads));
+            arena.execute(run);
+        }
+        return;
+    }
+#endif
+    for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+        function(chunk);
+    }
+}
+
+/*!
+ * Parses the rewards enclosed in brackets at the beginning of the given string and removes them from the string.
+ */
+template<typename ValueType>
+uint64_t parseRewards(std::string_view& line, uint64_t item, uint64_t lineNumber, ValueResolver<ValueType> const& resolver,
+                      std::vector<std::tuple<uint64_t, uint64_t, typename ValueTraits<ValueType>::Token>>& rewards) {
+    size_t posEndReward = line.find(']');
+    STORM_LOG_THROW(posEndReward != std::string_view::npos, storm::exceptions::WrongFormatException, "] missing in line " << lineNumber << " .");
+    std::string_view rewardsStr = line.substr(1, posEndReward - 1);
+    STORM_LOG_TRACE("Rewards: " << rewardsStr);
+    line = trimLeft(line.substr(posEndReward + 1));
+    uint64_t rewardModel = 0;
+    while (true) {
+        size_t posComma = rewardsStr.find(',');
+        auto rewardValue = resolver.makeToken(trim(rewardsStr.substr(0, posComma)));
+        bool isZero = false;
+        if constexpr (ValueTraits<ValueType>::parseEagerly) {
+            isZero = storm::utility::isZero(rewardValue);
+        }
+        if (!isZero) {
+            rewards.emplace_back(item, rewardModel, std::move(rewardValue));
+        }
+        ++rewardModel;
+        if (posComma == std::string_view::npos) {
+            break;
+        }
+        rewardsStr.remove_prefix(posComma + 1);
+    }
+    return rewardModel;
+}
+
+/*!
+ * Parses the states of the given chunk.
+ */
+template<typename ValueType>
+void parseChunk(StateChunk<ValueType>& chunk, storm::models::ModelType type, uint64_t stateSize, ValueResolver<ValueType> const& resolver,
+                bool buildChoiceLabeling) {
+    bool const continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    // Labels are separated by whitespace and can optionally be enclosed in quotation marks
+    // Regex for labels with two cases:
+    // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
+    //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
+    //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
+    //   (?=(\s|$|\"))
+    // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
+    //   - First part matches string without whitespace and quotation marks [^\s\"]+?
+    //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
+    std::regex const labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
+
+    uint64_t lineNumber = chunk.firstLineNumber;
+    bool firstState = true;
+    bool firstActionForState = true;
+    char const* position = chunk.begin;
+    while (position < chunk.end) {
+        char const* lineEnd = static_cast<char const*>(std::memchr(position, '\n', chunk.end - position));
+        if (lineEnd == nullptr) {
+            lineEnd = chunk.end;
+        }
+        std::string_view line = trim(std::string_view(position, lineEnd - position));
+        position = lineEnd + 1;
+        ++lineNumber;
+        if (line.empty() || startsWith(line, "//")) {
+            continue;
+        }
+        STORM_LOG_TRACE("Parsing line no " << lineNumber << " : " << line);
+        if (startsWith(line, "state ")) {
+            // New state
+            line.remove_prefix(6);
+            uint64_t const state = parseIndex(nextToken(line), lineNumber);
+            uint64_t const localState = chunk.rowGroupSizes.size();
+            if (firstState) {
+                chunk.firstState = state;
+                chunk.firstStateLineNumber = lineNumber;
+                firstState = false;
+            }
+            STORM_LOG_THROW(state == chunk.firstState + localState, storm::exceptions::WrongFormatException,
+                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << chunk.firstState + localState << " but got "
+                                       << state << ".");
+            STORM_LOG_THROW(state < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+            STORM_LOG_TRACE("New state " << state);
+            chunk.rowGroupSizes.push_back(1);
+            chunk.rowSizes.push_back(0);
+            firstActionForState = true;
+
+            if (continuousTime) {
+                // Parse exit rate for CTMC or MA
+                line = trimLeft(line);
+                STORM_LOG_THROW(startsWith(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << lineNumber);
+                line.remove_prefix(1);  // Remove "!"
+                chunk.exitRates.push_back(resolver.makeToken(nextToken(line)));
+            }
+
+            // Parse rewards and observation (in any order)
+            line = trimLeft(line);
+            bool sawObservation = false;
+            while (true) {
+                if (startsWith(line, "[")) {
+                    chunk.numberOfStateRewardModels =
+                        std::max(chunk.numberOfStateRewardModels, parseRewards(line, localState, lineNumber, resolver, chunk.stateRewards));
+                } else if (type == storm::models::ModelType::Pomdp && startsWith(line, "{")) {
+                    size_t posEndObservation = line.find('}');
+                    STORM_LOG_THROW(posEndObservation != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                    "} missing in line " << lineNumber << " .");
+                    std::string observation(trim(line.substr(1, posEndObservation - 1)));
+                    STORM_LOG_TRACE("State observation " << observation);
+                    chunk.observations.push_back(parseNumber<uint32_t>(observation));
+                    sawObservation = true;
+                    line = trimLeft(line.substr(posEndObservation + 1));
+                } else {
+                    break;
+                }
+            }
+            STORM_LOG_THROW(type != storm::models::ModelType::Pomdp || sawObservation, storm::exceptions::WrongFormatException,
+                            "Expected an observation for state " << state << " in line " << lineNumber);
+
+            // Parse labels
+            for (auto it = std::cregex_iterator(line.data(), line.data() + line.size(), labelRegex); it != std::cregex_iterator(); ++it) {
+                // Find matched group and add as label
+                std::string label = it->length(1) > 0 ? it->str(1) : it->str(3);
+                STORM_LOG_TRACE("New label: '" << label << "'");
+                chunk.stateLabels.add(label, localState);
+            }
+
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+            }
+        } else if (startsWith(line, "action ")) {
+            // New action
+            STORM_LOG_THROW(!firstState, storm::exceptions::WrongFormatException, "In line " << lineNumber << " an action is declared before the first state.");
+            if (firstActionForState) {
+                firstActionForState = false;
+            } else {
+                ++chunk.rowGroupSizes.back();
+                chunk.rowSizes.push_back(0);
+            }
+            uint64_t const localRow = chunk.rowSizes.size() - 1;
+            line.remove_prefix(7);
+            std::string_view actionName = nextToken(line);
+            if (buildChoiceLabeling && actionName != "__NOLABEL__") {
+                chunk.choiceLabels.add(std::string(actionName), localRow);
+            }
+            // Check for rewards
+            line = trimLeft(line);
+            if (startsWith(line, "[")) {
+                chunk.numberOfActionRewardModels =
+                    std::max(chunk.numberOfActionRewardModels, parseRewards(line, localRow, lineNumber, resolver, chunk.actionRewards));
+            }
+        } else {
+            // New transition
+            STORM_LOG_THROW(!firstState, storm::exceptions::WrongFormatException,
+                            "In line " << lineNumber << " a transition is declared before the first state.");
+            size_t posColon = line.find(':');
+            STORM_LOG_THROW(posColon != std::string_view::npos, storm::exceptions::WrongFormatException,
+                            "':' not found in '" << line << "' on line " << lineNumber << ".");
+            uint64_t const target = parseIndex(trim(line.substr(0, posColon)), lineNumber);
+            STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
+                            "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
+            uint64_t& rowSize = chunk.rowSizes.back();
+            if (rowSize > 0 && target <= chunk.entries.back().first) {
+                chunk.hasUnorderedRows = true;
+            }
+            ++rowSize;
+            chunk.entries.emplace_back(target, resolver.makeToken(trim(line.substr(posColon + 1))));
+        }
+    }
+}
+
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
@@ -48,7 +463,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     size_t nrChoices = 0;
     storm::models::ModelType type;
     std::vector<std::string> rewardModelNames;
-    std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> modelComponents;
+    bool sawModel = false;
+    uint64_t modelOffset = 0;
 
     // Parse header
     while (storm::utility::getline(file, line)) {
@@ -117,15 +533,22 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
             STORM_LOG_THROW(!options.buildChoiceLabeling || nrChoices != 0, storm::exceptions::WrongFormatException,
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
-            // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            // The states are parsed from the memory mapped file.
+            std::streampos position = file.tellg();
+            modelOffset = position == std::streampos(-1) ? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>(position);
+            sawModel = true;
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
         }
     }
-    // Done parsing
     storm::utility::closeFile(file);
+    STORM_LOG_THROW(sawModel, storm::exceptions::WrongFormatException, "Model (@model) is missing.");
+
+    // Construct model components
+    storm::parser::MappedFile mappedFile(filename.c_str());
+    char const* statesBegin = mappedFile.getData() + std::min<uint64_t>(modelOffset, mappedFile.getDataSize());
+    auto modelComponents = parseStates(statesBegin, mappedFile.getDataEnd(), type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
 
     // Build model
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
@@ -133,26 +556,125 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
-    std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-    ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+
     // Initialize
     auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
     bool nonDeterministic =
         (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
     bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-    storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
-    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
-    modelComponents->observabilityClasses = std::vector<uint32_t>();
-    modelComponents->observabilityClasses->resize(stateSize);
-    if (options.buildChoiceLabeling) {
-        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
+    ValueResolver<ValueType> resolver(placeholders, valueParser);
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(options.numberOfThreads == 1, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+#endif
+
+    // Split the states into chunks. We use the same chunks regardless of whether they are parsed in parallel.
+    uint64_t numberOfChunks = 1;
+    if (options.numberOfThreads != 1) {
+        uint64_t numberOfThreads = options.numberOfThreads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : options.numberOfThreads;
+        numberOfChunks = numberOfThreads * chunksPerThread;
+    }
+    std::vector<StateChunk<ValueType>> chunks = splitIntoChunks<ValueType>(begin, end, numberOfChunks, options.minimalChunkSize);
+    STORM_LOG_DEBUG("Parsing the states in " << chunks.size() << " chunks.");
+
+    // Determine the line numbers for error messages.
+    std::vector<uint64_t> numberOfLines(chunks.size());
+    forEachChunk(chunks.size(), options.numberOfThreads,
+                 [&chunks, &numberOfLines](uint64_t chunk) { numberOfLines[chunk] = std::count(chunks[chunk].begin, chunks[chunk].end, '\n'); });
+    for (uint64_t chunk = 1; chunk < chunks.size(); ++chunk) {
+        chunks[chunk].firstLineNumber = chunks[chunk - 1].firstLineNumber + numberOfLines[chunk - 1];
+    }
+
+    // Parse the chunks.
+    forEachChunk(chunks.size(), options.numberOfThreads, [&chunks, &type, &stateSize, &resolver, &options](uint64_t chunk) {
+        parseChunk(chunks[chunk], type, stateSize, resolver, options.buildChoiceLabeling);
+    });
+    STORM_LOG_TRACE("Finished parsing");
+
+    // Compute the offsets of the chunks.
+    std::vector<uint64_t> firstRows, firstEntries;
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfRows = 0;
+    uint64_t numberOfEntries = 0;
+    uint64_t numberOfStateRewardModels = 0;
+    uint64_t numberOfActionRewardModels = 0;
+    bool hasUnorderedRows = false;
+    for (auto const& chunk : chunks) {
+        STORM_LOG_THROW(chunk.rowGroupSizes.empty() || chunk.firstState == numberOfStates, storm::exceptions::WrongFormatException,
+                        "In line " << chunk.firstStateLineNumber << " state ids are not ordered and without gaps. Expected " << numberOfStates << " but got "
+                                   << chunk.firstState << ".");
+        firstRows.push_back(numberOfRows);
+        firstEntries.push_back(numberOfEntries);
+        numberOfStates += chunk.rowGroupSizes.size();
+        numberOfRows += chunk.rowSizes.size();
+        numberOfEntries += chunk.entries.size();
+        numberOfStateRewardModels = std::max(numberOfStateRewardModels, chunk.numberOfStateRewardModels);
+        numberOfActionRewardModels = std::max(numberOfActionRewardModels, chunk.numberOfActionRewardModels);
+        hasUnorderedRows |= chunk.hasUnorderedRows;
+    }
+    STORM_LOG_THROW(numberOfStates == stateSize, storm::exceptions::WrongFormatException,
+                    "Number of states detected (" << numberOfStates << ") does not match number of states declared (" << stateSize << ", in @nr_states).");
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || numberOfRows == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << numberOfRows << ") does not match number of actions declared (" << nrChoices << ", in @nr_choices).");
     }
-    std::vector<std::vector<ValueType>> stateRewards;
-    std::vector<std::vector<ValueType>> actionRewards;
+    STORM_LOG_THROW(!options.buildChoiceLabeling || numberOfRows <= nrChoices, storm::exceptions::WrongFormatException,
+                    "More actions detected than declared (in @nr_choices).");
+
+    // Stitch the chunks together. Values that are not parsed eagerly are resolved sequentially.
+    std::vector<index_type> rowIndications(numberOfRows + 1);
+    boost::optional<std::vector<index_type>> rowGroupIndices;
+    if (nonDeterministic) {
+        rowGroupIndices = std::vector<index_type>(numberOfStates + 1);
+    }
+    std::vector<storm::storage::MatrixEntry<index_type, ValueType>> columnsAndValues(numberOfEntries);
+    modelComponents->observabilityClasses = std::vector<uint32_t>(stateSize);
     if (continuousTime) {
         modelComponents->exitRates = std::vector<ValueType>(stateSize);
-        if (type == storm::models::ModelType::MarkovAutomaton) {
-            modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+    }
+    forEachChunk(chunks.size(), ValueTraits<ValueType>::parseEagerly ? options.numberOfThreads : 1, [&](uint64_t chunkIndex) {
+        auto& chunk = chunks[chunkIndex];
+        uint64_t row = firstRows[chunkIndex];
+        uint64_t state = chunk.firstState;
+        if (nonDeterministic) {
+            for (auto const& rowGroupSize : chunk.rowGroupSizes) {
+                rowGroupIndices.get()[state++] = row;
+                row += rowGroupSize;
+            }
+        }
+        row = firstRows[chunkIndex];
+        uint64_t entry = firstEntries[chunkIndex];
+        for (auto const& rowSize : chunk.rowSizes) {
+            rowIndications[row++] = entry;
+            entry += rowSize;
+        }
+        entry = firstEntries[chunkIndex];
+        for (auto const& chunkEntry : chunk.entries) {
+            columnsAndValues[entry++] = storm::storage::MatrixEntry<index_type, ValueType>(chunkEntry.first, resolver.resolve(chunkEntry.second));
+        }
+        std::vector<std::pair<uint64_t, typename ValueTraits<ValueType>::Token>>().swap(chunk.entries);
+        if (continuousTime) {
+            state = chunk.firstState;
+            for (auto const& exitRate : chunk.exitRates) {
+                modelComponents->exitRates.get()[state++] = resolver.resolve(exitRate);
+            }
+        }
+        std::copy(chunk.observations.begin(), chunk.observations.end(), modelComponents->observabilityClasses->begin() + chunk.firstState);
+    });
+    rowIndications.back() = numberOfEntries;
+    if (nonDeterministic) {
+        rowGroupIndices->back() = numberOfRows;
+    }
+
+    if (type == storm::models::ModelType::MarkovAutomaton) {
+        modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+        for (uint64_t state = 0; state < stateSize; ++state) {
+            if (!storm::utility::isZero<ValueType>(modelComponents->exitRates.get()[state])) {
+                modelComponents->markovianStates.get().set(state);
+            }
         }
     }
     // We parse rates for continuous time models.
@@ -160,234 +682,74 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         modelComponents->rateTransitions = true;
     }
 
-    // Iterate over all lines
-    std::string line;
-    size_t row = 0;
-    size_t state = 0;
-    uint64_t lineNumber = 0;
-    bool firstState = true;
-    bool firstActionForState = true;
-    while (storm::utility::getline(file, line)) {
-        lineNumber++;
-        if (boost::starts_with(line, "//")) {
-            continue;
-        }
-        if (line.empty()) {
-            continue;
-        }
-        STORM_LOG_TRACE("Parsing line no " << lineNumber << " : " << line);
-        boost::trim_left(line);
-        if (boost::starts_with(line, "state ")) {
-            // New state
-            if (firstState) {
-                firstState = false;
-            } else {
-                ++state;
-                ++row;
-            }
-            firstActionForState = true;
-            STORM_LOG_TRACE("New state " << state);
-            STORM_LOG_THROW(state <= stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
-
-            // Parse state id
-            line = line.substr(6);  // Remove "state "
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
-            }
-            size_t parsedId = parseNumber<size_t>(curString);
-            STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
-            if (nonDeterministic) {
-                STORM_LOG_TRACE("new Row Group starts at " << row << ".");
+    // Build transition matrix
+    if (hasUnorderedRows) {
+        // The matrix builder sorts the entries of each row and adds up duplicate entries.
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, nonDeterministic, 0);
+        uint64_t state = 0;
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            if (nonDeterministic && state < numberOfStates && rowGroupIndices.get()[state] == row) {
                 builder.newRowGroup(row);
-                STORM_LOG_THROW(nrChoices == 0 || builder.getCurrentRowGroupCount() <= nrChoices, storm::exceptions::WrongFormatException,
-                                "More actions detected than declared (in @nr_choices).");
+                ++state;
             }
-
-            if (continuousTime) {
-                // Parse exit rate for CTMC or MA
-                STORM_LOG_THROW(boost::starts_with(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << lineNumber);
-                line = line.substr(1);  // Remove "!"
-                curString = line;
-                posEnd = line.find(" ");
-                if (posEnd != std::string::npos) {
-                    curString = line.substr(0, posEnd);
-                    line = line.substr(posEnd + 1);
-                } else {
-                    line = "";
-                }
-                ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                    modelComponents->markovianStates.get().set(state);
-                }
-                STORM_LOG_TRACE("Exit rate " << exitRate);
-                modelComponents->exitRates.get()[state] = exitRate;
-            }
-
-            if (boost::starts_with(line, "[")) {
-                // Parse rewards
-                size_t posEndReward = line.find(']');
-                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing in line " << lineNumber << " .");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("State rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (stateRewards.size() < rewards.size()) {
-                    stateRewards.resize(rewards.size());
-                }
-                auto stateRewardsIt = stateRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (stateRewardsIt->empty()) {
-                            stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
-                        }
-                        (*stateRewardsIt)[state] = std::move(rewardValue);
-                    }
-                    ++stateRewardsIt;
-                }
-                line = line.substr(posEndReward + 1);
+            for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                builder.addNextValue(row, columnsAndValues[entry].getColumn(), columnsAndValues[entry].getValue());
             }
+        }
+        modelComponents->transitionMatrix = builder.build(numberOfRows, stateSize, nonDeterministic ? stateSize : 0);
+    } else {
+        modelComponents->transitionMatrix =
+            storm::storage::SparseMatrix<ValueType>(stateSize, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    }
+    STORM_LOG_TRACE("Built matrix");
 
-            if (type == storm::models::ModelType::Pomdp) {
-                if (boost::starts_with(line, "{")) {
-                    size_t posEndObservation = line.find("}");
-                    std::string observation = line.substr(1, posEndObservation - 1);
-                    STORM_LOG_TRACE("State observation " << observation);
-                    modelComponents->observabilityClasses.value()[state] = std::stoi(observation);
-                    line = line.substr(posEndObservation + 1);
-                } else {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << " in line " << lineNumber);
-                }
+    // Build labelings and reward models
+    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+    if (options.buildChoiceLabeling) {
+        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
+    }
+    std::vector<std::vector<ValueType>> stateRewards(numberOfStateRewardModels);
+    std::vector<std::vector<ValueType>> actionRewards(numberOfActionRewardModels);
+    for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+        auto const& chunk = chunks[chunkIndex];
+        for (uint64_t labelIndex = 0; labelIndex < chunk.stateLabels.names.size(); ++labelIndex) {
+            std::string const& label = chunk.stateLabels.names[labelIndex];
+            if (!modelComponents->stateLabeling.containsLabel(label)) {
+                modelComponents->stateLabeling.addLabel(label);
             }
-
-            // Parse labels
-            if (!line.empty()) {
-                std::vector<std::string> labels;
-                // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                // Regex for labels with two cases:
-                // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
-                //   (?=(\s|$|\"))
-                // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
-                // Iterate over matches
-                auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
-                auto match_end = std::sregex_iterator();
-                for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
-                    std::smatch match = *i;
-                    // Find matched group and add as label
-                    if (match.length(1) > 0) {
-                        labels.push_back(match.str(1));
-                    } else {
-                        labels.push_back(match.str(3));
-                    }
-                }
-
-                for (std::string const& label : labels) {
-                    if (!modelComponents->stateLabeling.containsLabel(label)) {
-                        modelComponents->stateLabeling.addLabel(label);
-                    }
-                    modelComponents->stateLabeling.addLabelToState(label, state);
-                    STORM_LOG_TRACE("New label: '" << label << "'");
-                }
+            for (auto const& localState : chunk.stateLabels.items[labelIndex]) {
+                modelComponents->stateLabeling.addLabelToState(label, chunk.firstState + localState);
             }
-        } else if (boost::starts_with(line, "action ")) {
-            // New action
-            if (firstActionForState) {
-                firstActionForState = false;
-            } else {
-                ++row;
+        }
+        for (uint64_t labelIndex = 0; labelIndex < chunk.choiceLabels.names.size(); ++labelIndex) {
+            std::string const& label = chunk.choiceLabels.names[labelIndex];
+            if (!modelComponents->choiceLabeling->containsLabel(label)) {
+                modelComponents->choiceLabeling->addLabel(label);
             }
-            STORM_LOG_TRACE("New action: " << row);
-            line = line.substr(7);
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
+            for (auto const& localRow : chunk.choiceLabels.items[labelIndex]) {
+                modelComponents->choiceLabeling->addLabelToChoice(label, firstRows[chunkIndex] + localRow);
             }
-
-            // curString contains action name.
-            if (options.buildChoiceLabeling) {
-                if (curString != "__NOLABEL__") {
-                    if (!modelComponents->choiceLabeling.value().containsLabel(curString)) {
-                        modelComponents->choiceLabeling.value().addLabel(curString);
-                    }
-                    modelComponents->choiceLabeling.value().addLabelToChoice(curString, row);
+        }
+        for (auto const& [localState, rewardModel, token] : chunk.stateRewards) {
+            ValueType rewardValue = resolver.resolve(token);
+            if (!storm::utility::isZero(rewardValue)) {
+                if (stateRewards[rewardModel].empty()) {
+                    stateRewards[rewardModel].resize(stateSize, storm::utility::zero<ValueType>());
                 }
+                stateRewards[rewardModel][chunk.firstState + localState] = std::move(rewardValue);
             }
-            // Check for rewards
-            if (boost::starts_with(line, "[")) {
-                // Rewards found
-                size_t posEndReward = line.find(']');
-                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing.");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("Action rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (actionRewards.size() < rewards.size()) {
-                    actionRewards.resize(rewards.size());
-                }
-                auto actionRewardsIt = actionRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (actionRewardsIt->size() <= row) {
-                            actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
-                        }
-                        (*actionRewardsIt)[row] = std::move(rewardValue);
-                    }
-                    ++actionRewardsIt;
+        }
+        for (auto const& [localRow, rewardModel, token] : chunk.actionRewards) {
+            ValueType rewardValue = resolver.resolve(token);
+            if (!storm::utility::isZero(rewardValue)) {
+                if (actionRewards[rewardModel].empty()) {
+                    actionRewards[rewardModel].resize(numberOfRows, storm::utility::zero<ValueType>());
                 }
-                line = line.substr(posEndReward + 1);
+                actionRewards[rewardModel][firstRows[chunkIndex] + localRow] = std::move(rewardValue);
             }
-
-        } else {
-            // New transition
-            size_t posColon = line.find(':');
-            STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException,
-                            "':' not found in '" << line << "' on line " << lineNumber << ".");
-            size_t target = parseNumber<size_t>(line.substr(0, posColon - 1));
-            std::string valueStr = line.substr(posColon + 2);
-            ValueType value = parseValue(valueStr, placeholders, valueParser);
-            STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
-            STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
-            builder.addNextValue(row, target, value);
         }
-
-        if (storm::utility::resources::isTerminate()) {
-            std::cout << "Parsed " << state << "/" << stateSize << " states before abort.\n";
-            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-            break;
-        }
-
-    }  // end state iteration
-    STORM_LOG_TRACE("Finished parsing");
-
-    if (nonDeterministic) {
-        STORM_LOG_THROW(nrChoices == 0 || builder.getLastRow() + 1 == nrChoices, storm::exceptions::WrongFormatException,
-                        "Number of actions detected (at least " << builder.getLastRow() + 1 << ") does not match number of actions declared (" << nrChoices
-                                                                << ", in @nr_choices).");
     }
 
-    // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
-    STORM_LOG_TRACE("Built matrix");
-
-    // Build reward models
     uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
     for (uint64_t i = 0; i < numRewardModels; ++i) {
         std::string rewardModelName;
@@ -401,7 +763,6 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             stateRewardVector = std::move(stateRewards[i]);
         }
         if (i < actionRewards.size() && !actionRewards[i].empty()) {
-            actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
             actionRewardVector = std::move(actionRewards[i]);
         }
         modelComponents->rewardModels.emplace(
@@ -415,14 +776,7 @@ template<typename ValueType, typename RewardModelType>
 ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr,
                                                                        std::unordered_map<std::string, ValueType> const& placeholders,
                                                                        ValueParser<ValueType> const& valueParser) {
-    if (boost::starts_with(valueStr, "$")) {
-        auto it = placeholders.find(valueStr.substr(1));
-        STORM_LOG_THROW(it != placeholders.end(), storm::exceptions::WrongFormatException, "Placeholder " << valueStr << " unknown.");
-        return it->second;
-    } else {
-        // Use default value parser
-        return valueParser.parseValue(valueStr);
-    }
+    return parseValueString(valueStr, placeholders, valueParser);
 }
 
 // Template instantiations.
@@ -11,6 +11,10 @@ namespace parser {
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // The number of threads used to parse the states. A value of 0 means that all available cores are used.
+    uint64_t numberOfThreads = 1;
+    // The minimal size (in bytes) of a chunk of states that is parsed independently. This only has an effect if multiple threads are requested.
+    uint64_t minimalChunkSize = 1ull << 16;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -31,8 +35,11 @@ class DirectEncodingParser {
    private:
     /*!
      * Parse states and return transition matrix.
+     * The states are split into chunks (at state declarations) which are parsed independently (and in parallel if multiple threads are requested).
+     * Afterwards, the chunks are stitched together.
      *
-     * @param file Input file stream.
+     * @param begin Pointer to the first character after the @model line.
+     * @param end Pointer to the first position after the last character of the file.
      * @param type Model type.
      * @param stateSize No. of states
      * @param placeholders Placeholders for values.
@@ -42,8 +49,9 @@ class DirectEncodingParser {
      * @return Transition matrix.
      */
     static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(
-        std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+        char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
     /*!
      * Parse value from string while using placeholders.
@@ -15,7 +15,9 @@ namespace modules {
 const std::string BeliefExplorationSettings::moduleName = "beliefExploration";
 
 const std::string refineOption = "refine";
+const std::string incrementalRefinementOption = "incremental-refinement";
 const std::string explorationTimeLimitOption = "exploration-time";
+const std::string explorationThreadsOption = "exploration-threads";
 const std::string resolutionOption = "resolution";
 const std::string clipGridResolutionOption = "clip-resolution";
 const std::string sizeThresholdOption = "size-threshold";
@@ -43,11 +45,31 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
                              .build())
             .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, incrementalRefinementOption, false,
+                                                   "If set, refinement steps only re-solve the part of the belief MDP that is affected by newly explored "
+                                                   "beliefs. Values of the remaining states are taken from the previous step.")
+                        .setIsAdvanced()
+                        .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, explorationTimeLimitOption, false, "Sets after which time no further states shall be explored.")
             .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "In seconds.").setDefaultValueUnsignedInteger(0).build())
             .build());
 
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, explorationThreadsOption, false,
+                                       "Sets the number of threads used to expand and triangulate beliefs when building the over-approximation.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads (0 means all available cores).")
+                             .setDefaultValueUnsignedInteger(1)
+                             .build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batch", "The number of beliefs that are expanded at once.")
+                             .setDefaultValueUnsignedInteger(1024)
+                             .makeOptional()
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, resolutionOption, false,
                                        "Sets the resolution of the discretization and how it is increased in case of refinement")
@@ -165,6 +187,10 @@ bool BeliefExplorationSettings::isRefineSet() const {
     return this->getOption(refineOption).getHasOptionBeenSet();
 }
 
+bool BeliefExplorationSettings::isIncrementalRefinementSet() const {
+    return this->getOption(incrementalRefinementOption).getHasOptionBeenSet();
+}
+
 bool BeliefExplorationSettings::isStateEliminationCutoffSet() const {
     return this->getOption(stateEliminationCutoffOption).getHasOptionBeenSet();
 }
@@ -181,6 +207,14 @@ uint64_t BeliefExplorationSettings::getExplorationTimeLimit() const {
     return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+uint64_t BeliefExplorationSettings::getExplorationThreads() const {
+    return this->getOption(explorationThreadsOption).getArgumentByName("threads").getValueAsUnsignedInteger();
+}
+
+uint64_t BeliefExplorationSettings::getExplorationBatchSize() const {
+    return this->getOption(explorationThreadsOption).getArgumentByName("batch").getValueAsUnsignedInteger();
+}
+
 uint64_t BeliefExplorationSettings::getResolutionInit() const {
     return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
 }
@@ -254,7 +288,10 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
     options.refine = isRefineSet();
     options.refinePrecision = storm::utility::convertNumber<ValueType>(getRefinePrecision());
     options.refineStepLimit = getRefineStepLimit();
+    options.incrementalRefinement = isIncrementalRefinementSet();
     options.explorationTimeLimit = getExplorationTimeLimit();
+    options.explorationThreads = getExplorationThreads();
+    options.explorationBatchSize = getExplorationBatchSize();
 
     options.clippingGridRes = getClippingGridResolution();
     options.resolutionInit = getResolutionInit();
@@ -36,9 +36,14 @@ class BeliefExplorationSettings : public ModuleSettings {
     bool isRefineSet() const;
     double getRefinePrecision() const;
     uint64_t getRefineStepLimit() const;
+    bool isIncrementalRefinementSet() const;
 
     uint64_t getExplorationTimeLimit() const;
 
+    /// Parallel expansion of beliefs
+    uint64_t getExplorationThreads() const;
+    uint64_t getExplorationBatchSize() const;
+
     /// Discretization Resolution
     uint64_t getResolutionInit() const;
     double getResolutionFactor() const;
@@ -12,6 +12,7 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -76,6 +77,8 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::startNewExploration(std::opt
     optimalChoices = std::nullopt;
     optimalChoicesReachableMdpStates = std::nullopt;
     scheduler = nullptr;
+    checkedOptimizationDirection = std::nullopt;
+    previousCheckResult = std::nullopt;
     exploredMdp = nullptr;
     internalAddRowGroupIndex();  // Mark the start of the first row group
 
@@ -120,6 +123,13 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::startNewExploration(std::opt
 template<typename PomdpType, typename BeliefValueType>
 void BeliefMdpExplorer<PomdpType, BeliefValueType>::restartExploration() {
     STORM_LOG_ASSERT(status == Status::ModelChecked || status == Status::ModelFinished, "Method call is invalid in current status.");
+    // Keep the current result so that it can be reused when checking the next MDP
+    if (status == Status::ModelChecked && scheduler && checkedOptimizationDirection) {
+        previousCheckResult = PreviousCheckResult{exploredMdp,      values,           scheduler, mdpStateToBeliefIdMap,
+                                                  extraTargetState, extraBottomState, checkedOptimizationDirection.value()};
+    } else {
+        previousCheckResult = std::nullopt;
+    }
     status = Status::Exploring;
     // We will not erase old states during the exploration phase, so most state-based data (like mappings between MDP and Belief states) remain valid.
     prio = storm::utility::zero<ValueType>();
@@ -214,6 +224,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::restoreExplorationState() {
     optimalChoicesReachableMdpStates = std::nullopt;
     exploredMdp = nullptr;
     scheduler = nullptr;
+    previousCheckResult = std::nullopt;
 }
 
 template<typename PomdpType, typename BeliefValueType>
@@ -233,6 +244,18 @@ std::vector<uint64_t> BeliefMdpExplorer<PomdpType, BeliefValueType>::getUnexplor
     return res;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getNextUnexploredBeliefs(
+    uint64_t maxNumberOfBeliefs) const {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    std::vector<BeliefId> res;
+    res.reserve(std::min<uint64_t>(maxNumberOfBeliefs, mdpStatesToExplorePrioState.size()));
+    for (auto stateIt = mdpStatesToExplorePrioState.rbegin(); stateIt != mdpStatesToExplorePrioState.rend() && res.size() < maxNumberOfBeliefs; ++stateIt) {
+        res.push_back(getBeliefId(stateIt->second));
+    }
+    return res;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplorer<PomdpType, BeliefValueType>::exploreNextState() {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
@@ -910,32 +933,250 @@ BeliefMdpExplorer<PomdpType, BeliefValueType>::computeFMSchedulerValueForMemoryN
 }
 
 template<typename PomdpType, typename BeliefValueType>
-void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir) {
+void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir,
+                                                                               bool incremental) {
     STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
     STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
-    auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
-    auto task = createStandardCheckTask(property);
-
-    std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
-    if (res) {
-        values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
-        scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
-        STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
-                                  "Computed values are smaller than the lower bound.");
-        STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
-                                  "Computed values are larger than the upper bound.");
+    if (incremental && computeValuesOfExploredMdpIncrementally(env, dir)) {
+        ++numberOfIncrementalChecks;
     } else {
-        STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
-        STORM_LOG_ERROR("No result obtained while checking.");
+        auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
+        auto task = createStandardCheckTask(property, values);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
+        if (res) {
+            values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+            scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+            STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
+                                      "Computed values are smaller than the lower bound.");
+            STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
+                                      "Computed values are larger than the upper bound.");
+        } else {
+            STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
+            STORM_LOG_ERROR("No result obtained while checking.");
+        }
     }
+    // The previous result is outdated now
+    previousCheckResult = std::nullopt;
+    checkedOptimizationDirection = dir;
     status = Status::ModelChecked;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+bool BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdpIncrementally(storm::Environment const &env,
+                                                                                           storm::solver::OptimizationDirection const &dir) {
+    if (!previousCheckResult || previousCheckResult->optimizationDirection != dir ||
+        previousCheckResult->mdp->hasRewardModel() != exploredMdp->hasRewardModel()) {
+        return false;
+    }
+    auto const &previous = previousCheckResult.value();
+    bool const computeRewards = exploredMdp->hasRewardModel();
+    if (computeRewards && (exploredMdp->getUniqueRewardModel().hasTransitionRewards() || previous.mdp->getUniqueRewardModel().hasTransitionRewards())) {
+        // Transition rewards only occur for clipping which does not support refinement.
+        return false;
+    }
+
+    uint64_t const numberOfStates = exploredMdp->getNumberOfStates();
+    auto const &transitions = exploredMdp->getTransitionMatrix();
+    auto const &previousTransitions = previous.mdp->getTransitionMatrix();
+    auto const &targets = exploredMdp->getStates("target");
+    auto const &previousTargets = previous.mdp->getStates("target");
+
+    // Find the state of the previously checked MDP that corresponds to each state (if any)
+    std::unordered_map<BeliefId, MdpStateType> previousBeliefIdToMdpStateMap;
+    for (MdpStateType previousState = 0; previousState < previous.mdpStateToBeliefIdMap.size(); ++previousState) {
+        if (previous.mdpStateToBeliefIdMap[previousState] != beliefManager->noId()) {
+            previousBeliefIdToMdpStateMap.emplace(previous.mdpStateToBeliefIdMap[previousState], previousState);
+        }
+    }
+    std::vector<MdpStateType> toPreviousState(numberOfStates, noState());
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        if (state == extraBottomState) {
+            toPreviousState[state] = previous.extraBottomState.value_or(noState());
+        } else if (state == extraTargetState) {
+            toPreviousState[state] = previous.extraTargetState.value_or(noState());
+        } else {
+            auto previousStateIt = previousBeliefIdToMdpStateMap.find(mdpStateToBeliefIdMap[state]);
+            if (previousStateIt != previousBeliefIdToMdpStateMap.end()) {
+                toPreviousState[state] = previousStateIt->second;
+            }
+        }
+    }
+
+    // Find the states whose behavior changed since the previous check, i.e., new states, re-explored states with different successors or
+    // (approximated) values as well as states that are now truncated.
+    auto choiceChanged = [&](uint64_t choice, uint64_t previousChoice) {
+        if (computeRewards &&
+            exploredMdp->getUniqueRewardModel().getStateActionReward(choice) != previous.mdp->getUniqueRewardModel().getStateActionReward(previousChoice)) {
+            return true;
+        }
+        auto const row = transitions.getRow(choice);
+        auto const previousRow = previousTransitions.getRow(previousChoice);
+        if (row.getNumberOfEntries() != previousRow.getNumberOfEntries()) {
+            return true;
+        }
+        std::vector<std::pair<MdpStateType, ValueType>> mappedRow;
+        mappedRow.reserve(row.getNumberOfEntries());
+        for (auto const &entry : row) {
+            if (toPreviousState[entry.getColumn()] == noState()) {
+                return true;
+            }
+            mappedRow.emplace_back(toPreviousState[entry.getColumn()], entry.getValue());
+        }
+        std::sort(mappedRow.begin(), mappedRow.end(), [](auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; });
+        auto mappedEntryIt = mappedRow.begin();
+        for (auto const &previousEntry : previousRow) {
+            if (mappedEntryIt->first != previousEntry.getColumn() || mappedEntryIt->second != previousEntry.getValue()) {
+                return true;
+            }
+            ++mappedEntryIt;
+        }
+        return false;
+    };
+    storm::storage::BitVector changedStates(numberOfStates, false);
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        MdpStateType const previousState = toPreviousState[state];
+        if (previousState == noState() || targets.get(state) != previousTargets.get(previousState) ||
+            transitions.getRowGroupSize(state) != previousTransitions.getRowGroupSize(previousState)) {
+            changedStates.set(state, true);
+            continue;
+        }
+        uint64_t const previousGroupStart = previousTransitions.getRowGroupIndices()[previousState];
+        for (uint64_t localChoice = 0; localChoice < transitions.getRowGroupSize(state); ++localChoice) {
+            if (choiceChanged(transitions.getRowGroupIndices()[state] + localChoice, previousGroupStart + localChoice)) {
+                changedStates.set(state, true);
+                break;
+            }
+        }
+    }
+
+    // The values of states that can not reach a changed state remain the same.
+    storm::storage::BitVector affectedStates =
+        storm::utility::graph::performProbGreater0E(exploredMdp->getBackwardTransitions(), storm::storage::BitVector(numberOfStates, true), changedStates);
+    if (affectedStates.full()) {
+        return false;
+    }
+    uint64_t const numberOfAffectedStates = affectedStates.getNumberOfSetBits();
+    STORM_LOG_INFO("Re-solving " << numberOfAffectedStates << " of " << numberOfStates << " states of the explored MDP (" << changedStates.getNumberOfSetBits()
+                                 << " states changed).");
+
+    std::vector<ValueType> newValues(numberOfStates);
+    auto newScheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(numberOfStates);
+    for (auto state : ~affectedStates) {
+        newValues[state] = previous.values[toPreviousState[state]];
+        newScheduler->setChoice(previous.scheduler->getChoice(toPreviousState[state]), state);
+    }
+
+    if (numberOfAffectedStates > 0) {
+        // Build the sub-MDP over the affected states. A transition to an unaffected state is split into a transition to a target sink (weighted with the
+        // previous value of the state) and a transition to a bottom sink. For rewards, the previous value is collected immediately instead.
+        std::vector<MdpStateType> toSubState(numberOfStates, noState());
+        MdpStateType nextSubState = 0;
+        uint64_t numberOfSubChoices = 2;  // one choice for each sink state
+        for (auto state : affectedStates) {
+            toSubState[state] = nextSubState++;
+            numberOfSubChoices += transitions.getRowGroupSize(state);
+        }
+        MdpStateType const subTargetState = numberOfAffectedStates;
+        MdpStateType const subBottomState = numberOfAffectedStates + 1;
+        uint64_t const numberOfSubStates = numberOfAffectedStates + 2;
+
+        storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfSubChoices, numberOfSubStates, 0, true, true, numberOfSubStates);
+        std::vector<ValueType> subActionRewards;
+        std::vector<ValueType> subValueHints;
+        subValueHints.reserve(numberOfSubStates);
+        uint64_t subRow = 0;
+        for (auto state : affectedStates) {
+            subValueHints.push_back(toPreviousState[state] == noState() ? values[state] : previous.values[toPreviousState[state]]);
+            builder.newRowGroup(subRow);
+            for (uint64_t choice = transitions.getRowGroupIndices()[state]; choice < transitions.getRowGroupIndices()[state + 1]; ++choice, ++subRow) {
+                ValueType toTarget = storm::utility::zero<ValueType>();
+                ValueType toBottom = storm::utility::zero<ValueType>();
+                ValueType reward = computeRewards ? exploredMdp->getUniqueRewardModel().getStateActionReward(choice) : storm::utility::zero<ValueType>();
+                for (auto const &entry : transitions.getRow(choice)) {
+                    if (affectedStates.get(entry.getColumn())) {
+                        builder.addNextValue(subRow, toSubState[entry.getColumn()], entry.getValue());
+                        continue;
+                    }
+                    ValueType const &previousValue = previous.values[toPreviousState[entry.getColumn()]];
+                    if (!computeRewards) {
+                        toTarget += entry.getValue() * previousValue;
+                        toBottom += entry.getValue() * (storm::utility::one<ValueType>() - previousValue);
+                    } else if (storm::utility::isInfinity(previousValue)) {
+                        // The bottom sink never reaches the target, so its reward is infinite as well
+                        toBottom += entry.getValue();
+                    } else {
+                        toTarget += entry.getValue();
+                        reward += entry.getValue() * previousValue;
+                    }
+                }
+                if (!storm::utility::isZero(toTarget)) {
+                    builder.addNextValue(subRow, subTargetState, toTarget);
+                }
+                if (!storm::utility::isZero(toBottom)) {
+                    builder.addNextValue(subRow, subBottomState, toBottom);
+                }
+                if (computeRewards) {
+                    subActionRewards.push_back(std::move(reward));
+                }
+            }
+        }
+        for (auto sinkState : {subTargetState, subBottomState}) {
+            builder.newRowGroup(subRow);
+            builder.addNextValue(subRow, sinkState, storm::utility::one<ValueType>());
+            ++subRow;
+            if (computeRewards) {
+                subActionRewards.push_back(storm::utility::zero<ValueType>());
+            }
+        }
+        subValueHints.push_back(computeRewards ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>());
+        subValueHints.push_back(storm::utility::zero<ValueType>());
+
+        storm::models::sparse::StateLabeling subLabeling(numberOfSubStates);
+        subLabeling.addLabel("init");
+        subLabeling.addLabelToState("init", affectedStates.get(initialMdpState) ? toSubState[initialMdpState] : subTargetState);
+        storm::storage::BitVector subTargetStates = targets % affectedStates;
+        subTargetStates.resize(numberOfSubStates, false);
+        subTargetStates.set(subTargetState, true);
+        subLabeling.addLabel("target", std::move(subTargetStates));
+        std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> subRewardModels;
+        if (computeRewards) {
+            subRewardModels.emplace(
+                "default", storm::models::sparse::StandardRewardModel<ValueType>(std::optional<std::vector<ValueType>>(), std::move(subActionRewards)));
+        }
+        storm::storage::sparse::ModelComponents<ValueType> subModelComponents(builder.build(), std::move(subLabeling), std::move(subRewardModels));
+        auto subMdp = std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(subModelComponents));
+
+        auto property = createStandardProperty(dir, computeRewards);
+        auto task = createStandardCheckTask(property, subValueHints);
+        std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, subMdp, task));
+        if (!res) {
+            STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
+            STORM_LOG_ERROR("No result obtained while checking.");
+            return true;
+        }
+        auto const &subValues = res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+        auto const &subScheduler = res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler();
+        for (auto state : affectedStates) {
+            newValues[state] = subValues[toSubState[state]];
+            newScheduler->setChoice(subScheduler.getChoice(toSubState[state]), state);
+        }
+    }
+    values = std::move(newValues);
+    scheduler = std::move(newScheduler);
+    return true;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 bool BeliefMdpExplorer<PomdpType, BeliefValueType>::hasComputedValues() const {
     return status == Status::ModelChecked;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+uint64_t BeliefMdpExplorer<PomdpType, BeliefValueType>::getNumberOfIncrementalChecks() const {
+    return numberOfIncrementalChecks;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType> const &BeliefMdpExplorer<PomdpType, BeliefValueType>::getValuesOfExploredMdp()
     const {
@@ -1077,12 +1318,13 @@ std::shared_ptr<storm::logic::Formula const> BeliefMdpExplorer<PomdpType, Belief
 
 template<typename PomdpType, typename BeliefValueType>
 storm::modelchecker::CheckTask<storm::logic::Formula, typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>
-BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property) {
+BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property,
+                                                                       std::vector<ValueType> const &resultHint) {
     // Note: The property should not run out of scope after calling this because the task only stores the property by reference.
     //  Therefore, this method needs the property by reference (and not const reference)
     auto task = storm::api::createTask<ValueType>(property, false);
     auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
-    hint.setResultHint(values);
+    hint.setResultHint(resultHint);
     auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
     task.setHint(hintPtr);
     task.setProduceSchedulers();
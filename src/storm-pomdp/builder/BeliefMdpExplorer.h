@@ -63,6 +63,12 @@ class BeliefMdpExplorer {
 
     std::vector<uint64_t> getUnexploredStates();
 
+    /*!
+     * Retrieves the beliefs of (at most) the given number of unexplored states in the order in which they will be explored (assuming that no further
+     * states are added to the exploration queue).
+     */
+    std::vector<BeliefId> getNextUnexploredBeliefs(uint64_t maxNumberOfBeliefs) const;
+
     BeliefId exploreNextState();
 
     void addChoiceLabelToCurrentState(uint64_t const &localActionIndex, std::string const &label);
@@ -180,10 +186,23 @@ class BeliefMdpExplorer {
 
     std::vector<storm::storage::Scheduler<ValueType>> getLowerValueBoundSchedulers() const;
 
-    void computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir);
+    /*!
+     * Computes the values (and an optimal scheduler) of the explored MDP.
+     *
+     * @param env The environment used for model checking.
+     * @param dir Whether values are minimized or maximized.
+     * @param incremental If set and the exploration was restarted after a previous check, only the states that can reach a state whose behavior
+     * changed since the previous check are re-solved. The values and choices of all other states are taken from the previous check.
+     */
+    void computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir, bool incremental = false);
 
     bool hasComputedValues() const;
 
+    /*!
+     * Retrieves the number of checks (see computeValuesOfExploredMdp) in which only the affected states were re-solved.
+     */
+    uint64_t getNumberOfIncrementalChecks() const;
+
     bool hasFMSchedulerValues() const;
 
     std::vector<ValueType> const &getValuesOfExploredMdp() const;
@@ -260,7 +279,17 @@ class BeliefMdpExplorer {
 
     std::shared_ptr<storm::logic::Formula const> createStandardProperty(storm::solver::OptimizationDirection const &dir, bool computeRewards);
 
-    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property);
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property,
+                                                                                             std::vector<ValueType> const &resultHint);
+
+    /*!
+     * Computes the values of the explored MDP by only re-solving the states that can reach a state whose behavior changed since the previous check.
+     * To this end, a sub-MDP over the affected states is solved, in which transitions to unaffected states are redirected to sink states according
+     * to the previously computed values.
+     *
+     * @return false if the previous result can not be reused (in this case, nothing is changed).
+     */
+    bool computeValuesOfExploredMdpIncrementally(storm::Environment const &env, storm::solver::OptimizationDirection const &dir);
 
     MdpStateType getCurrentMdpState() const;
 
@@ -318,6 +347,20 @@ class BeliefMdpExplorer {
     std::optional<storm::storage::BitVector> optimalChoices;
     std::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
     std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+    std::optional<storm::solver::OptimizationDirection> checkedOptimizationDirection;
+
+    // The result of the last check before the exploration was restarted (used for incremental checking)
+    struct PreviousCheckResult {
+        std::shared_ptr<storm::models::sparse::Mdp<ValueType>> mdp;
+        std::vector<ValueType> values;
+        std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+        std::vector<BeliefId> mdpStateToBeliefIdMap;
+        std::optional<MdpStateType> extraTargetState;
+        std::optional<MdpStateType> extraBottomState;
+        storm::solver::OptimizationDirection optimizationDirection;
+    };
+    std::optional<PreviousCheckResult> previousCheckResult;
+    uint64_t numberOfIncrementalChecks = 0;
 
     // The current status of this explorer
     ExplorationHeuristic explHeuristic;
@@ -2,6 +2,8 @@
 
 #include <tuple>
 
+#include "storm-config.h"
+
 #include "storm-pomdp/analysis/FiniteBeliefMdpDetection.h"
 #include "storm-pomdp/analysis/FormulaInformation.h"
 #include "storm-pomdp/transformer/MakeStateSetObservationClosed.h"
@@ -72,7 +74,9 @@ BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPTyp
     : beliefMdpDetectedToBeFinite(false),
       refinementFixpointDetected(false),
       overApproximationBuildAborted(false),
+      overApproximationIncrementalChecks(0),
       underApproximationBuildAborted(false),
+      underApproximationIncrementalChecks(0),
       aborted(false) {
     // intentionally left empty;
 }
@@ -88,6 +92,12 @@ BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPTyp
 
     beliefTypeCC = storm::utility::ConstantsComparator<BeliefValueType>(storm::utility::convertNumber<BeliefValueType>(this->options.numericPrecision), false);
     valueTypeCC = storm::utility::ConstantsComparator<ValueType>(this->options.numericPrecision, false);
+#ifndef STORM_HAVE_INTELTBB
+    if (this->options.explorationThreads != 1) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        this->options.explorationThreads = 1;
+    }
+#endif
 }
 
 /* Public Functions */
@@ -221,6 +231,11 @@ BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPTyp
     return result;
 }
 
+template<typename PomdpModelType, typename BeliefValueType, typename BeliefMDPType>
+uint64_t BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::getNumberOfIncrementalChecks() const {
+    return statistics.overApproximationIncrementalChecks + statistics.underApproximationIncrementalChecks;
+}
+
 template<typename PomdpModelType, typename BeliefValueType, typename BeliefMDPType>
 void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::printStatisticsToStream(std::ostream& stream) const {
     stream << "##### Grid Approximation Statistics ######\n";
@@ -257,6 +272,9 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         stream << "# Maximal resolution for over-approximation: " << statistics.overApproximationMaxResolution.value() << '\n';
         stream << "# Time spend for building the over-approx grid MDP(s): " << statistics.overApproximationBuildTime << '\n';
         stream << "# Time spend for checking the over-approx grid MDP(s): " << statistics.overApproximationCheckTime << '\n';
+        if (options.incrementalRefinement) {
+            stream << "# Incremental checks of the over-approx grid MDP(s): " << statistics.overApproximationIncrementalChecks << '\n';
+        }
     }
 
     // The underapproximation MDP:
@@ -290,6 +308,9 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         }
         stream << "# Time spend for building the under-approx grid MDP(s): " << statistics.underApproximationBuildTime << '\n';
         stream << "# Time spend for checking the under-approx grid MDP(s): " << statistics.underApproximationCheckTime << '\n';
+        if (options.incrementalRefinement) {
+            stream << "# Incremental checks of the under-approx grid MDP(s): " << statistics.underApproximationIncrementalChecks << '\n';
+        }
     }
 
     stream << "##########################################\n";
@@ -848,6 +869,17 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         }
 
         uint64_t currId = overApproximation->exploreNextState();
+        if (options.explorationThreads != 1 && targetObservations.count(beliefManager->getBeliefObservation(currId)) == 0 &&
+            !beliefManager->hasPreparedExpansions(currId, observationResolutionVector)) {
+            // Expand the current belief and the beliefs that are explored next in parallel. Ids are still assigned in the order of exploration.
+            std::vector<typename BeliefManagerType::BeliefId> beliefsToPrepare = {currId};
+            for (auto const& beliefId : overApproximation->getNextUnexploredBeliefs(options.explorationBatchSize - 1)) {
+                if (targetObservations.count(beliefManager->getBeliefObservation(beliefId)) == 0) {
+                    beliefsToPrepare.push_back(beliefId);
+                }
+            }
+            beliefManager->prepareExpansionsAndTriangulations(beliefsToPrepare, observationResolutionVector, options.explorationThreads);
+        }
         bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
         if (!hasOldBehavior) {
             STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because a new state is explored");
@@ -1016,6 +1048,7 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             break;
         }
     }
+    beliefManager->clearPreparedExpansions();
 
     if (storm::utility::resources::isTerminate()) {
         // don't overwrite statistics of a previous, successful computation
@@ -1031,8 +1064,10 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     statistics.overApproximationBuildTime.stop();
 
     statistics.overApproximationCheckTime.start();
-    overApproximation->computeValuesOfExploredMdp(env, min ? storm::solver::OptimizationDirection::Minimize : storm::solver::OptimizationDirection::Maximize);
+    overApproximation->computeValuesOfExploredMdp(env, min ? storm::solver::OptimizationDirection::Minimize : storm::solver::OptimizationDirection::Maximize,
+                                                  options.incrementalRefinement);
     statistics.overApproximationCheckTime.stop();
+    statistics.overApproximationIncrementalChecks = overApproximation->getNumberOfIncrementalChecks();
 
     // don't overwrite statistics of a previous, successful computation
     if (!storm::utility::resources::isTerminate() || !statistics.overApproximationStates) {
@@ -1283,8 +1318,10 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     STORM_PRINT_AND_LOG("Finished exploring Underapproximation MDP.\nStart analysis...\n");
     unfoldingStatus = Status::ModelExplorationFinished;
     statistics.underApproximationCheckTime.start();
-    underApproximation->computeValuesOfExploredMdp(env, min ? storm::solver::OptimizationDirection::Minimize : storm::solver::OptimizationDirection::Maximize);
+    underApproximation->computeValuesOfExploredMdp(env, min ? storm::solver::OptimizationDirection::Minimize : storm::solver::OptimizationDirection::Maximize,
+                                                   options.incrementalRefinement);
     statistics.underApproximationCheckTime.stop();
+    statistics.underApproximationIncrementalChecks = underApproximation->getNumberOfIncrementalChecks();
     if (underApproximation->getExploredMdp()->getStateLabeling().getStates("truncated").getNumberOfSetBits() > 0) {
         statistics.nrTruncatedStates = underApproximation->getExploredMdp()->getStateLabeling().getStates("truncated").getNumberOfSetBits();
     }
@@ -118,6 +118,12 @@ class BeliefExplorationPomdpModelChecker {
      */
     void printStatisticsToStream(std::ostream& stream) const;
 
+    /**
+     * Returns the number of checks of the over- and under-approximation MDPs in which only the states affected by a refinement were re-solved
+     * @return the number of incremental checks (always zero if incremental refinement is disabled)
+     */
+    uint64_t getNumberOfIncrementalChecks() const;
+
     /**
      * Uses model checking on the underlying MDP to generate values used for cut-offs and for clipping compensation if necessary
      * @param formula the formula to check
@@ -216,11 +222,13 @@ class BeliefExplorationPomdpModelChecker {
         storm::utility::Stopwatch overApproximationBuildTime;
         storm::utility::Stopwatch overApproximationCheckTime;
         std::optional<BeliefValueType> overApproximationMaxResolution;
+        uint64_t overApproximationIncrementalChecks;
 
         std::optional<uint64_t> underApproximationStates;
         bool underApproximationBuildAborted;
         storm::utility::Stopwatch underApproximationBuildTime;
         storm::utility::Stopwatch underApproximationCheckTime;
+        uint64_t underApproximationIncrementalChecks;
         std::optional<uint64_t> underApproximationStateLimit;
         std::optional<uint64_t> nrClippingAttempts;
         std::optional<uint64_t> nrClippedStates;
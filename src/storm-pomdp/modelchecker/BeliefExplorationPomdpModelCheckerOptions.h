@@ -27,8 +27,14 @@ struct BeliefExplorationPomdpModelCheckerOptions {
     bool cutZeroGap = false;
     bool useStateEliminationCutoff = false;
     uint64_t refineStepLimit = 0;
+    // If set, refinement steps only re-solve the states of the belief MDP that can reach a state whose behavior changed in that step
+    bool incrementalRefinement = false;
     ValueType refinePrecision = storm::utility::convertNumber<ValueType>(1e-4);
     uint64_t explorationTimeLimit = 0;
+    // The number of threads used for expanding and triangulating beliefs while building the over-approximation (0 means all available cores)
+    uint64_t explorationThreads = 1;
+    // The number of beliefs that are expanded at once if multiple threads are used
+    uint64_t explorationBatchSize = 1024;
 
     // Control parameters for the refinement heuristic
     // Discretization Resolution
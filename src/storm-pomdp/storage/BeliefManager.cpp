@@ -1,6 +1,7 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
 #include "solver/GlpkLpSolver.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -30,13 +31,15 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::oper
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const {
-    return lhBelief == rhBelief;
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(const BeliefType &lhBelief, const BeliefView &rhBelief) const {
+    return lhBelief.size() == rhBelief.size() && std::equal(lhBelief.begin(), lhBelief.end(), rhBelief.begin(), [](auto const &lhEntry, auto const &rhEntry) {
+               return lhEntry.first == rhEntry.first && lhEntry.second == rhEntry.second;
+           });
 }
 
 template<>
 bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(const BeliefType &lhBelief,
-                                                                                                        const BeliefType &rhBelief) const {
+                                                                                                        const BeliefView &rhBelief) const {
     // If the sizes are different, we don't have to look inside the belief
     if (lhBelief.size() != rhBelief.size()) {
         return false;
@@ -77,12 +80,42 @@ std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t
     return seed;
 }
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefIdHash::operator()(BeliefId const &id) const {
+    return manager->beliefHashes[id];
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefIdHash::operator()(HashedBelief const &belief) const {
+    return belief.hash;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefIdEqual::operator()(BeliefId const &lhId, BeliefId const &rhId) const {
+    // Beliefs are only stored once, so different ids refer to different beliefs
+    return lhId == rhId;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefIdEqual::operator()(HashedBelief const &lhBelief, BeliefId const &rhId) const {
+    return lhBelief.hash == manager->beliefHashes[rhId] && Belief_equal_to()(lhBelief.belief, manager->getBelief(rhId));
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefIdEqual::operator()(BeliefId const &lhId, HashedBelief const &rhBelief) const {
+    return (*this)(rhBelief, lhId);
+}
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision,
                                                                     TriangulationMode const &triangulationMode)
     : pomdp(pomdp), triangulationMode(triangulationMode) {
     cc = storm::utility::ConstantsComparator<BeliefValueType>(precision, false);
-    beliefToIdMap.resize(pomdp.getNrObservations());
+    beliefOffsets.push_back(0);
+    beliefToIdMap.reserve(pomdp.getNrObservations());
+    for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
+        beliefToIdMap.emplace_back(0, BeliefIdHash{this}, BeliefIdEqual{this});
+    }
     initialBeliefId = computeInitialBelief();
 }
 
@@ -108,12 +141,12 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefId const &first, BeliefId const &second) const {
-    return isEqual(getBelief(first), getBelief(second));
+    return isEqual(getBeliefCopy(first), getBeliefCopy(second));
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefId const &beliefId) const {
-    return toString(getBelief(beliefId));
+    return toString(getBeliefCopy(beliefId));
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -121,7 +154,7 @@ std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(Trian
     std::stringstream str;
     str << "(\n";
     for (uint64_t i = 0; i < t.size(); ++i) {
-        str << "\t" << t.weights[i] << " * \t" << toString(getBelief(t.gridPoints[i])) << "\n";
+        str << "\t" << t.weights[i] << " * \t" << toString(getBeliefCopy(t.gridPoints[i])) << "\n";
     }
     str << ")\n";
     return str.str();
@@ -177,7 +210,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType BeliefM
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
-    return getBeliefObservation(getBelief(beliefId));
+    return pomdp.getObservation(getBelief(beliefId).begin()->first);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -189,12 +222,13 @@ uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOf
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
     BeliefId beliefId, BeliefValueType resolution) {
-    return triangulateBelief(getBelief(beliefId), resolution);
+    return triangulateBelief(getBeliefCopy(beliefId), resolution);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state,
+                                                                             BeliefValueType const &value) const {
     auto insertionRes = distr.emplace(state, value);
     if (!insertionRes.second) {
         insertionRes.first->second += value;
@@ -203,7 +237,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(Dis
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) const {
     if (distr.size() == 1 && cc.isEqual(distr.begin()->second, storm::utility::one<BeliefValueType>())) {
         // If the distribution consists of only one entry and its value is sufficiently close to 1, make it exactly 1 to avoid numerical problems
         distr.begin()->second = storm::utility::one<BeliefValueType>();
@@ -220,7 +254,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-    return beliefs.size();
+    return beliefHashes.size();
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -228,6 +262,9 @@ std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateTy
                       typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
 BeliefManager<PomdpType, BeliefValueType, StateType>::expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex,
                                                                            std::vector<BeliefValueType> const &observationResolutions) {
+    if (hasPreparedExpansions(beliefId, observationResolutions)) {
+        return getOrAddGridPointIds(preparedExpansions.at(beliefId)[actionIndex]);
+    }
     return expandInternal(beliefId, actionIndex, observationResolutions);
 }
 
@@ -247,21 +284,81 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &bel
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
+void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansionsAndTriangulations(std::vector<BeliefId> const &beliefIds,
+                                                                                              std::vector<BeliefValueType> const &observationResolutions,
+                                                                                              uint64_t numberOfThreads) {
+    clearPreparedExpansions();
+    // The expansions only read from the belief store, which is not modified until all expansions are computed.
+    std::vector<std::vector<std::vector<PreparedGridPoint>>> expansions(beliefIds.size());
+    auto prepareRange = [&](uint64_t first, uint64_t last) {
+        for (uint64_t index = first; index < last; ++index) {
+            BeliefView belief = getBelief(beliefIds[index]);
+            uint64_t numberOfChoices = pomdp.getNumberOfChoices(belief.begin()->first);
+            expansions[index].reserve(numberOfChoices);
+            for (uint64_t action = 0; action < numberOfChoices; ++action) {
+                expansions[index].push_back(computeTriangulatedSuccessors(belief, action, observationResolutions));
+            }
+        }
+    };
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfThreads == 1) {
+        prepareRange(0, beliefIds.size());
+    } else {
+        auto prepareInParallel = [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, beliefIds.size()),
+                              [&](tbb::blocked_range<uint64_t> const &range) { prepareRange(range.begin(), range.end()); });
+        };
+        if (numberOfThreads == 0) {
+            prepareInParallel();
+        } else {
+            tbb::task_arena arena(static_cast<int>(numberOfThreads));
+            arena.execute(prepareInParallel);
+        }
+    }
+#else
+    STORM_LOG_WARN_COND(numberOfThreads == 1, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    prepareRange(0, beliefIds.size());
+#endif
+    for (uint64_t index = 0; index < beliefIds.size(); ++index) {
+        preparedExpansions.emplace(beliefIds[index], std::move(expansions[index]));
+    }
+    preparedObservationResolutions = observationResolutions;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::hasPreparedExpansions(BeliefId const &beliefId,
+                                                                                 std::vector<BeliefValueType> const &observationResolutions) const {
+    return preparedExpansions.count(beliefId) != 0 && preparedObservationResolutions == observationResolutions;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::clearPreparedExpansions() {
+    preparedExpansions.clear();
+    preparedObservationResolutions.clear();
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
     BeliefId const &id) const {
     STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
     STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-    return beliefs[id];
+    return BeliefView{beliefEntries.data() + beliefOffsets[id], beliefEntries.data() + beliefOffsets[id + 1]};
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefCopy(
+    BeliefId const &id) const {
+    BeliefView belief = getBelief(id);
+    // The entries in the pool are sorted, so the flat map can be filled without lookups
+    return BeliefType(boost::container::ordered_unique_range, belief.begin(), belief.end());
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
     BeliefType const &belief) const {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-    return idIt->second;
+    BeliefId id = findBeliefId(HashedBelief{belief, BeliefHash()(belief)});
+    STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+    return id;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -341,7 +438,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefTy
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, PendingTriangulation const &triangulation) const {
     if (triangulation.weights.size() != triangulation.gridPoints.size()) {
         STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
         return false;
@@ -365,8 +462,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
             STORM_LOG_ERROR("Weight greater than one in triangulation.");
         }
         weightSum += triangulation.weights[i];
-        BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-        for (auto const &pointEntry : gridPoint) {
+        for (auto const &pointEntry : triangulation.gridPoints[i]) {
             BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<BeliefValueType>()).first->second;
             triangulatedValue += triangulation.weights[i] * pointEntry.second;
         }
@@ -386,14 +482,14 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType const &belief) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
     return pomdp.getObservation(belief.begin()->first);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                        Triangulation &result) {
+                                                                                        PendingTriangulation &result) const {
     STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
     StateType numEntries = belief.size();
@@ -442,7 +538,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
                     gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                 }
             }
-            result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            result.gridPoints.push_back(std::move(gridPoint));
         }
         previousSortedDiff = currentSortedDiff++;
     }
@@ -450,7 +546,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                    Triangulation &result) {
+                                                                                    PendingTriangulation &result) const {
     // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is
     // minimal
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
@@ -488,14 +584,14 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDyna
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
-    BeliefType const &belief, BeliefValueType const &resolution) {
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::PendingTriangulation
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-    Triangulation result;
+    PendingTriangulation result;
     // Quickly triangulate Dirac beliefs
     if (belief.size() == 1u) {
         result.weights.push_back(storm::utility::one<BeliefValueType>());
-        result.gridPoints.push_back(getOrAddBeliefId(belief));
+        result.gridPoints.push_back(belief);
     } else {
         auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
         switch (triangulationMode) {
@@ -509,20 +605,26 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
                 STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
         }
     }
-    STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+    STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation of belief " << toString(belief) << ".");
     return result;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
-                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
-                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
-    std::vector<std::pair<BeliefId, ValueType>> destinations;
-
-    BeliefType belief = getBelief(beliefId);
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
+    BeliefType const &belief, BeliefValueType const &resolution) {
+    PendingTriangulation pendingTriangulation = computeTriangulation(belief, resolution);
+    Triangulation result;
+    result.weights = std::move(pendingTriangulation.weights);
+    result.gridPoints.reserve(pendingTriangulation.gridPoints.size());
+    for (auto const &gridPoint : pendingTriangulation.gridPoints) {
+        result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+    }
+    return result;
+}
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, BeliefValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefView const &belief, uint64_t actionIndex) const {
     // Find the probability we go to each observation
     BeliefType successorObs;  // This is actually not a belief but has the same type
     for (auto const &pointEntry : belief) {
@@ -536,7 +638,9 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
     }
     adjustDistribution(successorObs);
 
-    // Now for each successor observation we find and potentially triangulate the successor belief
+    // Now for each successor observation we find the successor belief
+    std::vector<std::pair<BeliefType, BeliefValueType>> successors;
+    successors.reserve(successorObs.size());
     for (auto const &successor : successorObs) {
         BeliefType successorBelief;
         for (auto const &pointEntry : belief) {
@@ -550,17 +654,63 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
         }
         adjustDistribution(successorBelief);
         STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
-
-        // Insert the destination. We know that destinations have to be disjoint since they have different observations
-        if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
-            for (size_t j = 0; j < triangulation.size(); ++j) {
-                // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                BeliefValueType a = triangulation.weights[j] * successor.second;
-                destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
+        successors.emplace_back(std::move(successorBelief), successor.second);
+    }
+    return successors;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<typename BeliefManager<PomdpType, BeliefValueType, StateType>::PreparedGridPoint>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulatedSuccessors(BeliefView const &belief, uint64_t actionIndex,
+                                                                                    std::vector<BeliefValueType> const &observationResolutions) const {
+    std::vector<PreparedGridPoint> result;
+    for (auto &successor : computeSuccessorBeliefs(belief, actionIndex)) {
+        uint32_t successorObservation = getBeliefObservation(successor.first);
+        PendingTriangulation triangulation = computeTriangulation(successor.first, observationResolutions[successorObservation]);
+        for (uint64_t j = 0; j < triangulation.size(); ++j) {
+            // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
+            PreparedGridPoint gridPoint{std::move(triangulation.gridPoints[j]), 0, noId(), triangulation.weights[j] * successor.second};
+            gridPoint.hash = BeliefHash()(gridPoint.belief);
+            gridPoint.id = findBeliefId(HashedBelief{gridPoint.belief, gridPoint.hash});
+            if (gridPoint.id != noId()) {
+                // The belief itself is no longer needed
+                gridPoint.belief = BeliefType();
             }
-        } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
+            result.push_back(std::move(gridPoint));
+        }
+    }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddGridPointIds(std::vector<PreparedGridPoint> const &gridPoints) {
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+    destinations.reserve(gridPoints.size());
+    for (auto const &gridPoint : gridPoints) {
+        BeliefId id = gridPoint.id == noId() ? getOrAddBeliefId(HashedBelief{gridPoint.belief, gridPoint.hash}) : gridPoint.id;
+        destinations.emplace_back(id, storm::utility::convertNumber<ValueType>(gridPoint.probability));
+    }
+    return destinations;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
+    if (observationTriangulationResolutions) {
+        return getOrAddGridPointIds(computeTriangulatedSuccessors(getBelief(beliefId), actionIndex, observationTriangulationResolutions.value()));
+    }
+
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+    // We know that destinations have to be disjoint since they have different observations
+    for (auto const &successor : computeSuccessorBeliefs(getBelief(beliefId), actionIndex)) {
+        BeliefType const &successorBelief = successor.first;
+        if (observationGridClippingResolutions) {
+            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[getBeliefObservation(successorBelief)],
                                                        storm::storage::BitVector(pomdp.getNumberOfStates()));
             if (clipping.isClippable) {
                 BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
@@ -580,7 +730,7 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite) {
-    auto res = clipBeliefToGrid(getBelief(beliefId), resolution, isInfinite);
+    auto res = clipBeliefToGrid(getBeliefCopy(beliefId), resolution, isInfinite);
     res.startingBelief = beliefId;
     return res;
 }
@@ -765,19 +915,36 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
     return getOrAddBeliefId(belief);
 }
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::findBeliefId(
+    HashedBelief const &belief) const {
+    uint32_t obs = getBeliefObservation(belief.belief);
+    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
+    auto idIt = beliefToIdMap[obs].find(belief);
+    return idIt == beliefToIdMap[obs].end() ? noId() : *idIt;
+}
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
     BeliefType const &belief) {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
+    return getOrAddBeliefId(HashedBelief{belief, BeliefHash()(belief)});
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
+    HashedBelief const &belief) {
+    STORM_LOG_ASSERT(belief.hash == BeliefHash()(belief.belief), "Invalid hash value for belief " << toString(belief.belief) << ".");
+    BeliefId id = findBeliefId(belief);
+    if (id == noId()) {
+        // Add the new belief to the pool. This has to happen before the id is inserted into the store, as the store looks at the pool.
+        id = getNumberOfBeliefIds();
+        STORM_LOG_TRACE("Add Belief " << id << " " << toString(belief.belief));
+        beliefEntries.insert(beliefEntries.end(), belief.belief.begin(), belief.belief.end());
+        beliefOffsets.push_back(beliefEntries.size());
+        beliefHashes.push_back(belief.hash);
+        beliefToIdMap[getBeliefObservation(belief.belief)].insert(id);
     }
-    // Return the id
-    return insertioRes.first->second;
+    return id;
 }
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
@@ -796,7 +963,11 @@ std::string BeliefManager<PomdpType, BeliefValueType, StateType>::getObservation
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(BeliefId const &beliefId) {
-    return getBeliefAsVector(getBelief(beliefId));
+    std::vector<BeliefValueType> res(pomdp.getNumberOfStates(), storm::utility::zero<BeliefValueType>());
+    for (auto const &stateprob : getBelief(beliefId)) {
+        res[stateprob.first] = stateprob.second;
+    }
+    return res;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -3,6 +3,7 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 #include <optional>
+#include <parallel_hashmap/phmap.h>
 #include <unordered_map>
 #include <vector>
 
@@ -30,6 +31,10 @@ class BeliefManager {
 
     BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode);
 
+    // The belief store refers to the belief manager, so the manager must not be copied.
+    BeliefManager(BeliefManager const &other) = delete;
+    BeliefManager &operator=(BeliefManager const &other) = delete;
+
     void setRewardModel(std::optional<std::string> rewardModelName = std::nullopt);
 
     void unsetRewardModel();
@@ -79,7 +84,7 @@ class BeliefManager {
     Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
     template<typename DistributionType>
-    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
     void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -93,6 +98,25 @@ class BeliefManager {
 
     std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+    /*!
+     * Computes the successors of the given beliefs under all actions and triangulates them w.r.t. the given resolutions. The computation is distributed
+     * over the given number of threads (0 means all available cores). The results are cached, such that calling expandAndTriangulate for one of the given
+     * beliefs (and the same resolutions) only needs to look up the ids of the grid points. As these ids are still assigned when expandAndTriangulate is
+     * called, they do not depend on the number of threads. Previously prepared expansions are discarded.
+     */
+    void prepareExpansionsAndTriangulations(std::vector<BeliefId> const &beliefIds, std::vector<BeliefValueType> const &observationResolutions,
+                                            uint64_t numberOfThreads);
+
+    /*!
+     * Returns true iff the expansions of the given belief have been prepared for the given resolutions.
+     */
+    bool hasPreparedExpansions(BeliefId const &beliefId, std::vector<BeliefValueType> const &observationResolutions) const;
+
+    /*!
+     * Discards all prepared expansions.
+     */
+    void clearPreparedExpansions();
+
     BeliefClipping clipBeliefToGrid(BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite = storm::storage::BitVector());
 
     std::string getObservationLabel(BeliefId const &beliefId);
@@ -100,6 +124,54 @@ class BeliefManager {
     std::vector<BeliefValueType> computeMatrixBeliefProduct(BeliefId const &beliefId, storm::storage::SparseMatrix<BeliefValueType> &matrix);
 
    private:
+    typedef std::pair<StateType, BeliefValueType> BeliefEntryType;
+
+    /*!
+     * Refers to the entries of a belief in the belief pool. The view is invalidated whenever a new belief is added.
+     */
+    struct BeliefView {
+        BeliefEntryType const *begin() const {
+            return first;
+        }
+        BeliefEntryType const *end() const {
+            return last;
+        }
+        uint64_t size() const {
+            return last - first;
+        }
+        BeliefEntryType const *first;
+        BeliefEntryType const *last;
+    };
+
+    /*!
+     * A belief together with its (precomputed) hash value. Used to look up beliefs in the belief store.
+     */
+    struct HashedBelief {
+        BeliefType const &belief;
+        std::size_t hash;
+    };
+
+    /*!
+     * A grid point of a triangulation whose id might not have been assigned, yet.
+     */
+    struct PreparedGridPoint {
+        BeliefType belief;  // Only set if the id is not known.
+        std::size_t hash;
+        BeliefId id;
+        BeliefValueType probability;
+    };
+
+    /*!
+     * A triangulation whose grid points are not (necessarily) stored, yet.
+     */
+    struct PendingTriangulation {
+        std::vector<BeliefType> gridPoints;
+        std::vector<BeliefValueType> weights;
+        uint64_t size() const {
+            return weights.size();
+        }
+    };
+
     std::vector<BeliefValueType> getBeliefAsVector(BeliefId const &beliefId);
 
     std::vector<BeliefValueType> getBeliefAsVector(const BeliefType &belief);
@@ -107,14 +179,30 @@ class BeliefManager {
     BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
-    void adjustDistribution(DistributionType &distr);
+    void adjustDistribution(DistributionType &distr) const;
 
     struct BeliefHash {
         std::size_t operator()(const BeliefType &belief) const;
     };
 
     struct Belief_equal_to {
-        bool operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const;
+        bool operator()(const BeliefType &lhBelief, const BeliefView &rhBelief) const;
+    };
+
+    // Hashes and compares stored beliefs (given by their ids) and beliefs that are looked up, such that the store does not need a copy of each belief.
+    struct BeliefIdHash {
+        using is_transparent = void;
+        std::size_t operator()(BeliefId const &id) const;
+        std::size_t operator()(HashedBelief const &belief) const;
+        BeliefManager const *manager = nullptr;
+    };
+
+    struct BeliefIdEqual {
+        using is_transparent = void;
+        bool operator()(BeliefId const &lhId, BeliefId const &rhId) const;
+        bool operator()(HashedBelief const &lhBelief, BeliefId const &rhId) const;
+        bool operator()(BeliefId const &lhId, HashedBelief const &rhBelief) const;
+        BeliefManager const *manager = nullptr;
     };
 
     struct FreudenthalDiff {
@@ -125,7 +213,9 @@ class BeliefManager {
         bool operator>(FreudenthalDiff const &other) const;
     };
 
-    BeliefType const &getBelief(BeliefId const &id) const;
+    BeliefView getBelief(BeliefId const &id) const;
+
+    BeliefType getBeliefCopy(BeliefId const &id) const;
 
     BeliefId getId(BeliefType const &belief) const;
 
@@ -135,31 +225,63 @@ class BeliefManager {
 
     bool assertBelief(BeliefType const &belief) const;
 
-    bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+    bool assertTriangulation(BeliefType const &belief, PendingTriangulation const &triangulation) const;
+
+    uint32_t getBeliefObservation(BeliefType const &belief) const;
 
-    uint32_t getBeliefObservation(BeliefType belief) const;
+    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, PendingTriangulation &result) const;
 
-    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, PendingTriangulation &result) const;
 
-    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    PendingTriangulation computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const;
 
     Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+    /*!
+     * Computes the successor beliefs of the given belief under the given action together with the probabilities to observe their observations.
+     * The successors are ordered by their observation.
+     */
+    std::vector<std::pair<BeliefType, BeliefValueType>> computeSuccessorBeliefs(BeliefView const &belief, uint64_t actionIndex) const;
+
+    /*!
+     * Computes the grid points (and their probabilities) of the triangulated successors of the given belief. Does not modify the belief store and can
+     * therefore be called concurrently.
+     */
+    std::vector<PreparedGridPoint> computeTriangulatedSuccessors(BeliefView const &belief, uint64_t actionIndex,
+                                                                 std::vector<BeliefValueType> const &observationResolutions) const;
+
+    /*!
+     * Retrieves the ids of the given grid points, adding the grid points to the belief store if necessary.
+     */
+    std::vector<std::pair<BeliefId, ValueType>> getOrAddGridPointIds(std::vector<PreparedGridPoint> const &gridPoints);
+
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
         std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions = std::nullopt);
 
     BeliefId computeInitialBelief();
 
+    BeliefId findBeliefId(HashedBelief const &belief) const;
+
     BeliefId getOrAddBeliefId(BeliefType const &belief);
 
+    BeliefId getOrAddBeliefId(HashedBelief const &belief);
+
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
-    std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    // All beliefs are stored consecutively in one pool. The entries of the belief with id i are at positions beliefOffsets[i] to beliefOffsets[i+1]-1.
+    std::vector<BeliefEntryType> beliefEntries;
+    std::vector<uint64_t> beliefOffsets;
+    std::vector<std::size_t> beliefHashes;
+    // The belief store is sharded by the observation of the beliefs. Each shard only holds the ids of its beliefs.
+    std::vector<phmap::flat_hash_set<BeliefId, BeliefIdHash, BeliefIdEqual>> beliefToIdMap;
     BeliefId initialBeliefId;
 
+    // The expansions that have been prepared (for each belief and action), together with the resolutions used for their triangulation.
+    std::unordered_map<BeliefId, std::vector<std::vector<PreparedGridPoint>>> preparedExpansions;
+    std::vector<BeliefValueType> preparedObservationResolutions;
+
     storm::utility::ConstantsComparator<BeliefValueType> cc;
 
     std::shared_ptr<storm::solver::LpSolver<BeliefValueType>> lpSolver;
@@ -4,6 +4,9 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
@@ -26,6 +29,11 @@ std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(st
     }
     options.setType(type);
 
+    auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+    options.signatureRefinement =
+        bisimulationSettings.getSparseRefinementMode() == storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+    options.numberOfThreads = bisimulationSettings.getNumberOfThreads();
+
     storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
     return bisimulationDecomposition.getQuotient();
@@ -41,6 +49,11 @@ std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization
     }
     options.setType(type);
 
+    auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+    options.signatureRefinement =
+        bisimulationSettings.getSparseRefinementMode() == storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+    options.numberOfThreads = bisimulationSettings.getNumberOfThreads();
+
     storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
     return bisimulationDecomposition.getQuotient();
@@ -48,6 +48,7 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       buildChoiceOrigins(false),
       scaleAndLiftTransitionRewards(true),
       explorationChecks(false),
+      compileExpressions(false),
       inferObservationsFromActions(false),
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
@@ -199,6 +200,10 @@ bool BuilderOptions::isExplorationChecksSet() const {
     return explorationChecks;
 }
 
+bool BuilderOptions::isCompileExpressionsSet() const {
+    return compileExpressions;
+}
+
 bool BuilderOptions::isShowProgressSet() const {
     return showProgress;
 }
@@ -212,6 +217,11 @@ BuilderOptions& BuilderOptions::setExplorationChecks(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setCompileExpressions(bool newValue) {
+    compileExpressions = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::addRewardModel(std::string const& rewardModelName) {
     STORM_LOG_THROW(!buildAllRewardModels, storm::exceptions::InvalidSettingsException, "Cannot add reward model, because all reward models are built anyway.");
     rewardModelNames.emplace(rewardModelName);
@@ -114,6 +114,7 @@ class BuilderOptions {
     bool isBuildAllRewardModelsSet() const;
     bool isBuildAllLabelsSet() const;
     bool isExplorationChecksSet() const;
+    bool isCompileExpressionsSet() const;
     bool isInferObservationsFromActionsSet() const;
     bool isShowProgressSet() const;
     bool isScaleAndLiftTransitionRewardsSet() const;
@@ -184,6 +185,14 @@ class BuilderOptions {
      */
     BuilderOptions& setExplorationChecks(bool newValue = true);
 
+    /**
+     * Should the expressions of the model be compiled to code that is evaluated directly on the compressed states?
+     * This is currently only supported for PRISM programs with floating point values.
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setCompileExpressions(bool newValue = true);
+
     BuilderOptions& setInferObservationsFromActions(bool newValue = true);
 
     /**
@@ -259,6 +268,9 @@ class BuilderOptions {
     /// A flag that stores whether exploration checks are to be performed.
     bool explorationChecks;
 
+    /// A flag that stores whether the expressions are to be compiled for the exploration.
+    bool compileExpressions;
+
     /// For POMDPs, should we allow inference of observation classes from different enabled actions.
     bool inferObservationsFromActions;
 
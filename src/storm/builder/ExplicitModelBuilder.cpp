@@ -1,7 +1,11 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <limits>
 #include <map>
 
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/builder/RewardModelBuilder.h"
@@ -9,6 +13,7 @@
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -27,12 +32,14 @@
 #include "storm/storage/jani/AutomatonComposition.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/ParallelComposition.h"
+#include "storm/storage/sparse/ConcurrentStateStorage.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
 
 namespace storm {
@@ -55,7 +62,9 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationThreads()),
+      reproducibleStateOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().isExplorationReproducibleSet()) {
     // Intentionally left empty.
 }
 
@@ -71,7 +80,13 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if constexpr (storm::utility::parallel::isThreadSafe<ValueType>()) {
+        if (builderOptions.numberOfThreads != 1) {
+            generatorFactory = [program, generatorOptions]() {
+                return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions);
+            };
+        }
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -79,7 +94,14 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    // Eliminating arrays declares new variables, which can only be done once.
+    if constexpr (storm::utility::parallel::isThreadSafe<ValueType>()) {
+        if (builderOptions.numberOfThreads != 1 && !model.getModelFeatures().hasArrays()) {
+            generatorFactory = [model, generatorOptions]() {
+                return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions);
+            };
+        }
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -193,104 +215,14 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
         storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-
-        // If there is no behavior, we might have to introduce a self-loop.
-        if (behavior.empty()) {
-            if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                if (behavior.wasExpanded()) {
-                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                }
-
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
-                }
-
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                    }
-
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                    }
-                }
-
-                // This state shall be Markovian (to not introduce Zeno behavior)
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-                // Other state-based information does not need to be treated, in particular:
-                // * StateValuations have already been set above
-                // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                ++currentRow;
-                ++currentRowGroup;
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-            }
-        } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
-            }
-
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
-            }
-
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
-
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
-                }
-                ++currentRow;
-                firstChoiceOfState = false;
-            }
-
-            ++currentRowGroup;
-        }
+        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+        bool const isUnfixedDeadlock =
+            behavior.empty() && behavior.wasExpanded() && storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+        STORM_LOG_THROW(!isUnfixedDeadlock, storm::exceptions::WrongFormatException,
+                        "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                            << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+        addStateBehavior(currentIndex, behavior, nullptr, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder, currentRow,
+                         currentRowGroup);
 
         ++numberOfExploredStates;
         if (generator->getOptions().isShowProgressSet()) {
@@ -345,6 +277,331 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     }
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(
+    StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* stateRemapping,
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup) {
+    // If there is no behavior, we have to introduce a self-loop.
+    if (behavior.empty()) {
+        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+        if (behavior.wasExpanded()) {
+            this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+        }
+
+        if (!generator->isDeterministicModel()) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+
+        transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
+
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+            }
+
+            if (rewardModelBuilder.hasStateActionRewards()) {
+                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+            }
+        }
+
+        // This state shall be Markovian (to not introduce Zeno behavior)
+        if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+            stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+        }
+        // Other state-based information does not need to be treated, in particular:
+        // * StateValuations have already been set above
+        // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+        ++currentRow;
+        ++currentRowGroup;
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*stateRewardIt);
+            }
+            ++stateRewardIt;
+        }
+
+        // If the model is nondeterministic, we need to open a row group.
+        if (!generator->isDeterministicModel()) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+
+        // Now add all choices.
+        bool firstChoiceOfState = true;
+        std::vector<std::pair<StateType, ValueType>> remappedEntries;
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                for (auto const& label : choice.getLabels()) {
+                    stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                STORM_LOG_ASSERT(
+                    firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                    "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+                if (firstChoiceOfState) {
+                    stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+
+            // Add the probabilistic behavior to the matrix. The entries of a row have to be added in the order of their columns.
+            if (stateRemapping) {
+                remappedEntries.clear();
+                for (auto const& stateProbabilityPair : choice) {
+                    remappedEntries.emplace_back((*stateRemapping)[stateProbabilityPair.first], stateProbabilityPair.second);
+                }
+                std::sort(remappedEntries.begin(), remappedEntries.end(), [](auto const& first, auto const& second) { return first.first < second.first; });
+                for (auto const& stateProbabilityPair : remappedEntries) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            } else {
+                for (auto const& stateProbabilityPair : choice) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            }
+
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                }
+                ++choiceRewardIt;
+            }
+            ++currentRow;
+            firstChoiceOfState = false;
+        }
+
+        ++currentRowGroup;
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isParallelExplorationSupported() const {
+    if (options.numberOfThreads == 1) {
+        return false;
+    }
+#ifdef STORM_HAVE_INTELTBB
+    if (!generatorFactory) {
+        STORM_LOG_WARN("Parallel exploration is not supported for this model (it requires a non-parametric PRISM program or JANI model without arrays). "
+                       "Falling back to sequential exploration.");
+        return false;
+    }
+    if (options.explorationOrder != ExplorationOrder::Bfs) {
+        STORM_LOG_WARN("Parallel exploration is only supported for breadth-first exploration order. Falling back to sequential exploration.");
+        return false;
+    }
+    if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("Parallel exploration does not support labeling states with overlapping guards. Falling back to sequential exploration.");
+        return false;
+    }
+    return true;
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    return false;
+#endif
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesParallel(
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+#ifdef STORM_HAVE_INTELTBB
+    // The information gathered by a single thread. Each thread has its own generator.
+    struct Worker {
+        std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
+        std::function<StateType(CompressedState const&)> stateToIdCallback;
+        // The states discovered by this thread that still need to be explored.
+        std::vector<std::pair<CompressedState, StateType>> discoveredStates;
+        // The behaviors of the states explored by this thread.
+        std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+        // If the state order needs to be reproducible, we store for each explored state the indices of the states requested during its
+        // expansion (in the order of the requests). The requests of the i-th explored state are requestedStates[requestIndices[i]], ...,
+        // requestedStates[requestIndices[i+1]-1].
+        std::vector<uint64_t> requestIndices;
+        std::vector<StateType> requestedStates;
+    };
+
+    storm::storage::sparse::ConcurrentStateStorage<StateType> concurrentStateStorage(stateStorage.bitsPerState);
+    bool const reproducible = options.reproducibleStateOrder;
+    bool const fixDeadlocks = !storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+    // For each explored state (in terms of the indices assigned during exploration), the worker and the position of its behavior.
+    std::vector<std::pair<uint64_t, uint64_t>> behaviorLocations;
+    std::vector<Worker> workers;
+    uint64_t numberOfInitialStates = 0;
+
+    auto explore = [&]() {
+        workers.resize(tbb::this_task_arena::max_concurrency());
+        for (uint64_t workerIndex = 0; workerIndex < workers.size(); ++workerIndex) {
+            Worker& worker = workers[workerIndex];
+            // Generators are created upfront, as their construction may modify the (shared) expression manager.
+            worker.generator = workerIndex == 0 ? generator : generatorFactory();
+            worker.stateToIdCallback = [&concurrentStateStorage, &worker, reproducible](CompressedState const& state) {
+                std::pair<StateType, bool> indexNewPair = concurrentStateStorage.findOrAdd(state);
+                if (indexNewPair.second) {
+                    worker.discoveredStates.emplace_back(state, indexNewPair.first);
+                }
+                if (reproducible) {
+                    worker.requestedStates.push_back(indexNewPair.first);
+                }
+                return indexNewPair.first;
+            };
+        }
+
+        // Let the generator create all initial states. As this is done sequentially, the initial states get the same indices as in the sequential
+        // exploration.
+        this->stateStorage.initialStateIndices = generator->getInitialStates(workers.front().stateToIdCallback);
+        STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
+                        "The model does not have a single initial state.");
+        std::vector<std::pair<CompressedState, StateType>> currentLayer = std::move(workers.front().discoveredStates);
+        workers.front().discoveredStates.clear();
+        numberOfInitialStates = currentLayer.size();
+        workers.front().requestedStates.clear();
+
+        auto timeOfStart = std::chrono::high_resolution_clock::now();
+        auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+        uint64_t numberOfExploredStates = 0;
+        uint64_t numberOfExploredStatesSinceLastMessage = 0;
+
+        // Explore the states layer by layer.
+        while (!currentLayer.empty()) {
+            behaviorLocations.resize(concurrentStateStorage.getNumberOfStates());
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, currentLayer.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                uint64_t const workerIndex = tbb::this_task_arena::current_thread_index();
+                Worker& worker = workers[workerIndex];
+                for (uint64_t stateIndex = range.begin(); stateIndex < range.end(); ++stateIndex) {
+                    CompressedState const& currentState = currentLayer[stateIndex].first;
+                    StateType const currentIndex = currentLayer[stateIndex].second;
+                    worker.generator->load(currentState);
+                    if (reproducible) {
+                        worker.requestIndices.push_back(worker.requestedStates.size());
+                    }
+                    storm::generator::StateBehavior<ValueType, StateType> behavior = worker.generator->expand(worker.stateToIdCallback);
+                    STORM_LOG_THROW(fixDeadlocks || !behavior.empty() || !behavior.wasExpanded(), storm::exceptions::WrongFormatException,
+                                    "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                        << worker.generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+                    behaviorLocations[currentIndex] = std::make_pair(workerIndex, worker.behaviors.size());
+                    worker.behaviors.push_back(std::move(behavior));
+                }
+            });
+
+            numberOfExploredStates += currentLayer.size();
+            numberOfExploredStatesSinceLastMessage += currentLayer.size();
+            currentLayer.clear();
+            for (auto& worker : workers) {
+                currentLayer.insert(currentLayer.end(), std::make_move_iterator(worker.discoveredStates.begin()),
+                                    std::make_move_iterator(worker.discoveredStates.end()));
+                worker.discoveredStates.clear();
+            }
+
+            if (generator->getOptions().isShowProgressSet()) {
+                auto now = std::chrono::high_resolution_clock::now();
+                auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                    auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
+                    auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                    std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond
+                              << " states per second).\n";
+                    timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                    numberOfExploredStatesSinceLastMessage = 0;
+                }
+            }
+
+            if (storm::utility::resources::isTerminate()) {
+                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+                std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
+                STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+            }
+        }
+    };
+    if (options.numberOfThreads == 0) {
+        explore();
+    } else {
+        tbb::task_arena arena(static_cast<int>(options.numberOfThreads));
+        arena.execute(explore);
+    }
+
+    uint64_t const numberOfStates = concurrentStateStorage.getNumberOfStates();
+    std::vector<StateType> explorationIndices;  // Maps the final indices to the indices assigned during the exploration.
+    std::vector<StateType> finalIndices;        // Maps the indices assigned during the exploration to the final indices.
+    if (reproducible) {
+        // Replay the sequential breadth-first search: The states are numbered in the order in which they are first requested while expanding the states
+        // in the order of their final indices. The initial states were numbered sequentially, so their indices do not change.
+        for (auto& worker : workers) {
+            worker.requestIndices.push_back(worker.requestedStates.size());
+        }
+        StateType const unassigned = std::numeric_limits<StateType>::max();
+        finalIndices.assign(numberOfStates, unassigned);
+        explorationIndices.reserve(numberOfStates);
+        for (StateType state = 0; state < numberOfInitialStates; ++state) {
+            finalIndices[state] = state;
+            explorationIndices.push_back(state);
+        }
+        for (uint64_t index = 0; index < explorationIndices.size(); ++index) {
+            auto const& location = behaviorLocations[explorationIndices[index]];
+            Worker const& worker = workers[location.first];
+            for (uint64_t request = worker.requestIndices[location.second]; request < worker.requestIndices[location.second + 1]; ++request) {
+                StateType const requestedState = worker.requestedStates[request];
+                if (finalIndices[requestedState] == unassigned) {
+                    finalIndices[requestedState] = static_cast<StateType>(explorationIndices.size());
+                    explorationIndices.push_back(requestedState);
+                }
+            }
+        }
+        STORM_LOG_ASSERT(explorationIndices.size() == numberOfStates, "Unexpected number of states after renumbering.");
+        for (auto& worker : workers) {
+            worker.requestIndices = std::vector<uint64_t>();
+            worker.requestedStates = std::vector<StateType>();
+        }
+    }
+
+    // Assemble the matrices in the order of the final state indices.
+    uint_fast64_t currentRow = 0;
+    uint_fast64_t currentRowGroup = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        auto const& location = behaviorLocations[reproducible ? explorationIndices[state] : state];
+        addStateBehavior(static_cast<StateType>(state), workers[location.first].behaviors[location.second], reproducible ? &finalIndices : nullptr,
+                         transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder, currentRow, currentRowGroup);
+    }
+    workers.clear();
+
+    // Move the states to the state storage. Note that the initial states keep their indices.
+    if (reproducible) {
+        concurrentStateStorage.moveTo(this->stateStorage.stateToId, [&finalIndices](StateType const& state) { return finalIndices[state]; });
+    } else {
+        concurrentStateStorage.moveTo(this->stateStorage.stateToId, [](StateType const& state) { return state; });
+    }
+
+    // The state valuations are built for the states in the order of their indices.
+    if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+        stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
+        std::vector<CompressedState> states(numberOfStates);
+        for (auto const& stateIndexPair : this->stateStorage.stateToId) {
+            states[stateIndexPair.second] = stateIndexPair.first;
+        }
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            generator->load(states[state]);
+            generator->addStateValuation(state, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+        }
+    }
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parallel exploration requires Intel TBB.");
+#endif
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
     // Determine whether we have to combine different choices to one or whether this model can have more than
@@ -364,7 +621,11 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     stateAndChoiceInformationBuilder.setBuildMarkovianStates(generator->getModelType() == storm::generator::ModelType::MA);
     stateAndChoiceInformationBuilder.setBuildStateValuations(generator->getOptions().isBuildStateValuationsSet());
 
-    buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    if (isParallelExplorationSupported()) {
+        buildMatricesParallel(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    } else {
+        buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    }
 
     // Initialize the model components with the obtained information.
     storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(
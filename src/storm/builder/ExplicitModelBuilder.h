@@ -6,6 +6,7 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -78,6 +79,12 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // The number of threads used to explore the model (0 uses all available cores).
+        uint64_t numberOfThreads;
+
+        // If set, the states explored by multiple threads are renumbered such that they have the same indices as in the sequential exploration.
+        bool reproducibleStateOrder;
     };
 
     /*!
@@ -144,6 +151,33 @@ class ExplicitModelBuilder {
                        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+    /*!
+     * Checks whether the state space can be explored with multiple threads using the current options and generator.
+     */
+    bool isParallelExplorationSupported() const;
+
+    /*!
+     * Builds the matrices like buildMatrices, but explores the state space with multiple threads. The states are explored in breadth-first layers.
+     * Each thread uses its own generator and buffers the behavior of the states it explores. The matrices are assembled once all states are explored.
+     */
+    void buildMatricesParallel(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                               std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                               StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+    /*!
+     * Adds the given behavior of a state as the next row group.
+     *
+     * @param stateIndex The index of the state.
+     * @param behavior The behavior of the state.
+     * @param stateRemapping If given, the state indices occurring in the behavior are replaced by the indices given by this mapping.
+     * @param currentRow The first row of the new row group. Afterwards, this is the first row of the next row group.
+     * @param currentRowGroup The index of the new row group. Afterwards, this is the index of the next row group.
+     */
+    void addStateBehavior(StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                          std::vector<StateType> const* stateRemapping, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                          std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                          StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup);
+
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
      *
@@ -161,6 +195,9 @@ class ExplicitModelBuilder {
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// Creates further generators that behave like the one above. This is only available if the builder was created from a model description.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
     /// The options to be used for the building process.
     Options options;
 
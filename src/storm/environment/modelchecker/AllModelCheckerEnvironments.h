@@ -1,4 +1,5 @@
 #pragma once
 
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
-#include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
\ No newline at end of file
+#include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
@@ -1,6 +1,7 @@
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/ModelCheckerSettings.h"
@@ -30,6 +31,14 @@ MultiObjectiveModelCheckerEnvironment const& ModelCheckerEnvironment::multi() co
     return multiObjectiveModelCheckerEnvironment.get();
 }
 
+StatisticalModelCheckerEnvironment& ModelCheckerEnvironment::statistical() {
+    return statisticalModelCheckerEnvironment.get();
+}
+
+StatisticalModelCheckerEnvironment const& ModelCheckerEnvironment::statistical() const {
+    return statisticalModelCheckerEnvironment.get();
+}
+
 bool ModelCheckerEnvironment::isLtl2daToolSet() const {
     return ltl2daTool.is_initialized();
 }
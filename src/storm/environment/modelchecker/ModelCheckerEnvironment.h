@@ -11,6 +11,7 @@ namespace storm {
 
 // Forward declare subenvironments
 class MultiObjectiveModelCheckerEnvironment;
+class StatisticalModelCheckerEnvironment;
 
 class ModelCheckerEnvironment {
    public:
@@ -20,6 +21,9 @@ class ModelCheckerEnvironment {
     MultiObjectiveModelCheckerEnvironment& multi();
     MultiObjectiveModelCheckerEnvironment const& multi() const;
 
+    StatisticalModelCheckerEnvironment& statistical();
+    StatisticalModelCheckerEnvironment const& statistical() const;
+
     bool isLtl2daToolSet() const;
     std::string const& getLtl2daTool() const;
     void setLtl2daTool(std::string const& value);
@@ -27,6 +31,7 @@ class ModelCheckerEnvironment {
 
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
+    SubEnvironment<StatisticalModelCheckerEnvironment> statisticalModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
 };
 }  // namespace storm
@@ -0,0 +1,92 @@
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+
+#include <random>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/StatisticalSettings.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/IllegalArgumentException.h"
+
+namespace storm {
+
+StatisticalModelCheckerEnvironment::StatisticalModelCheckerEnvironment() {
+    auto const& statisticalSettings = storm::settings::getModule<storm::settings::modules::StatisticalSettings>();
+    method = statisticalSettings.getMethod();
+    precision = statisticalSettings.getPrecision();
+    errorProbability = statisticalSettings.getErrorProbability();
+    numberOfThreads = statisticalSettings.getNumberOfThreads();
+    batchSize = statisticalSettings.getBatchSize();
+    if (statisticalSettings.isSeedSet()) {
+        seed = statisticalSettings.getSeed();
+    } else {
+        std::random_device randomDevice;
+        seed = (static_cast<uint64_t>(randomDevice()) << 32) | randomDevice();
+    }
+    maximalPathLength = statisticalSettings.getMaximalPathLength();
+}
+
+StatisticalModelCheckerEnvironment::~StatisticalModelCheckerEnvironment() {
+    // Intentionally left empty
+}
+
+storm::modelchecker::statistical::StatisticalMethod const& StatisticalModelCheckerEnvironment::getMethod() const {
+    return method;
+}
+
+void StatisticalModelCheckerEnvironment::setMethod(storm::modelchecker::statistical::StatisticalMethod value) {
+    method = value;
+}
+
+double StatisticalModelCheckerEnvironment::getPrecision() const {
+    return precision;
+}
+
+void StatisticalModelCheckerEnvironment::setPrecision(double value) {
+    STORM_LOG_THROW(value > 0.0 && value < 1.0, storm::exceptions::IllegalArgumentException, "The precision must be in (0,1).");
+    precision = value;
+}
+
+double StatisticalModelCheckerEnvironment::getErrorProbability() const {
+    return errorProbability;
+}
+
+void StatisticalModelCheckerEnvironment::setErrorProbability(double value) {
+    STORM_LOG_THROW(value > 0.0 && value < 1.0, storm::exceptions::IllegalArgumentException, "The error probability must be in (0,1).");
+    errorProbability = value;
+}
+
+uint64_t StatisticalModelCheckerEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void StatisticalModelCheckerEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
+uint64_t StatisticalModelCheckerEnvironment::getBatchSize() const {
+    return batchSize;
+}
+
+void StatisticalModelCheckerEnvironment::setBatchSize(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The batch size must be positive.");
+    batchSize = value;
+}
+
+uint64_t StatisticalModelCheckerEnvironment::getSeed() const {
+    return seed;
+}
+
+void StatisticalModelCheckerEnvironment::setSeed(uint64_t value) {
+    seed = value;
+}
+
+uint64_t StatisticalModelCheckerEnvironment::getMaximalPathLength() const {
+    return maximalPathLength;
+}
+
+void StatisticalModelCheckerEnvironment::setMaximalPathLength(uint64_t value) {
+    maximalPathLength = value;
+}
+
+}  // namespace storm
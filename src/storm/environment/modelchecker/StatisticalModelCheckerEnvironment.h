@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/modelchecker/statistical/StatisticalModelCheckingMethod.h"
+
+namespace storm {
+
+class StatisticalModelCheckerEnvironment {
+   public:
+    StatisticalModelCheckerEnvironment();
+    ~StatisticalModelCheckerEnvironment();
+
+    storm::modelchecker::statistical::StatisticalMethod const& getMethod() const;
+    void setMethod(storm::modelchecker::statistical::StatisticalMethod value);
+
+    double getPrecision() const;
+    void setPrecision(double value);
+
+    double getErrorProbability() const;
+    void setErrorProbability(double value);
+
+    uint64_t getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
+    uint64_t getBatchSize() const;
+    void setBatchSize(uint64_t value);
+
+    uint64_t getSeed() const;
+    void setSeed(uint64_t value);
+
+    uint64_t getMaximalPathLength() const;
+    void setMaximalPathLength(uint64_t value);
+
+   private:
+    storm::modelchecker::statistical::StatisticalMethod method;
+    double precision;
+    double errorProbability;
+    uint64_t numberOfThreads;
+    uint64_t batchSize;
+    uint64_t seed;
+    uint64_t maximalPathLength;
+};
+}  // namespace storm
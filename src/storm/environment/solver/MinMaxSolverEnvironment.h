@@ -26,6 +26,8 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isForceRequireUnique() const;
     void setForceRequireUnique(bool value);
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
@@ -35,5 +37,6 @@ class MinMaxSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool forceRequireUnique;
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
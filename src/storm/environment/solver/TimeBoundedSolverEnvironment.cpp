@@ -5,15 +5,20 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
 
 TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
     auto const& tbSettings = storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>();
     maMethod = tbSettings.getMaMethod();
     maMethodSetFromDefault = tbSettings.isMaMethodSetFromDefaultValue();
+    ctmcMethod = tbSettings.getCtmcMethod();
+    krylovDimension = tbSettings.getKrylovDimension();
     precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
     relative = tbSettings.isRelativePrecision();
     unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+    steadyStateDetection = tbSettings.isSteadyStateDetectionSet();
 }
 
 TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -33,6 +38,23 @@ void TimeBoundedSolverEnvironment::setMaMethod(storm::solver::MaBoundedReachabil
     maMethodSetFromDefault = isSetFromDefault;
 }
 
+storm::solver::CtmcTransientMethod const& TimeBoundedSolverEnvironment::getCtmcMethod() const {
+    return ctmcMethod;
+}
+
+void TimeBoundedSolverEnvironment::setCtmcMethod(storm::solver::CtmcTransientMethod value) {
+    ctmcMethod = value;
+}
+
+uint64_t const& TimeBoundedSolverEnvironment::getKrylovDimension() const {
+    return krylovDimension;
+}
+
+void TimeBoundedSolverEnvironment::setKrylovDimension(uint64_t value) {
+    STORM_LOG_THROW(value > 1, storm::exceptions::InvalidArgumentException, "The dimension of Krylov subspaces must be at least two.");
+    krylovDimension = value;
+}
+
 storm::RationalNumber const& TimeBoundedSolverEnvironment::getPrecision() const {
     return precision;
 }
@@ -57,4 +79,12 @@ void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value)
     unifPlusKappa = value;
 }
 
+bool const& TimeBoundedSolverEnvironment::isSteadyStateDetectionSet() const {
+    return steadyStateDetection;
+}
+
+void TimeBoundedSolverEnvironment::setSteadyStateDetection(bool value) {
+    steadyStateDetection = value;
+}
+
 }  // namespace storm
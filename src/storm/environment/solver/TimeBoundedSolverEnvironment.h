@@ -16,6 +16,11 @@ class TimeBoundedSolverEnvironment {
     bool const& isMaMethodSetFromDefault() const;
     void setMaMethod(storm::solver::MaBoundedReachabilityMethod value, bool isSetFromDefault = false);
 
+    storm::solver::CtmcTransientMethod const& getCtmcMethod() const;
+    void setCtmcMethod(storm::solver::CtmcTransientMethod value);
+    uint64_t const& getKrylovDimension() const;
+    void setKrylovDimension(uint64_t value);
+
     storm::RationalNumber const& getPrecision() const;
     void setPrecision(storm::RationalNumber value);
     bool const& getRelativeTerminationCriterion() const;
@@ -24,13 +29,21 @@ class TimeBoundedSolverEnvironment {
     storm::RationalNumber const& getUnifPlusKappa() const;
     void setUnifPlusKappa(storm::RationalNumber value);
 
+    bool const& isSteadyStateDetectionSet() const;
+    void setSteadyStateDetection(bool value);
+
    private:
     storm::solver::MaBoundedReachabilityMethod maMethod;
     bool maMethodSetFromDefault;
 
+    storm::solver::CtmcTransientMethod ctmcMethod;
+    uint64_t krylovDimension;
+
     storm::RationalNumber precision;
     bool relative;
 
     storm::RationalNumber unifPlusKappa;
+
+    bool steadyStateDetection;
 };
 }  // namespace storm
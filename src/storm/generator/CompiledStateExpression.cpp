@@ -0,0 +1,453 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+
+typedef CompiledStateExpression::OpCode OpCode;
+typedef CompiledStateExpression::OperandType OperandType;
+typedef CompiledStateExpression::Operand Operand;
+typedef CompiledStateExpression::Instruction Instruction;
+
+// The tolerance ExprTk uses to compare doubles.
+double const equalityEpsilon = 1e-10;
+
+inline bool isEqual(double first, double second) {
+    return std::abs(first - second) <= std::max(1.0, std::max(std::abs(first), std::abs(second))) * equalityEpsilon;
+}
+
+inline double asValue(bool value) {
+    return value ? 1.0 : 0.0;
+}
+
+inline bool isBinary(OpCode opCode) {
+    return opCode >= OpCode::Plus && opCode <= OpCode::GreaterOrEqual;
+}
+
+inline bool isJump(OpCode opCode) {
+    return opCode >= OpCode::Jump;
+}
+
+inline double loadOperand(Operand const& operand, CompressedState const& state) {
+    switch (operand.type) {
+        case OperandType::Constant:
+            return operand.value;
+        case OperandType::BooleanVariable:
+            return asValue(state.get(operand.bitOffset));
+        case OperandType::IntegerVariable:
+            return static_cast<double>(state.getAsInt(operand.bitOffset, operand.bitWidth)) + operand.value;
+        case OperandType::Stack:
+            break;
+    }
+    STORM_LOG_ASSERT(false, "Unexpected operand type.");
+    return 0.0;
+}
+
+class CompiledStateExpressionBuilder : public storm::expressions::ExpressionVisitor {
+   public:
+    CompiledStateExpressionBuilder(VariableInformation const& variableInformation) : currentStackSize(0), requiredStackSize(0), lastJumpTarget(0) {
+        for (auto const& booleanVariable : variableInformation.booleanVariables) {
+            booleanVariables.emplace(booleanVariable.variable.getIndex(), &booleanVariable);
+        }
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            integerVariables.emplace(integerVariable.variable.getIndex(), &integerVariable);
+        }
+    }
+
+    void compile(storm::expressions::Expression const& expression) {
+        expression.getBaseExpression().accept(*this, boost::none);
+        STORM_LOG_ASSERT(currentStackSize == 1, "Unexpected stack size after compiling expression " << expression << ".");
+    }
+
+    std::vector<Instruction>& getInstructions() {
+        return instructions;
+    }
+
+    uint64_t getRequiredStackSize() const {
+        return requiredStackSize;
+    }
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+        expression.getCondition()->accept(*this, data);
+        uint64_t jumpToElse = emitJump(OpCode::JumpIfFalse);
+        expression.getThenExpression()->accept(*this, data);
+        uint64_t jumpToEnd = emitJump(OpCode::Jump);
+        // Only one of the branches pushes its value.
+        --currentStackSize;
+        setJumpTarget(jumpToElse);
+        expression.getElseExpression()->accept(*this, data);
+        setJumpTarget(jumpToEnd);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::BinaryBooleanFunctionExpression::OperatorType OperatorType;
+        expression.getFirstOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case OperatorType::And:
+            case OperatorType::Or:
+            case OperatorType::Implies: {
+                // These are evaluated lazily. The value of the first operand decides whether the second one needs to be evaluated.
+                // Since the operands are boolean, their values are either zero or one and can be used as the result without further conversion.
+                if (expression.getOperatorType() == OperatorType::Implies) {
+                    emitUnary(OpCode::Not);
+                }
+                uint64_t jumpToEnd = emitJump(expression.getOperatorType() == OperatorType::And ? OpCode::JumpIfFalseElsePop : OpCode::JumpIfTrueElsePop);
+                expression.getSecondOperand()->accept(*this, data);
+                setJumpTarget(jumpToEnd);
+                break;
+            }
+            case OperatorType::Xor:
+                expression.getSecondOperand()->accept(*this, data);
+                emitBinary(OpCode::Xor);
+                break;
+            case OperatorType::Iff:
+                expression.getSecondOperand()->accept(*this, data);
+                emitBinary(OpCode::Iff);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::BinaryNumericalFunctionExpression::OperatorType OperatorType;
+        expression.getFirstOperand()->accept(*this, data);
+        expression.getSecondOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case OperatorType::Plus:
+                emitBinary(OpCode::Plus);
+                break;
+            case OperatorType::Minus:
+                emitBinary(OpCode::Minus);
+                break;
+            case OperatorType::Times:
+                emitBinary(OpCode::Times);
+                break;
+            case OperatorType::Divide:
+                emitBinary(OpCode::Divide);
+                break;
+            case OperatorType::Min:
+                emitBinary(OpCode::Min);
+                break;
+            case OperatorType::Max:
+                emitBinary(OpCode::Max);
+                break;
+            case OperatorType::Power:
+                emitBinary(OpCode::Power);
+                break;
+            case OperatorType::Modulo:
+                emitBinary(OpCode::Modulo);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::RelationType RelationType;
+        expression.getFirstOperand()->accept(*this, data);
+        expression.getSecondOperand()->accept(*this, data);
+        switch (expression.getRelationType()) {
+            case RelationType::Equal:
+                emitBinary(OpCode::Equal);
+                break;
+            case RelationType::NotEqual:
+                emitBinary(OpCode::NotEqual);
+                break;
+            case RelationType::Less:
+                emitBinary(OpCode::Less);
+                break;
+            case RelationType::LessOrEqual:
+                emitBinary(OpCode::LessOrEqual);
+                break;
+            case RelationType::Greater:
+                emitBinary(OpCode::Greater);
+                break;
+            case RelationType::GreaterOrEqual:
+                emitBinary(OpCode::GreaterOrEqual);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+        uint64_t index = expression.getVariable().getIndex();
+        auto booleanIt = booleanVariables.find(index);
+        if (booleanIt != booleanVariables.end()) {
+            emitPush(OperandType::BooleanVariable).bitOffset = booleanIt->second->bitOffset;
+            return boost::any();
+        }
+        auto integerIt = integerVariables.find(index);
+        STORM_LOG_THROW(integerIt != integerVariables.end(), storm::exceptions::NotSupportedException,
+                        "Cannot compile expression referring to variable '" << expression.getVariableName() << "' that is not part of the state.");
+        Operand& operand = emitPush(OperandType::IntegerVariable);
+        operand.bitOffset = integerIt->second->bitOffset;
+        operand.bitWidth = static_cast<uint32_t>(integerIt->second->bitWidth);
+        operand.value = static_cast<double>(integerIt->second->lowerBound);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        expression.getOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not:
+                emitUnary(OpCode::Not);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::UnaryNumericalFunctionExpression::OperatorType OperatorType;
+        expression.getOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case OperatorType::Minus:
+                emitUnary(OpCode::Negate);
+                break;
+            case OperatorType::Floor:
+                emitUnary(OpCode::Floor);
+                break;
+            case OperatorType::Ceil:
+                emitUnary(OpCode::Ceil);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+        emitPush(OperandType::Constant).value = asValue(expression.getValue());
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+        emitPush(OperandType::Constant).value = static_cast<double>(expression.getValue());
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+        emitPush(OperandType::Constant).value = expression.getValueAsDouble();
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::PredicateExpression const& expression, boost::any const&) override {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot compile predicate expression " << expression << ".");
+    }
+
+   private:
+    Instruction& emit(OpCode opCode) {
+        Operand stackOperand{OperandType::Stack, 0, 0, 0.0};
+        instructions.push_back(Instruction{opCode, 0, stackOperand, stackOperand});
+        return instructions.back();
+    }
+
+    Operand& emitPush(OperandType operandType) {
+        ++currentStackSize;
+        requiredStackSize = std::max(requiredStackSize, currentStackSize);
+        Instruction& instruction = emit(OpCode::Push);
+        instruction.first.type = operandType;
+        return instruction.first;
+    }
+
+    /*!
+     * Checks whether the instruction with the given index is a push that can be merged into the subsequent operation. This is not possible if some
+     * jump targets the subsequent operation, because then the pushed value is only one of several values that can be on top of the stack.
+     */
+    bool isMergeablePush(uint64_t index) const {
+        return instructions[index].opCode == OpCode::Push && lastJumpTarget != index + 1;
+    }
+
+    void emitUnary(OpCode opCode) {
+        if (isMergeablePush(instructions.size() - 1)) {
+            instructions.back().opCode = opCode;
+        } else {
+            emit(opCode);
+        }
+    }
+
+    void emitBinary(OpCode opCode) {
+        --currentStackSize;
+        uint64_t last = instructions.size() - 1;
+        if (!isMergeablePush(last)) {
+            emit(opCode);
+            return;
+        }
+        // Embed the second operand into the operation.
+        Instruction& instruction = instructions[last];
+        instruction.opCode = opCode;
+        instruction.second = instruction.first;
+        instruction.first.type = OperandType::Stack;
+        if (last > 0 && isMergeablePush(last - 1)) {
+            // Also embed the first operand.
+            instruction.first = instructions[last - 1].first;
+            instructions.erase(instructions.begin() + (last - 1));
+        }
+    }
+
+    uint64_t emitJump(OpCode opCode) {
+        // All conditional jumps pop the condition if they do not jump.
+        if (opCode != OpCode::Jump) {
+            --currentStackSize;
+        }
+        emit(opCode);
+        return instructions.size() - 1;
+    }
+
+    void setJumpTarget(uint64_t jumpIndex) {
+        lastJumpTarget = instructions.size();
+        instructions[jumpIndex].jumpTarget = lastJumpTarget;
+    }
+
+    std::unordered_map<uint64_t, BooleanVariableInformation const*> booleanVariables;
+    std::unordered_map<uint64_t, IntegerVariableInformation const*> integerVariables;
+    std::vector<Instruction> instructions;
+    uint64_t currentStackSize;
+    uint64_t requiredStackSize;
+    uint64_t lastJumpTarget;
+};
+
+}  // namespace
+
+CompiledStateExpression::CompiledStateExpression(storm::expressions::Expression const& expression, VariableInformation const& variableInformation) {
+    CompiledStateExpressionBuilder builder(variableInformation);
+    builder.compile(expression);
+    instructions = std::move(builder.getInstructions());
+    instructions.shrink_to_fit();
+    requiredStackSize = builder.getRequiredStackSize();
+}
+
+double CompiledStateExpression::evaluate(CompressedState const& state, double* stack) const {
+    // The stack pointer points to the topmost value.
+    double* top = stack - 1;
+    Instruction const* const begin = instructions.data();
+    Instruction const* const end = begin + instructions.size();
+    for (Instruction const* instruction = begin; instruction != end; ++instruction) {
+        if (isJump(instruction->opCode)) {
+            // The target of a jump is reduced by one to compensate for the increment of the loop.
+            switch (instruction->opCode) {
+                case OpCode::Jump:
+                    instruction = begin + instruction->jumpTarget - 1;
+                    break;
+                case OpCode::JumpIfFalse:
+                    if (*(top--) == 0.0) {
+                        instruction = begin + instruction->jumpTarget - 1;
+                    }
+                    break;
+                case OpCode::JumpIfFalseElsePop:
+                    if (top[0] == 0.0) {
+                        instruction = begin + instruction->jumpTarget - 1;
+                    } else {
+                        --top;
+                    }
+                    break;
+                case OpCode::JumpIfTrueElsePop:
+                    if (top[0] != 0.0) {
+                        instruction = begin + instruction->jumpTarget - 1;
+                    } else {
+                        --top;
+                    }
+                    break;
+                default:
+                    STORM_LOG_ASSERT(false, "Unexpected jump instruction.");
+            }
+            continue;
+        }
+
+        // Load the operands. Afterwards, the (first) operand is on top of the stack.
+        double second = 0.0;
+        if (isBinary(instruction->opCode)) {
+            second = instruction->second.type == OperandType::Stack ? *(top--) : loadOperand(instruction->second, state);
+        }
+        if (instruction->first.type != OperandType::Stack) {
+            *(++top) = loadOperand(instruction->first, state);
+        }
+
+        switch (instruction->opCode) {
+            case OpCode::Push:
+                break;
+            case OpCode::Plus:
+                top[0] += second;
+                break;
+            case OpCode::Minus:
+                top[0] -= second;
+                break;
+            case OpCode::Times:
+                top[0] *= second;
+                break;
+            case OpCode::Divide:
+                top[0] /= second;
+                break;
+            case OpCode::Min:
+                top[0] = std::min(top[0], second);
+                break;
+            case OpCode::Max:
+                top[0] = std::max(top[0], second);
+                break;
+            case OpCode::Power:
+                top[0] = std::pow(top[0], second);
+                break;
+            case OpCode::Modulo:
+                top[0] = std::fmod(top[0], second);
+                break;
+            case OpCode::Xor:
+                top[0] = asValue((top[0] != 0.0) != (second != 0.0));
+                break;
+            case OpCode::Iff:
+            case OpCode::Equal:
+                top[0] = asValue(isEqual(top[0], second));
+                break;
+            case OpCode::NotEqual:
+                top[0] = asValue(!isEqual(top[0], second));
+                break;
+            case OpCode::Less:
+                top[0] = asValue(top[0] < second);
+                break;
+            case OpCode::LessOrEqual:
+                top[0] = asValue(top[0] <= second);
+                break;
+            case OpCode::Greater:
+                top[0] = asValue(top[0] > second);
+                break;
+            case OpCode::GreaterOrEqual:
+                top[0] = asValue(top[0] >= second);
+                break;
+            case OpCode::Not:
+                top[0] = asValue(top[0] == 0.0);
+                break;
+            case OpCode::Negate:
+                top[0] = -top[0];
+                break;
+            case OpCode::Floor:
+                top[0] = std::floor(top[0]);
+                break;
+            case OpCode::Ceil:
+                top[0] = std::ceil(top[0]);
+                break;
+            default:
+                STORM_LOG_ASSERT(false, "Unexpected instruction.");
+        }
+    }
+    STORM_LOG_ASSERT(top == stack, "Unexpected stack size after evaluating compiled expression.");
+    return top[0];
+}
+
+uint64_t CompiledStateExpression::getRequiredStackSize() const {
+    return requiredStackSize;
+}
+
+uint64_t CompiledStateExpression::getNumberOfInstructions() const {
+    return instructions.size();
+}
+
+}  // namespace generator
+}  // namespace storm
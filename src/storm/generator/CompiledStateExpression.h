@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * An expression over the variables of a model that is compiled into a flat sequence of instructions for a small stack machine. The instructions read
+ * the values of the variables directly from a compressed state, so evaluating the expression neither requires the state to be unpacked into an
+ * expression evaluator nor any (virtual) dispatch over the expression tree.
+ *
+ * All values are represented as doubles and the semantics of the operators coincide with the ones of the ExprTk-based expression evaluator, i.e.,
+ * evaluating a compiled expression yields the same result as evaluating the original expression with ExpressionEvaluator<double>.
+ */
+class CompiledStateExpression {
+   public:
+    CompiledStateExpression() = default;
+
+    /*!
+     * Compiles the given expression. Throws a NotSupportedException if the expression refers to a variable that is not stored in the compressed
+     * states or if it contains an operator that can not be compiled.
+     *
+     * @param expression The expression to compile.
+     * @param variableInformation The information about how the variables are packed within the states.
+     */
+    CompiledStateExpression(storm::expressions::Expression const& expression, VariableInformation const& variableInformation);
+
+    /*!
+     * Evaluates the expression in the given state.
+     *
+     * @param state The state in which to evaluate the expression.
+     * @param stack A buffer that is used as the stack of the machine. It has to provide space for at least getRequiredStackSize() values.
+     * @return The value of the expression.
+     */
+    double evaluate(CompressedState const& state, double* stack) const;
+
+    /*!
+     * Evaluates the expression in the given state and interprets the result as a boolean (like ExpressionEvaluator<double>::asBool).
+     */
+    bool evaluateAsBool(CompressedState const& state, double* stack) const {
+        return evaluate(state, stack) == 1.0;
+    }
+
+    /*!
+     * Evaluates the expression in the given state and interprets the result as an integer (like ExpressionEvaluator<double>::asInt).
+     */
+    int64_t evaluateAsInt(CompressedState const& state, double* stack) const {
+        return static_cast<int64_t>(evaluate(state, stack));
+    }
+
+    /*!
+     * Retrieves the number of values that need to fit on the stack while evaluating the expression.
+     */
+    uint64_t getRequiredStackSize() const;
+
+    /*!
+     * Retrieves the number of instructions of the compiled expression.
+     */
+    uint64_t getNumberOfInstructions() const;
+
+    enum class OpCode : uint8_t {
+        Push,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Min,
+        Max,
+        Power,
+        Modulo,
+        Xor,
+        Iff,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        Not,
+        Negate,
+        Floor,
+        Ceil,
+        Jump,
+        JumpIfFalse,
+        JumpIfFalseElsePop,
+        JumpIfTrueElsePop
+    };
+
+    // The location of an operand of an instruction. Operands that are not on the stack are embedded into the instruction. This saves separate
+    // push instructions for the common case of operations over variables and constants, e.g., comparing a variable with a constant.
+    enum class OperandType : uint8_t { Stack, Constant, BooleanVariable, IntegerVariable };
+
+    struct Operand {
+        OperandType type;
+        // The bit width of an integer variable.
+        uint32_t bitWidth;
+        // The bit offset of a variable.
+        uint64_t bitOffset;
+        // The value of a constant or the lower bound of an integer variable.
+        double value;
+    };
+
+    struct Instruction {
+        OpCode opCode;
+        // The target of a jump.
+        uint64_t jumpTarget;
+        // The (first) operand of the instruction. If it is embedded, it is pushed before the operation is applied. Push instructions only have this
+        // operand.
+        Operand first;
+        // The second operand of a binary operation. If it is on the stack, it is the topmost value.
+        Operand second;
+    };
+
+   private:
+    std::vector<Instruction> instructions;
+    uint64_t requiredStackSize = 0;
+};
+
+}  // namespace generator
+}  // namespace storm
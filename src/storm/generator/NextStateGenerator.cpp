@@ -109,11 +109,24 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
 
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-    // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-    unpackStateIntoEvaluator(state, variableInformation, *evaluator);
-
-    // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+    // We need to store a pointer to the state itself, because we need to be able to access it when expanding it.
     this->state = &state;
+
+    // Since almost all subsequent operations are based on the evaluator, we load the state into it now (unless the generator evaluates its
+    // expressions directly on the state).
+    evaluatorLoaded = false;
+    if (!deferEvaluatorLoading) {
+        loadStateIntoEvaluator();
+    }
+}
+
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::loadStateIntoEvaluator() const {
+    if (!evaluatorLoaded) {
+        STORM_LOG_ASSERT(state != nullptr, "No state was loaded.");
+        unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+        evaluatorLoaded = true;
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -121,6 +134,7 @@ bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Exp
     if (expression.isTrue()) {
         return true;
     }
+    loadStateIntoEvaluator();
     return evaluator->asBool(expression);
 }
 
@@ -207,6 +221,8 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
             }
         }
     }
+    // The evaluator no longer holds the values of the currently loaded state.
+    evaluatorLoaded = false;
 
     if (!result.containsLabel("init")) {
         // Also label the initial state with the special label "init".
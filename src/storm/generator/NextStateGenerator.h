@@ -161,6 +161,11 @@ class NextStateGenerator {
 
     void postprocess(StateBehavior<ValueType, StateType>& result);
 
+    /*!
+     * Unpacks the currently loaded state into the evaluator, unless this has already been done since the state was loaded.
+     */
+    void loadStateIntoEvaluator() const;
+
     /// The options to be used for next-state generation.
     NextStateGeneratorOptions options;
 
@@ -179,6 +184,12 @@ class NextStateGenerator {
     /// The currently loaded state.
     CompressedState const* state;
 
+    /// Whether load() defers unpacking the state into the evaluator until the evaluator is actually needed.
+    bool deferEvaluatorLoading = false;
+
+    /// Whether the evaluator holds the values of the currently loaded state.
+    mutable bool evaluatorLoaded = false;
+
     /// A comparator used to compare constants.
     storm::utility::ConstantsComparator<ValueType> comparator;
 
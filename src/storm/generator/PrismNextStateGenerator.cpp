@@ -15,6 +15,7 @@
 #include "storm/solver/SmtSolver.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
@@ -37,7 +38,11 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
 template<typename ValueType, typename StateType>
 PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                                                                        std::shared_ptr<ActionMask<ValueType, StateType>> const& mask, bool)
-    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask), program(program), rewardModels(), hasStateActionRewards(false) {
+    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask),
+      program(program),
+      rewardModels(),
+      hasStateActionRewards(false),
+      useCompiledExpressions(false) {
     STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
     STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException,
                     "The explicit next-state generator currently does not support custom system compositions.");
@@ -101,6 +106,159 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    if (this->options.isCompileExpressionsSet()) {
+        if (std::is_same<ValueType, double>::value) {
+            compileExpressions();
+        } else {
+            STORM_LOG_WARN("Compiled expressions are only supported for floating point models, falling back to the expression evaluator.");
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+    auto const& variableInformation = this->variableInformation;
+    auto compile = [&variableInformation](storm::expressions::Expression const& expression) {
+        return CompiledStateExpression(expression, variableInformation);
+    };
+
+    try {
+        for (auto const& module : program.getModules()) {
+            for (auto const& command : module.getCommands()) {
+                if (command.getGlobalIndex() >= compiledCommands.size()) {
+                    compiledCommands.resize(command.getGlobalIndex() + 1);
+                }
+                CompiledCommand& compiledCommand = compiledCommands[command.getGlobalIndex()];
+                compiledCommand.guard = compile(command.getGuardExpression());
+                for (auto const& update : command.getUpdates()) {
+                    CompiledUpdate compiledUpdate;
+                    compiledUpdate.likelihood = compile(update.getLikelihoodExpression());
+                    for (auto const& assignment : update.getAssignments()) {
+                        auto const& booleanVariables = variableInformation.booleanVariables;
+                        auto const& integerVariables = variableInformation.integerVariables;
+                        auto booleanIt = std::find_if(booleanVariables.begin(), booleanVariables.end(), [&assignment](BooleanVariableInformation const& info) {
+                            return info.variable == assignment.getVariable();
+                        });
+                        if (booleanIt != booleanVariables.end()) {
+                            compiledUpdate.booleanAssignments.push_back({compile(assignment.getExpression()),
+                                                                         static_cast<uint64_t>(std::distance(booleanVariables.begin(), booleanIt))});
+                            continue;
+                        }
+                        auto integerIt = std::find_if(integerVariables.begin(), integerVariables.end(), [&assignment](IntegerVariableInformation const& info) {
+                            return info.variable == assignment.getVariable();
+                        });
+                        STORM_LOG_THROW(integerIt != integerVariables.end(), storm::exceptions::NotSupportedException,
+                                        "Cannot compile assignment to variable '" << assignment.getVariableName() << "'.");
+                        compiledUpdate.integerAssignments.push_back({compile(assignment.getExpression()),
+                                                                     static_cast<uint64_t>(std::distance(integerVariables.begin(), integerIt))});
+                    }
+                    compiledCommand.updates.push_back(std::move(compiledUpdate));
+                }
+            }
+        }
+
+        for (auto const& rewardModel : rewardModels) {
+            compiledStateRewards.emplace_back();
+            for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                compiledStateRewards.back().push_back({compile(stateReward.getStatePredicateExpression()), compile(stateReward.getRewardValueExpression())});
+            }
+            compiledStateActionRewards.emplace_back();
+            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                compiledStateActionRewards.back().push_back(
+                    {compile(stateActionReward.getStatePredicateExpression()), compile(stateActionReward.getRewardValueExpression())});
+            }
+        }
+    } catch (storm::exceptions::NotSupportedException const& e) {
+        STORM_LOG_WARN("Unable to compile the expressions of the program (" << e.what() << "), falling back to the expression evaluator.");
+        compiledCommands.clear();
+        compiledStateRewards.clear();
+        compiledStateActionRewards.clear();
+        return;
+    }
+
+    // Determine the size of the stack that is sufficient for all expressions.
+    uint64_t stackSize = 1;
+    auto updateStackSize = [&stackSize](CompiledStateExpression const& expression) {
+        stackSize = std::max(stackSize, expression.getRequiredStackSize());
+    };
+    for (auto const& compiledCommand : compiledCommands) {
+        updateStackSize(compiledCommand.guard);
+        for (auto const& compiledUpdate : compiledCommand.updates) {
+            updateStackSize(compiledUpdate.likelihood);
+            for (auto const& assignment : compiledUpdate.booleanAssignments) {
+                updateStackSize(assignment.expression);
+            }
+            for (auto const& assignment : compiledUpdate.integerAssignments) {
+                updateStackSize(assignment.expression);
+            }
+        }
+    }
+    for (auto const& rewards : {std::cref(compiledStateRewards), std::cref(compiledStateActionRewards)}) {
+        for (auto const& compiledRewards : rewards.get()) {
+            for (auto const& compiledReward : compiledRewards) {
+                updateStackSize(compiledReward.statePredicate);
+                updateStackSize(compiledReward.value);
+            }
+        }
+    }
+    evaluationStack.resize(stackSize);
+    useCompiledExpressions = true;
+    // The compiled expressions are evaluated directly on the states, so the evaluator only needs to be loaded on demand.
+    this->deferEvaluatorLoading = true;
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpression(storm::expressions::Expression const& expression,
+                                                                              CompiledStateExpression const* compiledExpression) {
+    if (compiledExpression) {
+        return compiledExpression->evaluateAsBool(*this->state, evaluationStack.data());
+    }
+    return this->evaluator->asBool(expression);
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateNumericalExpression(storm::expressions::Expression const& expression,
+                                                                                    CompiledStateExpression const* compiledExpression) {
+    if (compiledExpression) {
+        return storm::utility::convertNumber<ValueType>(compiledExpression->evaluate(*this->state, evaluationStack.data()));
+    }
+    return ValueType(this->evaluator->asRational(expression));
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isCommandEnabled(storm::prism::Command const& command) {
+    return evaluateBooleanExpression(command.getGuardExpression(), useCompiledExpressions ? &compiledCommands[command.getGlobalIndex()].guard : nullptr);
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::getUpdateLikelihood(storm::prism::Command const& command, uint64_t updateIndex) {
+    return evaluateNumericalExpression(command.getUpdate(updateIndex).getLikelihoodExpression(),
+                                       useCompiledExpressions ? &compiledCommands[command.getGlobalIndex()].updates[updateIndex].likelihood : nullptr);
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isStateRewardEnabled(uint64_t rewardModelIndex, uint64_t stateRewardIndex) {
+    return evaluateBooleanExpression(rewardModels[rewardModelIndex].get().getStateRewards()[stateRewardIndex].getStatePredicateExpression(),
+                                     useCompiledExpressions ? &compiledStateRewards[rewardModelIndex][stateRewardIndex].statePredicate : nullptr);
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::getStateRewardValue(uint64_t rewardModelIndex, uint64_t stateRewardIndex) {
+    return evaluateNumericalExpression(rewardModels[rewardModelIndex].get().getStateRewards()[stateRewardIndex].getRewardValueExpression(),
+                                       useCompiledExpressions ? &compiledStateRewards[rewardModelIndex][stateRewardIndex].value : nullptr);
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isStateActionRewardEnabled(uint64_t rewardModelIndex, uint64_t stateActionRewardIndex) {
+    return evaluateBooleanExpression(rewardModels[rewardModelIndex].get().getStateActionRewards()[stateActionRewardIndex].getStatePredicateExpression(),
+                                     useCompiledExpressions ? &compiledStateActionRewards[rewardModelIndex][stateActionRewardIndex].statePredicate : nullptr);
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::getStateActionRewardValue(uint64_t rewardModelIndex, uint64_t stateActionRewardIndex) {
+    return evaluateNumericalExpression(rewardModels[rewardModelIndex].get().getStateActionRewards()[stateActionRewardIndex].getRewardValueExpression(),
+                                       useCompiledExpressions ? &compiledStateActionRewards[rewardModelIndex][stateActionRewardIndex].value : nullptr);
 }
 
 template<typename ValueType, typename StateType>
@@ -285,13 +443,12 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
-    for (auto const& rewardModel : rewardModels) {
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
         ValueType stateRewardValue = storm::utility::zero<ValueType>();
-        if (rewardModel.get().hasStateRewards()) {
-            for (auto const& stateReward : rewardModel.get().getStateRewards()) {
-                if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
-                    stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
-                }
+        uint64_t numberOfStateRewards = rewardModels[rewardModelIndex].get().getStateRewards().size();
+        for (uint64_t stateRewardIndex = 0; stateRewardIndex < numberOfStateRewards; ++stateRewardIndex) {
+            if (isStateRewardEnabled(rewardModelIndex, stateRewardIndex)) {
+                stateRewardValue += getStateRewardValue(rewardModelIndex, stateRewardIndex);
             }
         }
         result.addStateReward(stateRewardValue);
@@ -299,6 +456,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // If a terminal expression was set and we must not expand this state, return now.
     if (!this->terminalStates.empty()) {
+        this->loadStateIntoEvaluator();
         for (auto const& expressionBool : this->terminalStates) {
             if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
                 return result;
@@ -309,18 +467,20 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     // Get all choices for the state.
     result.setExpanded();
 
-    std::vector<Choice<ValueType>> allChoices;
+    // The choices are gathered in a buffer that keeps its capacity across calls.
+    std::vector<Choice<ValueType>>& allChoices = choiceBuffer;
+    allChoices.clear();
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
+        addAsynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
         if (allChoices.empty()) {
             // Expand the Markovian edges if there are no probabilistic ones.
-            allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
+            addAsynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
             addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
         }
     } else {
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback);
+        addAsynchronousChoices(allChoices, *this->state, stateToIdCallback);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback);
     }
 
@@ -368,16 +528,14 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
 
         // Now construct the state-action reward for all selected reward models.
-        for (auto const& rewardModel : rewardModels) {
+        for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
             ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-            if (rewardModel.get().hasStateActionRewards()) {
-                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                    for (auto const& choice : allChoices) {
-                        if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                            stateActionRewardValue +=
-                                ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression())) * choice.getTotalMass();
-                        }
+            auto const& stateActionRewards = rewardModels[rewardModelIndex].get().getStateActionRewards();
+            for (uint64_t stateActionRewardIndex = 0; stateActionRewardIndex < stateActionRewards.size(); ++stateActionRewardIndex) {
+                for (auto const& choice : allChoices) {
+                    if (stateActionRewards[stateActionRewardIndex].getActionIndex() == choice.getActionIndex() &&
+                        isStateActionRewardEnabled(rewardModelIndex, stateActionRewardIndex)) {
+                        stateActionRewardValue += getStateActionRewardValue(rewardModelIndex, stateActionRewardIndex) * choice.getTotalMass();
                     }
                 }
             }
@@ -418,6 +576,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     for (auto& choice : allChoices) {
         result.addChoice(std::move(choice));
     }
+    allChoices.clear();
 
     this->postprocess(result);
 
@@ -426,12 +585,17 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInCurrentState(expressions::Expression const& expr) const {
+    this->loadStateIntoEvaluator();
     return this->evaluator->asBool(expr);
 }
 
 template<typename ValueType, typename StateType>
-CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
-    CompressedState newState(state);
+CompressedState const& PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Command const& command,
+                                                                                  uint64_t updateIndex, CompressedState& newState) {
+    STORM_LOG_ASSERT(&state != &newState, "Cannot apply update in place.");
+    // Since the states have the same size, this reuses the memory of the buffer.
+    newState = state;
+    storm::prism::Update const& update = command.getUpdate(updateIndex);
 
     // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
     // assignments to boolean variables precede the assignments to all integer variables and that within the
@@ -440,6 +604,8 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 
     auto assignmentIt = update.getAssignments().begin();
     auto assignmentIte = update.getAssignments().end();
+    CompiledUpdate const* compiledUpdate = useCompiledExpressions ? &compiledCommands[command.getGlobalIndex()].updates[updateIndex] : nullptr;
+    auto compiledAssignmentIt = compiledUpdate ? compiledUpdate->booleanAssignments.begin() : typename std::vector<CompiledAssignment>::const_iterator();
 
     // Iterate over all boolean assignments and carry them out.
     auto boolIt = this->variableInformation.booleanVariables.begin();
@@ -447,16 +613,21 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
         while (assignmentIt->getVariable() != boolIt->variable) {
             ++boolIt;
         }
-        newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+        CompiledStateExpression const* compiledExpression = compiledUpdate ? &(compiledAssignmentIt++)->expression : nullptr;
+        newState.set(boolIt->bitOffset, evaluateBooleanExpression(assignmentIt->getExpression(), compiledExpression));
     }
 
     // Iterate over all integer assignments and carry them out.
+    if (compiledUpdate) {
+        compiledAssignmentIt = compiledUpdate->integerAssignments.begin();
+    }
     auto integerIt = this->variableInformation.integerVariables.begin();
     for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
         while (assignmentIt->getVariable() != integerIt->variable) {
             ++integerIt;
         }
-        int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+        int_fast64_t assignedValue = compiledUpdate ? (compiledAssignmentIt++)->expression.evaluateAsInt(*this->state, evaluationStack.data())
+                                                    : this->evaluator->asInt(assignmentIt->getExpression());
         if (this->options.isAddOutOfBoundsStateSet()) {
             if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                 return this->outOfBoundsState;
@@ -481,27 +652,18 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
     return newState;
 }
 
-struct ActiveCommandData {
-    ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
-                      typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
-        : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
-        // Intentionally left empty
-    }
-    storm::prism::Module const* modulePtr;
-    std::set<uint_fast64_t> const* commandIndicesPtr;
-    typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
-};
-
 template<typename ValueType, typename StateType>
-boost::optional<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>>
-PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(uint_fast64_t const& actionIndex, CommandFilter const& commandFilter) {
+bool PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(
+    uint_fast64_t const& actionIndex, std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>& activeCommandLists,
+    CommandFilter const& commandFilter) {
     // First check whether there is at least one enabled command at each module
     // This avoids evaluating unnecessarily many guards.
-    // If we find one module without an enabled command, we return boost::none.
+    // If we find one module without an enabled command, we return false.
     // At the same time, we store pointers to the relevant modules, the relevant command sets and the first enabled command within each set.
 
     // Iterate over all modules.
-    std::vector<ActiveCommandData> activeCommands;
+    std::vector<ActiveCommandData>& activeCommands = activeCommandDataBuffer;
+    activeCommands.clear();
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
         storm::prism::Module const& module = program.getModule(i);
 
@@ -515,7 +677,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         // If the module contains the action, but there is no command in the module that is labeled with
         // this action, we don't have any feasible command combinations.
         if (commandIndices.empty()) {
-            return boost::none;
+            return false;
         }
 
         // Look up commands by their indices and check if the guard evaluates to true in the given state.
@@ -531,25 +693,28 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCommandEnabled(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
-                activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                activeCommands.push_back({&module, &commandIndices, commandIndexIt});
                 break;
             }
         }
 
         if (!hasOneEnabledCommand) {
-            return boost::none;
+            return false;
         }
     }
 
     // If we reach this point, there has to be at least one active command for each relevant module.
-    std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> result;
+    // The inner lists keep their capacity, so that they do not need to be reallocated for every state.
+    activeCommandLists.resize(activeCommands.size());
 
     // Iterate over all command sets.
-    for (auto const& activeCommand : activeCommands) {
-        std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
+    for (uint64_t listIndex = 0; listIndex < activeCommands.size(); ++listIndex) {
+        auto const& activeCommand = activeCommands[listIndex];
+        std::vector<std::reference_wrapper<storm::prism::Command const>>& commands = activeCommandLists[listIndex];
+        commands.clear();
 
         auto commandIndexIt = activeCommand.currentCommandIndexIt;
         // The command at the current position is already known to be enabled
@@ -565,24 +730,19 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCommandEnabled(command)) {
                 commands.push_back(command);
             }
         }
-
-        result.push_back(std::move(commands));
     }
 
-    STORM_LOG_ASSERT(!result.empty(), "Expected non-empty list.");
-    return result;
+    STORM_LOG_ASSERT(!activeCommandLists.empty(), "Expected non-empty list.");
+    return true;
 }
 
 template<typename ValueType, typename StateType>
-std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAsynchronousChoices(CompressedState const& state,
-                                                                                                     StateToIdCallback stateToIdCallback,
-                                                                                                     CommandFilter const& commandFilter) {
-    std::vector<Choice<ValueType>> result;
-
+void PrismNextStateGenerator<ValueType, StateType>::addAsynchronousChoices(std::vector<Choice<ValueType>>& result, CompressedState const& state,
+                                                                           StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter) {
     // Iterate over all modules.
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
         storm::prism::Module const& module = program.getModule(i);
@@ -608,12 +768,13 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isCommandEnabled(command)) {
                 continue;
             }
 
-            result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
+            result.emplace_back(command.getActionIndex(), command.isMarkovian());
             Choice<ValueType>& choice = result.back();
+            choice.reserve(command.getNumberOfUpdates());
 
             // Remember the choice origin only if we were asked to.
             if (this->options.isBuildChoiceOriginsSet()) {
@@ -624,13 +785,11 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             // Iterate over all updates of the current command.
             ValueType probabilitySum = storm::utility::zero<ValueType>();
             for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                storm::prism::Update const& update = command.getUpdate(k);
-
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                ValueType probability = getUpdateLikelihood(command, k);
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+                    StateType stateIndex = stateToIdCallback(applyUpdate(state, command, k, successorStateBuffer));
 
                     // Update the choice by adding the probability/target state to it.
                     choice.addProbability(stateIndex, probability);
@@ -641,18 +800,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Create the state-action reward for the newly created choice.
-            for (auto const& rewardModel : rewardModels) {
-                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateActionRewards()) {
-                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                        if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                        }
-                    }
-                }
-                choice.addReward(stateActionRewardValue);
-            }
+            addStateActionRewards(choice);
 
             if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
                 choice.addLabel(program.getActionName(command.getActionIndex()));
@@ -672,8 +820,6 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
         }
     }
-
-    return result;
 }
 
 template<typename ValueType, typename StateType>
@@ -690,10 +836,11 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
         distribution.add(id, probability);
     } else {
         storm::prism::Command const& command = *iteratorList[position];
+        // Every level of the recursion constructs its successors in its own buffer.
+        CompressedState& newState = synchronizationStateBuffer[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
-            storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
-                                             position + 1, iteratorList, distribution, stateToIdCallback);
+            generateSynchronizedDistribution(applyUpdate(state, command, j, newState), probability * getUpdateLikelihood(command, j), position + 1,
+                                             iteratorList, distribution, stateToIdCallback);
         }
     }
 }
@@ -707,20 +854,21 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 continue;
             }
         }
-        boost::optional<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>> optionalActiveCommandLists =
-            getActiveCommandsByActionIndex(actionIndex, commandFilter);
-
         // Only process this action label, if there is at least one feasible solution.
-        if (optionalActiveCommandLists) {
-            std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> const& activeCommandList = optionalActiveCommandLists.get();
-            std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator> iteratorList(activeCommandList.size());
+        if (getActiveCommandsByActionIndex(actionIndex, activeCommandListsBuffer, commandFilter)) {
+            std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> const& activeCommandList = activeCommandListsBuffer;
+            std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator>& iteratorList = iteratorListBuffer;
+            iteratorList.resize(activeCommandList.size());
+            if (synchronizationStateBuffer.size() < activeCommandList.size()) {
+                synchronizationStateBuffer.resize(activeCommandList.size());
+            }
 
             // Initialize the list of iterators.
             for (size_t i = 0; i < activeCommandList.size(); ++i) {
                 iteratorList[i] = activeCommandList[i].cbegin();
             }
 
-            storm::generator::Distribution<StateType, ValueType> distribution;
+            storm::generator::Distribution<StateType, ValueType>& distribution = distributionBuffer;
 
             // As long as there is one feasible combination of commands, keep on expanding it.
             bool done = false;
@@ -775,18 +923,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 }
 
                 // Create the state-action reward for the newly created choice.
-                for (auto const& rewardModel : rewardModels) {
-                    ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                    if (rewardModel.get().hasStateActionRewards()) {
-                        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                            if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                                this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                            }
-                        }
-                    }
-                    choice.addReward(stateActionRewardValue);
-                }
+                addStateActionRewards(choice);
 
                 // Now, check whether there is one more command combination to consider.
                 bool movedIterator = false;
@@ -806,6 +943,21 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
     }
 }
 
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::addStateActionRewards(Choice<ValueType>& choice) {
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+        auto const& stateActionRewards = rewardModels[rewardModelIndex].get().getStateActionRewards();
+        for (uint64_t stateActionRewardIndex = 0; stateActionRewardIndex < stateActionRewards.size(); ++stateActionRewardIndex) {
+            if (stateActionRewards[stateActionRewardIndex].getActionIndex() == choice.getActionIndex() &&
+                isStateActionRewardEnabled(rewardModelIndex, stateActionRewardIndex)) {
+                stateActionRewardValue += getStateActionRewardValue(rewardModelIndex, stateActionRewardIndex);
+            }
+        }
+        choice.addReward(stateActionRewardValue);
+    }
+}
+
 template<typename ValueType, typename StateType>
 std::map<std::string, storm::storage::PlayerIndex> PrismNextStateGenerator<ValueType, StateType>::getPlayerNameToIndexMap() const {
     return program.getPlayerNameToIndexMapping();
@@ -844,6 +996,7 @@ storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluat
         return result;
     }
     unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+    this->evaluatorLoaded = false;
     for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
         result.setFromInt(64 * i, 64, this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression()));
     }
@@ -852,6 +1005,7 @@ storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluat
 
 template<typename ValueType, typename StateType>
 void PrismNextStateGenerator<ValueType, StateType>::extendStateInformation(storm::json<ValueType>& result) const {
+    this->loadStateIntoEvaluator();
     for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
         result[program.getObservationLabels()[i].getName()] = this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression());
     }
@@ -1,6 +1,8 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/Distribution.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -8,8 +10,6 @@
 
 namespace storm {
 namespace generator {
-template<typename StateType, typename ValueType>
-class Distribution;
 
 template<typename ValueType, typename StateType = uint32_t>
 class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
@@ -60,12 +60,14 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     /*!
      * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
-     * the given compressed state.
+     * the given compressed state. The assignments are evaluated in the currently loaded state.
      * @params state The state to which to apply the new values.
-     * @params update The update to apply.
-     * @return The resulting state.
+     * @params command The command whose update to apply.
+     * @params updateIndex The index of the update within the command.
+     * @params newState A buffer in which the resulting state is constructed. It must not be the given state.
+     * @return The resulting state, which is either the given buffer or the out-of-bounds state.
      */
-    CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
+    CompressedState const& applyUpdate(CompressedState const& state, storm::prism::Command const& command, uint64_t updateIndex, CompressedState& newState);
 
     /*!
      * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
@@ -75,25 +77,25 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      * action and active (i.e. enabled) in the current state. The result is a list of lists of commands in which
      * the inner lists contain all commands of exactly one module. If a module does not have *any* (including
      * disabled) commands, there will not be a list of commands of that module in the result. If, however, the
-     * module has a command with a relevant label, but no enabled one, nothing is returned to indicate that there
+     * module has a command with a relevant label, but no enabled one, false is returned to indicate that there
      * is no legal transition possible.
      *
-     * @param The program in which to search for active commands.
-     * @param state The current state.
      * @param actionIndex The index of the action label to select.
-     * @return A list of lists of active commands or nothing.
+     * @param activeCommandLists The list of lists of active commands. Its contents are only valid if the function returns true.
+     * @return True iff there is at least one enabled command in each relevant module.
      */
-    boost::optional<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>> getActiveCommandsByActionIndex(
-        uint_fast64_t const& actionIndex, CommandFilter const& commandFilter = CommandFilter::All);
+    bool getActiveCommandsByActionIndex(uint_fast64_t const& actionIndex,
+                                        std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>& activeCommandLists,
+                                        CommandFilter const& commandFilter = CommandFilter::All);
 
     /*!
-     * Retrieves all choices that are definitively asynchronous, possible from the given state.
+     * Adds all choices that are definitively asynchronous, possible from the given state.
      *
+     * @param choices The new choices are inserted in this vector
      * @param state The state for which to retrieve the unlabeled choices.
-     * @return The asynchronous choices of the state.
      */
-    std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                          CommandFilter const& commandFilter = CommandFilter::All);
+    void addAsynchronousChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state, StateToIdCallback stateToIdCallback,
+                                CommandFilter const& commandFilter = CommandFilter::All);
 
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
@@ -125,6 +127,58 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+    /*!
+     * Compiles the guards, updates and rewards of the program into CompiledStateExpressions. If some expression can not be compiled, the generator
+     * falls back to the expression evaluator.
+     */
+    void compileExpressions();
+
+    /*!
+     * Evaluates the given expression of the program in the currently loaded state. If available, the compiled form of the expression is used.
+     */
+    bool evaluateBooleanExpression(storm::expressions::Expression const& expression, CompiledStateExpression const* compiledExpression);
+    ValueType evaluateNumericalExpression(storm::expressions::Expression const& expression, CompiledStateExpression const* compiledExpression);
+
+    bool isCommandEnabled(storm::prism::Command const& command);
+    ValueType getUpdateLikelihood(storm::prism::Command const& command, uint64_t updateIndex);
+    bool isStateRewardEnabled(uint64_t rewardModelIndex, uint64_t stateRewardIndex);
+    ValueType getStateRewardValue(uint64_t rewardModelIndex, uint64_t stateRewardIndex);
+    bool isStateActionRewardEnabled(uint64_t rewardModelIndex, uint64_t stateActionRewardIndex);
+    ValueType getStateActionRewardValue(uint64_t rewardModelIndex, uint64_t stateActionRewardIndex);
+
+    /*!
+     * Adds the state-action rewards of all selected reward models to the given choice.
+     */
+    void addStateActionRewards(Choice<ValueType>& choice);
+
+    struct ActiveCommandData {
+        storm::prism::Module const* modulePtr;
+        std::set<uint_fast64_t> const* commandIndicesPtr;
+        typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
+    };
+
+    struct CompiledAssignment {
+        CompiledStateExpression expression;
+        // The index of the assigned variable in the boolean or integer variables of the variable information.
+        uint64_t variableIndex;
+    };
+
+    struct CompiledUpdate {
+        CompiledStateExpression likelihood;
+        std::vector<CompiledAssignment> booleanAssignments;
+        std::vector<CompiledAssignment> integerAssignments;
+    };
+
+    struct CompiledCommand {
+        CompiledStateExpression guard;
+        std::vector<CompiledUpdate> updates;
+    };
+
+    struct CompiledReward {
+        CompiledStateExpression statePredicate;
+        CompiledStateExpression value;
+    };
+
     // The program used for the generation of next states.
     storm::prism::Program program;
 
@@ -137,6 +191,27 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // A flag that stores whether the compiled expressions are used instead of the expression evaluator.
+    bool useCompiledExpressions;
+
+    // The compiled commands (indexed by their global index) and the compiled state(-action) rewards of each reward model.
+    std::vector<CompiledCommand> compiledCommands;
+    std::vector<std::vector<CompiledReward>> compiledStateRewards;
+    std::vector<std::vector<CompiledReward>> compiledStateActionRewards;
+
+    // The stack used to evaluate compiled expressions.
+    std::vector<double> evaluationStack;
+
+    // Buffers that are reused across calls to expand to avoid allocations. Since every thread exploring the state space uses its own generator,
+    // they serve as per-thread arenas.
+    std::vector<Choice<ValueType>> choiceBuffer;
+    CompressedState successorStateBuffer;
+    std::vector<CompressedState> synchronizationStateBuffer;
+    std::vector<ActiveCommandData> activeCommandDataBuffer;
+    std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> activeCommandListsBuffer;
+    std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator> iteratorListBuffer;
+    storm::generator::Distribution<StateType, ValueType> distributionBuffer;
 };
 
 }  // namespace generator
@@ -0,0 +1,305 @@
+#include "storm/io/BinaryModelExporter.h"
+
+#include <cstring>
+#include <functional>
+#include <set>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+
+/*!
+ * Writes items in the binary format. If no stream is given, the items are only counted, which is used to determine the size of a section before
+ * writing it.
+ */
+class BinaryWriter {
+   public:
+    explicit BinaryWriter(std::ostream* os) : os(os), numberOfBytes(0) {
+        if (os) {
+            buffer.reserve(bufferSize);
+        }
+    }
+
+    ~BinaryWriter() {
+        flush();
+    }
+
+    void writeUint32(uint32_t value) {
+        writeBytes(reinterpret_cast<char const*>(&value), sizeof(value));
+    }
+
+    void writeUint64(uint64_t value) {
+        writeBytes(reinterpret_cast<char const*>(&value), sizeof(value));
+    }
+
+    void writeString(std::string const& value) {
+        writeUint64(value.size());
+        writeBytes(value.data(), value.size());
+        pad();
+    }
+
+    void writeBitVector(storm::storage::BitVector const& value) {
+        writeUint64(value.size());
+        for (uint64_t bucketStart = 0; bucketStart < value.size(); bucketStart += 64) {
+            writeUint64(value.getAsInt(bucketStart, std::min<uint64_t>(64, value.size() - bucketStart)));
+        }
+    }
+
+    void writeDoubleVector(std::vector<double> const& values) {
+        writeUint64(values.size());
+        writeArray(values);
+    }
+
+    template<typename T>
+    void writeArray(std::vector<T> const& values) {
+        static_assert(sizeof(T) == sizeof(uint64_t), "Only arrays of 64-bit values are stored.");
+        writeBytes(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+    }
+
+    void writeMatrix(storm::storage::SparseMatrix<double> const& matrix) {
+        writeUint64(matrix.getRowCount());
+        writeUint64(matrix.getColumnCount());
+        writeUint64(matrix.getEntryCount());
+        writeUint64(matrix.hasTrivialRowGrouping() ? 0 : matrix.getRowGroupCount());
+        std::vector<uint64_t> rowIndications;
+        rowIndications.reserve(matrix.getRowCount() + 1);
+        rowIndications.push_back(0);
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            rowIndications.push_back(rowIndications.back() + matrix.getRow(row).getNumberOfEntries());
+        }
+        writeArray(rowIndications);
+        if (!matrix.hasTrivialRowGrouping()) {
+            writeArray(matrix.getRowGroupIndices());
+        }
+        // The entries are stored as pairs of column and value, which is exactly the layout of the matrix entries.
+        static_assert(sizeof(storm::storage::MatrixEntry<uint64_t, double>) == 2 * sizeof(uint64_t), "Unexpected layout of matrix entries.");
+        if (matrix.getEntryCount() > 0) {
+            writeBytes(reinterpret_cast<char const*>(&*matrix.begin()), matrix.getEntryCount() * 2 * sizeof(uint64_t));
+        }
+    }
+
+    uint64_t getNumberOfBytes() const {
+        return numberOfBytes;
+    }
+
+    void flush() {
+        if (os && !buffer.empty()) {
+            os->write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+
+   private:
+    void writeBytes(char const* data, uint64_t size) {
+        numberOfBytes += size;
+        if (os) {
+            if (buffer.size() + size > bufferSize) {
+                flush();
+            }
+            if (size > bufferSize) {
+                os->write(data, size);
+            } else {
+                buffer.insert(buffer.end(), data, data + size);
+            }
+        }
+    }
+
+    void pad() {
+        static char const zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        writeBytes(zeros, (8 - numberOfBytes % 8) % 8);
+    }
+
+    static uint64_t const bufferSize = 1 << 20;
+
+    std::ostream* os;
+    uint64_t numberOfBytes;
+    std::vector<char> buffer;
+};
+
+/*!
+ * Writes a section whose content is produced by the given function. The function is called twice: once to determine the size of the content and
+ * once to actually write it.
+ */
+template<typename ContentWriter>
+void writeSection(std::ostream& os, binary::SectionKind kind, ContentWriter const& writeContent) {
+    BinaryWriter counter(nullptr);
+    writeContent(counter);
+
+    BinaryWriter writer(&os);
+    writer.writeUint32(static_cast<uint32_t>(kind));
+    // The reserved field.
+    writer.writeUint32(0);
+    writer.writeUint64(counter.getNumberOfBytes());
+    writeContent(writer);
+    STORM_LOG_ASSERT(writer.getNumberOfBytes() == counter.getNumberOfBytes() + 2 * sizeof(uint64_t), "Unexpected size of section.");
+}
+
+void writeLabeling(BinaryWriter& writer, storm::models::sparse::ItemLabeling const& labeling,
+                   std::function<storm::storage::BitVector const&(std::string const&)> const& getItems) {
+    std::set<std::string> labels = labeling.getLabels();
+    writer.writeUint64(labels.size());
+    for (auto const& label : labels) {
+        writer.writeString(label);
+        writer.writeBitVector(getItems(label));
+    }
+}
+
+void writeStateValuations(BinaryWriter& writer, storm::storage::sparse::StateValuations const& valuations) {
+    // Collect the variables and labels from the first state that has a valuation.
+    std::vector<std::pair<binary::VariableKind, std::string>> variables;
+    std::vector<std::string> labels;
+    uint64_t const numberOfStates = valuations.getNumberOfStates();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (!valuations.isEmpty(state)) {
+            auto valueRange = valuations.at(state);
+            for (auto valueIt = valueRange.begin(); valueIt != valueRange.end(); ++valueIt) {
+                if (valueIt.isVariableAssignment()) {
+                    if (valueIt.isBoolean()) {
+                        variables.emplace_back(binary::VariableKind::Boolean, valueIt.getName());
+                    } else if (valueIt.isInteger()) {
+                        variables.emplace_back(binary::VariableKind::Integer, valueIt.getName());
+                    } else {
+                        variables.emplace_back(binary::VariableKind::Rational, valueIt.getName());
+                    }
+                } else {
+                    labels.push_back(valueIt.getLabel());
+                }
+            }
+            break;
+        }
+    }
+
+    writer.writeUint64(variables.size());
+    for (auto const& variable : variables) {
+        writer.writeUint64(static_cast<uint64_t>(variable.first));
+        writer.writeString(variable.second);
+    }
+    writer.writeUint64(labels.size());
+    for (auto const& label : labels) {
+        writer.writeString(label);
+    }
+
+    // Write the values of each state in the order of the variables and labels above.
+    writer.writeUint64(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (valuations.isEmpty(state)) {
+            writer.writeUint64(0);
+            continue;
+        }
+        writer.writeUint64(1);
+        auto valueRange = valuations.at(state);
+        for (auto valueIt = valueRange.begin(); valueIt != valueRange.end(); ++valueIt) {
+            if (valueIt.isLabelAssignment()) {
+                writer.writeUint64(static_cast<uint64_t>(valueIt.getLabelValue()));
+            } else if (valueIt.isBoolean()) {
+                writer.writeUint64(valueIt.getBooleanValue() ? 1 : 0);
+            } else if (valueIt.isInteger()) {
+                writer.writeUint64(static_cast<uint64_t>(valueIt.getIntegerValue()));
+            } else {
+                writer.writeString(storm::utility::to_string(valueIt.getRationalValue()));
+            }
+        }
+    }
+}
+
+}  // namespace
+
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+    uint16_t const endiannessTest = 1;
+    STORM_LOG_THROW(*reinterpret_cast<uint8_t const*>(&endiannessTest) == 1, storm::exceptions::NotSupportedException,
+                    "The binary model format is only supported on little endian machines.");
+    STORM_LOG_THROW(sparseModel->getType() != storm::models::ModelType::S2pg && sparseModel->getType() != storm::models::ModelType::Smg,
+                    storm::exceptions::NotSupportedException, "Games can not be exported in the binary model format.");
+    STORM_LOG_WARN_COND(!sparseModel->hasChoiceOrigins(), "Choice origins are not exported in the binary model format.");
+
+    // Write header
+    {
+        BinaryWriter writer(&os);
+        std::stringstream modelType;
+        modelType << sparseModel->getType();
+        uint64_t magicNumber;
+        std::memcpy(&magicNumber, binary::magicNumber, sizeof(magicNumber));
+        writer.writeUint64(magicNumber);
+        writer.writeUint32(binary::formatVersion);
+        writer.writeUint32(static_cast<uint32_t>(binary::ValueKind::Double));
+        writer.writeString(modelType.str());
+        writer.writeUint64(sparseModel->getNumberOfStates());
+        writer.writeUint64(sparseModel->getNumberOfChoices());
+    }
+
+    writeSection(os, binary::SectionKind::TransitionMatrix, [&sparseModel](BinaryWriter& writer) { writer.writeMatrix(sparseModel->getTransitionMatrix()); });
+
+    writeSection(os, binary::SectionKind::StateLabeling, [&sparseModel](BinaryWriter& writer) {
+        auto const& labeling = sparseModel->getStateLabeling();
+        writeLabeling(writer, labeling, [&labeling](std::string const& label) -> storm::storage::BitVector const& { return labeling.getStates(label); });
+    });
+    if (sparseModel->hasChoiceLabeling()) {
+        writeSection(os, binary::SectionKind::ChoiceLabeling, [&sparseModel](BinaryWriter& writer) {
+            auto const& labeling = sparseModel->getChoiceLabeling();
+            writeLabeling(writer, labeling, [&labeling](std::string const& label) -> storm::storage::BitVector const& { return labeling.getChoices(label); });
+        });
+    }
+
+    for (auto const& nameRewardModelPair : sparseModel->getRewardModels()) {
+        writeSection(os, binary::SectionKind::RewardModel, [&nameRewardModelPair](BinaryWriter& writer) {
+            auto const& rewardModel = nameRewardModelPair.second;
+            writer.writeString(nameRewardModelPair.first);
+            writer.writeUint64((rewardModel.hasStateRewards() ? 1 : 0) | (rewardModel.hasStateActionRewards() ? 2 : 0) |
+                               (rewardModel.hasTransitionRewards() ? 4 : 0));
+            if (rewardModel.hasStateRewards()) {
+                writer.writeDoubleVector(rewardModel.getStateRewardVector());
+            }
+            if (rewardModel.hasStateActionRewards()) {
+                writer.writeDoubleVector(rewardModel.getStateActionRewardVector());
+            }
+            if (rewardModel.hasTransitionRewards()) {
+                writer.writeMatrix(rewardModel.getTransitionRewardMatrix());
+            }
+        });
+    }
+
+    if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
+        writeSection(os, binary::SectionKind::ExitRates, [&sparseModel](BinaryWriter& writer) {
+            writer.writeDoubleVector(sparseModel->template as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+        });
+    } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto ma = sparseModel->template as<storm::models::sparse::MarkovAutomaton<double>>();
+        writeSection(os, binary::SectionKind::ExitRates, [&ma](BinaryWriter& writer) { writer.writeDoubleVector(ma->getExitRates()); });
+        writeSection(os, binary::SectionKind::MarkovianStates, [&ma](BinaryWriter& writer) { writer.writeBitVector(ma->getMarkovianStates()); });
+    } else if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+        auto pomdp = sparseModel->template as<storm::models::sparse::Pomdp<double>>();
+        writeSection(os, binary::SectionKind::Observations, [&pomdp](BinaryWriter& writer) {
+            writer.writeUint64(pomdp->getObservations().size());
+            for (auto const& observation : pomdp->getObservations()) {
+                writer.writeUint64(observation);
+            }
+        });
+        if (pomdp->hasObservationValuations()) {
+            writeSection(os, binary::SectionKind::ObservationValuations,
+                         [&pomdp](BinaryWriter& writer) { writeStateValuations(writer, pomdp->getObservationValuations()); });
+        }
+    }
+
+    if (sparseModel->hasStateValuations()) {
+        writeSection(os, binary::SectionKind::StateValuations,
+                     [&sparseModel](BinaryWriter& writer) { writeStateValuations(writer, sparseModel->getStateValuations()); });
+    }
+
+    writeSection(os, binary::SectionKind::End, [](BinaryWriter&) {});
+}
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports a sparse model into the binary drb format. In contrast to the DRN format, the arrays of the model are written as they are stored in
+ * memory, which makes loading the model (almost) as fast as reading the file.
+ * Choice origins can not be exported, because they refer to the original model description.
+ *
+ * @param os           Stream to export to. This should be opened in binary mode.
+ * @param sparseModel  Model to export
+ */
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace binary {
+
+/*
+ * Layout of the binary model format (drb).
+ *
+ * All numbers are stored in little endian byte order and every item occupies a multiple of 8 bytes such that all arrays are 8-byte aligned when
+ * the file is mapped to memory. A string is stored as its length followed by its characters (padded with zeros). A bit vector is stored as its
+ * size followed by its 64-bit buckets.
+ *
+ * The file starts with the magic number, the (32-bit) version of the format, the (32-bit) type of the values, the model type (as string), the number
+ * of states and the number of choices. It is followed by a sequence of sections that is terminated by the end section. Each section consists of its
+ * 32-bit kind, a reserved 32-bit field and the size of its content in bytes. Sections of unknown kind are skipped when loading.
+ */
+
+// The first 8 bytes of every file in the binary model format.
+static char const magicNumber[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'R', 'B'};
+
+// The version of the format. This needs to be increased whenever the layout of a section changes.
+static uint32_t const formatVersion = 1;
+
+enum class ValueKind : uint32_t { Double = 1 };
+
+enum class SectionKind : uint32_t {
+    End = 0,
+    // The number of rows, columns, entries and row groups (or zero if the row grouping is trivial), followed by the row indications, the row group
+    // indices and the entries (pairs of column and value).
+    TransitionMatrix = 1,
+    // The number of labels, followed by the name and the labeled items of each label.
+    StateLabeling = 2,
+    ChoiceLabeling = 3,
+    // The name, a bit mask of the present components (1: state rewards, 2: state-action rewards, 4: transition rewards) and the present components.
+    RewardModel = 4,
+    // The number of states followed by the exit rate of each state.
+    ExitRates = 5,
+    // The bit vector of Markovian states.
+    MarkovianStates = 6,
+    // The number of states followed by the observation of each state.
+    Observations = 7,
+    // The variables (type and name), the labels and the valuation of each state.
+    StateValuations = 8,
+    ObservationValuations = 9
+};
+
+// The types of variables in state valuations.
+enum class VariableKind : uint64_t { Boolean = 0, Integer = 1, Rational = 2 };
+
+}  // namespace binary
+}  // namespace exporter
+}  // namespace storm
@@ -6,6 +6,8 @@
 
 #include "storm/modelchecker/blackbox/BlackboxChecker.h"
 
+#include "storm-config.h"
+
 #include "storm/modelchecker/blackbox/BMdp.h"
 #include "storm/modelchecker/blackbox/Simulator.h"
 #include "storm/modelchecker/blackbox/EMdpToDot.h"
@@ -31,7 +33,7 @@ namespace blackbox {
 
 
 template<typename ModelType, typename StateType>
-BlackboxChecker<ModelType, StateType>::BlackboxChecker(storm::prism::Program const& program) {
+BlackboxChecker<ModelType, StateType>::BlackboxChecker(storm::prism::Program const& program) : program(program) {
     if(storm::settings::getModule<storm::settings::modules::BlackboxSettings>().getIsGreybox()){
         auto ptr = std::make_shared<GreyboxWrapperOnWhitebox<StateType, ValueType>>(program);
         blackboxMDP = std::static_pointer_cast<BlackboxMDP<StateType, ValueType>>(ptr);
@@ -47,6 +49,14 @@ bool BlackboxChecker<ModelType, StateType>::canHandle(CheckTask<storm::logic::Fo
     return true;
 }
 
+template<typename StateType, typename ValueType>
+std::shared_ptr<BlackboxMDP<StateType, ValueType>> createSeededWrapper(storm::prism::Program const& program, bool greybox, std::seed_seq& seed) {
+    if(greybox) {
+        return std::make_shared<GreyboxWrapperOnWhitebox<StateType, ValueType>>(program, seed);
+    }
+    return std::make_shared<BlackboxWrapperOnWhitebox<StateType, ValueType>>(program, seed);
+}
+
 template<typename StateType>
 void executeEMdpFlags(settings::modules::BlackboxSettings blackboxSettings, EMdp<StateType> emdp) {
     if(blackboxSettings.isSetPrintEMdp()) //Print the explored emdp if flag is set 
@@ -88,7 +98,7 @@ void executeEMdpFlags(settings::modules::BlackboxSettings blackboxSettings, EMdp
 
 
 template<typename StateType>
-void executeBMdpFlags(const settings::modules::BlackboxSettings& blackboxSettings, BMdp<StateType> bmdp) {
+void executeBMdpFlags(const settings::modules::BlackboxSettings& blackboxSettings, BMdp<StateType> const& bmdp) {
     if(blackboxSettings.isSetBMdpToDot()) { //Convert bmdp to dot 
         if(blackboxSettings.getBMdpDotOutFileName() == "log") {
             bmdp.writeDotToStream(std::cout, 30, blackboxSettings.isSetDotIncLab(), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, true);
@@ -107,6 +117,7 @@ std::unique_ptr<CheckResult> BlackboxChecker<ModelType, StateType>::computeUntil
     uint_fast64_t maxIterations = blackboxSettings.getMaxIterations();
     std::seed_seq seedSimHeuristic = blackboxSettings.getSimHeuristicSeed();
     uint_fast64_t simulationsPerIter = blackboxSettings.getNumberOfSamplingsPerSimulationStep();
+    uint_fast64_t simulationThreads = blackboxSettings.getNumberOfSimulationThreads();
     heuristicSim::HeuristicSimType heuristicSimType = blackboxSettings.getSimulationHeuristicType();
     // cli arguments infer
     BoundFuncType boundFuncType = blackboxSettings.getBoundFuncType();
@@ -120,9 +131,25 @@ std::unique_ptr<CheckResult> BlackboxChecker<ModelType, StateType>::computeUntil
 
     auto heuristicSim(std::static_pointer_cast<heuristicSim::HeuristicSim<StateType, ValueType>>(std::make_shared<heuristicSim::NaiveHeuristicSim<StateType, ValueType>>(blackboxMDP, seedSimHeuristic)));
     Simulator<StateType, ValueType> simulator(blackboxMDP, heuristicSim);
+    if(simulationThreads > 1) {
+#ifndef STORM_HAVE_INTELTBB
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+#endif
+        // every worker gets its own blackbox MDP and heuristic with seeds derived from the given seed
+        std::vector<uint32_t> workerSeeds(2 * simulationThreads);
+        seedSimHeuristic.generate(workerSeeds.begin(), workerSeeds.end());
+        for(uint_fast64_t w = 0; w < simulationThreads; w++) {
+            std::seed_seq wrapperSeed({workerSeeds[2 * w]});
+            std::seed_seq workerHeuristicSeed({workerSeeds[2 * w + 1]});
+            auto workerMDP = createSeededWrapper<StateType, ValueType>(program, blackboxMDP->isGreybox(), wrapperSeed);
+            auto workerHeuristic = heuristicSim::getHeuristicSim<StateType, ValueType>(heuristicSimType, workerMDP, workerHeuristicSeed);
+            simulator.addWorker(workerMDP, workerHeuristic);
+        }
+    }
     auto boundFunc = getBoundFunc<ValueType>(boundFuncType);
     auto deltaDist = getDeltaDistribution<StateType>(deltaDistType);
     std::pair<double, double> valueBounds = std::make_pair(0, 1);
+    IncrementalInfer<StateType, ValueType, StateType> incrementalInfer(*boundFunc, *deltaDist, blackboxMDP->getPmin(), delta, blackboxMDP->isGreybox(), blackboxMDP);
 
     // run 3 step algorithm
     STORM_LOG_TRACE("Start SMC-Algorithm for blackbox MDP");
@@ -136,7 +163,7 @@ std::unique_ptr<CheckResult> BlackboxChecker<ModelType, StateType>::computeUntil
         simulator.simulate(emdp, simulationsPerIter);
 
         // infer 
-        auto bmdp = infer(emdp, *boundFunc, *deltaDist, blackboxMDP->getPmin(), delta, blackboxMDP->isGreybox(), blackboxMDP);
+        auto const& bmdp = incrementalInfer.infer(emdp);
 
         if(iterCount == maxIterations) //cli argument execution for emdp and bmdp
             executeBMdpFlags(blackboxSettings, bmdp); 
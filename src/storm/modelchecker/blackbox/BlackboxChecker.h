@@ -43,6 +43,7 @@ class BlackboxChecker: public storm::modelchecker::AbstractModelChecker<ModelTyp
      std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
 
     private:
+     storm::prism::Program program;
      std::shared_ptr<BlackboxMDP<StateType, ValueType>> blackboxMDP;
 
 };
@@ -29,6 +29,18 @@ StateType BlackboxMDP<StateType, ValueType>::getSucCount(StateType, StateType) {
     return 0;
 }
 
+template <typename StateType, typename ValueType>
+storm::storage::BitVector BlackboxMDP<StateType, ValueType>::getStateKey(StateType) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "getStateKey is not supported by this MDP");
+    return storm::storage::BitVector();
+}
+
+template <typename StateType, typename ValueType>
+StateType BlackboxMDP<StateType, ValueType>::getStateFromKey(storm::storage::BitVector const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "getStateFromKey is not supported by this MDP");
+    return 0;
+}
+
 template <typename StateType, typename ValueType> BlackboxMDP<StateType, ValueType>::~BlackboxMDP() = default;
 
 template <typename StateType, typename ValueType>
@@ -50,6 +62,12 @@ BlackboxWrapperOnWhitebox<StateType, ValueType>::BlackboxWrapperOnWhitebox(storm
     stateMappingOutIn[0] = getInitialState();
 }
 
+template <typename StateType, typename ValueType>
+BlackboxWrapperOnWhitebox<StateType, ValueType>::BlackboxWrapperOnWhitebox(storm::prism::Program const& program, std::seed_seq& seed)
+                                                : BlackboxWrapperOnWhitebox(program) {
+    randomGenerator.seed(seed);
+}
+
 template <typename StateType, typename ValueType>
 StateType BlackboxWrapperOnWhitebox<StateType, ValueType>::getInitialState() {
     return stateMappingInOut.at(stateGenerationLabels.getFirstInitialState());
@@ -73,17 +91,31 @@ StateType BlackboxWrapperOnWhitebox<StateType, ValueType>::sampleSucc(StateType
     std::transform(actionRow.begin(), actionRow.end(), probabilities.begin(), [] (storm::storage::MatrixEntry<exploration_state_type, ValueType> const& entry) { return entry.getValue(); });
     std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
     StateType successor = actionRow[distribution(randomGenerator)].getColumn();
-    
-    // explore successor and add new unexplored states if necessary
-    if (explorationInformation.isUnexplored(successor)) {
-        exploreState(successor);
+    return getExternalIndex(successor);
+}
+
+template <typename StateType, typename ValueType>
+StateType BlackboxWrapperOnWhitebox<StateType, ValueType>::getExternalIndex(StateType stateIdx) {
+    // explore state and add new unexplored states if necessary
+    if (explorationInformation.isUnexplored(stateIdx)) {
+        exploreState(stateIdx);
     }
-    // if successor is returned the first time, add mapping
-    if (stateMappingInOut.find(successor) == stateMappingInOut.end()) {
-        stateMappingInOut[successor] = stateMappingInOut.size();
-        stateMappingOutIn[stateMappingInOut.at(successor)] = successor;
+    // if state is returned the first time, add mapping
+    if (stateMappingInOut.find(stateIdx) == stateMappingInOut.end()) {
+        stateMappingInOut[stateIdx] = stateMappingInOut.size();
+        stateMappingOutIn[stateMappingInOut.at(stateIdx)] = stateIdx;
     }
-    return stateMappingInOut.at(successor);
+    return stateMappingInOut.at(stateIdx);
+}
+
+template <typename StateType, typename ValueType>
+storm::storage::BitVector BlackboxWrapperOnWhitebox<StateType, ValueType>::getStateKey(StateType state) {
+    return stateKeys.at(stateMappingOutIn.at(state));
+}
+
+template <typename StateType, typename ValueType>
+StateType BlackboxWrapperOnWhitebox<StateType, ValueType>::getStateFromKey(storm::storage::BitVector const& key) {
+    return getExternalIndex(stateGenerationLabels.getOrAddStateIndex(key));
 }
 
 template <typename StateType, typename ValueType>
@@ -135,6 +167,7 @@ void BlackboxWrapperOnWhitebox<StateType, ValueType>::exploreState(StateType sta
 
     explorationInformation.assignStateToNextRowGroup(stateIdx);
     storm::generator::CompressedState comprState = unexploredIt->second;
+    stateKeys[stateIdx] = comprState;
 
     // get actions; store them and their successors in explorationInformation
     stateGenerationLabels.load(comprState);
@@ -176,6 +209,10 @@ void BlackboxWrapperOnWhitebox<StateType, ValueType>::exploreState(StateType sta
 template<typename StateType, typename ValueType>
 GreyboxWrapperOnWhitebox<StateType, ValueType>::GreyboxWrapperOnWhitebox(storm::prism::Program const& program) : BlackboxWrapperOnWhitebox<StateType, ValueType>(program) {}
 
+template<typename StateType, typename ValueType>
+GreyboxWrapperOnWhitebox<StateType, ValueType>::GreyboxWrapperOnWhitebox(storm::prism::Program const& program, std::seed_seq& seed)
+    : BlackboxWrapperOnWhitebox<StateType, ValueType>(program, seed) {}
+
 template<typename StateType, typename ValueType>
 bool GreyboxWrapperOnWhitebox<StateType, ValueType>::isGreybox() {
     return true;
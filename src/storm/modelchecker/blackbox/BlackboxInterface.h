@@ -9,6 +9,7 @@
 #include "storm/modelchecker/blackbox/storage/StateGenerationLabels.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/BitVector.h"
 #include "storm/logic/Formula.h"
 
 
@@ -95,6 +96,24 @@ class BlackboxMDP {
       */
      virtual StateType getSucCount(StateType state, StateType action);
 
+     /*!
+      * returns a key that identifies the given state independently of the order in which the states were sampled.
+      * Used to merge eMDPs that were sampled from different instances of the same MDP
+      * 
+      * @param state 
+      * @throws NotSupportedException 
+      */
+     virtual storm::storage::BitVector getStateKey(StateType state);
+
+     /*!
+      * returns the state identifier of the state with the given key (see getStateKey). 
+      * If the state was never returned before, it gets the next largest index
+      * 
+      * @param key 
+      * @throws NotSupportedException 
+      */
+     virtual StateType getStateFromKey(storm::storage::BitVector const& key);
+
      virtual ~BlackboxMDP();
 };
 
@@ -104,6 +123,11 @@ class BlackboxWrapperOnWhitebox: public BlackboxMDP<StateType, ValueType> {
 
     public:
      explicit BlackboxWrapperOnWhitebox(storm::prism::Program const& program);
+
+     /*!
+      * constructs the wrapper with a random generator that is seeded with the given seed sequence
+      */
+     BlackboxWrapperOnWhitebox(storm::prism::Program const& program, std::seed_seq& seed);
     
      /*!
       * returns the state indentifier of the initial state
@@ -164,9 +188,25 @@ class BlackboxWrapperOnWhitebox: public BlackboxMDP<StateType, ValueType> {
       */
      std::set<std::string> getActionLabels(StateType state, StateType action) override;
 
+     /*!
+      * returns the compressed state of the given state
+      */
+     storm::storage::BitVector getStateKey(StateType state) override;
+
+     /*!
+      * returns the state identifier of the given compressed state
+      */
+     StateType getStateFromKey(storm::storage::BitVector const& key) override;
+
     protected:
      void exploreState(StateType state);
 
+     /*!
+      * explores the state with the given internal index (if necessary) and returns its external index.
+      * If the state is returned the first time, it gets the next largest external index
+      */
+     StateType getExternalIndex(StateType stateIdx);
+
      storm::prism::Program program;
      storm::modelchecker::exploration_detail::ExplorationInformation<exploration_state_type, ValueType> explorationInformation;
      storm::modelchecker::exploration_detail::StateGenerationLabels<exploration_state_type, ValueType> stateGenerationLabels;
@@ -187,6 +227,7 @@ class BlackboxWrapperOnWhitebox: public BlackboxMDP<StateType, ValueType> {
 
      std::unordered_map<StateType, StateType> stateMappingInOut;  // maps internal indice to external
      std::unordered_map<StateType, StateType> stateMappingOutIn;  // maps external indice to internal
+     std::unordered_map<StateType, storm::generator::CompressedState> stateKeys;  // maps internal indice of explored states to compressed state
      std::unordered_map<std::pair<StateType, StateType>, std::set<std::string>, pairHash> actionLabels;
      std::unordered_map<StateType, std::vector<ValueType>> stateRewards;
      std::unordered_map<std::pair<StateType, StateType>, std::vector<ValueType>, pairHash> stateActionRewards;
@@ -197,6 +238,7 @@ template <typename StateType, typename ValueType>
 class GreyboxWrapperOnWhitebox: public BlackboxWrapperOnWhitebox<StateType, ValueType> {
    public:
     explicit GreyboxWrapperOnWhitebox(storm::prism::Program const& program);
+    GreyboxWrapperOnWhitebox(storm::prism::Program const& program, std::seed_seq& seed);
     bool isGreybox() override;
     StateType getSucCount(StateType state, StateType action) override;
 
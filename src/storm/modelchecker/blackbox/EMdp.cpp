@@ -9,7 +9,7 @@ namespace modelchecker {
 namespace blackbox {
 
 template<typename StateType>
-EMdp<StateType>::EMdp() : hashStorage(), stateLabeling() {
+EMdp<StateType>::EMdp() : compactStorage(), stateLabeling() {
 }
 
 //_______________________ EMdp File I/O ___________________________ //
@@ -114,7 +114,7 @@ template<typename StateType>
 void EMdp<StateType>::print() {
     std::cout << "\nInitial State: " << initState << "\n";
     std::cout << "explored EMdp:\n";
-    hashStorage.print();
+    compactStorage.print();
 }
 
 //_______________________ Add states to EMdp ___________________________ //
@@ -122,7 +122,7 @@ void EMdp<StateType>::print() {
 template<typename StateType>
 void EMdp<StateType>::addInitialState(StateType state) {
     if(!initStateValid) {
-        hashStorage.addState(state);
+        compactStorage.addState(state);
         initState = state;
         initStateValid = true;
     }
@@ -135,22 +135,39 @@ StateType EMdp<StateType>::getInitialState() {
 
 template<typename StateType>
 void EMdp<StateType>::addState(StateType state, std::vector<StateType> availActions) {
-    hashStorage.addStateActions(state, availActions);
+    compactStorage.addStateActions(state, availActions);
 }
 
 template<typename StateType>
 void EMdp<StateType>::addVisit(StateType state, StateType action, StateType succ) {
-    hashStorage.incTrans(state, action, succ, 1);
+    compactStorage.incTrans(state, action, succ, 1);
 }
 
 template<typename StateType>
 void EMdp<StateType>::addVisits(StateType state, StateType action, StateType succ, uint64_t visits) {
-    hashStorage.incTrans(state, action, succ, visits);
+    compactStorage.incTrans(state, action, succ, visits);
 }
 
 template<typename StateType>
 void EMdp<StateType>::addUnsampledAction(StateType state, StateType action) {
-    hashStorage.addUnsampledAction(state, action);
+    compactStorage.addUnsampledAction(state, action);
+}
+
+template<typename StateType>
+void EMdp<StateType>::join(EMdp<StateType> const& other, std::vector<StateType> const& stateMapping) {
+    if(other.initStateValid) {
+        addInitialState(stateMapping[other.initState]);
+    }
+    compactStorage.join(other.compactStorage, stateMapping);
+
+    for(auto const& stateLabels : other.stateLabeling) {
+        for(auto const& label : stateLabels.second)
+            addStateLabel(label, stateMapping[stateLabels.first]);
+    }
+    for(auto const& actionLabels : other.actionLabeling) {
+        for(auto const& label : actionLabels.second)
+            addActionLabel(label, stateMapping[actionLabels.first.first], actionLabels.first.second);
+    }
 }
 
 
@@ -220,71 +237,76 @@ std::vector<std::string> EMdp<StateType>::getActionLabels(StateType state, State
 
 template<typename StateType>
 bool EMdp<StateType>::isStateKnown(StateType state) {
-    return hashStorage.stateExists(state);
+    return compactStorage.stateExists(state);
 }
 
 template<typename StateType>
 StateType EMdp<StateType>::getTotalStateCount() {
-    return hashStorage.getTotalStateCount();
+    return compactStorage.getTotalStateCount();
 }
 
 template<typename StateType>
 StateType EMdp<StateType>::gettotalStateActionPairCount() {
-    return hashStorage.gettotalStateActionPairCount();
+    return compactStorage.gettotalStateActionPairCount();
 }
 
 template<typename StateType>
 StateType EMdp<StateType>::getTotalTransitionCount() {
-    return hashStorage.getTotalTransitionCount();
+    return compactStorage.getTotalTransitionCount();
 }
 
 template<typename StateType>
 uint64_t EMdp<StateType>::getSampleCount(StateType state, StateType action) {
-    return hashStorage.getTotalSamples(state, action);
+    return compactStorage.getTotalSamples(state, action);
 }
 
 template<typename StateType>
 uint64_t EMdp<StateType>::getSampleCount(StateType state, StateType action, StateType succ) {
-    return hashStorage.getSuccSamples(state, action, succ);
+    return compactStorage.getSuccSamples(state, action, succ);
 }
 
 template<typename StateType>
 void EMdp<StateType>::setSuccCount(StateType state, StateType action, int count) {
-    hashStorage.setSuccCount(std::make_pair(state, action), count);
+    compactStorage.setSuccCount(std::make_pair(state, action), count);
 }
 
 template<typename StateType>
 int EMdp<StateType>::getSuccCount(StateType state, StateType action) {
-    return hashStorage.getSuccCount(std::make_pair(state, action));
+    return compactStorage.getSuccCount(std::make_pair(state, action));
 }
 
 //___________________________ Get Iterators ____________________________//
 
 template<typename StateType>
-storage::KeyIterator<StateType> EMdp<StateType>::getStateItr() {
-    return hashStorage.getStateItr();
+typename storage::CompactStorage<StateType>::StateIterator EMdp<StateType>::getStateItr() {
+    return compactStorage.getStateItr();
 }
 
 template<typename StateType>
-storage::KeyIterator<StateType> EMdp<StateType>::getStateActionsItr(StateType state) {
-    return hashStorage.getStateActionsItr(state);
+typename storage::CompactStorage<StateType>::ActionIterator EMdp<StateType>::getStateActionsItr(StateType state) {
+    return compactStorage.getStateActionsItr(state);
 }
 
 template<typename StateType>
-storage::KeyIterator<StateType> EMdp<StateType>::getStateActionsSuccItr(StateType state, StateType action) {
-    return hashStorage.getStateActionsSuccItr(state, action);
+typename storage::CompactStorage<StateType>::SuccessorIterator EMdp<StateType>::getStateActionsSuccItr(StateType state, StateType action) {
+    return compactStorage.getStateActionsSuccItr(state, action);
 }
 
 //__________________________ Create and acces reverse mapping ________________________________//
 
 template<typename StateType>
 void EMdp<StateType>::createReverseMapping() {
-    hashStorage.createReverseMapping(); 
+    compactStorage.createReverseMapping(); 
 }
 
 template<typename StateType>
 std::vector<std::pair<StateType, StateType> > EMdp<StateType>::getPredecessors(StateType state) {  
-    return hashStorage.getPredecessors(state);
+    return compactStorage.getPredecessors(state);
+}
+
+template<typename StateType>
+storm::storage::SparseMatrix<uint64_t> EMdp<StateType>::createSampleCountMatrix() {
+    return compactStorage.createSampleCountMatrix();
 }
 
 template class EMdp<uint32_t>;
@@ -7,7 +7,7 @@
 #include <boost/functional/hash.hpp>
 
 
-#include "storage/HashStorage.h"
+#include "storage/CompactStorage.h"
 
 
 namespace storm {
@@ -18,7 +18,7 @@ namespace blackbox {
 template<typename StateType>
 class EMdp {
    private:
-    storage::HashStorage<StateType> hashStorage; //store all the states and labeling 
+    storage::CompactStorage<StateType> compactStorage; //store all the states and transitions 
     std::unordered_map<StateType, std::vector<std::string> > stateLabeling; //store the state labeling 
     typedef std::pair<StateType, StateType> stateTypePair; 
     std::unordered_map<stateTypePair, std::vector<std::string>, boost::hash<stateTypePair> > actionLabeling; //store the action labeling 
@@ -71,6 +71,16 @@ class EMdp {
 
     void addVisits(StateType state, StateType action, StateType succ, uint64_t visits);
 
+    /*!
+     * Adds all states, visits and labels of the other EMdp to this EMdp.
+     * The states of the other EMdp are renamed according to the given mapping, i.e., state s of the other EMdp becomes stateMapping[s].
+     * The initial state of the other EMdp is only taken over if this EMdp does not have one yet.
+     * 
+     * @param other 
+     * @param stateMapping 
+     */
+    void join(EMdp<StateType> const& other, std::vector<StateType> const& stateMapping);
+
     /*!
      * Add action that is reachable from the state to the emdp, without having to add a successor state 
      * (because the successor state might not have been sampled yet)
@@ -217,31 +227,35 @@ class EMdp {
     //? Save to disk
 
     /*!
-     * Returns a KeyIterator over the states 
+     * Returns an iterator over the states 
      * 
-     * @return KeyIterator<StateType> 
      */
-    storage::KeyIterator<StateType> getStateItr();
+    typename storage::CompactStorage<StateType>::StateIterator getStateItr();
 
     /*!
-     * Returns a KeyIterator over the actions of a state
+     * Returns an iterator over the actions of a state
      * 
      * @param state 
-     * @return KeyIterator<StateType> 
      */
-    storage::KeyIterator<StateType> getStateActionsItr(StateType state);
+    typename storage::CompactStorage<StateType>::ActionIterator getStateActionsItr(StateType state);
 
     /*!
-     * Returns a KeyIterator over the successor of a state for a given action 
+     * Returns an iterator over the successor of a state for a given action 
      * 
      * @param state 
      * @param action 
-     * @return KeyIterator<StateType> 
      */
-    storage::KeyIterator<StateType> getStateActionsSuccItr(StateType state, StateType action);
+    typename storage::CompactStorage<StateType>::SuccessorIterator getStateActionsSuccItr(StateType state, StateType action);
     
     void createReverseMapping();
 
+    /*!
+     * Creates a matrix with the sample counts of all transitions.
+     * There is one row group for every state (in the order in which they were added) with one row for each action (in ascending order).
+     * Columns refer to the position of the successor state in that order.
+     */
+    storm::storage::SparseMatrix<uint64_t> createSampleCountMatrix();
+
     /**
      * @brief Get the (state,action) predecessor vector of state
      * 
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/blackbox/Infer.h"
 
+#include <tuple>
+
 #include "storm/storage/SparseMatrix.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -62,9 +64,80 @@ void transferActionInformation(storm::models::sparse::ChoiceLabeling &choiceLabe
  */
 template <typename IndexType, typename ValueType, typename StateType>
 BMdp<ValueType> infer(EMdp<IndexType> &emdp, BoundFunc<ValueType> &boundFunc, DeltaDistribution<IndexType> &valueFunc, double pmin, double delta, bool isGreybox, std::shared_ptr<storm::modelchecker::blackbox::BlackboxMDP<StateType, ValueType>> interface){
+    IncrementalInfer<IndexType, ValueType, StateType> incrementalInfer(boundFunc, valueFunc, pmin, delta, isGreybox, interface);
+    return incrementalInfer.infer(emdp);
+}
+
+template <typename IndexType, typename ValueType, typename StateType>
+IncrementalInfer<IndexType, ValueType, StateType>::IncrementalInfer(BoundFunc<ValueType> &boundFunc, DeltaDistribution<IndexType> &valueFunc, double pmin,
+                                                                    double delta, bool isGreybox,
+                                                                    std::shared_ptr<storm::modelchecker::blackbox::BlackboxMDP<StateType, ValueType>> interface)
+    : boundFunc(boundFunc), valueFunc(valueFunc), pmin(pmin), delta(delta), isGreybox(isGreybox), interface(interface) {
+    // intentionally empty
+}
+
+template <typename IndexType, typename ValueType, typename StateType>
+BMdp<ValueType> const& IncrementalInfer<IndexType, ValueType, StateType>::infer(EMdp<IndexType> &emdp) {
+    //initialise value function with eMDP
+    valueFunc.initialiseFor(emdp, delta);
+    numberOfRecomputedPairs = 0;
+
+    // if nothing was added, the structure of the BMdp stays the same (states, actions and transitions are never removed)
+    bool sameStructure = bmdp && stateCount == emdp.getTotalStateCount() && stateActionPairCount == emdp.gettotalStateActionPairCount() &&
+                         transitionCount == emdp.getTotalTransitionCount();
+    if(!sameStructure || !updateInPlace(emdp)){
+        rebuild(emdp);
+    }
+    return *bmdp;
+}
 
-    using Bounds = storm::utility::ValuePair<ValueType>;
+template <typename IndexType, typename ValueType, typename StateType>
+uint64_t IncrementalInfer<IndexType, ValueType, StateType>::getNumberOfRecomputedPairs() const {
+    return numberOfRecomputedPairs;
+}
+
+template <typename IndexType, typename ValueType, typename StateType>
+bool IncrementalInfer<IndexType, ValueType, StateType>::updateInPlace(EMdp<IndexType> &emdp) {
+    auto &matrix = bmdp->getTransitionMatrix();
+
+    // collect the outdated rows first, so that the BMdp stays unchanged if it has to be rebuilt
+    std::vector<std::tuple<IndexType, IndexType, uint64_t>> outdatedRows;
+    uint64_t row = 0;
+    for(IndexType state = 0; state < emdp.getTotalStateCount(); state++){
+        for(auto actItr = emdp.getStateActionsItr(state); actItr.hasNext(); row++){
+            auto action = actItr.next();
+            uint64_t actionSamples = emdp.getSampleCount(state, action);
+            if(isRowUpToDate(emdp, state, action, actionSamples, row)){
+                continue;
+            }
+            // as no transitions were added, the successors are the same (and the pair was sampled before)
+            uint64_t sampledSuccessors = 0;
+            for(auto targetItr = emdp.getStateActionsSuccItr(state, action); targetItr.hasNext(); targetItr.next()){
+                sampledSuccessors++;
+            }
+            bool hasDummyTransition = (matrix.end(row) - 1)->getColumn() == stateCount;
+            if(needsDummyTransition(emdp, state, action, actionSamples, sampledSuccessors) != hasDummyTransition){
+                return false;
+            }
+            outdatedRows.emplace_back(state, action, row);
+        }
+    }
+
+    for(auto const &[state, action, outdatedRow] : outdatedRows){
+        uint64_t actionSamples = emdp.getSampleCount(state, action);
+        rowSamples[outdatedRow] = actionSamples;
+        auto entryIt = matrix.begin(outdatedRow);
+        uint64_t entry = entryIt - matrix.begin();
+        for(auto targetItr = emdp.getStateActionsSuccItr(state, action); targetItr.hasNext(); ++entryIt, ++entry){
+            entryIt->setValue(computeInterval(emdp, state, action, targetItr.next(), actionSamples, entryDeltas[entry]));
+        }
+        numberOfRecomputedPairs++;
+    }
+    return true;
+}
 
+template <typename IndexType, typename ValueType, typename StateType>
+void IncrementalInfer<IndexType, ValueType, StateType>::rebuild(EMdp<IndexType> &emdp) {
     //Because of the dummy state both the state and action label need to be copied as it is not possible to change the item count of a labeling
     storm::models::sparse::StateLabeling stateLabeling(emdp.getTotalStateCount() + 1);
     storm::models::sparse::ChoiceLabeling choiceLabeling(emdp.gettotalStateActionPairCount() + 1);
@@ -84,8 +157,11 @@ BMdp<ValueType> infer(EMdp<IndexType> &emdp, BoundFunc<ValueType> &boundFunc, De
 
     IndexType dummy_state = emdp.getTotalStateCount(); //put dummy state at the last index
 
-    //initialise value function with eMDP
-    valueFunc.initialiseFor(emdp, delta);
+    std::vector<IndexType> newRowActions;
+    std::vector<uint64_t> newRowSamples;
+    std::vector<double> newEntryDeltas;
+    newRowActions.reserve(emdp.gettotalStateActionPairCount());
+    newRowSamples.reserve(emdp.gettotalStateActionPairCount());
 
     int currentRow = 0;
 
@@ -94,49 +170,57 @@ BMdp<ValueType> infer(EMdp<IndexType> &emdp, BoundFunc<ValueType> &boundFunc, De
 
         transferStateInformation(emdp.getStateLabels(state), stateLabeling, state, interface->getStateRewards(state), rewards);
 
+        // rows of this state in the previous BMdp, actions are sorted in both
+        uint64_t previousRow = 0;
+        uint64_t previousRowGroupEnd = 0;
+        if(bmdp && state < stateCount){
+            previousRow = bmdp->getTransitionMatrix().getRowGroupIndices()[state];
+            previousRowGroupEnd = bmdp->getTransitionMatrix().getRowGroupIndices()[state + 1];
+        }
+
         for(auto actItr = emdp.getStateActionsItr(state); actItr.hasNext();) {
             auto action = actItr.next();
-            int actionSamples = emdp.getSampleCount(state,action);
-
-            int sampledSuccessors = 0; //For determining if we sampled all successors of a greybox MDP
+            uint64_t actionSamples = emdp.getSampleCount(state,action);
 
             transferActionInformation(choiceLabeling, currentRow, emdp.getActionLabels(state, action), rewards,
                                       interface->getStateActionRewards(state, action));
+            newRowActions.push_back(action);
+            newRowSamples.push_back(actionSamples);
 
-            if (actionSamples == 0) {
+            while(previousRow < previousRowGroupEnd && rowActions[previousRow] < action){
+                previousRow++;
+            }
+            if(previousRow < previousRowGroupEnd && rowActions[previousRow] == action && isRowUpToDate(emdp, state, action, actionSamples, previousRow)){
+                // copy the intervals of the previous round, only the index of the dummy state changes
+                auto const &previousMatrix = bmdp->getTransitionMatrix();
+                uint64_t entry = previousMatrix.begin(previousRow) - previousMatrix.begin();
+                for(auto const &matrixEntry : previousMatrix.getRow(previousRow)){
+                    IndexType column = matrixEntry.getColumn() == stateCount ? dummy_state : matrixEntry.getColumn();
+                    matrixBuilder.addNextValue(currentRow, column, matrixEntry.getValue());
+                    newEntryDeltas.push_back(entryDeltas[entry++]);
+                }
+            } else if (actionSamples == 0) {
                 // Account for unsampled actions: one transition to dummy state (interval [1,1])
                 matrixBuilder.addNextValue(currentRow,dummy_state,storm::utility::ValuePair(std::make_pair(1.0,1.0)));
+                newEntryDeltas.push_back(-1);
+                numberOfRecomputedPairs++;
             } else {
+                uint64_t sampledSuccessors = 0; //For determining if we sampled all successors of a greybox MDP
                 for(auto targetItr = emdp.getStateActionsSuccItr(state,action); targetItr.hasNext();){
                     auto target_state = targetItr.next();
                     sampledSuccessors++;
 
-                    //Small optimisation: if we know that there is only one successor, we do not need to calculate anything and just set the interval to [1,1]
-                    if(isGreybox && emdp.getSuccCount(state,action) == 1){
-                        matrixBuilder.addNextValue(currentRow, target_state, storm::utility::ValuePair(std::make_pair(1.0,1.0)));
-                    } else {
-                        // delta assigned to this transition
-                        double delta_transition = valueFunc.getDeltaT(state, action, target_state);
-                        int samples = emdp.getSampleCount(state, action, target_state);
-                        auto interval = boundFunc.INTERVAL(actionSamples, samples, delta_transition);
-
-                        matrixBuilder.addNextValue(currentRow, target_state, storm::utility::ValuePair(std::move(interval)));
-                    }
+                    double delta_transition;
+                    matrixBuilder.addNextValue(currentRow, target_state, computeInterval(emdp, state, action, target_state, actionSamples, delta_transition));
+                    newEntryDeltas.push_back(delta_transition);
                 }
 
                 // account for unsampled successors: transition to dummy state with the interval [0, 1]
-                if(!isGreybox){
-                    //blackbox: skip if this state action pair has been sampled enough times
-                    int requiredSamples =floor( log(delta) / log(1 - pmin));
-                    if(actionSamples <= requiredSamples){
-                        matrixBuilder.addNextValue(currentRow,dummy_state,storm::utility::ValuePair(std::make_pair(ValueType{0},ValueType{1})));
-                    }
-                } else {
-                    //greybox: skip if we got all successors
-                    if(sampledSuccessors < emdp.getSuccCount(state,action)){
-                        matrixBuilder.addNextValue(currentRow,dummy_state,storm::utility::ValuePair(std::make_pair(ValueType{0},ValueType{1})));
-                    }
+                if(needsDummyTransition(emdp, state, action, actionSamples, sampledSuccessors)){
+                    matrixBuilder.addNextValue(currentRow,dummy_state,storm::utility::ValuePair(std::make_pair(ValueType{0},ValueType{1})));
+                    newEntryDeltas.push_back(-1);
                 }
+                numberOfRecomputedPairs++;
             }
 
             currentRow++;
@@ -150,6 +234,7 @@ BMdp<ValueType> infer(EMdp<IndexType> &emdp, BoundFunc<ValueType> &boundFunc, De
     stateLabeling.addUniqueLabel("dummy_state", v);
     //one action with one transition to itself (interval [1,1])
     matrixBuilder.addNextValue(currentRow,dummy_state,storm::utility::ValuePair(std::make_pair(ValueType{1},ValueType{1})));
+    newEntryDeltas.push_back(-1);
 
     for(auto & reward : rewards){
         reward.setStateReward(dummy_state, ValueType(NAN));
@@ -166,10 +251,62 @@ BMdp<ValueType> infer(EMdp<IndexType> &emdp, BoundFunc<ValueType> &boundFunc, De
     storm::storage::sparse::ModelComponents<Bounds, storm::models::sparse::StandardRewardModel<ValueType> > components{matrixBuilder.build(),std::move(stateLabeling), std::move(rewardMap)};
     components.choiceLabeling = std::move(choiceLabeling);
 
-    return BMdp<ValueType>(components);
+    bmdp.emplace(std::move(components));
+    stateCount = emdp.getTotalStateCount();
+    stateActionPairCount = emdp.gettotalStateActionPairCount();
+    transitionCount = emdp.getTotalTransitionCount();
+    rowActions = std::move(newRowActions);
+    rowSamples = std::move(newRowSamples);
+    entryDeltas = std::move(newEntryDeltas);
+}
+
+template <typename IndexType, typename ValueType, typename StateType>
+bool IncrementalInfer<IndexType, ValueType, StateType>::isRowUpToDate(EMdp<IndexType> &emdp, IndexType state, IndexType action, uint64_t actionSamples,
+                                                                      uint64_t previousRow) {
+    if(!bmdp || rowSamples[previousRow] != actionSamples){
+        return false;
+    }
+    // the successors are the same as in the previous round, as every new successor increases the samples
+    auto const &previousMatrix = bmdp->getTransitionMatrix();
+    uint64_t entry = previousMatrix.begin(previousRow) - previousMatrix.begin();
+    for(auto targetItr = emdp.getStateActionsSuccItr(state, action); targetItr.hasNext(); entry++){
+        auto target_state = targetItr.next();
+        if(entryDeltas[entry] != -1 && valueFunc.getDeltaT(state, action, target_state) != entryDeltas[entry]){
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename IndexType, typename ValueType, typename StateType>
+bool IncrementalInfer<IndexType, ValueType, StateType>::needsDummyTransition(EMdp<IndexType> &emdp, IndexType state, IndexType action, uint64_t actionSamples,
+                                                                             uint64_t sampledSuccessors) const {
+    if(!isGreybox){
+        //blackbox: skip if this state action pair has been sampled enough times
+        int requiredSamples =floor( log(delta) / log(1 - pmin));
+        return static_cast<int64_t>(actionSamples) <= requiredSamples;
+    }
+    //greybox: skip if we got all successors
+    return static_cast<int>(sampledSuccessors) < emdp.getSuccCount(state,action);
+}
 
+template <typename IndexType, typename ValueType, typename StateType>
+typename IncrementalInfer<IndexType, ValueType, StateType>::Bounds IncrementalInfer<IndexType, ValueType, StateType>::computeInterval(
+    EMdp<IndexType> &emdp, IndexType state, IndexType action, IndexType target, uint64_t actionSamples, double &usedDelta) {
+    //Small optimisation: if we know that there is only one successor, we do not need to calculate anything and just set the interval to [1,1]
+    if(isGreybox && emdp.getSuccCount(state,action) == 1){
+        usedDelta = -1;
+        return storm::utility::ValuePair(std::make_pair(1.0,1.0));
+    }
+    // delta assigned to this transition
+    usedDelta = valueFunc.getDeltaT(state, action, target);
+    uint64_t samples = emdp.getSampleCount(state, action, target);
+    return storm::utility::ValuePair(boundFunc.INTERVAL(actionSamples, samples, usedDelta));
 }
 
 
 template BMdp<double> infer<uint32_t, double, uint32_t>(EMdp<uint32_t> &emdp, BoundFunc<double> &boundFunc, DeltaDistribution<uint32_t> &valueFunc, double pmin, double delta, bool isBlackbox, std::shared_ptr<storm::modelchecker::blackbox::BlackboxMDP<uint32_t, double>>);
 template BMdp<double> infer<uint64_t, double, uint64_t>(EMdp<uint64_t> &emdp, BoundFunc<double> &boundFunc, DeltaDistribution<uint64_t> &valueFunc, double pmin, double delta, bool isBlackbox, std::shared_ptr<storm::modelchecker::blackbox::BlackboxMDP<uint64_t, double>>);
+
+template class IncrementalInfer<uint32_t, double, uint32_t>;
+template class IncrementalInfer<uint64_t, double, uint64_t>;
@@ -1,4 +1,5 @@
 #pragma once
+#include <optional>
 #include <utility>
 #include "BlackboxInterface.h"
 #include "modelchecker/blackbox/BMdp.h"
@@ -11,3 +12,74 @@ using storm::models::sparse::BMdp;
 template <typename IndexType, typename ValueType, typename StateType>
 BMdp<ValueType> infer(EMdp<IndexType> &emdp, BoundFunc<ValueType> &boundFunc, DeltaDistribution<IndexType> &valueFunc, double pmin, double delta, bool isGreybox, std::shared_ptr<storm::modelchecker::blackbox::BlackboxMDP<StateType, ValueType>>);
 
+/*!
+ * Infers BMdps from an eMDP that is extended over several rounds of simulation. The result coincides with the one of infer.
+ * The BMdp of the previous round is kept and the intervals are only recomputed for state action pairs whose samples (or deltas) changed.
+ * If no states, actions or transitions were added, the transition matrix of the previous round is updated in place and its labels and rewards are
+ * reused. Otherwise the BMdp is rebuilt, but the intervals of unchanged state action pairs are copied from the previous round.
+ */
+template <typename IndexType, typename ValueType, typename StateType>
+class IncrementalInfer {
+   public:
+    IncrementalInfer(BoundFunc<ValueType> &boundFunc, DeltaDistribution<IndexType> &valueFunc, double pmin, double delta, bool isGreybox,
+                     std::shared_ptr<storm::modelchecker::blackbox::BlackboxMDP<StateType, ValueType>> interface);
+
+    /*!
+     * Infers the BMdp for the given eMDP, which has to extend the eMDPs of previous calls (i.e. states, actions and samples were only added)
+     * @param emdp the current simulation data
+     * @return the inferred BMdp, which stays valid (and is updated) until the next call of infer
+     */
+    BMdp<ValueType> const& infer(EMdp<IndexType> &emdp);
+
+    /*!
+     * Returns the number of state action pairs whose intervals were computed in the last call of infer
+     */
+    uint64_t getNumberOfRecomputedPairs() const;
+
+   private:
+    using Bounds = storm::utility::ValuePair<ValueType>;
+
+    /*!
+     * Updates the intervals of the previous BMdp in place. Returns false (and leaves the BMdp unchanged) if this is not possible
+     * because a transition to the dummy state was added or removed
+     */
+    bool updateInPlace(EMdp<IndexType> &emdp);
+
+    /*!
+     * Builds a new BMdp, copying the intervals of unchanged state action pairs from the previous BMdp
+     */
+    void rebuild(EMdp<IndexType> &emdp);
+
+    /*!
+     * Returns true if the intervals of the given row of the previous BMdp are still valid for the state action pair, i.e. if the pair has
+     * the same number of samples and all of its transitions have the same delta as before
+     */
+    bool isRowUpToDate(EMdp<IndexType> &emdp, IndexType state, IndexType action, uint64_t actionSamples, uint64_t previousRow);
+
+    /*!
+     * Returns true if the (sampled) state action pair needs a transition to the dummy state for its unsampled successors
+     */
+    bool needsDummyTransition(EMdp<IndexType> &emdp, IndexType state, IndexType action, uint64_t actionSamples, uint64_t sampledSuccessors) const;
+
+    /*!
+     * Computes the interval of a transition and returns the delta that was used (or -1 if the interval is exact)
+     */
+    Bounds computeInterval(EMdp<IndexType> &emdp, IndexType state, IndexType action, IndexType target, uint64_t actionSamples, double &usedDelta);
+
+    BoundFunc<ValueType> &boundFunc;
+    DeltaDistribution<IndexType> &valueFunc;
+    double pmin;
+    double delta;
+    bool isGreybox;
+    std::shared_ptr<storm::modelchecker::blackbox::BlackboxMDP<StateType, ValueType>> interface;
+
+    // the BMdp of the previous round and the information its intervals were computed with
+    std::optional<BMdp<ValueType>> bmdp;
+    IndexType stateCount = 0;
+    IndexType stateActionPairCount = 0;
+    IndexType transitionCount = 0;
+    std::vector<IndexType> rowActions;  // action of each row (without the dummy row)
+    std::vector<uint64_t> rowSamples;   // samples of each row (without the dummy row)
+    std::vector<double> entryDeltas;    // delta of each entry of the transition matrix (-1 if the interval is exact)
+    uint64_t numberOfRecomputedPairs = 0;
+};
@@ -3,6 +3,11 @@
 //
 
 #include "storm/modelchecker/blackbox/Simulator.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/modelchecker/blackbox/BlackboxInterface.h"
 #include "storm/modelchecker/blackbox/EMdp.h"
 
@@ -17,23 +22,74 @@ Simulator<StateType, ValueType>::Simulator(std::shared_ptr<BlackboxMDP<StateType
 }
 
 template <typename StateType, typename ValueType>
-void Simulator<StateType, ValueType>::simulate(EMdp<StateType>& emdp, StateType numExplorations) {
-    StateActionStack stack;
-    StateType maxPathLen = 10; // TODO magicNumber, collect constants
+void Simulator<StateType, ValueType>::addWorker(std::shared_ptr<BlackboxMDP<StateType, ValueType>> blackboxMDP,
+                                                std::shared_ptr<heuristicSim::HeuristicSim<StateType, ValueType>> heuristicSim) {
+    workers.push_back(Worker{blackboxMDP, heuristicSim, {}});
+}
 
+template <typename StateType, typename ValueType>
+void Simulator<StateType, ValueType>::simulate(EMdp<StateType>& emdp, StateType numExplorations) {
     // set initial state
     emdp.addInitialState(blackboxMdp->getInitialState());
     // safe highest stateIdx, to later update new states
     StateType latestExploredState = emdp.getTotalStateCount() - 1;
 
+    if (workers.empty()) {
+        simulatePaths(*blackboxMdp, *heuristicSim, emdp, numExplorations, 0);
+    } else {
+        // every worker samples its share of the paths in its own emdp
+        std::vector<EMdp<StateType>> workerEmdps(workers.size());
+        StateType knownStateCount = emdp.getTotalStateCount();
+        auto simulateWorkers = [&](uint64_t begin, uint64_t end) {
+            for (uint64_t w = begin; w < end; w++) {
+                StateType workerExplorations = numExplorations / workers.size() + (w < numExplorations % workers.size() ? 1 : 0);
+                workerEmdps[w].addInitialState(workers[w].blackboxMdp->getInitialState());
+                simulatePaths(*workers[w].blackboxMdp, *workers[w].heuristicSim, workerEmdps[w], workerExplorations, knownStateCount);
+            }
+        };
+#ifdef STORM_HAVE_INTELTBB
+        tbb::task_arena arena(static_cast<int>(workers.size()));
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, workers.size(), 1),
+                              [&](tbb::blocked_range<uint64_t> const& range) { simulateWorkers(range.begin(), range.end()); });
+        });
+#else
+        simulateWorkers(0, workers.size());
+#endif
+        // join in a fixed order, so that the state indices do not depend on the scheduling of the workers
+        for (uint64_t w = 0; w < workers.size(); w++) {
+            joinWorkerEMdp(emdp, workers[w], workerEmdps[w]);
+        }
+    }
+
+    // set labels of new states
+    for (StateType i = latestExploredState; i < emdp.getTotalStateCount(); i++) {
+        for (auto const &label: blackboxMdp->getStateLabels(i))
+        emdp.addStateLabel(label, i);
+        // action labels
+        for (StateType a = 0; a < blackboxMdp->getAvailActions(i); a++) {
+            for (auto& label: blackboxMdp->getActionLabels(i, a)) {
+                emdp.addActionLabel(label, i, a);
+            }
+        }
+    }
+}
+
+template <typename StateType, typename ValueType>
+void Simulator<StateType, ValueType>::simulatePaths(BlackboxMDP<StateType, ValueType>& mdp,
+                                                    heuristicSim::HeuristicSim<StateType, ValueType>& heuristic,
+                                                    EMdp<StateType>& emdp, StateType numExplorations, StateType knownStateCount) {
+    StateActionStack stack;
+    StateType maxPathLen = 10; // TODO magicNumber, collect constants
+
     for (StateType i = 0; i < numExplorations; i++) {
-        stack.push_back(std::make_pair(blackboxMdp->getInitialState(), 0));
+        stack.push_back(std::make_pair(mdp.getInitialState(), 0));
         ActionType actionTaken;
         StateType suc;
         // do exploration
-        while (stack.size() < maxPathLen && !heuristicSim->shouldStopSim(stack)) {
-            actionTaken = heuristicSim->sampleAction(stack);
-            suc = blackboxMdp->sampleSucc((stack.back().first), actionTaken);
+        while (stack.size() < maxPathLen && !heuristic.shouldStopSim(stack)) {
+            actionTaken = heuristic.sampleAction(stack);
+            suc = mdp.sampleSucc((stack.back().first), actionTaken);
 
             // save in stack
             stack.back().second = actionTaken;
@@ -48,11 +104,11 @@ void Simulator<StateType, ValueType>::simulate(EMdp<StateType>& emdp, StateType
             state = stack.back().first;
             if (!emdp.isStateKnown(state)) {
                 // init State with all actions in emdp
-                for (StateType action = 0; action < blackboxMdp->getAvailActions(state); action++) {
+                for (StateType action = 0; action < mdp.getAvailActions(state); action++) {
                     emdp.addUnsampledAction(state, action);
 
-                    if(blackboxMdp->isGreybox()){
-                        emdp.setSuccCount(state, action, blackboxMdp->getSucCount(state, action));
+                    if(mdp.isGreybox()){
+                        emdp.setSuccCount(state, action, mdp.getSucCount(state, action));
                     }
                 }
 
@@ -66,20 +122,23 @@ void Simulator<StateType, ValueType>::simulate(EMdp<StateType>& emdp, StateType
         }
 
         // update maxPathLen
-        maxPathLen = 3 * emdp.getTotalStateCount();  // TODO magic number; collect constants
+        maxPathLen = 3 * std::max(knownStateCount, emdp.getTotalStateCount());  // TODO magic number; collect constants
     }
+}
 
-    // set labels of new states
-    for (StateType i = latestExploredState; i < emdp.getTotalStateCount(); i++) {
-        for (auto const &label: blackboxMdp->getStateLabels(i))
-        emdp.addStateLabel(label, i);
-        // action labels
-        for (StateType a = 0; a < blackboxMdp->getAvailActions(i); a++) {
-            for (auto& label: blackboxMdp->getActionLabels(i, a)) {
-                emdp.addActionLabel(label, i, a);
-            }
+template <typename StateType, typename ValueType>
+void Simulator<StateType, ValueType>::joinWorkerEMdp(EMdp<StateType>& emdp, Worker& worker, EMdp<StateType>& workerEmdp) {
+    // translate new states of the worker via their keys, the translation of previously seen states is reused
+    for (auto stateItr = workerEmdp.getStateItr(); stateItr.hasNext();) {
+        StateType state = stateItr.next();
+        if (state >= worker.stateMapping.size()) {
+            worker.stateMapping.resize(state + 1, std::numeric_limits<StateType>::max());
+        }
+        if (worker.stateMapping[state] == std::numeric_limits<StateType>::max()) {
+            worker.stateMapping[state] = blackboxMdp->getStateFromKey(worker.blackboxMdp->getStateKey(state));
         }
     }
+    emdp.join(workerEmdp, worker.stateMapping);
 }
 
 template class Simulator<uint32_t, double>;
@@ -23,8 +23,22 @@ class Simulator {
      */
     Simulator(std::shared_ptr<BlackboxMDP<StateType, ValueType>> blackboxMDP, std::shared_ptr<heuristicSim::HeuristicSim<StateType, ValueType>> heuristicSim);
 
+    /*!
+     * adds a worker that samples paths in parallel to the other workers.
+     * Every worker needs its own instance of the blackboxMDP and heuristicSim, which has to support getStateKey.
+     * As soon as a worker is added, all paths are sampled by the workers and the blackboxMDP of the simulator is only used to
+     * translate the states of the workers (via getStateFromKey)
+     *
+     * @param blackboxMDP
+     * @param heuristicSim
+     */
+    void addWorker(std::shared_ptr<BlackboxMDP<StateType, ValueType>> blackboxMDP,
+                   std::shared_ptr<heuristicSim::HeuristicSim<StateType, ValueType>> heuristicSim);
+
     /*!
      * simulate paths in the blackboxMDP and stores the visits in the given emdp
+     * If workers were added, every worker samples its share of the paths in its own emdp. The emdps of the workers are joined in the order
+     * in which the workers were added, so the result only depends on the seeds of the workers and their number
      *
      * @param emdp
      * @param numExploration number of paths to explore
@@ -32,8 +46,37 @@ class Simulator {
     void simulate(EMdp<StateType>& emdp, StateType numExplorations);
 
    private:
+    struct Worker {
+        std::shared_ptr<BlackboxMDP<StateType, ValueType>> blackboxMdp;
+        std::shared_ptr<heuristicSim::HeuristicSim<StateType, ValueType>> heuristicSim;
+        // maps the states of the worker to the states of the simulator (or -1 if not yet translated)
+        std::vector<StateType> stateMapping;
+    };
+
+    /*!
+     * simulate paths in the blackboxMDP and stores the visits in the given emdp
+     *
+     * @param mdp
+     * @param heuristic
+     * @param emdp
+     * @param numExploration number of paths to explore
+     * @param knownStateCount number of states that are known in total, used to bound the length of the paths
+     */
+    static void simulatePaths(BlackboxMDP<StateType, ValueType>& mdp, heuristicSim::HeuristicSim<StateType, ValueType>& heuristic,
+                              EMdp<StateType>& emdp, StateType numExplorations, StateType knownStateCount);
+
+    /*!
+     * translates the states of the emdp of the worker to states of the simulator and adds the emdp of the worker to the given emdp
+     *
+     * @param emdp
+     * @param worker
+     * @param workerEmdp
+     */
+    void joinWorkerEMdp(EMdp<StateType>& emdp, Worker& worker, EMdp<StateType>& workerEmdp);
+
     std::shared_ptr<BlackboxMDP<StateType, ValueType>> blackboxMdp;
     std::shared_ptr<heuristicSim::HeuristicSim<StateType, ValueType>> heuristicSim;
+    std::vector<Worker> workers;
 };
 
 }  // namespace blackbox
@@ -0,0 +1,398 @@
+#include "storm/modelchecker/blackbox/storage/CompactStorage.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace storm {
+namespace modelchecker {
+namespace blackbox {
+namespace storage {
+
+namespace {
+/*!
+ * Returns the binary logarithm of the smallest power of two that is at least the given (positive) number
+ */
+uint64_t capacityClass(uint64_t minimalCapacity) {
+    uint64_t result = 0;
+    while ((1ull << result) < minimalCapacity) {
+        ++result;
+    }
+    return result;
+}
+
+/*!
+ * Returns the position of the first entry in the given range whose key is not smaller than the given key
+ */
+template<typename EntryType, typename StateType>
+uint64_t lowerBound(EntryType const* begin, uint32_t size, StateType key) {
+    return std::lower_bound(begin, begin + size, key, [](EntryType const& entry, StateType const& key) { return entry.key < key; }) - begin;
+}
+}  // namespace
+
+template<typename StateType>
+CompactStorage<StateType>::CompactStorage() {
+    // Intentionally left empty.
+}
+
+//__________________ Internal helpers _____________________________//
+
+template<typename StateType>
+typename CompactStorage<StateType>::StateEntry* CompactStorage<StateType>::findState(StateType state) {
+    auto it = stateIndices.find(state);
+    return it == stateIndices.end() ? nullptr : &states[it->second];
+}
+
+template<typename StateType>
+typename CompactStorage<StateType>::ActionEntry* CompactStorage<StateType>::findAction(StateType state, StateType action) {
+    StateEntry const* stateEntry = findState(state);
+    if (stateEntry == nullptr) {
+        return nullptr;
+    }
+    ActionEntry* begin = actionPool.data() + stateEntry->actions.offset;
+    uint64_t position = lowerBound(begin, stateEntry->actions.size, action);
+    if (position == stateEntry->actions.size || begin[position].key != action) {
+        return nullptr;
+    }
+    return begin + position;
+}
+
+template<typename StateType>
+uint64_t CompactStorage<StateType>::getOrAddStateIndex(StateType state) {
+    auto insertionResult = stateIndices.try_emplace(state, states.size());
+    if (insertionResult.second) {
+        states.push_back(StateEntry{state, Segment()});
+    }
+    return insertionResult.first->second;
+}
+
+template<typename StateType>
+typename CompactStorage<StateType>::ActionEntry& CompactStorage<StateType>::getOrAddAction(uint64_t stateIndex, StateType action) {
+    Segment& actions = states[stateIndex].actions;
+    uint64_t position = lowerBound(actionPool.data() + actions.offset, actions.size, action);
+    if (position < actions.size && actionPool[actions.offset + position].key == action) {
+        return actionPool[actions.offset + position];
+    }
+    ++totalStateActionPairCount;
+    return insertIntoSegment(actionPool, freeActionSegments, actions, position, ActionEntry{action, 0, -1, Segment()});
+}
+
+template<typename StateType>
+template<typename EntryType>
+void CompactStorage<StateType>::relocateSegment(std::vector<EntryType>& pool, std::vector<std::vector<uint64_t>>& freeSegments, Segment& segment,
+                                                uint32_t minimalCapacity) {
+    uint64_t newClass = capacityClass(minimalCapacity);
+    uint64_t newOffset;
+    if (newClass < freeSegments.size() && !freeSegments[newClass].empty()) {
+        newOffset = freeSegments[newClass].back();
+        freeSegments[newClass].pop_back();
+    } else {
+        newOffset = pool.size();
+        pool.resize(pool.size() + (1ull << newClass));
+    }
+    std::copy(pool.begin() + segment.offset, pool.begin() + segment.offset + segment.size, pool.begin() + newOffset);
+    if (segment.capacity > 0) {
+        uint64_t oldClass = capacityClass(segment.capacity);
+        if (freeSegments.size() <= oldClass) {
+            freeSegments.resize(oldClass + 1);
+        }
+        freeSegments[oldClass].push_back(segment.offset);
+    }
+    segment.offset = newOffset;
+    segment.capacity = 1u << newClass;
+}
+
+template<typename StateType>
+template<typename EntryType>
+EntryType& CompactStorage<StateType>::insertIntoSegment(std::vector<EntryType>& pool, std::vector<std::vector<uint64_t>>& freeSegments, Segment& segment,
+                                                        uint64_t position, EntryType const& entry) {
+    if (segment.size == segment.capacity) {
+        relocateSegment(pool, freeSegments, segment, std::max<uint32_t>(2, 2 * segment.capacity));
+    }
+    auto begin = pool.begin() + segment.offset;
+    std::copy_backward(begin + position, begin + segment.size, begin + segment.size + 1);
+    begin[position] = entry;
+    ++segment.size;
+    return begin[position];
+}
+
+//__________________ Add states and actions to Datastructure __________//
+
+template<typename StateType>
+void CompactStorage<StateType>::addState(StateType state) {
+    getOrAddStateIndex(state);
+}
+
+template<typename StateType>
+void CompactStorage<StateType>::addStateActions(StateType state, std::vector<StateType> actions) {
+    uint64_t stateIndex = getOrAddStateIndex(state);
+    if (states[stateIndex].actions.size == 0 && !actions.empty()) {
+        // Reserve the space for all actions at once
+        relocateSegment(actionPool, freeActionSegments, states[stateIndex].actions, actions.size());
+        for (auto action : actions) {
+            getOrAddAction(stateIndex, action);
+        }
+    }
+}
+
+template<typename StateType>
+void CompactStorage<StateType>::addUnsampledAction(StateType state, StateType action) {
+    getOrAddAction(getOrAddStateIndex(state), action);
+}
+
+template<typename StateType>
+void CompactStorage<StateType>::incTrans(StateType state, StateType action, StateType succ, uint64_t samples) {
+    uint64_t stateIndex = getOrAddStateIndex(state);  // add state to data if it doesn't exist
+    getOrAddStateIndex(succ);                         // add succ to data if it doesn't exist
+
+    ActionEntry& actionEntry = getOrAddAction(stateIndex, action);
+    actionEntry.samples += samples;  // Increment the total samples for the action
+
+    Segment& successors = actionEntry.successors;
+    uint64_t position = lowerBound(successorPool.data() + successors.offset, successors.size, succ);
+    if (position < successors.size && successorPool[successors.offset + position].key == succ) {
+        successorPool[successors.offset + position].samples += samples;  // Increments the samples for the (state,action,succ) triple
+    } else {
+        ++totalTransitionCount;
+        insertIntoSegment(successorPool, freeSuccessorSegments, successors, position, SuccessorEntry{succ, samples});
+    }
+}
+
+//__________________ Access the Datastructure via Vectors _________________//
+
+template<typename StateType>
+std::vector<StateType> CompactStorage<StateType>::getStateVec() {
+    std::vector<StateType> stateVec;
+    stateVec.reserve(states.size());
+    for (auto const& stateEntry : states) {
+        stateVec.push_back(stateEntry.key);
+    }
+    return stateVec;
+}
+
+template<typename StateType>
+std::vector<StateType> CompactStorage<StateType>::getStateActionVec(StateType state) {
+    std::vector<StateType> actionVec;
+    for (auto actionItr = getStateActionsItr(state); actionItr.hasNext();) {
+        actionVec.push_back(actionItr.next());
+    }
+    return actionVec;
+}
+
+template<typename StateType>
+std::vector<StateType> CompactStorage<StateType>::getStateActionSuccVec(StateType state, StateType action) {
+    std::vector<StateType> succVec;
+    for (auto succItr = getStateActionsSuccItr(state, action); succItr.hasNext();) {
+        succVec.push_back(succItr.next());
+    }
+    return succVec;
+}
+
+//__________________ Access the Datastructure via Iterators _________________//
+
+template<typename StateType>
+typename CompactStorage<StateType>::StateIterator CompactStorage<StateType>::getStateItr() {
+    return StateIterator(states.data(), states.data() + states.size());
+}
+
+template<typename StateType>
+typename CompactStorage<StateType>::ActionIterator CompactStorage<StateType>::getStateActionsItr(StateType state) {
+    StateEntry const* stateEntry = findState(state);
+    if (stateEntry == nullptr) {
+        return ActionIterator();
+    }
+    ActionEntry const* begin = actionPool.data() + stateEntry->actions.offset;
+    return ActionIterator(begin, begin + stateEntry->actions.size);
+}
+
+template<typename StateType>
+typename CompactStorage<StateType>::SuccessorIterator CompactStorage<StateType>::getStateActionsSuccItr(StateType state, StateType action) {
+    ActionEntry const* actionEntry = findAction(state, action);
+    if (actionEntry == nullptr) {
+        return SuccessorIterator();
+    }
+    SuccessorEntry const* begin = successorPool.data() + actionEntry->successors.offset;
+    return SuccessorIterator(begin, begin + actionEntry->successors.size);
+}
+
+//_______________________________ Access predeccesors of states ___________________________//
+
+template<typename StateType>
+void CompactStorage<StateType>::createReverseMapping() {
+    // Count the predecessors of each state first such that they can be stored contiguously
+    predecessorOffsets.assign(states.size() + 1, 0);
+    for (auto const& stateEntry : states) {
+        for (uint64_t action = stateEntry.actions.offset; action < stateEntry.actions.offset + stateEntry.actions.size; ++action) {
+            Segment const& successors = actionPool[action].successors;
+            for (uint64_t succ = successors.offset; succ < successors.offset + successors.size; ++succ) {
+                ++predecessorOffsets[stateIndices.at(successorPool[succ].key) + 1];
+            }
+        }
+    }
+    for (uint64_t stateIndex = 0; stateIndex < states.size(); ++stateIndex) {
+        predecessorOffsets[stateIndex + 1] += predecessorOffsets[stateIndex];
+    }
+    predecessors.resize(predecessorOffsets.back());
+    std::vector<uint64_t> nextPosition(predecessorOffsets.begin(), predecessorOffsets.end() - 1);
+    for (auto const& stateEntry : states) {
+        for (uint64_t action = stateEntry.actions.offset; action < stateEntry.actions.offset + stateEntry.actions.size; ++action) {
+            Segment const& successors = actionPool[action].successors;
+            for (uint64_t succ = successors.offset; succ < successors.offset + successors.size; ++succ) {
+                predecessors[nextPosition[stateIndices.at(successorPool[succ].key)]++] = std::make_pair(stateEntry.key, actionPool[action].key);
+            }
+        }
+    }
+}
+
+template<typename StateType>
+std::vector<std::pair<StateType, StateType>> CompactStorage<StateType>::getPredecessors(StateType state) {
+    auto it = stateIndices.find(state);
+    if (it == stateIndices.end() || it->second + 1 >= predecessorOffsets.size()) {
+        return std::vector<std::pair<StateType, StateType>>();
+    }
+    return std::vector<std::pair<StateType, StateType>>(predecessors.begin() + predecessorOffsets[it->second],
+                                                        predecessors.begin() + predecessorOffsets[it->second + 1]);
+}
+
+//__________________ Access seperate elements of the Datastructure _____________________//
+
+template<typename StateType>
+bool CompactStorage<StateType>::stateExists(StateType state) {
+    return stateIndices.contains(state);
+}
+
+template<typename StateType>
+StateType CompactStorage<StateType>::getTotalStateCount() {
+    return states.size();
+}
+
+template<typename StateType>
+StateType CompactStorage<StateType>::gettotalStateActionPairCount() {
+    return totalStateActionPairCount;
+}
+
+template<typename StateType>
+StateType CompactStorage<StateType>::getTotalTransitionCount() {
+    return totalTransitionCount;
+}
+
+template<typename StateType>
+uint64_t CompactStorage<StateType>::getTotalSamples(StateType state, StateType action) {
+    ActionEntry const* actionEntry = findAction(state, action);
+    return actionEntry == nullptr ? -1 : actionEntry->samples;
+}
+
+template<typename StateType>
+uint64_t CompactStorage<StateType>::getSuccSamples(StateType state, StateType action, StateType succ) {
+    ActionEntry const* actionEntry = findAction(state, action);
+    if (actionEntry == nullptr) {
+        return -1;
+    }
+    SuccessorEntry const* begin = successorPool.data() + actionEntry->successors.offset;
+    uint64_t position = lowerBound(begin, actionEntry->successors.size, succ);
+    if (position == actionEntry->successors.size || begin[position].key != succ) {
+        return -1;
+    }
+    return begin[position].samples;
+}
+
+template<typename StateType>
+void CompactStorage<StateType>::setSuccCount(std::pair<StateType, StateType> stateActionPair, int count) {
+    getOrAddAction(getOrAddStateIndex(stateActionPair.first), stateActionPair.second).succCount = count;
+}
+
+template<typename StateType>
+int CompactStorage<StateType>::getSuccCount(std::pair<StateType, StateType> stateActionPair) {
+    ActionEntry const* actionEntry = findAction(stateActionPair.first, stateActionPair.second);
+    return actionEntry == nullptr ? -1 : actionEntry->succCount;
+}
+
+//__________________ Merging _____________________//
+
+template<typename StateType>
+void CompactStorage<StateType>::join(CompactStorage<StateType> const& other, std::vector<StateType> const& stateMapping) {
+    for (auto const& otherStateEntry : other.states) {
+        uint64_t stateIndex = getOrAddStateIndex(stateMapping[otherStateEntry.key]);
+        for (uint64_t otherAction = otherStateEntry.actions.offset; otherAction < otherStateEntry.actions.offset + otherStateEntry.actions.size;
+             ++otherAction) {
+            ActionEntry const& otherActionEntry = other.actionPool[otherAction];
+            ActionEntry& actionEntry = getOrAddAction(stateIndex, otherActionEntry.key);
+            actionEntry.samples += otherActionEntry.samples;
+            if (otherActionEntry.succCount != -1) {
+                actionEntry.succCount = otherActionEntry.succCount;
+            }
+
+            Segment const& otherSuccessors = otherActionEntry.successors;
+            for (uint64_t otherSucc = otherSuccessors.offset; otherSucc < otherSuccessors.offset + otherSuccessors.size; ++otherSucc) {
+                StateType succ = stateMapping[other.successorPool[otherSucc].key];
+                uint64_t samples = other.successorPool[otherSucc].samples;
+                getOrAddStateIndex(succ);
+
+                // Successors are inserted into the segment of this storage, so the action entry is not invalidated
+                Segment& successors = actionEntry.successors;
+                uint64_t position = lowerBound(successorPool.data() + successors.offset, successors.size, succ);
+                if (position < successors.size && successorPool[successors.offset + position].key == succ) {
+                    successorPool[successors.offset + position].samples += samples;
+                } else {
+                    ++totalTransitionCount;
+                    insertIntoSegment(successorPool, freeSuccessorSegments, successors, position, SuccessorEntry{succ, samples});
+                }
+            }
+        }
+    }
+}
+
+//__________________ Conversion _____________________//
+
+template<typename StateType>
+storm::storage::SparseMatrix<uint64_t> CompactStorage<StateType>::createSampleCountMatrix() {
+    storm::storage::SparseMatrixBuilder<uint64_t> builder(totalStateActionPairCount, states.size(), totalTransitionCount, true, true, states.size());
+    uint64_t row = 0;
+    for (auto const& stateEntry : states) {
+        builder.newRowGroup(row);
+        for (uint64_t action = stateEntry.actions.offset; action < stateEntry.actions.offset + stateEntry.actions.size; ++action, ++row) {
+            Segment const& successors = actionPool[action].successors;
+            for (uint64_t succ = successors.offset; succ < successors.offset + successors.size; ++succ) {
+                builder.addNextValue(row, stateIndices.at(successorPool[succ].key), successorPool[succ].samples);
+            }
+        }
+    }
+    return builder.build();
+}
+
+template<typename StateType>
+uint64_t CompactStorage<StateType>::getAllocatedBytes() const {
+    uint64_t result = states.capacity() * sizeof(StateEntry) + actionPool.capacity() * sizeof(ActionEntry) +
+                      successorPool.capacity() * sizeof(SuccessorEntry) + stateIndices.capacity() * (sizeof(std::pair<StateType, uint64_t>) + 1);
+    for (auto const& offsets : freeActionSegments) {
+        result += offsets.capacity() * sizeof(uint64_t);
+    }
+    for (auto const& offsets : freeSuccessorSegments) {
+        result += offsets.capacity() * sizeof(uint64_t);
+    }
+    return result;
+}
+
+template<typename StateType>
+void CompactStorage<StateType>::print() {
+    std::cout << "Total state count: " << getTotalStateCount() << std::endl;
+    std::cout << "Total state action pair count: " << gettotalStateActionPairCount() << std::endl;
+    std::cout << "Total transition count: " << getTotalTransitionCount() << std::endl;
+    for (auto state : getStateVec()) {
+        std::cout << "-------------------------\n";
+        std::cout << "State: " << state << "\n";
+        for (auto action : getStateActionVec(state)) {
+            std::cout << " Action: " << action << " | Total Samples: " << getTotalSamples(state, action) << "\n";
+            for (auto succ : getStateActionSuccVec(state, action)) {
+                std::cout << "  * Succ: " << succ << " | Samples: " << getSuccSamples(state, action, succ) << "\n";
+            }
+        }
+    }
+}
+
+template class CompactStorage<uint32_t>;
+template class CompactStorage<uint64_t>;
+
+}  // namespace storage
+}  // namespace blackbox
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <parallel_hashmap/phmap.h>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace modelchecker {
+namespace blackbox {
+namespace storage {
+
+/*!
+ * Iterates over the keys of a contiguous range of entries of the compact storage.
+ * The iterator is invalidated whenever the storage is modified.
+ */
+template<typename StateType, typename EntryType>
+class EntryKeyIterator {
+   public:
+    EntryKeyIterator() : cur(nullptr), end(nullptr) {}
+    EntryKeyIterator(EntryType const* begin, EntryType const* end) : cur(begin), end(end) {}
+
+    StateType peek() const {
+        return cur->key;
+    }
+    StateType next() {
+        return (cur++)->key;
+    }
+    bool hasNext() const {
+        return cur != end;
+    }
+
+   private:
+    EntryType const* cur;
+    EntryType const* end;
+};
+
+/*!
+ * Class to store eMDPs in a compact way.
+ * The states are indexed by an open-addressing hash map. The actions of a state and the successors of a state-action pair are stored in
+ * (sorted) segments of two pooled vectors, similar to the rows of a sparse matrix. Segments grow geometrically and the space of relocated segments
+ * is reused for other segments.
+ * Compared to HashStorage, there is no memory overhead per transition apart from the sample count and lookups only touch contiguous memory.
+ * The interface coincides with the one of HashStorage. States are iterated in the order in which they were added, actions and successors in
+ * ascending order.
+ */
+template<typename StateType>
+class CompactStorage {
+   private:
+    struct Segment {
+        uint64_t offset = 0;
+        uint32_t size = 0;
+        uint32_t capacity = 0;
+    };
+
+    struct SuccessorEntry {
+        StateType key;
+        uint64_t samples;
+    };
+
+    struct ActionEntry {
+        StateType key;
+        uint64_t samples;
+        // The number of successors (only known in the greybox setting)
+        int succCount;
+        Segment successors;
+    };
+
+    struct StateEntry {
+        StateType key;
+        Segment actions;
+    };
+
+   public:
+    using StateIterator = EntryKeyIterator<StateType, StateEntry>;
+    using ActionIterator = EntryKeyIterator<StateType, ActionEntry>;
+    using SuccessorIterator = EntryKeyIterator<StateType, SuccessorEntry>;
+
+    /*!
+     * Construct empty storage
+     */
+    CompactStorage();
+
+    /*!
+     * adds state to data
+     *
+     * @param state
+     */
+    void addState(StateType state);
+
+    /*!
+     * Adds a vector of actions to the state
+     * (only if the state does not have any actions yet!)
+     *
+     * @param state
+     * @param actions
+     */
+    void addStateActions(StateType state, std::vector<StateType> actions);
+
+    /*!
+     * Add action that is reachable from the state, without having to add a successor state
+     * (because the successor state might not have been sampled yet)
+     *
+     * @param state
+     * @param action
+     */
+    void addUnsampledAction(StateType state, StateType action);
+
+    /*!
+     * Increments a transition of the form (state,action,succ) = samples
+     * If state or succ don't exists yet they get added to data
+     * Increments the total samples of the action by samples
+     *
+     * @param state
+     * @param action
+     * @param succ
+     * @param samples
+     */
+    void incTrans(StateType state, StateType action, StateType succ, uint64_t samples);
+
+    /*!
+     * Returns a vector of all states
+     */
+    std::vector<StateType> getStateVec();
+
+    /*!
+     * Returns a vector of available actions for the state
+     *
+     * @param state
+     */
+    std::vector<StateType> getStateActionVec(StateType state);
+
+    /*!
+     * Return as vector of successors for a state action pair
+     *
+     * @param state
+     * @param action
+     */
+    std::vector<StateType> getStateActionSuccVec(StateType state, StateType action);
+
+    /*!
+     * Returns an iterator over the states
+     */
+    StateIterator getStateItr();
+
+    /*!
+     * Returns an iterator over the actions of a state
+     *
+     * @param state
+     */
+    ActionIterator getStateActionsItr(StateType state);
+
+    /*!
+     * Returns an iterator over the successor of a state for a given action
+     *
+     * @param state
+     * @param action
+     */
+    SuccessorIterator getStateActionsSuccItr(StateType state, StateType action);
+
+    /*!
+     * Get the (state,action) predecessor vector of state
+     * (requires that the reverse mapping has been created)
+     *
+     * @param state
+     */
+    std::vector<std::pair<StateType, StateType>> getPredecessors(StateType state);
+
+    /*!
+     * Returns true if the passed state is in data
+     *
+     * @param state
+     */
+    bool stateExists(StateType state);
+
+    /*!
+     * Return the total number of States
+     */
+    StateType getTotalStateCount();
+
+    /*!
+     * Return the total number of state action pairs
+     */
+    StateType gettotalStateActionPairCount();
+
+    /*!
+     * Return the total number of transitions
+     */
+    StateType getTotalTransitionCount();
+
+    /*!
+     * Returns the total samples for a given state and action
+     *
+     * @param state
+     * @param action
+     */
+    uint64_t getTotalSamples(StateType state, StateType action);
+
+    /*!
+     * Returns the samples for a (state,action,succ) triple
+     *
+     * @param state
+     * @param action
+     * @param succ
+     */
+    uint64_t getSuccSamples(StateType state, StateType action, StateType succ);
+
+    /*!
+     * Set the number of successors for a (state,action) pair
+     * (used in greybox case). The pair is added if it does not exist yet.
+     *
+     * @param stateActionPair
+     * @param count
+     */
+    void setSuccCount(std::pair<StateType, StateType> stateActionPair, int count);
+
+    /*!
+     * get the number of successors for a (state,action) pair
+     * (used in greybox case)
+     *
+     * @param stateActionPair
+     */
+    int getSuccCount(std::pair<StateType, StateType> stateActionPair);
+
+    /*!
+     * Adds all states, actions and samples of the other storage to this storage.
+     * The states of the other storage are renamed according to the given mapping, i.e., state s of the other storage becomes stateMapping[s].
+     * Successor counts of the other storage overwrite the ones of this storage.
+     *
+     * @param other
+     * @param stateMapping
+     */
+    void join(CompactStorage<StateType> const& other, std::vector<StateType> const& stateMapping);
+
+    /*!
+     * Creates a mapping to the (state,action) predecessors of every state.
+     * Is generated on demand
+     * Used for the visualization of neighborhoods in eMdpToDot
+     */
+    void createReverseMapping();
+
+    /*!
+     * Creates a matrix with the sample counts of all transitions.
+     * There is one row group for every state (in the order of getStateVec()) with one row for each of its actions (in ascending order).
+     * Columns refer to the position of the successor state in getStateVec().
+     */
+    storm::storage::SparseMatrix<uint64_t> createSampleCountMatrix();
+
+    /*!
+     * Returns the number of bytes that are allocated for the stored eMDP (excluding the reverse mapping).
+     */
+    uint64_t getAllocatedBytes() const;
+
+    /*!
+     * Prints the data structure to std::cout
+     */
+    void print();
+
+   private:
+    StateEntry* findState(StateType state);
+    ActionEntry* findAction(StateType state, StateType action);
+
+    /*!
+     * Returns the index of the state, adding the state if it does not exist yet
+     */
+    uint64_t getOrAddStateIndex(StateType state);
+
+    /*!
+     * Returns the action entry of the given state, adding the action if it does not exist yet
+     */
+    ActionEntry& getOrAddAction(uint64_t stateIndex, StateType action);
+
+    /*!
+     * Inserts the given entry at the given position of the segment, growing the segment if necessary
+     */
+    template<typename EntryType>
+    EntryType& insertIntoSegment(std::vector<EntryType>& pool, std::vector<std::vector<uint64_t>>& freeSegments, Segment& segment, uint64_t position,
+                                 EntryType const& entry);
+
+    /*!
+     * Moves the entries of the segment to a free segment with (at least) the given capacity
+     */
+    template<typename EntryType>
+    void relocateSegment(std::vector<EntryType>& pool, std::vector<std::vector<uint64_t>>& freeSegments, Segment& segment, uint32_t minimalCapacity);
+
+    std::vector<StateEntry> states;
+    phmap::flat_hash_map<StateType, uint64_t> stateIndices;
+    std::vector<ActionEntry> actionPool;
+    std::vector<SuccessorEntry> successorPool;
+    // Offsets of unused segments, indexed by the binary logarithm of their capacity
+    std::vector<std::vector<uint64_t>> freeActionSegments;
+    std::vector<std::vector<uint64_t>> freeSuccessorSegments;
+
+    // The (state,action) predecessors of each state (created on demand), indexed by the position of the state
+    std::vector<uint64_t> predecessorOffsets;
+    std::vector<std::pair<StateType, StateType>> predecessors;
+
+    StateType totalStateActionPairCount = 0;
+    StateType totalTransitionCount = 0;
+};
+
+}  // namespace storage
+}  // namespace blackbox
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseDeterministicInfiniteHorizonHelper.h"
@@ -85,6 +88,66 @@ std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::com
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 }
 
+template<typename SparseCtmcModelType>
+std::vector<std::unique_ptr<CheckResult>> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, std::vector<CheckTask<storm::logic::BoundedUntilFormula, ValueType>> const& checkTasks) {
+    std::vector<std::unique_ptr<CheckResult>> results(checkTasks.size());
+    if constexpr (storm::NumberTraits<ValueType>::SupportsExponential) {
+        // The tasks with the same phi and psi states, each of which only has an upper time bound.
+        struct TaskGroup {
+            storm::storage::BitVector phiStates;
+            storm::storage::BitVector psiStates;
+            std::vector<uint64_t> taskIndices;
+            std::vector<double> upperBounds;
+        };
+        std::vector<TaskGroup> taskGroups;
+        for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+            auto const& checkTask = checkTasks[taskIndex];
+            storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
+            if (checkTask.isQualitativeSet() || pathFormula.isMultiDimensional() || !pathFormula.getTimeBoundReference().isTimeBound() ||
+                pathFormula.hasLowerBound() || !pathFormula.hasUpperBound()) {
+                continue;
+            }
+
+            std::unique_ptr<CheckResult> leftResultPointer = this->check(env, pathFormula.getLeftSubformula());
+            std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
+            storm::storage::BitVector const& phiStates = leftResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            storm::storage::BitVector const& psiStates = rightResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            auto taskGroupIt = std::find_if(taskGroups.begin(), taskGroups.end(), [&phiStates, &psiStates](TaskGroup const& taskGroup) {
+                return taskGroup.phiStates == phiStates && taskGroup.psiStates == psiStates;
+            });
+            if (taskGroupIt == taskGroups.end()) {
+                taskGroups.push_back(TaskGroup{phiStates, psiStates, {}, {}});
+                taskGroupIt = std::prev(taskGroups.end());
+            }
+            taskGroupIt->taskIndices.push_back(taskIndex);
+            taskGroupIt->upperBounds.push_back(pathFormula.getNonStrictUpperBound<double>());
+        }
+
+        for (auto const& taskGroup : taskGroups) {
+            // A single time bound is treated individually below, which allows to only consider the relevant values.
+            if (taskGroup.taskIndices.size() < 2) {
+                continue;
+            }
+            STORM_LOG_INFO("Computing the probabilities for " << taskGroup.upperBounds.size() << " time bounds in a single pass.");
+            std::vector<std::vector<ValueType>> numericResults =
+                storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+                    env, this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), taskGroup.phiStates, taskGroup.psiStates,
+                    this->getModel().getExitRateVector(), taskGroup.upperBounds);
+            for (uint64_t index = 0; index < taskGroup.taskIndices.size(); ++index) {
+                results[taskGroup.taskIndices[index]] = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(numericResults[index]));
+            }
+        }
+    }
+
+    for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+        if (!results[taskIndex]) {
+            results[taskIndex] = this->computeBoundedUntilProbabilities(env, checkTasks[taskIndex]);
+        }
+    }
+    return results;
+}
+
 template<typename SparseCtmcModelType>
 std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeNextProbabilities(
     Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
@@ -56,6 +56,16 @@ class SparseCtmcCslModelChecker : public SparsePropositionalModelChecker<SparseC
     virtual std::unique_ptr<CheckResult> computeTotalRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
                                                              CheckTask<storm::logic::TotalRewardFormula, ValueType> const& checkTask) override;
 
+    /*!
+     * Computes the probabilities of the given time-bounded until formulas. Formulas that only have an upper time bound and whose subformulas are
+     * satisfied by the same states are treated together, i.e., the transient probabilities for all of their time bounds are computed in a single
+     * pass. All other formulas are checked individually.
+     *
+     * @return The results of the given check tasks (in the same order).
+     */
+    std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilitiesForTimeBounds(
+        Environment const& env, std::vector<CheckTask<storm::logic::BoundedUntilFormula, ValueType>> const& checkTasks);
+
     /*!
      * Compute transient probabilities for all states.
      */
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <boost/optional.hpp>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -9,6 +11,7 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/KrylovExponentialHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
@@ -277,6 +280,70 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
+    std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_WARN_COND(!env.solver().timeBounded().getRelativeTerminationCriterion(),
+                        "Computation of transient probabilities with relative precision not supported. Using absolute precision instead.");
+    for (auto const& upperBound : upperBounds) {
+        STORM_LOG_THROW(upperBound >= 0.0 && upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidPropertyException,
+                        "Time bounds must be finite and non-negative.");
+    }
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    // Initially, all psi states have probability one.
+    std::vector<ValueType> initialResult(numberOfStates, storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+    std::vector<std::vector<ValueType>> results(upperBounds.size(), initialResult);
+
+    // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+    // further computations.
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+    if (statesWithProbabilityGreater0NonPsi.empty()) {
+        return results;
+    }
+
+    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+    ValueType uniformizationRate = 0;
+    for (auto state : statesWithProbabilityGreater0NonPsi) {
+        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+    }
+    uniformizationRate *= 1.02;
+    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+    // Compute the uniformized matrix.
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
+        computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+    // Compute the vector that is to be added as a compensation for removing the absorbing states.
+    std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+    for (auto& element : b) {
+        element /= uniformizationRate;
+    }
+
+    // Finally compute the transient probabilities for all time bounds at once.
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(upperBounds.size());
+    for (auto const& upperBound : upperBounds) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+    }
+    std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+    std::vector<std::vector<ValueType>> subresults =
+        computeTransientProbabilitiesForTimeBounds(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < upperBounds.size(); ++timeBoundIndex) {
+        storm::utility::vector::setVectorValues(results[timeBoundIndex], statesWithProbabilityGreater0NonPsi, subresults[timeBoundIndex]);
+    }
+    return results;
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -657,6 +724,13 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
                                                                           storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
                                                                           std::vector<ValueType> const* addVector, ValueType timeBound,
                                                                           ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    if (!useMixedPoissonProbabilities) {
+        return std::move(
+            computeTransientProbabilitiesForTimeBounds<ValueType>(env, uniformizedMatrix, addVector, {timeBound}, uniformizationRate, values, epsilon).front());
+    }
+    STORM_LOG_WARN_COND(env.solver().timeBounded().getCtmcMethod() != storm::solver::CtmcTransientMethod::Krylov,
+                        "Krylov subspace method is not supported for cumulative rewards. Using uniformization instead.");
+
     STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
                         "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
     ValueType lambda = timeBound * uniformizationRate;
@@ -671,14 +745,11 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
     // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
 
-    // If the cumulative reward is to be computed, we need to adjust the weights.
-    if (useMixedPoissonProbabilities) {
-        ValueType sum = storm::utility::zero<ValueType>();
-
-        for (auto& element : foxGlynnResult.weights) {
-            sum += element;
-            element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
-        }
+    // As the cumulative reward is to be computed, we need to adjust the weights.
+    ValueType sum = storm::utility::zero<ValueType>();
+    for (auto& element : foxGlynnResult.weights) {
+        sum += element;
+        element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
     }
 
     STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
@@ -691,36 +762,28 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         storm::utility::vector::scaleVectorInPlace(result, foxGlynnResult.weights.front());
         ++startingIteration;
     } else {
-        if (useMixedPoissonProbabilities) {
-            result = std::vector<ValueType>(values.size());
-            std::function<ValueType(ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate](ValueType const& a) -> ValueType {
-                return a / uniformizationRate;
-            };
-            storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
-        } else {
-            result = std::vector<ValueType>(values.size());
-        }
+        result = std::vector<ValueType>(values.size());
+        std::function<ValueType(ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate](ValueType const& a) -> ValueType {
+            return a / uniformizationRate;
+        };
+        storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
     }
 
     auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
-    if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
-        // Perform the matrix-vector multiplications (without adding).
-        multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
-    } else if (useMixedPoissonProbabilities) {
-        std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate](ValueType const& a, ValueType const& b) {
-            return a + b / uniformizationRate;
-        };
-
-        // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
-        for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-            multiplier->multiply(env, values, nullptr, values);
-            storm::utility::vector::applyPointwise(result, values, result, addAndScale);
-        }
-        // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
-        // between the left and right truncation point, we scale them here with the total sum of the weights.
-        // Note that we divide with this value afterwards. This is to improve numerical stability.
-        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, foxGlynnResult.totalWeight);
+    std::function<ValueType(ValueType const&, ValueType const&)> addAndScaleWithUniformizationRate = [&uniformizationRate](ValueType const& a,
+                                                                                                                          ValueType const& b) {
+        return a + b / uniformizationRate;
+    };
+
+    // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
+    for (uint_fast64_t index = 1; index < startingIteration; ++index) {
+        multiplier->multiply(env, values, nullptr, values);
+        storm::utility::vector::applyPointwise(result, values, result, addAndScaleWithUniformizationRate);
     }
+    // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
+    // between the left and right truncation point, we scale them here with the total sum of the weights.
+    // Note that we divide with this value afterwards. This is to improve numerical stability.
+    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, foxGlynnResult.totalWeight);
 
     // For the indices that fall in between the truncation points, we need to perform the matrix-vector
     // multiplication, scale and add the result.
@@ -738,6 +801,125 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+    std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+    if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::Krylov) {
+        STORM_LOG_WARN_COND(!env.solver().isForceSoundness(), "The Krylov subspace method relies on error estimates and does not yield sound results.");
+        storm::solver::helper::KrylovExponentialHelper<ValueType> krylovHelper(env, uniformizedMatrix, addVector, uniformizationRate,
+                                                                               env.solver().timeBounded().getKrylovDimension());
+        return krylovHelper.computeTransientValues(timeBounds, values, epsilon);
+    }
+
+    // Use Fox-Glynn to get the truncation points and the weights of every time bound. The iterations are shared by all time bounds, so we need
+    // as many iterations as the largest right truncation point.
+    std::vector<std::vector<ValueType>> results(timeBounds.size(), std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>()));
+    std::vector<boost::optional<storm::utility::numerical::FoxGlynnResult<ValueType>>> foxGlynnResults(timeBounds.size());
+    uint64_t numberOfIterations = 0;
+    bool timeCanPass = false;
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        ValueType lambda = timeBounds[timeBoundIndex] * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            // If no time can pass, the initial values are the result.
+            results[timeBoundIndex] = values;
+        } else {
+            foxGlynnResults[timeBoundIndex] = storm::utility::numerical::foxGlynn(lambda, epsilon);
+            STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[timeBoundIndex] << ": left=" << foxGlynnResults[timeBoundIndex]->left
+                                                                      << ", right=" << foxGlynnResults[timeBoundIndex]->right);
+            numberOfIterations = std::max<uint64_t>(numberOfIterations, foxGlynnResults[timeBoundIndex]->right);
+            timeCanPass = true;
+        }
+    }
+    if (!timeCanPass) {
+        return results;
+    }
+
+    // The differences between the values of successive iterations never increase if the matrix is substochastic. Depending on whether the rows
+    // (backward computation) or the columns (forward computation) sum up to at most one, this holds for the maximum norm or the sum norm. Thus,
+    // if the values barely change anymore, the values of all remaining iterations are close to the current ones and we can stop early.
+    bool detectSteadyState = env.solver().timeBounded().isSteadyStateDetectionSet();
+    bool useMaximumNorm = false;
+    if (detectSteadyState) {
+        ValueType const tolerance = storm::utility::convertNumber<ValueType>(1e-12);
+        ValueType maximalRowSum = storm::utility::zero<ValueType>();
+        std::vector<ValueType> columnSums(uniformizedMatrix.getColumnCount(), storm::utility::zero<ValueType>());
+        for (uint64_t row = 0; row < uniformizedMatrix.getRowCount(); ++row) {
+            ValueType rowSum = storm::utility::zero<ValueType>();
+            for (auto const& entry : uniformizedMatrix.getRow(row)) {
+                rowSum += entry.getValue();
+                columnSums[entry.getColumn()] += entry.getValue();
+            }
+            maximalRowSum = std::max(maximalRowSum, rowSum);
+        }
+        ValueType maximalColumnSum = storm::utility::zero<ValueType>();
+        for (auto const& columnSum : columnSums) {
+            maximalColumnSum = std::max(maximalColumnSum, columnSum);
+        }
+        useMaximumNorm = maximalRowSum <= storm::utility::one<ValueType>() + tolerance;
+        detectSteadyState = useMaximumNorm || maximalColumnSum <= storm::utility::one<ValueType>() + tolerance;
+        STORM_LOG_INFO_COND(detectSteadyState, "Steady-state detection is disabled as the uniformized matrix is not substochastic.");
+    }
+
+    STORM_LOG_DEBUG("Starting " << numberOfIterations << " iterations with " << uniformizedMatrix.getRowCount() << " x "
+                                << uniformizedMatrix.getColumnCount() << " matrix for " << timeBounds.size() << " time bound(s).");
+
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    std::vector<ValueType> nextValues(values.size());
+    for (uint64_t iteration = 0;; ++iteration) {
+        // Add the values of the current iteration to the result of every time bound whose truncation window contains the iteration.
+        for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+            auto const& foxGlynnResult = foxGlynnResults[timeBoundIndex];
+            if (foxGlynnResult && foxGlynnResult->left <= iteration && iteration <= foxGlynnResult->right) {
+                storm::utility::vector::addScaledVector(results[timeBoundIndex], values, foxGlynnResult->weights[iteration - foxGlynnResult->left]);
+            }
+        }
+        if (iteration == numberOfIterations) {
+            break;
+        }
+
+        multiplier->multiply(env, values, addVector, nextValues);
+
+        if (detectSteadyState && iteration + 1 < numberOfIterations) {
+            ValueType difference = storm::utility::zero<ValueType>();
+            for (uint64_t index = 0; index < values.size(); ++index) {
+                ValueType const elementDifference = storm::utility::abs<ValueType>(nextValues[index] - values[index]);
+                difference = useMaximumNorm ? std::max(difference, elementDifference) : difference + elementDifference;
+            }
+            // The values of every later iteration differ by at most (number of further iterations) * difference from the next values. As the
+            // weights are normalized, this also bounds the error of replacing all later values by the next values.
+            if (difference * storm::utility::convertNumber<ValueType>(numberOfIterations - iteration - 1) <= epsilon) {
+                STORM_LOG_INFO("Detected steady state in the computation of transient probabilities after " << (iteration + 1) << " of "
+                                                                                                             << numberOfIterations << " iterations.");
+                for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+                    auto const& foxGlynnResult = foxGlynnResults[timeBoundIndex];
+                    if (foxGlynnResult && iteration < foxGlynnResult->right) {
+                        ValueType remainingWeight = storm::utility::zero<ValueType>();
+                        for (uint64_t index = std::max<uint64_t>(iteration + 1, foxGlynnResult->left); index <= foxGlynnResult->right; ++index) {
+                            remainingWeight += foxGlynnResult->weights[index - foxGlynnResult->left];
+                        }
+                        storm::utility::vector::addScaledVector(results[timeBoundIndex], nextValues, remainingWeight);
+                    }
+                }
+                break;
+            }
+        }
+        std::swap(values, nextValues);
+    }
+
+    // Finally, divide the results by the total weights.
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        if (foxGlynnResults[timeBoundIndex]) {
+            storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(results[timeBoundIndex],
+                                                                             storm::utility::one<ValueType>() / foxGlynnResults[timeBoundIndex]->totalWeight);
+        }
+    }
+    return results;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -835,6 +1017,15 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
+
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates,
+    std::vector<double> const& upperBounds);
+
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -38,6 +38,19 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of satisfying phi U[0,t] psi for each of the given time bounds t. All time bounds are handled by a single
+     * sequence of matrix-vector multiplications, so a series of time points is not more expensive than the largest one.
+     *
+     * @param upperBounds The (finite) time bounds.
+     * @return For each time bound, the probabilities of all states.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(
+        Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
+        std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -142,6 +155,29 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for multiple time bounds at once. The matrix-vector multiplications are shared by all time bounds, i.e.,
+     * the number of multiplications is given by the largest (right) Fox-Glynn truncation point. If the values of successive iterations barely
+     * change, a steady state is detected and the remaining iterations are skipped (unless disabled in the environment).
+     * If the Krylov subspace method is selected in the environment, the transient probabilities are instead computed via Krylov subspace
+     * projections of the matrix exponential, whose cost does not grow linearly with the time bounds.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBounds The time bounds to use.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points
+     * @return For each time bound, the vector of transient probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilitiesForTimeBounds(Environment const& env,
+                                                                                         storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                         std::vector<ValueType> const* addVector,
+                                                                                         std::vector<ValueType> const& timeBounds, ValueType uniformizationRate,
+                                                                                         std::vector<ValueType> values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
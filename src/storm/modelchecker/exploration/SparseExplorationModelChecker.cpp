@@ -26,6 +26,8 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/ExplorationSettings.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
@@ -38,11 +40,33 @@
 namespace storm {
 namespace modelchecker {
 
+namespace detail {
+template<typename StateType, typename ValueType>
+std::vector<std::vector<storm::storage::MatrixEntry<StateType, ValueType>>> getChoices(storm::generator::StateBehavior<ValueType, StateType> const& behavior) {
+    std::vector<std::vector<storm::storage::MatrixEntry<StateType, ValueType>>> choices;
+    choices.reserve(behavior.getNumberOfChoices());
+    for (auto const& choice : behavior) {
+        choices.emplace_back();
+        for (auto const& entry : choice) {
+            choices.back().emplace_back(entry.first, entry.second);
+        }
+    }
+    return choices;
+}
+}  // namespace detail
+
 template<typename ModelType, typename StateType>
 SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
+    : SparseExplorationModelChecker(program, storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads)
     : program(program.substituteConstantsFormulas()),
       randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
-      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()),
+      numberOfThreads(numberOfThreads) {
     // Intentionally left empty.
 }
 
@@ -68,6 +92,9 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     // The first row group starts at action 0.
     explorationInformation.newRowGroup(0);
 
+    // The cached rows refer to the actions of a previous exploration.
+    samplingCache.clear();
+
     std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
     StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation,
                                                           conditionFormula.toExpression(program.getManager(), labelToExpressionMapping),
@@ -81,6 +108,10 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
 template<typename ModelType, typename StateType>
 std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performExploration(
     StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
+    if (isParallelExplorationEnabled()) {
+        return performParallelExploration(stateGeneration, explorationInformation);
+    }
+
     // Generate the initial state so we know where to start the simulation.
     stateGeneration.computeInitialStates();
     STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
@@ -136,6 +167,297 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                            bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
 }
 
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::isParallelExplorationEnabled() const {
+    if (numberOfThreads == 1) {
+        return false;
+    }
+#ifdef STORM_HAVE_INTELTBB
+    return true;
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    return false;
+#endif
+}
+
+template<typename ModelType, typename StateType>
+std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType>
+SparseExplorationModelChecker<ModelType, StateType>::performParallelExploration(
+    StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
+#ifdef STORM_HAVE_INTELTBB
+    // Generate the initial state so we know where to start the simulation.
+    stateGeneration.computeInitialStates();
+    STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
+                    "Currently only models with one initial state are supported by the exploration engine.");
+    StateType initialStateIndex = stateGeneration.getFirstInitialState();
+
+    Bounds<StateType, ValueType> bounds;
+    Statistics<StateType, ValueType> stats;
+
+    // Paths that get stuck in an end component are aborted after this many steps.
+    uint64_t const maxPathLength = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfExplorationStepsUntilPrecomputation();
+
+    auto explore = [&]() {
+        uint64_t const numberOfWorkers = tbb::this_task_arena::max_concurrency();
+        stateGeneration.prepareConcurrentExpansion(numberOfWorkers);
+
+        // Each thread uses its own sampling cache. The random number generators are associated with the paths of a batch (rather than the threads),
+        // such that the sampled paths do not depend on the scheduling of the threads.
+        std::vector<storm::storage::SuccessorSamplingCache<ValueType>> caches(numberOfWorkers);
+        std::vector<std::default_random_engine> generators;
+        for (uint64_t pathIndex = 0; pathIndex < numberOfWorkers; ++pathIndex) {
+            generators.emplace_back(randomGenerator());
+        }
+        std::vector<SampledPath> paths(numberOfWorkers);
+
+        // The stack of the current path and the states and actions of all paths of the batch (needed for local precomputations).
+        StateActionStack stack;
+        StateActionStack batchStack;
+
+        bool convergenceCriterionMet = false;
+        while (!convergenceCriterionMet) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, paths.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                uint64_t const thread = tbb::this_task_arena::current_thread_index();
+                for (uint64_t pathIndex = range.begin(); pathIndex < range.end(); ++pathIndex) {
+                    samplePathConcurrently(thread, stateGeneration, explorationInformation, bounds, generators[pathIndex], caches[thread], maxPathLength,
+                                           paths[pathIndex]);
+                }
+            });
+
+            // Add the explored states and update the bounds along the paths in the order of the paths.
+            bool pathAborted = false;
+            batchStack.clear();
+            for (auto& path : paths) {
+                mergeSampledPath(stateGeneration, path, explorationInformation, bounds, stats, stack);
+                stats.sampledPath();
+                stats.updateMaxPathLength(stack.size());
+                batchStack.insert(batchStack.end(), stack.begin(), stack.end());
+
+                if (path.foundTerminalState) {
+                    STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                    updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+                } else {
+                    STORM_LOG_TRACE("Did not find terminal state.");
+                    pathAborted = true;
+                }
+                stack.clear();
+            }
+
+            STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates
+                                                  << " explored, " << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
+            STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
+                                                             << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
+            ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+            STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
+            convergenceCriterionMet = comparator.isZero(difference);
+
+            // Aborted paths are stuck in end components, so we perform a precomputation to detect them.
+            if (!convergenceCriterionMet) {
+                bool excessiveExplorationSteps =
+                    explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation);
+                bool excessiveSampledPaths = explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation);
+                if (pathAborted || excessiveExplorationSteps || excessiveSampledPaths) {
+                    performPrecomputation(batchStack, explorationInformation, bounds, stats);
+                }
+            }
+        }
+    };
+    if (numberOfThreads == 0) {
+        explore();
+    } else {
+        tbb::task_arena arena(static_cast<int>(numberOfThreads));
+        arena.execute(explore);
+    }
+
+    // Show statistics if required.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        stats.printToStream(std::cout, explorationInformation);
+    }
+
+    return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation),
+                           bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parallel exploration requires Intel TBB.");
+#endif
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::samplePathConcurrently(
+    uint64_t thread, StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType> const& explorationInformation,
+    Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator, storm::storage::SuccessorSamplingCache<ValueType>& cache,
+    uint64_t maxPathLength, SampledPath& path) const {
+    path.steps.clear();
+    path.localStates.clear();
+    path.localStateIndices = storm::storage::BitVectorHashMap<StateType>(stateGeneration.getStateSize(), 100);
+    path.foundTerminalState = false;
+
+    // Start the search from the initial state. The current state is local iff it was not explored before the path was sampled.
+    StateType currentState = stateGeneration.getFirstInitialState();
+    bool local = false;
+    while (path.steps.size() < maxPathLength) {
+        if (!local) {
+            // As the exploration information must not be modified concurrently, unexplored states are explored locally.
+            auto unexploredIt = explorationInformation.findUnexploredState(currentState);
+            if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                currentState = getOrAddLocalState(stateGeneration, unexploredIt->second, path);
+                local = true;
+                continue;
+            }
+
+            if (explorationInformation.isTerminal(currentState)) {
+                path.steps.push_back({currentState, 0, false});
+                path.foundTerminalState = true;
+                break;
+            }
+
+            ActionType chosenAction = sampleActionOfState(currentState, explorationInformation, bounds, generator);
+            path.steps.push_back({currentState, chosenAction, false});
+            currentState = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, generator, cache);
+        } else {
+            expandLocalState(thread, stateGeneration, currentState, path);
+            LocalState const& localState = path.localStates[currentState];
+            if (localState.isTerminalState) {
+                path.steps.push_back({currentState, 0, true});
+                path.foundTerminalState = true;
+                break;
+            }
+
+            // As the bounds of the choices of local states are not known yet, all choices are equally good.
+            std::uniform_int_distribution<ActionType> distribution(0, localState.choices.size() - 1);
+            ActionType chosenChoice = distribution(generator);
+            path.steps.push_back({currentState, chosenChoice, true});
+            StateType successor = sampleSuccessorOfLocalState(localState, chosenChoice, explorationInformation, bounds, generator, path);
+
+            // If the successor was already explored, the path continues in the explored part of the state space.
+            LocalState const& successorState = path.localStates[successor];
+            if (successorState.index && !explorationInformation.isUnexplored(successorState.index.get())) {
+                currentState = successorState.index.get();
+                local = false;
+            } else {
+                currentState = successor;
+            }
+        }
+    }
+}
+
+template<typename ModelType, typename StateType>
+StateType SparseExplorationModelChecker<ModelType, StateType>::getOrAddLocalState(StateGeneration<StateType, ValueType> const& stateGeneration,
+                                                                                  storm::generator::CompressedState const& state, SampledPath& path) const {
+    StateType newIndex = path.localStates.size();
+    StateType index = path.localStateIndices.findOrAdd(state, newIndex);
+    if (index == newIndex) {
+        LocalState localState;
+        localState.state = state;
+        localState.index = stateGeneration.findStateIndex(state);
+        path.localStates.push_back(std::move(localState));
+    }
+    return index;
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::expandLocalState(uint64_t thread, StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                           StateType const& localState, SampledPath& path) const {
+    if (path.localStates[localState].expanded) {
+        return;
+    }
+
+    // The generator refers to the loaded state, so we need a copy that is not moved when new local states are added.
+    storm::generator::CompressedState state = path.localStates[localState].state;
+    stateGeneration.load(thread, state);
+    bool isTargetState = stateGeneration.isTargetState(thread);
+    bool isConditionState = !isTargetState && stateGeneration.isConditionState(thread);
+    ChoiceList choices;
+    if (isConditionState) {
+        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand(
+            thread, [this, &stateGeneration, &path](storm::generator::CompressedState const& successor) {
+                return getOrAddLocalState(stateGeneration, successor, path);
+            });
+        choices = detail::getChoices(behavior);
+    }
+
+    LocalState& expandedState = path.localStates[localState];
+    expandedState.expanded = true;
+    expandedState.isTargetState = isTargetState;
+    expandedState.isConditionState = isConditionState;
+    // As in the sequential exploration, states all of whose transitions are self-loops are terminal.
+    auto isSelfLoop = [&localState](storm::storage::MatrixEntry<StateType, ValueType> const& entry) { return entry.getColumn() == localState; };
+    expandedState.isTerminalState = !isConditionState || std::all_of(choices.begin(), choices.end(), [&isSelfLoop](auto const& choice) {
+                                        return std::all_of(choice.begin(), choice.end(), isSelfLoop);
+                                    });
+    expandedState.choices = std::move(choices);
+}
+
+template<typename ModelType, typename StateType>
+StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorOfLocalState(
+    LocalState const& localState, ActionType const& choice, ExplorationInformation<StateType, ValueType> const& explorationInformation,
+    Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator, SampledPath const& path) const {
+    std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = localState.choices[choice];
+    if (row.size() == 1) {
+        return row.front().getColumn();
+    }
+
+    if (explorationInformation.useUniformHeuristic()) {
+        std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
+        return row[distribution(generator)].getColumn();
+    }
+
+    // Unexplored states have the bounds 0 and 1.
+    std::vector<ValueType> probabilities(row.size());
+    bool const addDifferences = explorationInformation.useDifferenceProbabilitySumHeuristic();
+    std::transform(row.begin(), row.end(), probabilities.begin(), [&](storm::storage::MatrixEntry<StateType, ValueType> const& entry) {
+        if (!addDifferences) {
+            return entry.getValue();
+        }
+        LocalState const& successor = path.localStates[entry.getColumn()];
+        return entry.getValue() + (successor.index ? bounds.getDifferenceOfStateBounds(successor.index.get(), explorationInformation)
+                                                   : storm::utility::one<ValueType>());
+    });
+    std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
+    return row[distribution(generator)].getColumn();
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::mergeSampledPath(StateGeneration<StateType, ValueType>& stateGeneration, SampledPath& path,
+                                                                           ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                           Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats,
+                                                                           StateActionStack& stack) const {
+    // Retrieve the indices of the local states. States that were newly discovered get their indices in the order of the paths.
+    std::vector<StateType> indices;
+    indices.reserve(path.localStates.size());
+    for (auto const& localState : path.localStates) {
+        indices.push_back(localState.index ? localState.index.get() : stateGeneration.getOrAddStateIndex(localState.state));
+    }
+
+    // Add the expanded states, unless they were already added while merging a previous path of the batch.
+    for (StateType localIndex = 0; localIndex < path.localStates.size(); ++localIndex) {
+        LocalState& localState = path.localStates[localIndex];
+        StateType const& index = indices[localIndex];
+        if (!localState.expanded || !explorationInformation.isUnexplored(index)) {
+            continue;
+        }
+        for (auto& choice : localState.choices) {
+            for (auto& entry : choice) {
+                entry.setColumn(indices[entry.getColumn()]);
+            }
+        }
+        addExploredState(index, localState.isTargetState, localState.isConditionState, std::move(localState.choices), explorationInformation, bounds,
+                         stats);
+        explorationInformation.removeUnexploredState(explorationInformation.findUnexploredState(index));
+    }
+
+    // Translate the path. As the expansion is deterministic, the choices of local states appear in the same order in the exploration information.
+    stack.clear();
+    for (auto const& step : path.steps) {
+        if (step.local) {
+            StateType const& index = indices[step.state];
+            stack.emplace_back(index, explorationInformation.getStartRowOfGroup(explorationInformation.getRowGroup(index)) + step.action);
+        } else {
+            stack.emplace_back(step.state, step.action);
+        }
+        stats.explorationStep();
+    }
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                                      ExplorationInformation<StateType, ValueType>& explorationInformation,
@@ -177,11 +499,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
             stack.back().second = chosenAction;
             STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
 
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator, samplingCache);
             STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
 
             // Put the successor state and a dummy action on top of the stack.
@@ -206,8 +528,32 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
                                                                        storm::generator::CompressedState const& currentState,
                                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                                        Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+    // Before generating the behavior of the state, we need to determine whether it's a target state that
+    // does not need to be expanded.
+    stateGeneration.load(currentState);
+    bool isTargetState = stateGeneration.isTargetState();
+    bool isConditionState = !isTargetState && stateGeneration.isConditionState();
+
+    ChoiceList choices;
+    if (isConditionState) {
+        STORM_LOG_TRACE("Exploring state.");
+
+        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
+        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
+        STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
+        choices = detail::getChoices(behavior);
+    }
+
+    return addExploredState(currentStateId, isTargetState, isConditionState, std::move(choices), explorationInformation, bounds, stats);
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::addExploredState(StateType const& currentStateId, bool isTargetState, bool isConditionState,
+                                                                           ChoiceList&& choices,
+                                                                           ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                           Bounds<StateType, ValueType>& bounds,
+                                                                           Statistics<StateType, ValueType>& stats) const {
     bool isTerminalState = false;
-    bool isTargetState = false;
 
     ++stats.numberOfExploredStates;
 
@@ -219,25 +565,15 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
     // all states that have been assigned to a row-group.
     bounds.initializeBoundsForNextState();
 
-    // Before generating the behavior of the state, we need to determine whether it's a target state that
-    // does not need to be expanded.
-    stateGeneration.load(currentState);
-    if (stateGeneration.isTargetState()) {
+    if (isTargetState) {
         ++stats.numberOfTargetStates;
-        isTargetState = true;
         isTerminalState = true;
-    } else if (stateGeneration.isConditionState()) {
-        STORM_LOG_TRACE("Exploring state.");
-
-        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
-        STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
-
+    } else if (isConditionState) {
         // Clumsily check whether we have found a state that forms a trivial BMEC.
         bool otherSuccessor = false;
-        for (auto const& choice : behavior) {
+        for (auto const& choice : choices) {
             for (auto const& entry : choice) {
-                if (entry.first != currentStateId) {
+                if (entry.getColumn() != currentStateId) {
                     otherSuccessor = true;
                     break;
                 }
@@ -250,19 +586,19 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
         if (!isTerminalState) {
             // Next, we insert the behavior into our matrix structure.
             StateType startAction = explorationInformation.getActionCount();
-            explorationInformation.addActionsToMatrix(behavior.getNumberOfChoices());
+            explorationInformation.addActionsToMatrix(choices.size());
 
             ActionType localAction = 0;
 
             // Retrieve the lowest state bounds (wrt. to the current optimization direction).
             std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
 
-            for (auto const& choice : behavior) {
+            for (auto& choice : choices) {
                 for (auto const& entry : choice) {
-                    explorationInformation.getRowOfMatrix(startAction + localAction).emplace_back(entry.first, entry.second);
-                    STORM_LOG_TRACE("Found transition " << currentStateId << "-[" << (startAction + localAction) << ", " << entry.second << "]-> "
-                                                        << entry.first << ".");
+                    STORM_LOG_TRACE("Found transition " << currentStateId << "-[" << (startAction + localAction) << ", " << entry.getValue() << "]-> "
+                                                        << entry.getColumn() << ".");
                 }
+                explorationInformation.getRowOfMatrix(startAction + localAction) = std::move(choice);
 
                 std::pair<ValueType, ValueType> actionBounds = computeBoundsOfAction(startAction + localAction, explorationInformation, bounds);
                 bounds.initializeBoundsForNextAction(actionBounds);
@@ -314,7 +650,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& generator) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -350,38 +687,39 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 
     // Now sample from all maximizing actions.
     std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-    return actionValues[distribution(randomGenerator)].first;
+    return actionValues[distribution(generator)].first;
 }
 
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
-    ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& generator, storm::storage::SuccessorSamplingCache<ValueType>& cache) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
     }
 
     // Depending on the selected next-state heuristic, we give the states other likelihoods of getting chosen.
-    if (explorationInformation.useDifferenceProbabilitySumHeuristic() || explorationInformation.useProbabilityHeuristic()) {
+    if (explorationInformation.useDifferenceProbabilitySumHeuristic()) {
         std::vector<ValueType> probabilities(row.size());
-        if (explorationInformation.useDifferenceProbabilitySumHeuristic()) {
-            std::transform(row.begin(), row.end(), probabilities.begin(),
-                           [&bounds, &explorationInformation](storm::storage::MatrixEntry<StateType, ValueType> const& entry) {
-                               return entry.getValue() + bounds.getDifferenceOfStateBounds(entry.getColumn(), explorationInformation);
-                           });
-        } else if (explorationInformation.useProbabilityHeuristic()) {
-            std::transform(row.begin(), row.end(), probabilities.begin(),
-                           [](storm::storage::MatrixEntry<StateType, ValueType> const& entry) { return entry.getValue(); });
-        }
+        std::transform(row.begin(), row.end(), probabilities.begin(),
+                       [&bounds, &explorationInformation](storm::storage::MatrixEntry<StateType, ValueType> const& entry) {
+                           return entry.getValue() + bounds.getDifferenceOfStateBounds(entry.getColumn(), explorationInformation);
+                       });
 
         // Now sample according to the probabilities.
         std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
+    } else if (explorationInformation.useProbabilityHeuristic()) {
+        // As the probabilities of the row do not change, the successor can be selected using the cached cumulative probabilities of the row.
+        std::uniform_real_distribution<ValueType> distribution(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+        uint64_t const offset = cache.selectEntry(chosenAction, row.begin(), row.end(), distribution(generator));
+        // Due to rounding, the probabilities might not sum up to one.
+        return row[std::min<uint64_t>(offset, row.size() - 1)].getColumn();
     } else {
         STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
         std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     }
 }
 
@@ -3,8 +3,13 @@
 
 #include <random>
 
+#include <boost/optional.hpp>
+
 #include "storm/modelchecker/AbstractModelChecker.h"
 
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SuccessorSamplingCache.h"
 #include "storm/storage/prism/Program.h"
 
 #include "storm/generator/CompressedState.h"
@@ -45,18 +50,86 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     typedef typename ModelType::ValueType ValueType;
     typedef StateType ActionType;
     typedef std::vector<std::pair<StateType, ActionType>> StateActionStack;
+    typedef std::vector<std::vector<storm::storage::MatrixEntry<StateType, ValueType>>> ChoiceList;
 
     SparseExplorationModelChecker(storm::prism::Program const& program);
 
+    /*!
+     * Creates a model checker that samples paths with the given number of threads (where 0 means that all available cores are used), regardless
+     * of the number of threads set in the exploration settings.
+     */
+    SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads);
+
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
 
     virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
                                                                    CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
 
    private:
+    // A state that a thread explored while sampling a path concurrently, but that is not yet part of the exploration information.
+    struct LocalState {
+        storm::generator::CompressedState state;
+        // The index of the state if it was already discovered before the path was sampled.
+        boost::optional<StateType> index;
+        bool expanded = false;
+        bool isTargetState = false;
+        bool isConditionState = false;
+        bool isTerminalState = false;
+        // The choices of the state (if it was expanded). The columns refer to the local states of the path.
+        ChoiceList choices;
+    };
+
+    // A step of a path that was sampled concurrently. The state of a local step is a local state of the path and its action is the offset of the
+    // chosen choice.
+    struct PathStep {
+        StateType state;
+        ActionType action;
+        bool local;
+    };
+
+    // A path that was sampled concurrently together with the states that were explored while sampling it.
+    struct SampledPath {
+        std::vector<PathStep> steps;
+        std::vector<LocalState> localStates;
+        storm::storage::BitVectorHashMap<StateType> localStateIndices;
+        bool foundTerminalState = false;
+    };
+
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                    ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+    bool isParallelExplorationEnabled() const;
+
+    /*!
+     * Performs the exploration by repeatedly sampling a batch of paths concurrently (one per thread). While sampling, the exploration information
+     * and the bounds are only read and newly discovered states are expanded locally. Afterwards, the expanded states are added to the exploration
+     * information and the bounds are updated along the paths. As precomputations are only performed in between batches, the collapsing of MECs
+     * never interferes with the sampling.
+     */
+    std::tuple<StateType, ValueType, ValueType> performParallelExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                           ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+
+    void samplePathConcurrently(uint64_t thread, StateGeneration<StateType, ValueType>& stateGeneration,
+                                ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+                                std::default_random_engine& generator, storm::storage::SuccessorSamplingCache<ValueType>& cache, uint64_t maxPathLength,
+                                SampledPath& path) const;
+
+    StateType getOrAddLocalState(StateGeneration<StateType, ValueType> const& stateGeneration, storm::generator::CompressedState const& state,
+                                 SampledPath& path) const;
+
+    void expandLocalState(uint64_t thread, StateGeneration<StateType, ValueType>& stateGeneration, StateType const& localState, SampledPath& path) const;
+
+    StateType sampleSuccessorOfLocalState(LocalState const& localState, ActionType const& choice,
+                                          ExplorationInformation<StateType, ValueType> const& explorationInformation,
+                                          Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator, SampledPath const& path) const;
+
+    /*!
+     * Adds the states explored while sampling the path to the exploration information and translates the path to the corresponding stack.
+     */
+    void mergeSampledPath(StateGeneration<StateType, ValueType>& stateGeneration, SampledPath& path,
+                          ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                          Statistics<StateType, ValueType>& stats, StateActionStack& stack) const;
+
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
                                     Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -65,11 +138,16 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                       storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation,
                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
+    bool addExploredState(StateType const& currentStateId, bool isTargetState, bool isConditionState, ChoiceList&& choices,
+                          ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                          Statistics<StateType, ValueType>& stats) const;
+
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator,
+                                        storm::storage::SuccessorSamplingCache<ValueType>& cache) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -108,8 +186,14 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     // The random number generator.
     mutable std::default_random_engine randomGenerator;
 
+    // The cumulative probabilities of actions with many successors, which are used to sample successors according to their probabilities.
+    mutable storm::storage::SuccessorSamplingCache<ValueType> samplingCache;
+
     // A comparator used to determine whether values are equal.
     storm::utility::ConstantsComparator<ValueType> comparator;
+
+    // The number of threads that sample paths concurrently.
+    uint64_t numberOfThreads;
 };
 }  // namespace modelchecker
 }  // namespace storm
@@ -3,6 +3,8 @@
 
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 
+#include "storm/utility/macros.h"
+
 namespace storm {
 namespace modelchecker {
 namespace exploration_detail {
@@ -22,7 +24,9 @@ StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program con
                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                        storm::expressions::Expression const& conditionStateExpression,
                                                        storm::expressions::Expression const& targetStateExpression)
-    : generator(program, generatorOptions),
+    : program(program),
+      generatorOptions(generatorOptions),
+      generator(program, generatorOptions),
       stateStorage(generator.getStateSize()),
       conditionStateExpression(conditionStateExpression),
       targetStateExpression(targetStateExpression) {
@@ -80,6 +84,64 @@ std::size_t StateGeneration<StateType, ValueType>::getNumberOfInitialStates() co
     return stateStorage.initialStateIndices.size();
 }
 
+template<typename StateType, typename ValueType>
+StateType StateGeneration<StateType, ValueType>::getOrAddStateIndex(storm::generator::CompressedState const& state) {
+    return stateToIdCallback(state);
+}
+
+template<typename StateType, typename ValueType>
+void StateGeneration<StateType, ValueType>::prepareConcurrentExpansion(uint64_t numberOfThreads) {
+    while (threadGenerators.size() + 1 < numberOfThreads) {
+        threadGenerators.push_back(std::make_unique<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions));
+    }
+}
+
+template<typename StateType, typename ValueType>
+boost::optional<StateType> StateGeneration<StateType, ValueType>::findStateIndex(storm::generator::CompressedState const& state) const {
+    if (stateStorage.stateToId.contains(state)) {
+        return stateStorage.stateToId.getValue(state);
+    }
+    return boost::none;
+}
+
+template<typename StateType, typename ValueType>
+void StateGeneration<StateType, ValueType>::load(uint64_t thread, storm::generator::CompressedState const& state) {
+    getGenerator(thread).load(state);
+}
+
+template<typename StateType, typename ValueType>
+storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::expand(
+    uint64_t thread, std::function<StateType(storm::generator::CompressedState const&)> const& stateToIdCallback) {
+    return getGenerator(thread).expand(stateToIdCallback);
+}
+
+template<typename StateType, typename ValueType>
+bool StateGeneration<StateType, ValueType>::isConditionState(uint64_t thread) const {
+    return getGenerator(thread).satisfies(conditionStateExpression);
+}
+
+template<typename StateType, typename ValueType>
+bool StateGeneration<StateType, ValueType>::isTargetState(uint64_t thread) const {
+    return getGenerator(thread).satisfies(targetStateExpression);
+}
+
+template<typename StateType, typename ValueType>
+uint64_t StateGeneration<StateType, ValueType>::getStateSize() const {
+    return generator.getStateSize();
+}
+
+template<typename StateType, typename ValueType>
+storm::generator::PrismNextStateGenerator<ValueType, StateType> const& StateGeneration<StateType, ValueType>::getGenerator(uint64_t thread) const {
+    STORM_LOG_ASSERT(thread <= threadGenerators.size(), "No generator for thread " << thread << " available.");
+    return thread == 0 ? generator : *threadGenerators[thread - 1];
+}
+
+template<typename StateType, typename ValueType>
+storm::generator::PrismNextStateGenerator<ValueType, StateType>& StateGeneration<StateType, ValueType>::getGenerator(uint64_t thread) {
+    STORM_LOG_ASSERT(thread <= threadGenerators.size(), "No generator for thread " << thread << " available.");
+    return thread == 0 ? generator : *threadGenerators[thread - 1];
+}
+
 template class StateGeneration<uint32_t, double>;
 }  // namespace exploration_detail
 }  // namespace modelchecker
@@ -1,6 +1,11 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/PrismNextStateGenerator.h"
 
@@ -45,13 +50,56 @@ class StateGeneration {
 
     bool isTargetState() const;
 
+    /*!
+     * Retrieves the index of the given state. If the state was not discovered yet, it gets the next free index and is added as an unexplored
+     * state.
+     */
+    StateType getOrAddStateIndex(storm::generator::CompressedState const& state);
+
+    /*!
+     * Creates the generators needed to expand states from the given number of threads concurrently. Generators are created upfront, as their
+     * construction may modify the (shared) expression manager.
+     */
+    void prepareConcurrentExpansion(uint64_t numberOfThreads);
+
+    /*!
+     * Retrieves the index of the given state if it was already discovered. As this does not register the state, it may be called concurrently as
+     * long as no other thread discovers new states.
+     */
+    boost::optional<StateType> findStateIndex(storm::generator::CompressedState const& state) const;
+
+    /*!
+     * The following methods are the counterparts of the methods above that use the generator of the given thread (see prepareConcurrentExpansion).
+     * Upon expansion, the successor states are passed to the given callback instead of being registered.
+     */
+    void load(uint64_t thread, storm::generator::CompressedState const& state);
+
+    storm::generator::StateBehavior<ValueType, StateType> expand(uint64_t thread,
+                                                                 std::function<StateType(storm::generator::CompressedState const&)> const& stateToIdCallback);
+
+    bool isConditionState(uint64_t thread) const;
+
+    bool isTargetState(uint64_t thread) const;
+
+    uint64_t getStateSize() const;
+
    protected:
     StateGeneration(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions,
                     ExplorationInformation<StateType, ValueType>& explorationInformation, storm::expressions::Expression const& conditionStateExpression,
                     storm::expressions::Expression const& targetStateExpression);
 
    private:
+    storm::generator::PrismNextStateGenerator<ValueType, StateType> const& getGenerator(uint64_t thread) const;
+
+    storm::generator::PrismNextStateGenerator<ValueType, StateType>& getGenerator(uint64_t thread);
+
+    // The program and the options are stored to create the generators of further threads. Like the generators, the object keeps its own copy of
+    // the program, so it does not depend on the lifetime of the program it was created from.
+    storm::prism::Program program;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
     storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
+    // The generators of the threads other than the first one (which uses the generator above).
+    std::vector<std::unique_ptr<storm::generator::PrismNextStateGenerator<ValueType, StateType>>> threadGenerators;
     std::function<StateType(storm::generator::CompressedState const&)> stateToIdCallback;
 
     storm::storage::sparse::StateStorage<StateType> stateStorage;
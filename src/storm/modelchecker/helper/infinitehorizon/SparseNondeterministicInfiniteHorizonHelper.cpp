@@ -2,6 +2,7 @@
 
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
+#include "storm/modelchecker/helper/utility/MaximalEndComponentDecompositionOptionsFromSettings.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/Scheduler.h"
@@ -70,7 +71,8 @@ void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition
         // The decomposition has not been provided or computed, yet.
         this->createBackwardTransitions();
         this->_computedLongRunComponentDecomposition =
-            std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(this->_transitionMatrix, *this->_backwardTransitions);
+            std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(this->_transitionMatrix, *this->_backwardTransitions,
+                                                                                          getMaximalEndComponentDecompositionOptionsFromSettings());
         this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
     }
 }
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Retrieves the options for MEC decompositions as specified in the core settings.
+ */
+inline storm::storage::MaximalEndComponentDecompositionOptions getMaximalEndComponentDecompositionOptionsFromSettings() {
+    auto const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+    return storm::storage::MaximalEndComponentDecompositionOptions()
+        .numberOfThreads(coreSettings.getNumberOfMecThreads())
+        .minimalSizeForParallelSccDecomposition(coreSettings.getMinimalMecCandidateSizeForParallelDecomposition());
+}
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -2,6 +2,7 @@
 
 #include <boost/container/flat_map.hpp>
 
+#include "storm/modelchecker/helper/utility/MaximalEndComponentDecompositionOptionsFromSettings.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
@@ -608,7 +609,8 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
     storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
     if (doDecomposition) {
         // Compute the states that are in MECs.
-        endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+        endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates,
+                                                                                                getMaximalEndComponentDecompositionOptionsFromSettings());
     }
 
     // Only do more work if there are actually end-components.
@@ -748,7 +750,8 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     bool useMecBasedTechnique) {
     if (useMecBasedTechnique) {
         // TODO: does this really work for minimizing objectives?
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, psiStates);
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, psiStates,
+                                                                                     getMaximalEndComponentDecompositionOptionsFromSettings());
         storm::storage::BitVector statesInPsiMecs(transitionMatrix.getRowGroupCount());
         for (auto const& mec : mecDecomposition) {
             for (auto const& stateActionsPair : mec) {
@@ -1175,7 +1178,8 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
     if (doDecomposition) {
         // Then compute the states that are in MECs with zero reward.
         endComponentDecomposition =
-            storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices);
+            storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates, zeroRewardChoices,
+                                                                        getMaximalEndComponentDecompositionOptionsFromSettings());
     }
 
     // Only do more work if there are actually end-components.
@@ -1353,7 +1357,8 @@ std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditional
         fixedTargetStates = targetStates;
     } else {
         fixedTargetStates = storm::storage::BitVector(targetStates.size());
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, ~targetStates);
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, ~targetStates,
+                                                                                     getMaximalEndComponentDecompositionOptionsFromSettings());
         for (auto const& mec : mecDecomposition) {
             for (auto const& stateActionsPair : mec) {
                 fixedTargetStates.set(stateActionsPair.first);
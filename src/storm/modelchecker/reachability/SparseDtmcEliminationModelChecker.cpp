@@ -2,8 +2,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <iterator>
+#include <memory>
+#include <numeric>
 #include <random>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -914,9 +918,18 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performHyb
     // When using the hybrid technique, we recursively treat the SCCs up to some size.
     std::vector<storm::storage::sparse::state_type> entryStateQueue;
     STORM_LOG_DEBUG("Eliminating " << subsystem.size() << " states using the hybrid elimination technique.\n");
+
+    uint64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads();
+#ifndef STORM_HAVE_INTELTBB
+    if (numberOfThreads != 1) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        numberOfThreads = 1;
+    }
+#endif
+
     uint_fast64_t maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0,
-                                          storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), entryStateQueue,
-                                          computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                                          storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), numberOfThreads,
+                                          entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
 
     // If the entry states were to be eliminated last, we need to do so now.
     if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet()) {
@@ -979,8 +992,8 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values, storm::storage::BitVector const& entryStates,
     storm::storage::BitVector const& scc, storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions,
     storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize,
-    std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly,
-    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+    uint64_t numberOfThreads, std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly,
+    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities, bool deferEntryStates) {
     uint_fast64_t maximalDepth = level;
 
     // If the SCCs are large enough, we try to split them further.
@@ -1016,28 +1029,36 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
 
         // And then recursively treat the remaining sub-SCCs.
         STORM_LOG_TRACE("Eliminating " << remainingSccs.getNumberOfSetBits() << " remaining SCCs on level " << level << ".");
-        for (auto sccIndex : remainingSccs) {
-            storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
-
-            // Rewrite SCC into bit vector and subtract it from the remaining states.
-            storm::storage::BitVector newSccAsBitVector(forwardTransitions.getRowCount(), newScc.begin(), newScc.end());
-
-            // Determine the set of entry states of the SCC.
-            storm::storage::BitVector entryStates(forwardTransitions.getRowCount());
-            for (auto const& state : newScc) {
-                for (auto const& predecessor : backwardTransitions.getRow(state)) {
-                    if (predecessor.getValue() != storm::utility::zero<ValueType>() && !newSccAsBitVector.get(predecessor.getColumn())) {
-                        entryStates.set(state);
-                    }
-                }
+        bool eliminateSubSccEntryStates =
+            eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet();
+        if (numberOfThreads != 1 && remainingSccs.getNumberOfSetBits() > 1) {
+            std::vector<storm::storage::BitVector> sccs;
+            sccs.reserve(remainingSccs.getNumberOfSetBits());
+            for (auto sccIndex : remainingSccs) {
+                storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
+                sccs.emplace_back(forwardTransitions.getRowCount(), newScc.begin(), newScc.end());
             }
-
-            // Recursively descend in SCC-hierarchy.
             uint_fast64_t depth =
-                treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions,
-                         eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(),
-                         level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                treatSccsInParallel(matrix, values, sccs, initialStates, forwardTransitions, backwardTransitions, eliminateSubSccEntryStates, level + 1,
+                                    maximalSccSize, numberOfThreads, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
             maximalDepth = std::max(maximalDepth, depth);
+        } else {
+            for (auto sccIndex : remainingSccs) {
+                storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
+
+                // Rewrite SCC into bit vector and subtract it from the remaining states.
+                storm::storage::BitVector newSccAsBitVector(forwardTransitions.getRowCount(), newScc.begin(), newScc.end());
+
+                // Determine the set of entry states of the SCC.
+                storm::storage::BitVector entryStates = computeEntryStates(backwardTransitions, newSccAsBitVector);
+
+                // Recursively descend in SCC-hierarchy.
+                uint_fast64_t depth =
+                    treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions,
+                             eliminateSubSccEntryStates, level + 1, maximalSccSize, numberOfThreads, entryStateQueue, computeResultsForInitialStatesOnly,
+                             distanceBasedPriorities);
+                maximalDepth = std::max(maximalDepth, depth);
+            }
         }
     } else {
         // In this case, we perform simple state elimination in the current SCC.
@@ -1049,7 +1070,9 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
     }
 
     // Finally, eliminate the entry states (if we are required to do so).
-    if (eliminateEntryStates) {
+    if (deferEntryStates) {
+        STORM_LOG_TRACE("Finally, leaving entry states to the caller.");
+    } else if (eliminateEntryStates) {
         STORM_LOG_TRACE("Finally, eliminating entry states.");
         std::shared_ptr<StatePriorityQueue> naivePriorities = createStatePriorityQueue(entryStates);
         performPrioritizedStateElimination(naivePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
@@ -1064,6 +1087,335 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
     return maximalDepth;
 }
 
+namespace {
+
+/*!
+ * Moves the values of an SCC that is treated in isolation to a polynomial cache of its own and back. This only affects rational functions: the
+ * factorizations of their polynomials are stored in a cache that is shared by all values and is not thread-safe. For all other value types,
+ * nothing needs to be done.
+ */
+template<typename ValueType>
+class LocalPolynomialCache {
+   public:
+    void localize(ValueType&) {
+        // Intentionally left empty.
+    }
+
+    template<typename EntryType>
+    void localize(EntryType&) {
+        // Intentionally left empty.
+    }
+
+    void globalize(ValueType&) const {
+        // Intentionally left empty.
+    }
+
+    template<typename EntryType>
+    void globalize(EntryType&) const {
+        // Intentionally left empty.
+    }
+};
+
+template<>
+class LocalPolynomialCache<storm::RationalFunction> {
+   public:
+    LocalPolynomialCache() : localCache(std::make_shared<storm::RawPolynomialCache>()) {
+        // Intentionally left empty.
+    }
+
+    void localize(storm::RationalFunction& value) {
+        if (!storm::utility::isConstant(value)) {
+            // Remember the cache of the values, such that we can move them back later. A non-constant polynomial always refers to a cache.
+            if (!globalCache) {
+                globalCache = value.nominator().isConstant() ? value.denominator().pCache() : value.nominator().pCache();
+            }
+            value = moveToCache(value, localCache);
+        }
+    }
+
+    template<typename EntryType>
+    void localize(EntryType& entry) {
+        if (!storm::utility::isConstant(entry.getValue())) {
+            storm::RationalFunction value = entry.getValue();
+            localize(value);
+            entry.setValue(value);
+        }
+    }
+
+    void globalize(storm::RationalFunction& value) const {
+        if (!storm::utility::isConstant(value)) {
+            // Non-constant values can only be obtained from the (non-constant) values that were moved to the local cache before.
+            STORM_LOG_ASSERT(globalCache, "Unable to move a value back to the cache it originates from.");
+            value = moveToCache(value, globalCache);
+        }
+    }
+
+    template<typename EntryType>
+    void globalize(EntryType& entry) const {
+        if (!storm::utility::isConstant(entry.getValue())) {
+            entry.setValue(moveToCache(entry.getValue(), globalCache));
+        }
+    }
+
+   private:
+    static storm::RationalFunction moveToCache(storm::RationalFunction const& value, std::shared_ptr<storm::RawPolynomialCache> const& cache) {
+        return storm::RationalFunction(storm::Polynomial(value.nominator().polynomialWithCoefficient(), cache),
+                                       storm::Polynomial(value.denominator().polynomialWithCoefficient(), cache));
+    }
+
+    std::shared_ptr<storm::RawPolynomialCache> localCache;
+    std::shared_ptr<storm::RawPolynomialCache> globalCache;
+};
+
+}  // namespace
+
+template<typename SparseDtmcModelType>
+uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatSccsInParallel(
+    storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values, std::vector<storm::storage::BitVector> const& sccs,
+    storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions,
+    storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize,
+    uint64_t numberOfThreads, std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly,
+    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+    uint_fast64_t maximalDepth = level;
+
+    // An SCC whose non-entry states only have predecessors within the SCC can be treated in isolation: eliminating its non-entry states only
+    // modifies the forward rows of states of the SCC and the backward rows of the SCC and its successors.
+    std::vector<storm::storage::BitVector> entryStatesOfSccs(sccs.size());
+    std::vector<uint64_t> independentSccs;
+    std::vector<uint64_t> dependentSccs;
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        storm::storage::BitVector const& scc = sccs[sccIndex];
+        entryStatesOfSccs[sccIndex] = computeEntryStates(backwardTransitions, scc);
+        bool independent = true;
+        for (auto state : scc & ~entryStatesOfSccs[sccIndex]) {
+            for (auto const& predecessor : backwardTransitions.getRow(state)) {
+                if (!scc.get(predecessor.getColumn())) {
+                    independent = false;
+                    break;
+                }
+            }
+            if (!independent) {
+                break;
+            }
+        }
+        if (independent) {
+            independentSccs.push_back(sccIndex);
+        } else {
+            dependentSccs.push_back(sccIndex);
+        }
+    }
+    if (independentSccs.size() < 2) {
+        // There is nothing to gain from treating a single SCC in isolation.
+        independentSccs.clear();
+        dependentSccs.resize(sccs.size());
+        std::iota(dependentSccs.begin(), dependentSccs.end(), 0);
+    }
+    STORM_LOG_TRACE("Treating " << independentSccs.size() << " of " << sccs.size() << " SCCs on level " << level << " in parallel.");
+
+    // The data of an SCC that is treated in isolation. The local index of a state is its position in the (sorted) vector of states, which
+    // contains the states of the SCC and their successors. Hence, the order of the rows and columns is preserved.
+    struct LocalScc {
+        std::vector<storm::storage::sparse::state_type> states;
+        storm::storage::BitVector scc;
+        storm::storage::BitVector entryStates;
+        storm::storage::BitVector initialStates;
+        storm::storage::FlexibleSparseMatrix<ValueType> matrix;
+        storm::storage::FlexibleSparseMatrix<ValueType> backwardTransitions;
+        storm::storage::SparseMatrix<ValueType> forwardTransitions;
+        std::vector<ValueType> values;
+        boost::optional<std::vector<uint_fast64_t>> distanceBasedPriorities;
+        std::vector<storm::storage::sparse::state_type> entryStateQueue;
+        uint_fast64_t depth = 0;
+        LocalPolynomialCache<ValueType> polynomialCache;
+    };
+
+    // Move the rows of every independent SCC to its local matrices. The backward rows of the successors outside the SCC are split, such that the
+    // local matrices only contain the predecessors within the SCC.
+    std::vector<LocalScc> localSccs(independentSccs.size());
+    for (uint64_t localSccIndex = 0; localSccIndex < independentSccs.size(); ++localSccIndex) {
+        storm::storage::BitVector const& scc = sccs[independentSccs[localSccIndex]];
+        storm::storage::BitVector const& entryStates = entryStatesOfSccs[independentSccs[localSccIndex]];
+        LocalScc& local = localSccs[localSccIndex];
+        for (auto state : scc) {
+            local.states.push_back(state);
+            for (auto const& entry : matrix.getRow(state)) {
+                if (!scc.get(entry.getColumn())) {
+                    local.states.push_back(entry.getColumn());
+                }
+            }
+        }
+        std::sort(local.states.begin(), local.states.end());
+        local.states.erase(std::unique(local.states.begin(), local.states.end()), local.states.end());
+        auto toLocal = [&local](storm::storage::sparse::state_type state) {
+            return static_cast<storm::storage::sparse::state_type>(std::lower_bound(local.states.begin(), local.states.end(), state) - local.states.begin());
+        };
+
+        uint64_t numberOfLocalStates = local.states.size();
+        local.scc = storm::storage::BitVector(numberOfLocalStates);
+        local.entryStates = storm::storage::BitVector(numberOfLocalStates);
+        local.initialStates = storm::storage::BitVector(numberOfLocalStates);
+        local.matrix = storm::storage::FlexibleSparseMatrix<ValueType>(numberOfLocalStates);
+        local.backwardTransitions = storm::storage::FlexibleSparseMatrix<ValueType>(numberOfLocalStates);
+        local.values.resize(numberOfLocalStates, storm::utility::zero<ValueType>());
+        if (distanceBasedPriorities) {
+            local.distanceBasedPriorities = std::vector<uint_fast64_t>(numberOfLocalStates);
+        }
+        storm::storage::SparseMatrixBuilder<ValueType> forwardTransitionsBuilder(numberOfLocalStates, numberOfLocalStates);
+        for (uint64_t localState = 0; localState < numberOfLocalStates; ++localState) {
+            storm::storage::sparse::state_type state = local.states[localState];
+            if (initialStates.get(state)) {
+                local.initialStates.set(localState);
+            }
+            if (distanceBasedPriorities) {
+                local.distanceBasedPriorities.get()[localState] = distanceBasedPriorities.get()[state];
+            }
+            if (scc.get(state)) {
+                local.scc.set(localState);
+                if (entryStates.get(state)) {
+                    local.entryStates.set(localState);
+                }
+                local.values[localState] = std::move(values[state]);
+                local.polynomialCache.localize(local.values[localState]);
+
+                auto& localRow = local.matrix.getRow(localState);
+                localRow = std::move(matrix.getRow(state));
+                matrix.getRow(state).clear();
+                for (auto& entry : localRow) {
+                    entry.setColumn(toLocal(entry.getColumn()));
+                    local.polynomialCache.localize(entry);
+                }
+
+                // The sub-SCCs are determined wrt. the original transitions, so we only need the structure of those within the SCC.
+                for (auto const& entry : forwardTransitions.getRow(state)) {
+                    if (scc.get(entry.getColumn())) {
+                        forwardTransitionsBuilder.addNextValue(localState, toLocal(entry.getColumn()), storm::utility::one<ValueType>());
+                    }
+                }
+            }
+
+            auto& row = backwardTransitions.getRow(state);
+            auto& localRow = local.backwardTransitions.getRow(localState);
+            auto keptEntriesEnd = row.begin();
+            for (auto entryIt = row.begin(), entryIte = row.end(); entryIt != entryIte; ++entryIt) {
+                if (scc.get(entryIt->getColumn())) {
+                    localRow.push_back(std::move(*entryIt));
+                    localRow.back().setColumn(toLocal(localRow.back().getColumn()));
+                    local.polynomialCache.localize(localRow.back());
+                } else {
+                    if (keptEntriesEnd != entryIt) {
+                        *keptEntriesEnd = std::move(*entryIt);
+                    }
+                    ++keptEntriesEnd;
+                }
+            }
+            row.erase(keptEntriesEnd, row.end());
+        }
+        local.forwardTransitions = forwardTransitionsBuilder.build();
+    }
+
+    // Treat the independent SCCs concurrently. The entry states have predecessors outside of the SCC, so they are left to us.
+    auto treatLocalScc = [&](uint64_t localSccIndex) {
+        LocalScc& local = localSccs[localSccIndex];
+        local.depth = treatScc(local.matrix, local.values, local.entryStates, local.scc, local.initialStates, local.forwardTransitions,
+                               local.backwardTransitions, eliminateEntryStates, level, maximalSccSize, numberOfThreads, local.entryStateQueue,
+                               computeResultsForInitialStatesOnly, local.distanceBasedPriorities, true);
+    };
+#ifdef STORM_HAVE_INTELTBB
+    auto execute = [&]() {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, localSccs.size(), 1), [&treatLocalScc](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t localSccIndex = range.begin(); localSccIndex < range.end(); ++localSccIndex) {
+                treatLocalScc(localSccIndex);
+            }
+        });
+    };
+    if (numberOfThreads == 0) {
+        execute();
+    } else {
+        tbb::task_arena arena(static_cast<int>(numberOfThreads));
+        arena.execute(execute);
+    }
+#else
+    for (uint64_t localSccIndex = 0; localSccIndex < localSccs.size(); ++localSccIndex) {
+        treatLocalScc(localSccIndex);
+    }
+#endif
+
+    // Merge the local matrices back. As the SCCs are disjoint, the local backward rows of a state refer to disjoint sets of predecessors.
+    for (auto& local : localSccs) {
+        for (uint64_t localState = 0; localState < local.states.size(); ++localState) {
+            storm::storage::sparse::state_type state = local.states[localState];
+            if (local.scc.get(localState)) {
+                auto& row = matrix.getRow(state);
+                row = std::move(local.matrix.getRow(localState));
+                for (auto& entry : row) {
+                    entry.setColumn(local.states[entry.getColumn()]);
+                    local.polynomialCache.globalize(entry);
+                }
+                values[state] = std::move(local.values[localState]);
+                local.polynomialCache.globalize(values[state]);
+            }
+
+            auto& localRow = local.backwardTransitions.getRow(localState);
+            if (!localRow.empty()) {
+                for (auto& entry : localRow) {
+                    entry.setColumn(local.states[entry.getColumn()]);
+                    local.polynomialCache.globalize(entry);
+                }
+                auto& row = backwardTransitions.getRow(state);
+                typename storm::storage::FlexibleSparseMatrix<ValueType>::row_type mergedRow;
+                mergedRow.reserve(row.size() + localRow.size());
+                std::merge(std::make_move_iterator(row.begin()), std::make_move_iterator(row.end()), std::make_move_iterator(localRow.begin()),
+                           std::make_move_iterator(localRow.end()), std::back_inserter(mergedRow),
+                           [](auto const& first, auto const& second) { return first.getColumn() < second.getColumn(); });
+                row.swap(mergedRow);
+            }
+        }
+        maximalDepth = std::max(maximalDepth, local.depth);
+    }
+
+    // Now that all rows are in place again, we can eliminate (or queue) the entry states.
+    for (uint64_t localSccIndex = 0; localSccIndex < independentSccs.size(); ++localSccIndex) {
+        for (auto state : localSccs[localSccIndex].entryStateQueue) {
+            entryStateQueue.push_back(localSccs[localSccIndex].states[state]);
+        }
+        storm::storage::BitVector const& entryStates = entryStatesOfSccs[independentSccs[localSccIndex]];
+        if (eliminateEntryStates) {
+            std::shared_ptr<StatePriorityQueue> naivePriorities = createStatePriorityQueue(entryStates);
+            performPrioritizedStateElimination(naivePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+        } else {
+            for (auto state : entryStates) {
+                entryStateQueue.push_back(state);
+            }
+        }
+    }
+    localSccs.clear();
+
+    // Finally, treat the remaining SCCs sequentially. Their entry states need to be determined wrt. the current transitions.
+    for (auto sccIndex : dependentSccs) {
+        storm::storage::BitVector entryStates = computeEntryStates(backwardTransitions, sccs[sccIndex]);
+        uint_fast64_t depth = treatScc(matrix, values, entryStates, sccs[sccIndex], initialStates, forwardTransitions, backwardTransitions,
+                                       eliminateEntryStates, level, maximalSccSize, numberOfThreads, entryStateQueue, computeResultsForInitialStatesOnly,
+                                       distanceBasedPriorities);
+        maximalDepth = std::max(maximalDepth, depth);
+    }
+
+    return maximalDepth;
+}
+
+template<typename SparseDtmcModelType>
+storm::storage::BitVector SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeEntryStates(
+    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& scc) {
+    storm::storage::BitVector entryStates(scc.size());
+    for (auto const& state : scc) {
+        for (auto const& predecessor : backwardTransitions.getRow(state)) {
+            if (predecessor.getValue() != storm::utility::zero<ValueType>() && !scc.get(predecessor.getColumn())) {
+                entryStates.set(state);
+            }
+        }
+    }
+    return entryStates;
+}
+
 template<typename SparseDtmcModelType>
 bool SparseDtmcEliminationModelChecker<SparseDtmcModelType>::checkConsistent(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                                              storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions) {
@@ -113,9 +113,29 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
                                   storm::storage::BitVector const& entryStates, storm::storage::BitVector const& scc,
                                   storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions,
                                   storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level,
-                                  uint_fast64_t maximalSccSize, std::vector<storm::storage::sparse::state_type>& entryStateQueue,
+                                  uint_fast64_t maximalSccSize, uint64_t numberOfThreads, std::vector<storm::storage::sparse::state_type>& entryStateQueue,
                                   bool computeResultsForInitialStatesOnly,
-                                  boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities = boost::none);
+                                  boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities = boost::none, bool deferEntryStates = false);
+
+    /*!
+     * Treats the given sub-SCCs of the same level of the SCC hierarchy concurrently. For every sub-SCC whose non-entry states only have
+     * predecessors within the sub-SCC, the rows of the sub-SCC (and the backward rows of its successors restricted to the sub-SCC) are moved to
+     * local matrices in which the sub-SCC is treated in isolation. The local matrices are merged back afterwards and the entry states are
+     * eliminated (or queued) sequentially. All other sub-SCCs are treated sequentially. Rational functions are moved to a polynomial cache
+     * per sub-SCC while the sub-SCC is treated in isolation.
+     *
+     * @return The maximal depth of the SCC hierarchy below the given sub-SCCs.
+     */
+    static uint_fast64_t treatSccsInParallel(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values,
+                                             std::vector<storm::storage::BitVector> const& sccs, storm::storage::BitVector const& initialStates,
+                                             storm::storage::SparseMatrix<ValueType> const& forwardTransitions,
+                                             storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates,
+                                             uint_fast64_t level, uint_fast64_t maximalSccSize, uint64_t numberOfThreads,
+                                             std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly,
+                                             boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities);
+
+    static storm::storage::BitVector computeEntryStates(storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                        storm::storage::BitVector const& scc);
 
     static bool checkConsistent(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                 storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions);
@@ -0,0 +1,132 @@
+#include "storm/modelchecker/statistical/PathSampler.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace statistical {
+
+SparseModelPathSampler::SparseModelPathSampler(storm::models::sparse::Dtmc<double> const& model, std::vector<storm::storage::BitVector> const& stateSets,
+                                               std::vector<double> const* stateRewards, std::vector<double> const* rewards)
+    : model(model), simulator(model), stateSets(stateSets), stateRewards(stateRewards), rewards(rewards) {
+    // Intentionally left empty.
+}
+
+void SparseModelPathSampler::resetToInitial() {
+    simulator.resetToInitial();
+}
+
+void SparseModelPathSampler::step(double probability) {
+    simulator.step(0, probability);
+}
+
+bool SparseModelPathSampler::isAbsorbing() const {
+    uint64_t state = simulator.getCurrentState();
+    auto row = model.getTransitionMatrix().getRow(state);
+    return row.getNumberOfEntries() == 1 && row.begin()->getColumn() == state;
+}
+
+bool SparseModelPathSampler::satisfies(uint64_t formulaIndex) const {
+    return stateSets[formulaIndex].get(simulator.getCurrentState());
+}
+
+double SparseModelPathSampler::getStateReward() const {
+    return stateRewards ? (*stateRewards)[simulator.getCurrentState()] : 0.0;
+}
+
+double SparseModelPathSampler::getReward() const {
+    return rewards ? (*rewards)[simulator.getCurrentState()] : 0.0;
+}
+
+PrismProgramPathSampler::PrismProgramPathSampler(storm::prism::Program const& program, std::vector<storm::expressions::Expression> const& stateFormulas,
+                                                 boost::optional<std::string> const& rewardModelName)
+    : stateFormulas(stateFormulas), hasRewards(rewardModelName.is_initialized()), absorbing(false) {
+    storm::generator::NextStateGeneratorOptions options;
+    if (rewardModelName) {
+        options.addRewardModel(rewardModelName.get());
+    }
+    generator = std::make_unique<storm::generator::PrismNextStateGenerator<double, uint32_t>>(program, options);
+    STORM_LOG_THROW(generator->getModelType() == storm::generator::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Statistical model checking is only supported for DTMCs.");
+
+    auto stateToIdCallback = [this](storm::generator::CompressedState const& state) {
+        successors.push_back(state);
+        return static_cast<uint32_t>(successors.size() - 1);
+    };
+    std::vector<uint32_t> initialStates = generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException,
+                    "Statistical model checking requires a unique initial state, but the program has " << initialStates.size() << ".");
+    initialState = successors[initialStates.front()];
+}
+
+void PrismProgramPathSampler::resetToInitial() {
+    currentState = initialState;
+    explore();
+}
+
+void PrismProgramPathSampler::step(double probability) {
+    if (absorbing) {
+        return;
+    }
+    auto const& choice = behavior.getChoices().front();
+    double sum = 0.0;
+    uint32_t successorIndex = 0;
+    for (auto const& entry : choice) {
+        // If the probabilities do not quite sum up to one, we take the last successor.
+        successorIndex = entry.first;
+        sum += entry.second;
+        if (sum > probability) {
+            break;
+        }
+    }
+    currentState = std::move(successors[successorIndex]);
+    explore();
+}
+
+void PrismProgramPathSampler::explore() {
+    successors.clear();
+    generator->load(currentState);
+    behavior = generator->expand([this](storm::generator::CompressedState const& state) {
+        successors.push_back(state);
+        return static_cast<uint32_t>(successors.size() - 1);
+    });
+    if (behavior.getChoices().empty()) {
+        // A deadlock state is treated as if it had a self-loop.
+        absorbing = true;
+    } else {
+        auto const& choice = behavior.getChoices().front();
+        absorbing = choice.size() == 1 && successors[choice.begin()->first] == currentState;
+    }
+}
+
+bool PrismProgramPathSampler::isAbsorbing() const {
+    return absorbing;
+}
+
+bool PrismProgramPathSampler::satisfies(uint64_t formulaIndex) const {
+    return generator->satisfies(stateFormulas[formulaIndex]);
+}
+
+double PrismProgramPathSampler::getStateReward() const {
+    return hasRewards ? behavior.getStateRewards().front() : 0.0;
+}
+
+double PrismProgramPathSampler::getReward() const {
+    if (!hasRewards) {
+        return 0.0;
+    }
+    double result = behavior.getStateRewards().front();
+    // Choices only carry rewards if the reward model has state-action rewards.
+    if (!behavior.getChoices().empty() && !behavior.getChoices().front().getRewards().empty()) {
+        result += behavior.getChoices().front().getRewards().front();
+    }
+    return result;
+}
+
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
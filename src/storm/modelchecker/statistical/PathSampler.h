@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/StateBehavior.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace modelchecker {
+namespace statistical {
+
+/*!
+ * Samples paths of a discrete-time Markov chain. The random numbers are provided by the caller, so that the sampled paths only depend on the
+ * random number streams and not on the sampler. A sampler is not thread-safe, i.e., every thread needs its own sampler.
+ */
+class PathSampler {
+   public:
+    virtual ~PathSampler() = default;
+
+    /*!
+     * Moves to the (unique) initial state.
+     */
+    virtual void resetToInitial() = 0;
+
+    /*!
+     * Moves to a successor of the current state.
+     *
+     * @param probability A value from [0,1) drawn uniformly at random that selects the successor.
+     */
+    virtual void step(double probability) = 0;
+
+    /*!
+     * Retrieves whether the current state has no successor but itself, i.e., the path does not change anymore.
+     */
+    virtual bool isAbsorbing() const = 0;
+
+    /*!
+     * Retrieves whether the current state satisfies the state formula with the given index.
+     */
+    virtual bool satisfies(uint64_t formulaIndex) const = 0;
+
+    /*!
+     * Retrieves the state reward of the current state.
+     */
+    virtual double getStateReward() const = 0;
+
+    /*!
+     * Retrieves the (expected) reward that is collected when leaving the current state, i.e., the state reward plus the reward of the choice.
+     */
+    virtual double getReward() const = 0;
+};
+
+/*!
+ * Samples the paths of an explicitly built model using a DiscreteTimeSparseModelSimulator.
+ */
+class SparseModelPathSampler : public PathSampler {
+   public:
+    /*!
+     * @param model The model whose paths are sampled.
+     * @param stateSets For every considered state formula, the states satisfying it.
+     * @param stateRewards The state rewards (if any).
+     * @param rewards For every state, the reward collected when leaving it (if any).
+     */
+    SparseModelPathSampler(storm::models::sparse::Dtmc<double> const& model, std::vector<storm::storage::BitVector> const& stateSets,
+                           std::vector<double> const* stateRewards, std::vector<double> const* rewards);
+
+    virtual void resetToInitial() override;
+    virtual void step(double probability) override;
+    virtual bool isAbsorbing() const override;
+    virtual bool satisfies(uint64_t formulaIndex) const override;
+    virtual double getStateReward() const override;
+    virtual double getReward() const override;
+
+   private:
+    storm::models::sparse::Dtmc<double> const& model;
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> simulator;
+    std::vector<storm::storage::BitVector> const& stateSets;
+    std::vector<double> const* stateRewards;
+    std::vector<double> const* rewards;
+};
+
+/*!
+ * Samples the paths of the DTMC described by a PRISM program without building its state space. The successors of a state are generated on the
+ * fly whenever the path enters the state.
+ */
+class PrismProgramPathSampler : public PathSampler {
+   public:
+    /*!
+     * @param program The program whose paths are sampled. The constants have to be defined.
+     * @param stateFormulas For every considered state formula, an equivalent expression over the variables of the program.
+     * @param rewardModelName If given, the name of the reward model whose rewards are collected ("" refers to the unique reward model).
+     */
+    PrismProgramPathSampler(storm::prism::Program const& program, std::vector<storm::expressions::Expression> const& stateFormulas,
+                            boost::optional<std::string> const& rewardModelName);
+
+    virtual void resetToInitial() override;
+    virtual void step(double probability) override;
+    virtual bool isAbsorbing() const override;
+    virtual bool satisfies(uint64_t formulaIndex) const override;
+    virtual double getStateReward() const override;
+    virtual double getReward() const override;
+
+   private:
+    /*!
+     * Generates the successors of the current state.
+     */
+    void explore();
+
+    std::unique_ptr<storm::generator::PrismNextStateGenerator<double, uint32_t>> generator;
+    std::vector<storm::expressions::Expression> stateFormulas;
+    bool hasRewards;
+    storm::generator::CompressedState initialState;
+    storm::generator::CompressedState currentState;
+    // The successors that were generated for the current state. Their indices are the ones in the distribution of the current state.
+    std::vector<storm::generator::CompressedState> successors;
+    storm::generator::StateBehavior<double, uint32_t> behavior;
+    bool absorbing;
+};
+
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,478 @@
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/special_functions/beta.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/statistical/PathSampler.h"
+#include "storm/modelchecker/statistical/StatisticalModelCheckingMethod.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/random.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+
+/*!
+ * Retrieves the number of samples that suffices to estimate a probability with the given precision and error probability (Okamoto bound).
+ */
+uint64_t getOkamotoBound(double precision, double errorProbability) {
+    return static_cast<uint64_t>(std::ceil(std::log(2.0 / errorProbability) / (2.0 * precision * precision)));
+}
+
+/*!
+ * The number of samples that is taken before the confidence interval of expected rewards is evaluated. The interval is based on the asymptotic
+ * normality of the estimate, so it is unreliable for few samples (for instance, a sample variance of 0 does not imply that the reward is
+ * deterministic).
+ */
+uint64_t const minimalNumberOfRewardSamples = 1000;
+
+}  // namespace
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::prism::Program const& program)
+    : program(program.substituteConstantsFormulas()), model(nullptr) {
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Statistical model checking is only supported for DTMCs.");
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(ModelType const& model) : model(&model) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::~StatisticalModelChecker() = default;
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    return checkTask.isOnlyInitialStatesRelevantSet() && formula.isInFragment(storm::logic::prctl()
+                                                                                  .setGloballyFormulasAllowed(false)
+                                                                                  .setLongRunAverageOperatorsAllowed(false)
+                                                                                  .setNestedOperatorsAllowed(false)
+                                                                                  .setOperatorAtTopLevelRequired(true));
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    if (checkTask.isBoundSet() && env.modelchecker().statistical().getMethod() == statistical::StatisticalMethod::Sprt) {
+        // Testing the bound directly typically requires far less samples than estimating the probability.
+        return createResult(testProbability(env, createProbabilityTask(env, checkTask.getFormula().getSubformula()), checkTask.getBound()));
+    }
+    STORM_LOG_WARN_COND(env.modelchecker().statistical().getMethod() != statistical::StatisticalMethod::Sprt,
+                        "The sequential probability ratio test requires a probability bound. Estimating the probability using the Okamoto bound instead.");
+    return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    return createResult(estimateProbability(env, createProbabilityTask(env, checkTask.getFormula())));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeNextProbabilities(Environment const& env,
+                                                                                          CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
+    return createResult(estimateProbability(env, createProbabilityTask(env, checkTask.getFormula())));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeUntilProbabilities(Environment const& env,
+                                                                                           CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+    return createResult(estimateProbability(env, createProbabilityTask(env, checkTask.getFormula())));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeCumulativeRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) {
+    storm::logic::CumulativeRewardFormula const& rewardPathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(!rewardPathFormula.isMultiDimensional() && !rewardPathFormula.getTimeBoundReference().isRewardBound(),
+                    storm::exceptions::NotSupportedException, "Statistical model checking only supports step-bounded cumulative reward formulas.");
+    STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete time bound.");
+    uint64_t const numberOfSteps = rewardPathFormula.getNonStrictBound<uint64_t>();
+
+    SamplingTask task;
+    task.rewardModelName = checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "";
+    task.evaluator = [numberOfSteps](statistical::PathSampler& sampler, storm::utility::CounterBasedRandomGenerator& generator) {
+        double reward = 0.0;
+        for (uint64_t step = 0; step < numberOfSteps; ++step) {
+            if (sampler.isAbsorbing()) {
+                // The remaining steps all collect the reward of the current state.
+                return reward + (numberOfSteps - step) * sampler.getReward();
+            }
+            reward += sampler.getReward();
+            sampler.step(generator.random());
+        }
+        return reward;
+    };
+    return createResult(estimateReward(env, task));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeInstantaneousRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) {
+    storm::logic::InstantaneousRewardFormula const& rewardPathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete time bound.");
+    uint64_t const numberOfSteps = rewardPathFormula.getBound<uint64_t>();
+
+    SamplingTask task;
+    task.rewardModelName = checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "";
+    task.evaluator = [numberOfSteps](statistical::PathSampler& sampler, storm::utility::CounterBasedRandomGenerator& generator) {
+        for (uint64_t step = 0; step < numberOfSteps && !sampler.isAbsorbing(); ++step) {
+            sampler.step(generator.random());
+        }
+        return sampler.getStateReward();
+    };
+    return createResult(estimateReward(env, task));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeReachabilityRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) {
+    uint64_t const maximalPathLength = env.modelchecker().statistical().getMaximalPathLength();
+
+    SamplingTask task;
+    task.stateFormulas.push_back(checkTask.getFormula().getSubformula().asSharedPointer());
+    task.rewardModelName = checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "";
+    task.evaluator = [maximalPathLength](statistical::PathSampler& sampler, storm::utility::CounterBasedRandomGenerator& generator) {
+        double reward = 0.0;
+        for (uint64_t step = 0; !sampler.satisfies(0); ++step) {
+            if (sampler.isAbsorbing()) {
+                // The target is never reached, so the expected reward is infinite.
+                return std::numeric_limits<double>::infinity();
+            }
+            STORM_LOG_THROW(step < maximalPathLength, storm::exceptions::InvalidOperationException,
+                            "A sampled path did not reach the target within " << maximalPathLength
+                                                                              << " steps. Consider increasing the maximal path length (--smc:maxpathlength).");
+            reward += sampler.getReward();
+            sampler.step(generator.random());
+        }
+        return reward;
+    };
+    return createResult(estimateReward(env, task));
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::SamplingTask StatisticalModelChecker<ModelType>::createProbabilityTask(
+    Environment const& env, storm::logic::Formula const& pathFormula) const {
+    if (pathFormula.isBoundedUntilFormula()) {
+        storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+        STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && !boundedUntilFormula.getTimeBoundReference().isRewardBound(),
+                        storm::exceptions::NotSupportedException, "Statistical model checking only supports step-bounded until formulas.");
+        STORM_LOG_THROW(!boundedUntilFormula.hasLowerBound() || boundedUntilFormula.hasIntegerLowerBound(), storm::exceptions::InvalidPropertyException,
+                        "Formula lower step bound must be discrete/integral.");
+        STORM_LOG_THROW(!boundedUntilFormula.hasUpperBound() || boundedUntilFormula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException,
+                        "Formula upper step bound must be discrete/integral.");
+        uint64_t const lowerBound = boundedUntilFormula.hasLowerBound() ? boundedUntilFormula.getNonStrictLowerBound<uint64_t>() : 0;
+        boost::optional<uint64_t> upperBound;
+        if (boundedUntilFormula.hasUpperBound()) {
+            upperBound = boundedUntilFormula.getNonStrictUpperBound<uint64_t>();
+        }
+        return createUntilTask(env, boundedUntilFormula.getLeftSubformula(), boundedUntilFormula.getRightSubformula(), lowerBound, upperBound);
+    } else if (pathFormula.isUntilFormula()) {
+        storm::logic::UntilFormula const& untilFormula = pathFormula.asUntilFormula();
+        return createUntilTask(env, untilFormula.getLeftSubformula(), untilFormula.getRightSubformula(), 0, boost::none);
+    } else if (pathFormula.isEventuallyFormula()) {
+        return createUntilTask(env, *storm::logic::Formula::getTrueFormula(), pathFormula.asEventuallyFormula().getSubformula(), 0, boost::none);
+    } else if (pathFormula.isNextFormula()) {
+        SamplingTask task;
+        task.stateFormulas.push_back(pathFormula.asNextFormula().getSubformula().asSharedPointer());
+        task.evaluator = [](statistical::PathSampler& sampler, storm::utility::CounterBasedRandomGenerator& generator) {
+            sampler.step(generator.random());
+            return sampler.satisfies(0) ? 1.0 : 0.0;
+        };
+        return task;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The path formula " << pathFormula << " is not supported by the statistical engine.");
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::SamplingTask StatisticalModelChecker<ModelType>::createUntilTask(
+    Environment const& env, storm::logic::Formula const& leftFormula, storm::logic::Formula const& rightFormula, uint64_t lowerBound,
+    boost::optional<uint64_t> const& upperBound) const {
+    uint64_t const maximalPathLength = env.modelchecker().statistical().getMaximalPathLength();
+
+    SamplingTask task;
+    task.stateFormulas.push_back(leftFormula.asSharedPointer());
+    task.stateFormulas.push_back(rightFormula.asSharedPointer());
+    task.evaluator = [lowerBound, upperBound, maximalPathLength](statistical::PathSampler& sampler, storm::utility::CounterBasedRandomGenerator& generator) {
+        for (uint64_t step = 0;; ++step) {
+            if (step >= lowerBound && sampler.satisfies(1)) {
+                return 1.0;
+            }
+            if ((upperBound && step >= upperBound.get()) || !sampler.satisfies(0)) {
+                return 0.0;
+            }
+            if (sampler.isAbsorbing()) {
+                // The path stays in the current state, so it satisfies the formula iff the state is eventually accepted once the lower bound is reached.
+                return (sampler.satisfies(1) && (!upperBound || lowerBound <= upperBound.get())) ? 1.0 : 0.0;
+            }
+            STORM_LOG_THROW(upperBound || step < maximalPathLength, storm::exceptions::InvalidOperationException,
+                            "A sampled path was not decided within " << maximalPathLength
+                                                                     << " steps. Consider increasing the maximal path length (--smc:maxpathlength).");
+            sampler.step(generator.random());
+        }
+    };
+    return task;
+}
+
+template<typename ModelType>
+double StatisticalModelChecker<ModelType>::estimateProbability(Environment const& env, SamplingTask const& task) const {
+    auto const& statisticalEnv = env.modelchecker().statistical();
+    double const precision = statisticalEnv.getPrecision();
+    double const errorProbability = statisticalEnv.getErrorProbability();
+
+    SampleStatistics result;
+    if (statisticalEnv.getMethod() == statistical::StatisticalMethod::ClopperPearson) {
+        // Stop as soon as the exact (Clopper-Pearson) confidence interval around the estimate is small enough. As the interval is evaluated after
+        // every batch, the error probability is split: Half of it is spent on the Okamoto bound, which limits the number of samples (and thereby
+        // the number of evaluations), and the other half is distributed evenly over all evaluations of the interval (Bonferroni correction).
+        uint64_t const maximalNumberOfSamples = getOkamotoBound(precision, errorProbability / 2.0);
+        uint64_t const batchSize = statisticalEnv.getBatchSize();
+        uint64_t const numberOfEvaluations = (maximalNumberOfSamples + batchSize - 1) / batchSize;
+        double const errorProbabilityPerEvaluation = errorProbability / (2.0 * numberOfEvaluations);
+        samplePaths(env, task, [&](SampleStatistics const& statistics) {
+            result = statistics;
+            double const n = static_cast<double>(statistics.numberOfSamples);
+            double const k = statistics.sum;
+            double const estimate = k / n;
+            double const lower = k == 0.0 ? 0.0 : boost::math::ibeta_inv(k, n - k + 1.0, errorProbabilityPerEvaluation / 2.0);
+            double const upper = k == n ? 1.0 : boost::math::ibeta_inv(k + 1.0, n - k, 1.0 - errorProbabilityPerEvaluation / 2.0);
+            return statistics.numberOfSamples >= maximalNumberOfSamples || std::max(upper - estimate, estimate - lower) <= precision;
+        });
+    } else {
+        uint64_t const maximalNumberOfSamples = getOkamotoBound(precision, errorProbability);
+        samplePaths(env, task, [&](SampleStatistics const& statistics) {
+            result = statistics;
+            return statistics.numberOfSamples >= maximalNumberOfSamples;
+        });
+    }
+    return result.sum / result.numberOfSamples;
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::testProbability(Environment const& env, SamplingTask const& task, storm::logic::Bound const& bound) const {
+    auto const& statisticalEnv = env.modelchecker().statistical();
+    double const threshold = storm::utility::convertNumber<double>(bound.threshold.evaluateAsRational());
+    double const precision = statisticalEnv.getPrecision();
+    double const errorProbability = statisticalEnv.getErrorProbability();
+
+    // We test the hypothesis H0: p >= threshold + precision against H1: p <= threshold - precision. Within the indifference region, the test may
+    // accept either hypothesis.
+    double const p0 = std::min(threshold + precision, 1.0);
+    double const p1 = std::max(threshold - precision, 0.0);
+    STORM_LOG_THROW(p0 < 1.0 || p1 > 0.0, storm::exceptions::InvalidOperationException,
+                    "The indifference region of the sequential probability ratio test covers all probabilities. Consider decreasing the precision.");
+    double const acceptH1 = std::log((1.0 - errorProbability) / errorProbability);
+    double const acceptH0 = std::log(errorProbability / (1.0 - errorProbability));
+
+    bool resultH0 = false;
+    samplePaths(env, task, [&](SampleStatistics const& statistics) {
+        double const successes = statistics.sum;
+        double const failures = statistics.numberOfSamples - statistics.sum;
+        // The log-likelihood ratio of H1 and H0. Terms without observations are skipped as they might be 0 * infinity.
+        double logLikelihoodRatio = 0.0;
+        if (successes > 0.0) {
+            logLikelihoodRatio += successes * std::log(p1 / p0);
+        }
+        if (failures > 0.0) {
+            logLikelihoodRatio += failures * std::log((1.0 - p1) / (1.0 - p0));
+        }
+        if (logLikelihoodRatio >= acceptH1) {
+            resultH0 = false;
+            return true;
+        } else if (logLikelihoodRatio <= acceptH0) {
+            resultH0 = true;
+            return true;
+        }
+        return false;
+    });
+    return storm::logic::isLowerBound(bound.comparisonType) ? resultH0 : !resultH0;
+}
+
+template<typename ModelType>
+double StatisticalModelChecker<ModelType>::estimateReward(Environment const& env, SamplingTask const& task) const {
+    auto const& statisticalEnv = env.modelchecker().statistical();
+    double const precision = statisticalEnv.getPrecision();
+    double const quantile = boost::math::quantile(boost::math::normal(), 1.0 - statisticalEnv.getErrorProbability() / 2.0);
+
+    // The rewards are not bounded, so we stop as soon as the (asymptotic) confidence interval derived from the sample variance is small enough.
+    SampleStatistics result;
+    samplePaths(env, task, [&](SampleStatistics const& statistics) {
+        result = statistics;
+        if (std::isinf(statistics.sum)) {
+            return true;
+        }
+        if (statistics.numberOfSamples < minimalNumberOfRewardSamples) {
+            return false;
+        }
+        double const n = static_cast<double>(statistics.numberOfSamples);
+        double const variance = std::max((statistics.sumOfSquares - statistics.sum * statistics.sum / n) / (n - 1.0), 0.0);
+        return quantile * std::sqrt(variance / n) <= precision;
+    });
+    return result.sum / result.numberOfSamples;
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::samplePaths(Environment const& env, SamplingTask const& task,
+                                                     std::function<bool(SampleStatistics const&)> const& isDone) const {
+    auto const& statisticalEnv = env.modelchecker().statistical();
+    uint64_t const numberOfThreads = statisticalEnv.getNumberOfThreads();
+    uint64_t const batchSize = statisticalEnv.getBatchSize();
+    uint64_t const seed = statisticalEnv.getSeed();
+
+    // Data shared by all samplers.
+    std::vector<storm::storage::BitVector> stateSets;
+    std::vector<double> stateRewards;
+    std::vector<double> rewards;
+    bool hasStateRewards = false;
+    std::vector<storm::expressions::Expression> stateExpressions;
+    if (model) {
+        SparsePropositionalModelChecker<ModelType> propositionalChecker(*model);
+        for (auto const& formula : task.stateFormulas) {
+            stateSets.push_back(propositionalChecker.check(env, *formula)->asExplicitQualitativeCheckResult().getTruthValuesVector());
+        }
+        if (task.rewardModelName) {
+            auto const& rewardModel = model->getRewardModel(task.rewardModelName.get());
+            hasStateRewards = rewardModel.hasStateRewards();
+            if (hasStateRewards) {
+                stateRewards = rewardModel.getStateRewardVector();
+            }
+            rewards = rewardModel.getTotalRewardVector(model->getTransitionMatrix());
+        }
+    } else {
+        std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program->getLabelToExpressionMapping();
+        for (auto const& formula : task.stateFormulas) {
+            stateExpressions.push_back(formula->toExpression(program->getManager(), labelToExpressionMapping));
+        }
+    }
+
+    std::vector<std::unique_ptr<statistical::PathSampler>> samplers;
+    std::vector<SampleStatistics> samplerStatistics;
+    SampleStatistics statistics;
+
+    // Samples the paths firstPath, ..., lastPath - 1 using the sampler with the given index. Every path uses its own random number stream.
+    auto samplePathRange = [&](uint64_t samplerIndex, uint64_t firstPath, uint64_t lastPath) {
+        statistical::PathSampler& sampler = *samplers[samplerIndex];
+        SampleStatistics& result = samplerStatistics[samplerIndex];
+        result = SampleStatistics();
+        storm::utility::CounterBasedRandomGenerator generator(seed);
+        for (uint64_t path = firstPath; path < lastPath; ++path) {
+            generator.setStream(path);
+            sampler.resetToInitial();
+            double const value = task.evaluator(sampler, generator);
+            ++result.numberOfSamples;
+            result.sum += value;
+            result.sumOfSquares += value * value;
+        }
+    };
+
+    auto sample = [&]() {
+#ifdef STORM_HAVE_INTELTBB
+        uint64_t const numberOfSamplers = tbb::this_task_arena::max_concurrency();
+#else
+        uint64_t const numberOfSamplers = 1;
+#endif
+        // The samplers are created upfront, as creating the generator of a program may modify the (shared) expression manager.
+        for (uint64_t samplerIndex = 0; samplerIndex < numberOfSamplers; ++samplerIndex) {
+            if (model) {
+                samplers.push_back(std::make_unique<statistical::SparseModelPathSampler>(*model, stateSets, hasStateRewards ? &stateRewards : nullptr,
+                                                                                        task.rewardModelName ? &rewards : nullptr));
+            } else {
+                samplers.push_back(std::make_unique<statistical::PrismProgramPathSampler>(program.get(), stateExpressions, task.rewardModelName));
+            }
+        }
+        samplerStatistics.resize(numberOfSamplers);
+
+        do {
+            // Every sampler processes a contiguous range of the paths of the batch. The statistics are combined in a fixed order, such that the
+            // result does not depend on the scheduling of the threads.
+            uint64_t const firstPath = statistics.numberOfSamples;
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(static_cast<uint64_t>(0), numberOfSamplers, [&](uint64_t samplerIndex) {
+                samplePathRange(samplerIndex, firstPath + batchSize * samplerIndex / numberOfSamplers,
+                                firstPath + batchSize * (samplerIndex + 1) / numberOfSamplers);
+            });
+#else
+            samplePathRange(0, firstPath, firstPath + batchSize);
+#endif
+            for (auto const& samplerResult : samplerStatistics) {
+                statistics.add(samplerResult);
+            }
+            STORM_LOG_INFO("Sampled " << statistics.numberOfSamples << " paths, current estimate is " << statistics.sum / statistics.numberOfSamples
+                                      << ".");
+        } while (!isDone(statistics));
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfThreads == 0) {
+        sample();
+    } else {
+        tbb::task_arena arena(static_cast<int>(numberOfThreads));
+        arena.execute(sample);
+    }
+#else
+    STORM_LOG_WARN_COND(numberOfThreads == 1, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    sample();
+#endif
+    STORM_LOG_INFO("Statistical model checking sampled " << statistics.numberOfSamples << " paths.");
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::SampleStatistics::add(SampleStatistics const& other) {
+    numberOfSamples += other.numberOfSamples;
+    sum += other.sum;
+    sumOfSquares += other.sumOfSquares;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::createResult(double value) const {
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(getResultState(), value);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::createResult(bool value) const {
+    return std::make_unique<ExplicitQualitativeCheckResult>(getResultState(), value);
+}
+
+template<typename ModelType>
+storm::storage::sparse::state_type StatisticalModelChecker<ModelType>::getResultState() const {
+    if (model) {
+        STORM_LOG_THROW(model->getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException,
+                        "Statistical model checking requires a unique initial state.");
+        return *model->getInitialStates().begin();
+    }
+    // Without a model, the (unique) initial state has index 0.
+    return 0;
+}
+
+template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/sparse/StateType.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+
+class Environment;
+
+namespace utility {
+class CounterBasedRandomGenerator;
+}
+
+namespace modelchecker {
+namespace statistical {
+class PathSampler;
+}
+
+/*!
+ * A model checker that estimates the values of properties of discrete-time Markov chains from a large number of independently sampled paths
+ * (statistical model checking). The paths are sampled by multiple threads, where every path draws its random numbers from its own stream. Thus,
+ * the sampled paths (and for probabilities also the result) only depend on the seed but not on the number of threads.
+ *
+ * The number of sampled paths is determined by the selected method: The Okamoto (Chernoff-Hoeffding) bound, a Clopper-Pearson interval that
+ * is evaluated after every batch (with a Bonferroni-corrected error probability) or (for probability bounds) a sequential probability ratio test.
+ * Expected rewards are estimated until the (Chow-Robbins) confidence interval based on the sample variance of a minimal number of samples is small
+ * enough.
+ *
+ * The paths are either sampled from an explicitly built model or directly from a PRISM program, i.e., without building the state space.
+ */
+template<typename ModelType>
+class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    /*!
+     * Creates a model checker that samples the paths of the DTMC described by the given program without building it.
+     */
+    explicit StatisticalModelChecker(storm::prism::Program const& program);
+
+    /*!
+     * Creates a model checker that samples the paths of the given model.
+     */
+    explicit StatisticalModelChecker(ModelType const& model);
+
+    ~StatisticalModelChecker();
+
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeNextProbabilities(Environment const& env,
+                                                                  CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
+                                                                   CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeCumulativeRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                  CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeInstantaneousRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                     CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                    CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
+
+   private:
+    // Evaluates the sampled path, i.e., returns 1 or 0 for path formulas and the collected reward for reward formulas. The random number generator
+    // is already set to the stream of the path.
+    typedef std::function<double(statistical::PathSampler&, storm::utility::CounterBasedRandomGenerator&)> PathEvaluator;
+
+    /*!
+     * The paths that need to be sampled to check a formula: The state formulas occurring in the path formula (referred to by their index) and
+     * the reward model whose rewards are collected (if any).
+     */
+    struct SamplingTask {
+        std::vector<std::shared_ptr<storm::logic::Formula const>> stateFormulas;
+        boost::optional<std::string> rewardModelName;
+        PathEvaluator evaluator;
+    };
+
+    // Aggregated values of a number of sampled paths.
+    struct SampleStatistics {
+        uint64_t numberOfSamples = 0;
+        double sum = 0.0;
+        double sumOfSquares = 0.0;
+
+        void add(SampleStatistics const& other);
+    };
+
+    /*!
+     * Creates the task of sampling paths that satisfy the given path formula.
+     */
+    SamplingTask createProbabilityTask(Environment const& env, storm::logic::Formula const& pathFormula) const;
+
+    /*!
+     * Creates the task of sampling paths that satisfy the given (bounded) until formula.
+     */
+    SamplingTask createUntilTask(Environment const& env, storm::logic::Formula const& leftFormula, storm::logic::Formula const& rightFormula,
+                                 uint64_t lowerBound, boost::optional<uint64_t> const& upperBound) const;
+
+    /*!
+     * Estimates the probability of the paths satisfying the path formula of the given task.
+     */
+    double estimateProbability(Environment const& env, SamplingTask const& task) const;
+
+    /*!
+     * Decides whether the probability of the paths satisfying the path formula of the given task meets the given bound, using a sequential
+     * probability ratio test.
+     */
+    bool testProbability(Environment const& env, SamplingTask const& task, storm::logic::Bound const& bound) const;
+
+    /*!
+     * Estimates the expected reward collected by the paths.
+     */
+    double estimateReward(Environment const& env, SamplingTask const& task) const;
+
+    /*!
+     * Samples paths in batches until the given callback, which is invoked with the statistics of all paths sampled so far, returns true.
+     */
+    void samplePaths(Environment const& env, SamplingTask const& task, std::function<bool(SampleStatistics const&)> const& isDone) const;
+
+    std::unique_ptr<CheckResult> createResult(double value) const;
+    std::unique_ptr<CheckResult> createResult(bool value) const;
+
+    /*!
+     * Retrieves the state to which the results refer, i.e., the unique initial state.
+     */
+    storm::storage::sparse::state_type getResultState() const;
+
+    // The program to sample from (if no model is given).
+    boost::optional<storm::prism::Program> program;
+
+    // The model to sample from (if no program is given).
+    ModelType const* model;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
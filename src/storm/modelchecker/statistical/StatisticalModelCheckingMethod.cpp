@@ -0,0 +1,20 @@
+#include "storm/modelchecker/statistical/StatisticalModelCheckingMethod.h"
+
+namespace storm {
+namespace modelchecker {
+namespace statistical {
+
+std::string toString(StatisticalMethod m) {
+    switch (m) {
+        case StatisticalMethod::Chernoff:
+            return "chernoff";
+        case StatisticalMethod::ClopperPearson:
+            return "clopper-pearson";
+        case StatisticalMethod::Sprt:
+            return "sprt";
+    }
+    return "invalid";
+}
+}  // namespace statistical
+}  // namespace modelchecker
+}  // namespace storm
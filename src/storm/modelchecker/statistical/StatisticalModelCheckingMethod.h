@@ -0,0 +1,11 @@
+#pragma once
+
+#include "storm/utility/ExtendSettingEnumWithSelectionField.h"
+
+namespace storm {
+namespace modelchecker {
+namespace statistical {
+ExtendEnumsWithSelectionField(StatisticalMethod, Chernoff, ClopperPearson, Sprt)
+}
+}  // namespace modelchecker
+}  // namespace storm
@@ -21,6 +21,8 @@ const std::string BisimulationSettings::signatureModeOptionName = "sigmode";
 const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
+const std::string BisimulationSettings::sparseRefinementModeOptionName = "sparserefine";
+const std::string BisimulationSettings::threadsOptionName = "threads";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
@@ -83,14 +85,36 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .build())
                         .build());
 
-    std::vector<std::string> refinementModes = {"full", "changed"};
-    this->addOption(storm::settings::OptionBuilder(moduleName, refinementModeOptionName, true, "Sets which refinement mode to use.")
+    std::vector<std::string> refinementModes = {"full", "changed", "incremental"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, refinementModeOptionName, true,
+                                                   "Sets which refinement mode to use (incremental only recomputes the signatures of blocks with changed "
+                                                   "successors).")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.")
                                          .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    std::vector<std::string> sparseRefinementModes = {"splitter", "signature"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementModeOptionName, true,
+                                                   "Sets which refinement mode to use for sparse models (signature only applies to strong bisimulation).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementModes))
+                                         .setDefaultValueString("splitter")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads used for signature computation and quotient construction of sparse models "
+                                                   "(requires Intel TBB).")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 uses all available cores.")
+                                .setDefaultValueUnsignedInteger(1)
+                                .build())
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -169,10 +193,24 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
         return RefinementMode::Full;
     } else if (refinementModeAsString == "changed") {
         return RefinementMode::ChangedStates;
+    } else if (refinementModeAsString == "incremental") {
+        return RefinementMode::Incremental;
     }
     return RefinementMode::Full;
 }
 
+BisimulationSettings::SparseRefinementMode BisimulationSettings::getSparseRefinementMode() const {
+    std::string refinementModeAsString = this->getOption(sparseRefinementModeOptionName).getArgumentByName("mode").getValueAsString();
+    if (refinementModeAsString == "signature") {
+        return SparseRefinementMode::Signature;
+    }
+    return SparseRefinementMode::Splitter;
+}
+
+uint64_t BisimulationSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
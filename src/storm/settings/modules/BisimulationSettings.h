@@ -22,7 +22,9 @@ class BisimulationSettings : public ModuleSettings {
 
     enum class InitialPartitionMode { Regular, Finer };
 
-    enum class RefinementMode { Full, ChangedStates };
+    enum class RefinementMode { Full, ChangedStates, Incremental };
+
+    enum class SparseRefinementMode { Splitter, Signature };
 
     /*!
      * Creates a new set of bisimulation settings.
@@ -96,6 +98,20 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the refinement mode to use for sparse models.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    SparseRefinementMode getSparseRefinementMode() const;
+
+    /*!
+     * Retrieves the number of threads that are used for sparse bisimulation.
+     * NOTE: only applies to sparse bisimulation.
+     *
+     * @return The number of threads. A value of 0 means that all available cores are used.
+     */
+    uint64_t getNumberOfThreads() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -111,6 +127,8 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string reuseOptionName;
     static const std::string initialPartitionOptionName;
     static const std::string refinementModeOptionName;
+    static const std::string sparseRefinementModeOptionName;
+    static const std::string threadsOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
 };
@@ -32,6 +32,7 @@ const std::string BlackboxSettings::convertToDotBMdpOptionName = "bmdpToDot";
 
 // simulation constants
 const std::string BlackboxSettings::numberOfSamplingsPerSimulationStepOptionName = "stepsim";
+const std::string BlackboxSettings::numberOfSimulationThreadsOptionName = "simthreads";
 const std::string BlackboxSettings::simulationHeuristicOptionName = "simheuristic";
 const std::string BlackboxSettings::seedSimHeuristicOptionName = "seedsimheuristic";
 // plot simulation
@@ -133,6 +134,15 @@ BlackboxSettings::BlackboxSettings() : ModuleSettings(moduleName) {
                                          .build())
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfSimulationThreadsOptionName, true,
+                                                   "Sets the number of threads that sample paths in parallel.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of simulation threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
     std::vector<std::string> simulationHeuristics = {"naive"};
     this->addOption(storm::settings::OptionBuilder(moduleName, simulationHeuristicOptionName, true, "Sets the heuristic used for simulation.")
                         .setIsAdvanced()
@@ -283,6 +293,10 @@ uint_fast64_t BlackboxSettings::getNumberOfSamplingsPerSimulationStep() const {
     return this->getOption(numberOfSamplingsPerSimulationStepOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
 }
 
+uint_fast64_t BlackboxSettings::getNumberOfSimulationThreads() const {
+    return this->getOption(numberOfSimulationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 uint_fast64_t BlackboxSettings::getMaxIterations() const {
     return this->getOption(maxNumIterationsOptionName).getArgumentByName("maxIter").getValueAsUnsignedInteger();
 }
@@ -340,6 +354,7 @@ bool BlackboxSettings::getIsGreybox() const {
 
 bool BlackboxSettings::check() const {
     bool optionsSet = this->getOption(numberOfSamplingsPerSimulationStepOptionName).getHasOptionBeenSet() ||
+                      this->getOption(numberOfSimulationThreadsOptionName).getHasOptionBeenSet() ||
                       this->getOption(simulationHeuristicOptionName).getHasOptionBeenSet() ||
                       this->getOption(seedSimHeuristicOptionName).getHasOptionBeenSet() ||
                       this->getOption(deltaDistributionOptionName).getHasOptionBeenSet() ||
@@ -98,6 +98,13 @@ class BlackboxSettings : public ModuleSettings {
      */
     uint_fast64_t getNumberOfSamplingsPerSimulationStep() const;
 
+    /*!
+     * Retrieves the number of threads that sample paths in parallel.
+     *
+     * @return The number of simulation threads.
+     */
+    uint_fast64_t getNumberOfSimulationThreads() const;
+
     /*!
      * Retrieves the selected next-state heuristic.
      *
@@ -180,6 +187,7 @@ class BlackboxSettings : public ModuleSettings {
 
     // simulation step constants
     static const std::string numberOfSamplingsPerSimulationStepOptionName;
+    static const std::string numberOfSimulationThreadsOptionName;
     static const std::string simulationHeuristicOptionName;
     static const std::string seedSimHeuristicOptionName;  // TODO replace with one general seed
 
@@ -21,6 +21,9 @@ const std::string BuildSettings::moduleName = "build";
 const std::string explorationOrderOptionName = "explorder";
 const std::string explorationOrderOptionShortName = "eo";
 const std::string explorationChecksOptionName = "explchecks";
+const std::string explorationThreadsOptionName = "explthreads";
+const std::string explorationReproducibleOptionName = "explreproducible";
+const std::string explorationCompiledOptionName = "explcompiled";
 const std::string explorationChecksOptionShortName = "ec";
 const std::string prismCompatibilityOptionName = "prismcompat";
 const std::string prismCompatibilityOptionShortName = "pc";
@@ -84,6 +87,23 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads used to explore the state space of explicit models (requires Intel TBB).")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 uses all available cores.")
+                                .setDefaultValueUnsignedInteger(1)
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationReproducibleOptionName, false,
+                                                   "If set, the states explored by multiple threads get the same indices as in the sequential exploration.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationCompiledOptionName, false,
+                                                   "If set, the guards, updates and rewards of PRISM programs are compiled to code that is evaluated "
+                                                   "directly on the explored states (only for floating point models).")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added")
                         .setIsAdvanced()
                         .build());
@@ -183,6 +203,18 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
 
+uint64_t BuildSettings::getExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BuildSettings::isExplorationReproducibleSet() const {
+    return this->getOption(explorationReproducibleOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isExplorationCompiledSet() const {
+    return this->getOption(explorationCompiledOptionName).getHasOptionBeenSet();
+}
+
 bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
@@ -35,6 +35,27 @@ class BuildSettings : public ModuleSettings {
      */
     storm::builder::ExplorationOrder getExplorationOrder() const;
 
+    /*!
+     * Retrieves the number of threads used to explore the state space of explicit models.
+     *
+     * @return The number of threads. A value of 0 means that all available cores are used.
+     */
+    uint64_t getExplorationThreads() const;
+
+    /*!
+     * Retrieves whether the states explored by multiple threads are to be numbered as in the sequential exploration.
+     *
+     * @return True iff the state order is to be reproducible.
+     */
+    bool isExplorationReproducibleSet() const;
+
+    /*!
+     * Retrieves whether the expressions of the model are to be compiled for the exploration of explicit models.
+     *
+     * @return True iff the expressions are to be compiled.
+     */
+    bool isExplorationCompiledSet() const;
+
     /*!
      * Retrieves whether the PRISM compatibility mode was enabled.
      *
@@ -31,6 +31,7 @@ const std::string CoreSettings::ddLibraryOptionName = "ddlib";
 const std::string CoreSettings::cudaOptionName = "cuda";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::mecThreadsOptionName = "mec-threads";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -88,6 +89,19 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, mecThreadsOptionName, false,
+                                       "Sets the number of threads used to decompose large end component candidates into SCCs (requires Intel TBB).")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 uses all available cores.")
+                             .setDefaultValueUnsignedInteger(1)
+                             .build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                             "min-size", "The minimal number of states of a candidate for which its SCCs are computed in parallel.")
+                             .setDefaultValueUnsignedInteger(100000)
+                             .makeOptional()
+                             .build())
+            .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -166,6 +180,14 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+uint64_t CoreSettings::getNumberOfMecThreads() const {
+    return this->getOption(mecThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t CoreSettings::getMinimalMecCandidateSizeForParallelDecomposition() const {
+    return this->getOption(mecThreadsOptionName).getArgumentByName("min-size").getValueAsUnsignedInteger();
+}
+
 bool CoreSettings::isUseCudaSet() const {
     return this->getOption(cudaOptionName).getHasOptionBeenSet();
 }
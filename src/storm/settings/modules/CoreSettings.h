@@ -102,6 +102,20 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Retrieves the number of threads that are used to decompose large end component candidates into SCCs.
+     *
+     * @return The number of threads. A value of 0 means that all available cores are used.
+     */
+    uint64_t getNumberOfMecThreads() const;
+
+    /*!
+     * Retrieves the minimal number of states of an end component candidate for which its SCCs are computed by multiple threads.
+     *
+     * @return The minimal number of states.
+     */
+    uint64_t getMinimalMecCandidateSizeForParallelDecomposition() const;
+
     /*!
      * Retrieves whether the option to use CUDA is set.
      *
@@ -142,6 +156,7 @@ class CoreSettings : public ModuleSettings {
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
     static const std::string cudaOptionName;
+    static const std::string mecThreadsOptionName;
 };
 
 }  // namespace modules
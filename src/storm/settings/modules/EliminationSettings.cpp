@@ -18,9 +18,10 @@ const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+const std::string EliminationSettings::threadsOptionName = "threads";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "mindeg", "minfill"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.")
             .setIsAdvanced()
@@ -54,6 +55,15 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads used to treat independent SCCs in the hybrid elimination technique "
+                                                   "(requires Intel TBB).")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 uses all available cores.")
+                                .setDefaultValueUnsignedInteger(1)
+                                .build())
+                        .build());
 }
 
 EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -85,6 +95,10 @@ EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder()
         return EliminationOrder::DynamicPenalty;
     } else if (eliminationOrderAsString == "regex") {
         return EliminationOrder::RegularExpression;
+    } else if (eliminationOrderAsString == "mindeg") {
+        return EliminationOrder::MinimumDegree;
+    } else if (eliminationOrderAsString == "minfill") {
+        return EliminationOrder::MinimumFill;
     } else {
         STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
     }
@@ -101,6 +115,23 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
+
+uint64_t EliminationSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+void EliminationSettings::setEliminationMethod(EliminationMethod method) {
+    STORM_LOG_THROW(method != EliminationMethod::Scc, storm::exceptions::IllegalArgumentValueException, "Illegal elimination method.");
+    this->getOption(eliminationMethodOptionName).getArgumentByName("name").setFromStringValue(method == EliminationMethod::State ? "state" : "hybrid");
+}
+
+void EliminationSettings::setMaximalSccSize(uint64_t maximalSccSize) {
+    this->getOption(maximalSccSizeOptionName).getArgumentByName("maxsize").setFromStringValue(std::to_string(maximalSccSize));
+}
+
+void EliminationSettings::setNumberOfThreads(uint64_t numberOfThreads) {
+    this->getOption(threadsOptionName).getArgumentByName("count").setFromStringValue(std::to_string(numberOfThreads));
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
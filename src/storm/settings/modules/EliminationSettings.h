@@ -15,7 +15,18 @@ class EliminationSettings : public ModuleSettings {
     /*!
      * An enum that contains all available state elimination orders.
      */
-    enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+    enum class EliminationOrder {
+        Forward,
+        ForwardReversed,
+        Backward,
+        BackwardReversed,
+        Random,
+        StaticPenalty,
+        DynamicPenalty,
+        RegularExpression,
+        MinimumDegree,
+        MinimumFill
+    };
 
     /*!
      * An enum that contains all available elimination methods.
@@ -62,6 +73,34 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves the number of threads that are used to treat independent SCCs in the hybrid elimination technique.
+     *
+     * @return The number of threads. A value of 0 means that all available cores are used.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Sets the elimination method to the specified value.
+     *
+     * @param method The new elimination method.
+     */
+    void setEliminationMethod(EliminationMethod method);
+
+    /*!
+     * Sets the maximal size of an SCC on which state elimination is to be directly applied.
+     *
+     * @param maximalSccSize The new maximal size.
+     */
+    void setMaximalSccSize(uint64_t maximalSccSize);
+
+    /*!
+     * Sets the number of threads that are used to treat independent SCCs in the hybrid elimination technique.
+     *
+     * @param numberOfThreads The new number of threads. A value of 0 means that all available cores are used.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
     const static std::string moduleName;
 
    private:
@@ -70,6 +109,7 @@ class EliminationSettings : public ModuleSettings {
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string threadsOptionName;
 };
 
 }  // namespace modules
@@ -173,6 +173,27 @@ class IOSettings : public ModuleSettings {
      */
     bool isExplicitExportPlaceholdersDisabled() const;
 
+    /*!
+     * Retrieves the number of threads used to parse the states of a DRN file.
+     *
+     * @return The number of threads. A value of 0 means that all available cores are used.
+     */
+    uint64_t getExplicitDRNThreads() const;
+
+    /*!
+     * Retrieves whether the explicit option with the binary drb format was set.
+     *
+     * @return True if the explicit option with the binary drb format was set.
+     */
+    bool isExplicitBinarySet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the model in the binary drb format.
+     *
+     * @return The name of the drb file that contains the model.
+     */
+    std::string getExplicitBinaryFilename() const;
+
     /*!
      * Retrieves whether the explicit option with IMCA was set.
      *
@@ -390,6 +411,8 @@ class IOSettings : public ModuleSettings {
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
     static const std::string explicitDrnOptionShortName;
+    static const std::string explicitBinaryOptionName;
+    static const std::string explicitBinaryOptionShortName;
     static const std::string explicitImcaOptionName;
     static const std::string explicitImcaOptionShortName;
     static const std::string prismInputOptionName;
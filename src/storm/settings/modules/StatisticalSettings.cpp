@@ -0,0 +1,135 @@
+#include "storm/settings/modules/StatisticalSettings.h"
+
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string StatisticalSettings::moduleName = "smc";
+const std::string methodOptionName = "method";
+const std::string precisionOptionName = "precision";
+const std::string precisionOptionShortName = "eps";
+const std::string errorProbabilityOptionName = "error";
+const std::string threadsOptionName = "threads";
+const std::string batchSizeOptionName = "batch";
+const std::string seedOptionName = "seed";
+const std::string maximalPathLengthOptionName = "maxpathlength";
+
+StatisticalSettings::StatisticalSettings() : ModuleSettings(moduleName) {
+    std::vector<std::string> methods = {"chernoff", "clopper-pearson", "sprt"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, methodOptionName, true, "Sets the method that decides when enough paths have been sampled.")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "name",
+                             "The name of the method. 'chernoff' samples the number of paths given by the Okamoto bound, 'clopper-pearson' stops as soon as "
+                             "the exact confidence interval is small enough and 'sprt' decides probability bounds with a sequential probability ratio test.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods))
+                             .setDefaultValueString("chernoff")
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true,
+                                                   "The maximal distance between the estimate and the actual value (or the half-width of the "
+                                                   "indifference region of the sequential probability ratio test).")
+                        .setShortName(precisionOptionShortName)
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision.")
+                                         .setDefaultValueDouble(1e-02)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, errorProbabilityOptionName, true,
+                                                   "The maximal probability with which the result may violate the precision.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.")
+                                         .setDefaultValueDouble(5e-02)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that sample paths (requires Intel TBB).")
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 uses all available cores.")
+                                .setDefaultValueUnsignedInteger(1)
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true,
+                                                   "Sets the number of paths that are sampled before the stopping criterion is checked again.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths.")
+                                         .setDefaultValueUnsignedInteger(10000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true,
+                                                   "Sets the seed for the random number generation. The result does not depend on the number of threads.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maximalPathLengthOptionName, true,
+                                                   "Sets the maximal length of paths for properties that do not bound the length of the paths themselves.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("length", "The maximal number of steps.")
+                                         .setDefaultValueUnsignedInteger(1000000)
+                                         .build())
+                        .build());
+}
+
+storm::modelchecker::statistical::StatisticalMethod StatisticalSettings::getMethod() const {
+    std::string methodAsString = this->getOption(methodOptionName).getArgumentByName("name").getValueAsString();
+    if (methodAsString == "chernoff") {
+        return storm::modelchecker::statistical::StatisticalMethod::Chernoff;
+    } else if (methodAsString == "clopper-pearson") {
+        return storm::modelchecker::statistical::StatisticalMethod::ClopperPearson;
+    } else if (methodAsString == "sprt") {
+        return storm::modelchecker::statistical::StatisticalMethod::Sprt;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown statistical model checking method '" << methodAsString << "'.");
+}
+
+double StatisticalSettings::getPrecision() const {
+    return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double StatisticalSettings::getErrorProbability() const {
+    return this->getOption(errorProbabilityOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t StatisticalSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalSettings::getBatchSize() const {
+    return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool StatisticalSettings::isSeedSet() const {
+    return this->getOption(seedOptionName).getHasOptionBeenSet();
+}
+
+uint64_t StatisticalSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalSettings::getMaximalPathLength() const {
+    return this->getOption(maximalPathLengthOptionName).getArgumentByName("length").getValueAsUnsignedInteger();
+}
+
+bool StatisticalSettings::check() const {
+    bool optionsSet = this->getOption(methodOptionName).getHasOptionBeenSet() || this->getOption(precisionOptionName).getHasOptionBeenSet() ||
+                      this->getOption(errorProbabilityOptionName).getHasOptionBeenSet() || this->getOption(threadsOptionName).getHasOptionBeenSet() ||
+                      this->getOption(batchSizeOptionName).getHasOptionBeenSet() || this->getOption(seedOptionName).getHasOptionBeenSet() ||
+                      this->getOption(maximalPathLengthOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Statistical || !optionsSet,
+                        "Statistical model checking engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
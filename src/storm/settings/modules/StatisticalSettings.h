@@ -0,0 +1,69 @@
+#pragma once
+
+#include "storm/modelchecker/statistical/StatisticalModelCheckingMethod.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the statistical model checking engine.
+ */
+class StatisticalSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of statistical model checking settings.
+     */
+    StatisticalSettings();
+
+    /*!
+     * Retrieves the method that decides when enough paths have been sampled.
+     */
+    storm::modelchecker::statistical::StatisticalMethod getMethod() const;
+
+    /*!
+     * Retrieves the maximal distance between the estimated and the actual value. For the sequential probability ratio test, this is the
+     * half-width of the indifference region around the probability bound.
+     */
+    double getPrecision() const;
+
+    /*!
+     * Retrieves the maximal probability with which the result may violate the precision.
+     */
+    double getErrorProbability() const;
+
+    /*!
+     * Retrieves the number of threads that sample paths. 0 means that all available cores are used.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves the number of paths that are sampled before the stopping criterion is checked again.
+     */
+    uint64_t getBatchSize() const;
+
+    /*!
+     * Retrieves whether a seed for the random number generation was set.
+     */
+    bool isSeedSet() const;
+
+    /*!
+     * Retrieves the seed for the random number generation.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves the maximal length of a sampled path for properties whose paths are not bounded by the property itself.
+     */
+    uint64_t getMaximalPathLength() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
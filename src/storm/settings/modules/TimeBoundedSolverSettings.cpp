@@ -13,9 +13,12 @@ namespace modules {
 const std::string TimeBoundedSolverSettings::moduleName = "timebounded";
 
 const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
+const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
+const std::string TimeBoundedSolverSettings::krylovDimensionOptionName = "krylovdim";
 const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
 const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
 const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
+const std::string TimeBoundedSolverSettings::noSteadyStateDetectionOptionName = "nosteadystate";
 
 TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> maMethods = {"imca", "unifplus"};
@@ -27,6 +30,24 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                                          .build())
                         .build());
 
+    std::vector<std::string> ctmcMethods = {"uniformization", "krylov"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false, "The method to use to compute transient probabilities of CTMCs.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods))
+                                         .setDefaultValueString("uniformization")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, krylovDimensionOptionName, false,
+                                                   "The maximal dimension of the Krylov subspaces used to compute transient probabilities of CTMCs.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("dim", "The dimension.")
+                                         .setDefaultValueUnsignedInteger(30)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(1))
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
@@ -48,6 +69,11 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                              .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                              .build())
             .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, noSteadyStateDetectionOptionName, false,
+                                                   "Disables stopping the computation of transient probabilities (of CTMCs) once a steady state is detected.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool TimeBoundedSolverSettings::isPrecisionSet() const {
@@ -70,6 +96,18 @@ storm::solver::MaBoundedReachabilityMethod TimeBoundedSolverSettings::getMaMetho
     return storm::solver::MaBoundedReachabilityMethod::UnifPlus;
 }
 
+storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+    std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (techniqueAsString == "krylov") {
+        return storm::solver::CtmcTransientMethod::Krylov;
+    }
+    return storm::solver::CtmcTransientMethod::Uniformization;
+}
+
+uint64_t TimeBoundedSolverSettings::getKrylovDimension() const {
+    return this->getOption(krylovDimensionOptionName).getArgumentByName("dim").getValueAsUnsignedInteger();
+}
+
 bool TimeBoundedSolverSettings::isMaMethodSetFromDefaultValue() const {
     return !this->getOption(maMethodOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(maMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
@@ -79,6 +117,10 @@ double TimeBoundedSolverSettings::getUnifPlusKappa() const {
     return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
 }
 
+bool TimeBoundedSolverSettings::isSteadyStateDetectionSet() const {
+    return !this->getOption(noSteadyStateDetectionOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -26,6 +26,16 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     storm::solver::MaBoundedReachabilityMethod getMaMethod() const;
 
+    /*!
+     * Retrieves the selected technique for computing transient probabilities of CTMCs.
+     */
+    storm::solver::CtmcTransientMethod getCtmcMethod() const;
+
+    /*!
+     * Retrieves the (maximal) dimension of the Krylov subspaces used for computing transient probabilities of CTMCs.
+     */
+    uint64_t getKrylovDimension() const;
+
     /*!
      * Retrieves whether the precision has been set.
      *
@@ -50,14 +60,22 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     double getUnifPlusKappa() const;
 
+    /*!
+     * Retrieves whether the computation of transient probabilities stops early once the iterations reach a steady state.
+     */
+    bool isSteadyStateDetectionSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string maMethodOptionName;
+    static const std::string ctmcMethodOptionName;
+    static const std::string krylovDimensionOptionName;
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string unifPlusKappaOptionName;
+    static const std::string noSteadyStateDetectionOptionName;
 };
 
 }  // namespace modules
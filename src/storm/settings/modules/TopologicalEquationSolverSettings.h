@@ -60,6 +60,13 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
 
+    /*!
+     * Retrieves the number of threads that are used to solve independent SCCs concurrently.
+     *
+     * @return The number of threads. A value of 0 means that all available cores are used.
+     */
+    uint64_t getNumberOfThreads() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -69,6 +76,7 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
+    static const std::string numberOfThreadsOptionName;
 };
 
 }  // namespace modules
@@ -35,10 +35,14 @@ bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStep()
 
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t action) {
+    return step(action, generator.random());
+}
+
+template<typename ValueType, typename RewardModelType>
+bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t action, ValueType const& probability) {
     // TODO lots of optimization potential.
     //  E.g., do not sample random numbers if there is only a single transition
     lastRewards = zeroRewards;
-    ValueType probability = generator.random();
     STORM_LOG_ASSERT(action < model.getTransitionMatrix().getRowGroupSize(currentState), "Action index higher than number of actions");
     uint64_t row = model.getTransitionMatrix().getRowGroupIndices()[currentState] + action;
     uint64_t i = 0;
@@ -48,23 +52,21 @@ bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t
         }
         ++i;
     }
-    ValueType sum = storm::utility::zero<ValueType>();
-    for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
-        sum += entry.getValue();
-        if (sum >= probability) {
-            currentState = entry.getColumn();
-            i = 0;
-            for (auto const& rewModPair : model.getRewardModels()) {
-                if (rewModPair.second.hasStateRewards()) {
-                    lastRewards[i] += rewModPair.second.getStateReward(currentState);
-                }
-                ++i;
-            }
-            return true;
+    auto const& successors = model.getTransitionMatrix().getRow(row);
+    uint64_t const offset = samplingCache.selectEntry(row, successors.begin(), successors.end(), probability);
+    if (offset == successors.getNumberOfEntries()) {
+        // This position should never be reached
+        return false;
+    }
+    currentState = (successors.begin() + offset)->getColumn();
+    i = 0;
+    for (auto const& rewModPair : model.getRewardModels()) {
+        if (rewModPair.second.hasStateRewards()) {
+            lastRewards[i] += rewModPair.second.getStateReward(currentState);
         }
+        ++i;
     }
-    // This position should never be reached
-    return false;
+    return true;
 }
 
 template<typename ValueType, typename RewardModelType>
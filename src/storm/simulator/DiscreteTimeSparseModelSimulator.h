@@ -1,5 +1,6 @@
 #include <cstdint>
 #include "storm/models/sparse/Model.h"
+#include "storm/storage/SuccessorSamplingCache.h"
 #include "storm/utility/random.h"
 
 namespace storm {
@@ -19,6 +20,11 @@ class DiscreteTimeSparseModelSimulator {
     DiscreteTimeSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model);
     void setSeed(uint64_t);
     bool step(uint64_t action);
+    /**
+     * Takes the given action and selects the successor with the given probability, i.e., the successor at which the cumulative probability of the
+     * successors reaches the given value. This allows the caller to provide the random numbers, e.g., from independent streams.
+     */
+    bool step(uint64_t action, ValueType const& probability);
     bool randomStep();
     std::vector<ValueType> const& getLastRewards() const;
     uint64_t getCurrentState() const;
@@ -30,6 +36,8 @@ class DiscreteTimeSparseModelSimulator {
     std::vector<ValueType> lastRewards;
     std::vector<ValueType> zeroRewards;
     storm::utility::RandomProbabilityGenerator<ValueType> generator;
+    // The cumulative probabilities of rows with many successors, which allows to select a successor via binary search.
+    storm::storage::SuccessorSamplingCache<ValueType> samplingCache;
 };
 }  // namespace simulator
 }  // namespace storm
\ No newline at end of file
@@ -114,10 +114,13 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Envi
 }
 
 template<typename ValueType>
-void IterativeMinMaxLinearEquationSolver<ValueType>::setUpViOperator() const {
+void IterativeMinMaxLinearEquationSolver<ValueType>::setUpViOperator(Environment const& env) const {
     if (!viOperator) {
         viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, false>>();
+        viOperator->setNumberOfThreads(env.solver().minMax().getNumberOfThreads());
         viOperator->setMatrixBackwards(*this->A);
+    } else if (viOperator->getNumberOfThreads() != env.solver().minMax().getNumberOfThreads()) {
+        viOperator->setNumberOfThreads(env.solver().minMax().getNumberOfThreads());
     }
     if (this->choiceFixedForRowGroup) {
         // Ignore those rows that are not selected
@@ -130,8 +133,8 @@ void IterativeMinMaxLinearEquationSolver<ValueType>::setUpViOperator() const {
 }
 
 template<typename ValueType>
-void IterativeMinMaxLinearEquationSolver<ValueType>::extractScheduler(std::vector<ValueType>& x, std::vector<ValueType> const& b,
-                                                                      OptimizationDirection const& dir, bool updateX) const {
+void IterativeMinMaxLinearEquationSolver<ValueType>::extractScheduler(Environment const& env, std::vector<ValueType>& x,
+                                                                      std::vector<ValueType> const& b, OptimizationDirection const& dir, bool updateX) const {
     // Make sure that storage for scheduler choices is available
     if (!this->schedulerChoices) {
         this->schedulerChoices = std::vector<uint64_t>(x.size(), 0);
@@ -141,7 +144,7 @@ void IterativeMinMaxLinearEquationSolver<ValueType>::extractScheduler(std::vecto
     // Set the correct choices.
     STORM_LOG_WARN_COND(viOperator, "Expected VI operator to be initialized for scheduler extraction. Initializing now, but this is inefficient.");
     if (!viOperator) {
-        setUpViOperator();
+        setUpViOperator(env);
     }
     storm::solver::helper::SchedulerTrackingHelper<ValueType> schedHelper(viOperator);
     schedHelper.computeScheduler(x, b, dir, *this->schedulerChoices, updateX ? &x : nullptr);
@@ -404,7 +407,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
         return true;
     }
 
-    setUpViOperator();
+    setUpViOperator(env);
 
     helper::OptimisticValueIterationHelper<ValueType, false> oviHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
@@ -432,7 +435,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
 
     // If requested, we store the scheduler for retrieval.
     if (this->isTrackSchedulerSet()) {
-        this->extractScheduler(x, b, dir);
+        this->extractScheduler(env, x, b, dir);
     }
 
     if (!this->isCachingEnabled()) {
@@ -445,7 +448,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                                                   std::vector<ValueType> const& b) const {
-    setUpViOperator();
+    setUpViOperator(env);
 
     // By default, we can not provide any guarantee
     SolverGuarantee guarantee = SolverGuarantee::None;
@@ -514,7 +517,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
 
     // If requested, we store the scheduler for retrieval.
     if (this->isTrackSchedulerSet()) {
-        this->extractScheduler(x, b, dir);
+        this->extractScheduler(env, x, b, dir);
     }
 
     if (!this->isCachingEnabled()) {
@@ -538,7 +541,7 @@ void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::s
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir,
                                                                                      std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-    setUpViOperator();
+    setUpViOperator(env);
     helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
     auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
@@ -562,7 +565,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
 
     // If requested, we store the scheduler for retrieval.
     if (this->isTrackSchedulerSet()) {
-        this->extractScheduler(x, b, dir);
+        this->extractScheduler(env, x, b, dir);
     }
 
     if (!this->isCachingEnabled()) {
@@ -586,7 +589,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
         upperBound = this->getUpperBound(true);
     }
 
-    setUpViOperator();
+    setUpViOperator(env);
 
     auto precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
     uint64_t numIterations{0};
@@ -607,7 +610,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
 
     // If requested, we store the scheduler for retrieval.
     if (this->isTrackSchedulerSet()) {
-        this->extractScheduler(x, b, dir);
+        this->extractScheduler(env, x, b, dir);
     }
 
     this->reportStatus(status, numIterations);
@@ -649,7 +652,7 @@ template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                                                   std::vector<ValueType> const& b) const {
     // Set up two value iteration operators. One for exact and one for imprecise computations
-    setUpViOperator();
+    setUpViOperator(env);
     std::shared_ptr<helper::ValueIterationOperator<storm::RationalNumber, false>> exactOp;
     std::shared_ptr<helper::ValueIterationOperator<double, false>> impreciseOp;
     std::function<bool(uint64_t, uint64_t)> fixedChoicesCallback;
@@ -690,7 +693,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearc
 
     // If requested, we store the scheduler for retrieval.
     if (this->isTrackSchedulerSet()) {
-        this->extractScheduler(x, b, dir);
+        this->extractScheduler(env, x, b, dir);
     }
 
     if (!this->isCachingEnabled()) {
@@ -55,8 +55,9 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
 
     bool solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
-    void setUpViOperator() const;
-    void extractScheduler(std::vector<ValueType>& x, std::vector<ValueType> const& b, OptimizationDirection const& dir, bool updateX = true) const;
+    void setUpViOperator(Environment const& env) const;
+    void extractScheduler(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, OptimizationDirection const& dir,
+                          bool updateX = true) const;
 
     void createLinearEquationSolver(Environment const& env) const;
 
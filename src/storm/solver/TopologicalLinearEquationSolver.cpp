@@ -1,5 +1,7 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <type_traits>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -10,6 +12,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -69,7 +72,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, env.solver().topological().getNumberOfThreads());
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -97,26 +100,35 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         }
     } else {
         // Solve each SCC individually
-        storm::storage::BitVector sccAsBitVector(x.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-            } else {
-                sccAsBitVector.clear();
-                for (auto const& state : scc) {
-                    sccAsBitVector.set(state, true);
+        uint64_t const numberOfThreads =
+            storm::utility::parallel::getNumberOfThreads<ValueType>(env.solver().topological().getNumberOfThreads(), "Solving SCCs concurrently");
+        if (numberOfThreads != 1) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, x, b, numberOfThreads);
+        } else {
+            storm::storage::BitVector sccAsBitVector(x.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                } else {
+                    sccAsBitVector.clear();
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, true);
+                    }
+                    if (!this->sccSolver) {
+                        this->sccSolver = createSccSolver(sccSolverEnvironment);
+                    }
+                    returnValue = solveScc(*this->sccSolver, sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
     }
@@ -129,13 +141,48 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
 }
 
 template<typename ValueType>
-void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
+                                                                       std::vector<ValueType> const& b, uint64_t numberOfThreads) const {
+    if (!this->sccScheduler) {
+        this->sccScheduler = std::make_unique<storm::solver::helper::TopologicalSccScheduler>(*this->A, *this->sortedSccDecomposition);
+    }
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCC(s) in " << this->sccScheduler->getNumberOfTasks() << " task(s) using "
+                              << (numberOfThreads == 0 ? std::string("all available") : std::to_string(numberOfThreads)) << " thread(s).");
+    return this->sccScheduler->analyzeSccs(numberOfThreads, [&](uint64_t sccIndex) {
+        auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+        if (scc.size() == 1) {
+            return solveTrivialScc(*scc.begin(), x, b);
+        }
+        // Solvers can not be shared between threads, so each SCC gets its own one.
+        storm::storage::BitVector sccAsBitVector(x.size(), false);
+        for (auto const& state : scc) {
+            sccAsBitVector.set(state, true);
+        }
+        auto sccSolver = createSccSolver(sccSolverEnvironment);
+        return solveScc(*sccSolver, sccSolverEnvironment, sccAsBitVector, x, b);
+    });
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> TopologicalLinearEquationSolver<ValueType>::createSccSolver(
+    storm::Environment const& sccSolverEnvironment) const {
+    auto result = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+    result->setCachingEnabled(true);
+    return result;
+}
+
+template<typename ValueType>
+void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions()
+                      .forceTopologicalSort()
+                      .computeSccDepths(needLongestChainSize)
+                      .numberOfThreads(numberOfThreads));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
+    this->sccScheduler.reset();
 }
 
 template<typename ValueType>
@@ -172,8 +219,7 @@ template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
                                                                                    std::vector<ValueType> const& b) const {
     if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+        this->sccSolver = createSccSolver(sccSolverEnvironment);
         this->sccSolver->setBoundsFromOtherSolver(*this);
         if (this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem) {
             // Convert the matrix to an equation system. Note that we need to insert diagonal entries.
@@ -188,21 +234,16 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 }
 
 template<typename ValueType>
-bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
+bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::solver::LinearEquationSolver<ValueType>& sccSolver,
+                                                          storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
                                                           std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
-    // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
-    }
-
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = sccSolver.getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver.setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -222,20 +263,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver.setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        sccSolver.setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver.setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        sccSolver.setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = sccSolver.solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
@@ -255,6 +296,7 @@ template<typename ValueType>
 void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
     sortedSccDecomposition.reset();
     longestSccChainSize = boost::none;
+    sccScheduler.reset();
     sccSolver.reset();
     LinearEquationSolver<ValueType>::clearCache();
 }
@@ -3,6 +3,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/TopologicalSccScheduler.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -37,7 +38,7 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -45,8 +46,15 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     // ... for the case that there is just one large SCC
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+    bool solveScc(storm::solver::LinearEquationSolver<ValueType>& sccSolver, storm::Environment const& sccSolverEnvironment,
+                  storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+
+    // Solves all SCCs, where independent SCCs are solved concurrently using the given number of threads.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                               uint64_t numberOfThreads) const;
+
+    // Creates a solver for the non-trivial SCCs.
+    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> createSccSolver(storm::Environment const& sccSolverEnvironment) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -59,6 +67,7 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
+    mutable std::unique_ptr<storm::solver::helper::TopologicalSccScheduler> sccScheduler;
     mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
 };
 
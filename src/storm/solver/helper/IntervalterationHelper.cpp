@@ -41,6 +41,10 @@ class IIBackend {
         // intentionally left empty.
     }
 
+    void join(IIBackend const&) {
+        // intentionally left empty.
+    }
+
     bool constexpr converged() const {
         return false;
     }
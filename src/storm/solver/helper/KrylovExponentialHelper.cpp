@@ -0,0 +1,443 @@
+#include "storm/solver/helper/KrylovExponentialHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <boost/math/constants/constants.hpp>
+
+#include "storm/environment/Environment.h"
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/PrecisionExceededException.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+
+// The parameters of the step size control as in Expokit.
+double const stepSafetyFactor = 0.9;
+double const errorSafetyFactor = 1.2;
+
+template<typename ValueType>
+ValueType dot(std::vector<ValueType> const& first, std::vector<ValueType> const& second) {
+    return std::inner_product(first.begin(), first.end(), second.begin(), storm::utility::zero<ValueType>());
+}
+
+template<typename ValueType>
+ValueType euclideanNorm(std::vector<ValueType> const& vector) {
+    return std::sqrt(dot(vector, vector));
+}
+
+/*!
+ * Rounds the given step size to two significant digits (as done in Expokit).
+ */
+template<typename ValueType>
+ValueType roundStepSize(ValueType const& stepSize) {
+    ValueType const factor = std::pow(10.0, std::round(std::log10(stepSize) - std::sqrt(0.1)) - 1.0);
+    return std::floor(stepSize / factor + 0.55) * factor;
+}
+
+/*!
+ * A dense, square matrix (stored row-wise) that is used for the small Hessenberg matrices.
+ */
+template<typename ValueType>
+class DenseMatrix {
+   public:
+    DenseMatrix(uint64_t dimension, ValueType const& diagonal = storm::utility::zero<ValueType>())
+        : dimension(dimension), entries(dimension * dimension, storm::utility::zero<ValueType>()) {
+        for (uint64_t index = 0; index < dimension; ++index) {
+            (*this)(index, index) = diagonal;
+        }
+    }
+
+    ValueType& operator()(uint64_t row, uint64_t column) {
+        return entries[row * dimension + column];
+    }
+
+    ValueType const& operator()(uint64_t row, uint64_t column) const {
+        return entries[row * dimension + column];
+    }
+
+    DenseMatrix operator*(DenseMatrix const& other) const {
+        DenseMatrix result(dimension);
+        for (uint64_t row = 0; row < dimension; ++row) {
+            for (uint64_t k = 0; k < dimension; ++k) {
+                ValueType const& factor = (*this)(row, k);
+                if (factor != storm::utility::zero<ValueType>()) {
+                    for (uint64_t column = 0; column < dimension; ++column) {
+                        result(row, column) += factor * other(k, column);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Adds the given multiple of the other matrix to this matrix.
+     */
+    void addScaled(DenseMatrix const& other, ValueType const& factor) {
+        for (uint64_t index = 0; index < entries.size(); ++index) {
+            entries[index] += factor * other.entries[index];
+        }
+    }
+
+    ValueType maximumNorm() const {
+        ValueType result = storm::utility::zero<ValueType>();
+        for (uint64_t row = 0; row < dimension; ++row) {
+            ValueType rowSum = storm::utility::zero<ValueType>();
+            for (uint64_t column = 0; column < dimension; ++column) {
+                rowSum += std::abs((*this)(row, column));
+            }
+            result = std::max(result, rowSum);
+        }
+        return result;
+    }
+
+    /*!
+     * Solves this * X = rightHandSides via Gaussian elimination with partial pivoting. This matrix is destroyed.
+     */
+    DenseMatrix solve(DenseMatrix rightHandSides) {
+        for (uint64_t pivotColumn = 0; pivotColumn < dimension; ++pivotColumn) {
+            uint64_t pivotRow = pivotColumn;
+            for (uint64_t row = pivotColumn + 1; row < dimension; ++row) {
+                if (std::abs((*this)(row, pivotColumn)) > std::abs((*this)(pivotRow, pivotColumn))) {
+                    pivotRow = row;
+                }
+            }
+            STORM_LOG_THROW((*this)(pivotRow, pivotColumn) != storm::utility::zero<ValueType>(), storm::exceptions::PrecisionExceededException,
+                            "Singular matrix in the Pade approximation of the matrix exponential.");
+            if (pivotRow != pivotColumn) {
+                for (uint64_t column = 0; column < dimension; ++column) {
+                    std::swap((*this)(pivotRow, column), (*this)(pivotColumn, column));
+                    std::swap(rightHandSides(pivotRow, column), rightHandSides(pivotColumn, column));
+                }
+            }
+            for (uint64_t row = pivotColumn + 1; row < dimension; ++row) {
+                ValueType const factor = (*this)(row, pivotColumn) / (*this)(pivotColumn, pivotColumn);
+                if (factor != storm::utility::zero<ValueType>()) {
+                    for (uint64_t column = pivotColumn; column < dimension; ++column) {
+                        (*this)(row, column) -= factor * (*this)(pivotColumn, column);
+                    }
+                    for (uint64_t column = 0; column < dimension; ++column) {
+                        rightHandSides(row, column) -= factor * rightHandSides(pivotColumn, column);
+                    }
+                }
+            }
+        }
+        for (uint64_t row = dimension; row > 0; --row) {
+            uint64_t const currentRow = row - 1;
+            for (uint64_t column = 0; column < dimension; ++column) {
+                ValueType value = rightHandSides(currentRow, column);
+                for (uint64_t k = row; k < dimension; ++k) {
+                    value -= (*this)(currentRow, k) * rightHandSides(k, column);
+                }
+                rightHandSides(currentRow, column) = value / (*this)(currentRow, currentRow);
+            }
+        }
+        return rightHandSides;
+    }
+
+    /*!
+     * Computes the matrix exponential of this matrix via a diagonal Pade approximation of degree 6 with scaling and squaring.
+     */
+    DenseMatrix exponential() const {
+        // Scale the matrix such that its norm is at most 1/2.
+        uint64_t numberOfSquarings = 0;
+        ValueType const norm = maximumNorm();
+        if (norm > 0.5) {
+            numberOfSquarings = static_cast<uint64_t>(std::max(0.0, std::ceil(std::log2(norm / 0.5))));
+        }
+        DenseMatrix scaled = *this;
+        ValueType const scalingFactor = std::ldexp(1.0, -static_cast<int>(numberOfSquarings));
+        for (auto& entry : scaled.entries) {
+            entry *= scalingFactor;
+        }
+
+        // The coefficients c_k = (2q-k)! q! / ((2q)! k! (q-k)!) of the Pade approximation for q = 6.
+        std::vector<ValueType> coefficients(7, storm::utility::one<ValueType>());
+        for (uint64_t k = 1; k < coefficients.size(); ++k) {
+            coefficients[k] = coefficients[k - 1] * static_cast<ValueType>(7 - k) / static_cast<ValueType>(k * (13 - k));
+        }
+
+        // Split the numerator into the odd part U and the even part V such that the approximation is (V - U)^-1 (V + U).
+        DenseMatrix const squared = scaled * scaled;
+        DenseMatrix const fourthPower = squared * squared;
+        DenseMatrix const sixthPower = fourthPower * squared;
+        DenseMatrix odd(dimension, coefficients[1]);
+        odd.addScaled(squared, coefficients[3]);
+        odd.addScaled(fourthPower, coefficients[5]);
+        odd = scaled * odd;
+        DenseMatrix even(dimension, coefficients[0]);
+        even.addScaled(squared, coefficients[2]);
+        even.addScaled(fourthPower, coefficients[4]);
+        even.addScaled(sixthPower, coefficients[6]);
+
+        DenseMatrix numerator = even;
+        numerator.addScaled(odd, storm::utility::one<ValueType>());
+        DenseMatrix denominator = std::move(even);
+        denominator.addScaled(odd, -storm::utility::one<ValueType>());
+        DenseMatrix result = denominator.solve(std::move(numerator));
+
+        for (uint64_t squaring = 0; squaring < numberOfSquarings; ++squaring) {
+            result = result * result;
+        }
+        return result;
+    }
+
+   private:
+    uint64_t dimension;
+    std::vector<ValueType> entries;
+};
+
+}  // namespace
+
+template<typename ValueType>
+KrylovExponentialHelper<ValueType>::KrylovExponentialHelper(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                            std::vector<ValueType> const* addVector, ValueType const& uniformizationRate,
+                                                            uint64_t krylovDimension)
+    : env(env),
+      addVector(addVector),
+      uniformizationRate(uniformizationRate),
+      krylovDimension(krylovDimension),
+      numberOfStates(uniformizedMatrix.getRowCount()),
+      generatorNorm(storm::utility::zero<ValueType>()),
+      numberOfMultiplications(0) {
+    STORM_LOG_THROW(uniformizedMatrix.getRowCount() == uniformizedMatrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "The uniformized matrix must be square.");
+    STORM_LOG_THROW(addVector == nullptr || addVector->size() == numberOfStates, storm::exceptions::InvalidArgumentException,
+                    "The add vector has an unexpected size.");
+    STORM_LOG_THROW(krylovDimension > 1, storm::exceptions::InvalidArgumentException, "The dimension of Krylov subspaces must be at least two.");
+
+    // The generator is Q = q*(P - I), possibly augmented with the column q*addVector.
+    for (uint64_t row = 0; row < numberOfStates; ++row) {
+        ValueType rowSum = storm::utility::zero<ValueType>();
+        bool hasDiagonal = false;
+        for (auto const& entry : uniformizedMatrix.getRow(row)) {
+            if (entry.getColumn() == row) {
+                rowSum += std::abs(entry.getValue() - storm::utility::one<ValueType>());
+                hasDiagonal = true;
+            } else {
+                rowSum += std::abs(entry.getValue());
+            }
+        }
+        if (!hasDiagonal) {
+            rowSum += storm::utility::one<ValueType>();
+        }
+        if (addVector != nullptr) {
+            rowSum += std::abs((*addVector)[row]);
+        }
+        generatorNorm = std::max(generatorNorm, rowSum);
+    }
+    generatorNorm *= uniformizationRate;
+
+    multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    multiplicationInput.resize(numberOfStates);
+    multiplicationResult.resize(numberOfStates);
+}
+
+template<typename ValueType>
+KrylovExponentialHelper<ValueType>::~KrylovExponentialHelper() = default;
+
+template<typename ValueType>
+void KrylovExponentialHelper<ValueType>::multiplyWithGenerator(std::vector<ValueType> const& x, std::vector<ValueType>& result) {
+    std::copy(x.begin(), x.begin() + numberOfStates, multiplicationInput.begin());
+    multiplier->multiply(env, multiplicationInput, nullptr, multiplicationResult);
+    ++numberOfMultiplications;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        result[state] = uniformizationRate * (multiplicationResult[state] - x[state]);
+    }
+    if (addVector != nullptr) {
+        ValueType const factor = uniformizationRate * x.back();
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            result[state] += factor * (*addVector)[state];
+        }
+        result.back() = storm::utility::zero<ValueType>();
+    }
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> KrylovExponentialHelper<ValueType>::computeTransientValues(std::vector<ValueType> const& timePoints,
+                                                                                               std::vector<ValueType> const& values,
+                                                                                               ValueType const& precision) {
+    STORM_LOG_THROW(values.size() == numberOfStates, storm::exceptions::InvalidArgumentException, "The vector of values has an unexpected size.");
+    std::vector<uint64_t> sortedTimePoints(timePoints.size());
+    std::iota(sortedTimePoints.begin(), sortedTimePoints.end(), 0);
+    std::sort(sortedTimePoints.begin(), sortedTimePoints.end(),
+              [&timePoints](uint64_t first, uint64_t second) { return timePoints[first] < timePoints[second]; });
+    std::vector<std::vector<ValueType>> results(timePoints.size());
+    if (timePoints.empty()) {
+        return results;
+    }
+    ValueType const finalTime = timePoints[sortedTimePoints.back()];
+    STORM_LOG_THROW(timePoints[sortedTimePoints.front()] >= storm::utility::zero<ValueType>(), storm::exceptions::InvalidArgumentException,
+                    "Time points must be non-negative.");
+
+    // With an add vector, the vector is augmented with an entry that stays one.
+    uint64_t const dimension = numberOfStates + (addVector == nullptr ? 0 : 1);
+    std::vector<ValueType> w = values;
+    if (addVector != nullptr) {
+        w.push_back(storm::utility::one<ValueType>());
+    }
+
+    // The subspace dimension cannot exceed the dimension of the vectors.
+    uint64_t const m = std::min(krylovDimension, dimension);
+    // The error that is tolerated per time unit.
+    ValueType const tolerance = precision / (errorSafetyFactor * std::max(finalTime, storm::utility::one<ValueType>()));
+    // If the norm of the new basis vector falls below this threshold, the Krylov subspace is considered to be invariant under the generator.
+    ValueType const breakdownTolerance = generatorNorm * 1e-12;
+
+    ValueType beta = euclideanNorm(w);
+    ValueType currentTime = storm::utility::zero<ValueType>();
+    ValueType nextStepSize = storm::utility::zero<ValueType>();
+    if (m > 0 && !storm::utility::isZero(generatorNorm) && !storm::utility::isZero(beta)) {
+        // The initial step size as proposed by Expokit.
+        ValueType const e = boost::math::constants::e<ValueType>();
+        ValueType const factor = std::pow((m + 1) / e, m + 1) * std::sqrt(2.0 * boost::math::constants::pi<ValueType>() * (m + 1));
+        nextStepSize = roundStepSize<ValueType>(std::pow((factor * tolerance) / (4.0 * beta * generatorNorm), 1.0 / m) / generatorNorm);
+    }
+
+    std::vector<std::vector<ValueType>> basis(m + 1, std::vector<ValueType>(dimension));
+    std::vector<ValueType> nextBasisVector(dimension);
+    uint64_t numberOfSteps = 0;
+    uint64_t numberOfRejectedSteps = 0;
+    ValueType accumulatedError = storm::utility::zero<ValueType>();
+    for (auto timePointIndex : sortedTimePoints) {
+        ValueType const targetTime = timePoints[timePointIndex];
+        // If the generator or the values vanish, the values do not change anymore.
+        while (currentTime < targetTime && !storm::utility::isZero(nextStepSize) && !storm::utility::isZero(beta)) {
+            ValueType stepSize = std::min(targetTime - currentTime, nextStepSize);
+            ++numberOfSteps;
+
+            // Arnoldi process: Compute an orthonormal basis V of the Krylov subspace span{w, Qw, ..., Q^(m-1)w} and the Hessenberg matrix H = V^T Q V.
+            // H is augmented by two rows and columns for the error estimate.
+            DenseMatrix<ValueType> hessenberg(m + 2);
+            for (uint64_t index = 0; index < dimension; ++index) {
+                basis[0][index] = w[index] / beta;
+            }
+            uint64_t basisSize = m;
+            // The number of additional rows and columns used for the error estimate (zero, if the Krylov subspace is invariant).
+            uint64_t correction = 2;
+            ValueType nextBasisVectorNorm = storm::utility::zero<ValueType>();
+            for (uint64_t j = 0; j < m; ++j) {
+                multiplyWithGenerator(basis[j], nextBasisVector);
+                for (uint64_t i = 0; i <= j; ++i) {
+                    ValueType const projection = dot(basis[i], nextBasisVector);
+                    hessenberg(i, j) = projection;
+                    for (uint64_t index = 0; index < dimension; ++index) {
+                        nextBasisVector[index] -= projection * basis[i][index];
+                    }
+                }
+                ValueType const norm = euclideanNorm(nextBasisVector);
+                if (norm <= breakdownTolerance) {
+                    // Happy breakdown: The subspace is invariant, so the exponential can be computed exactly for arbitrary large steps.
+                    correction = 0;
+                    basisSize = j + 1;
+                    stepSize = targetTime - currentTime;
+                    break;
+                }
+                hessenberg(j + 1, j) = norm;
+                for (uint64_t index = 0; index < dimension; ++index) {
+                    basis[j + 1][index] = nextBasisVector[index] / norm;
+                }
+            }
+            if (correction != 0) {
+                multiplyWithGenerator(basis[m], nextBasisVector);
+                nextBasisVectorNorm = euclideanNorm(nextBasisVector);
+                hessenberg(m + 1, m) = storm::utility::one<ValueType>();
+            }
+
+            // Compute exp(stepSize * H) and estimate the local error. Reject the step size and retry with a smaller one if the error is too large.
+            DenseMatrix<ValueType> exponential(0);
+            ValueType localError = storm::utility::zero<ValueType>();
+            ValueType errorExponent = 1.0 / m;
+            while (true) {
+                uint64_t const exponentialDimension = basisSize + correction;
+                DenseMatrix<ValueType> scaledHessenberg(exponentialDimension);
+                for (uint64_t row = 0; row < exponentialDimension; ++row) {
+                    for (uint64_t column = 0; column < exponentialDimension; ++column) {
+                        scaledHessenberg(row, column) = stepSize * hessenberg(row, column);
+                    }
+                }
+                exponential = scaledHessenberg.exponential();
+                if (correction == 0) {
+                    break;
+                }
+                ValueType const firstEstimate = std::abs(exponential(m, 0)) * beta;
+                ValueType const secondEstimate = std::abs(exponential(m + 1, 0)) * beta * nextBasisVectorNorm;
+                if (firstEstimate > 10.0 * secondEstimate) {
+                    localError = secondEstimate;
+                    errorExponent = 1.0 / m;
+                } else if (firstEstimate > secondEstimate) {
+                    localError = (firstEstimate * secondEstimate) / (firstEstimate - secondEstimate);
+                    errorExponent = 1.0 / m;
+                } else {
+                    localError = firstEstimate;
+                    errorExponent = 1.0 / std::max<uint64_t>(m - 1, 1);
+                }
+                if (localError <= errorSafetyFactor * stepSize * tolerance) {
+                    break;
+                }
+                ++numberOfRejectedSteps;
+                stepSize = roundStepSize<ValueType>(stepSafetyFactor * stepSize * std::pow(stepSize * tolerance / localError, errorExponent));
+                STORM_LOG_THROW(currentTime + stepSize > currentTime, storm::exceptions::PrecisionExceededException,
+                                "The step size of the Krylov subspace method became too small.");
+            }
+
+            // Update w = beta * V * exp(stepSize * H) * e_1.
+            uint64_t const usedBasisVectors = basisSize + (correction == 0 ? 0 : 1);
+            std::fill(w.begin(), w.end(), storm::utility::zero<ValueType>());
+            for (uint64_t i = 0; i < usedBasisVectors; ++i) {
+                ValueType const factor = beta * exponential(i, 0);
+                for (uint64_t index = 0; index < dimension; ++index) {
+                    w[index] += factor * basis[i][index];
+                }
+            }
+            beta = euclideanNorm(w);
+            accumulatedError += localError;
+
+            if (stepSize >= targetTime - currentTime) {
+                currentTime = targetTime;
+            } else {
+                currentTime += stepSize;
+            }
+            if (correction == 0) {
+                // The subspace is invariant, so the next step can span the remaining time.
+                nextStepSize = std::max(finalTime - currentTime, stepSize);
+            } else {
+                nextStepSize = roundStepSize<ValueType>(
+                    stepSafetyFactor * stepSize * std::pow(stepSize * tolerance / std::max(localError, std::numeric_limits<ValueType>::min()), errorExponent));
+            }
+
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_THROW(false, storm::exceptions::AbortException, "Computation of transient values aborted.");
+            }
+        }
+        results[timePointIndex] = std::vector<ValueType>(w.begin(), w.begin() + numberOfStates);
+    }
+    STORM_LOG_INFO("Krylov subspace method took " << numberOfSteps << " steps (" << numberOfRejectedSteps << " rejected step sizes) and "
+                                                  << numberOfMultiplications << " matrix-vector multiplications. Estimated error: " << accumulatedError
+                                                  << ".");
+    return results;
+}
+
+template<typename ValueType>
+uint64_t KrylovExponentialHelper<ValueType>::getNumberOfMultiplications() const {
+    return numberOfMultiplications;
+}
+
+template class KrylovExponentialHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace storm {
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}  // namespace storage
+
+namespace solver {
+template<typename ValueType>
+class Multiplier;
+
+namespace helper {
+
+/*!
+ * Computes transient values of a CTMC, i.e., products exp(t*Q)*v of the matrix exponential of the generator Q with a vector v, via projections onto
+ * Krylov subspaces (Arnoldi process) with adaptive time stepping and local error control as in Expokit.
+ * In contrast to uniformization, the number of matrix-vector multiplications does not grow linearly with the product of the time bound and the
+ * maximal exit rate, which makes this approach well-suited for stiff CTMCs with long time horizons.
+ * Note that the error control relies on error estimates and does not yield sound bounds.
+ *
+ * @see Sidje: Expokit: A Software Package for Computing Matrix Exponentials. ACM Trans. Math. Softw. 24(1), 1998. https://doi.org/10.1145/285861.285868
+ */
+template<typename ValueType>
+class KrylovExponentialHelper {
+   public:
+    /*!
+     * Prepares the computation of transient values. The generator is given in uniformized form, i.e., Q = q*(P - I) for the uniformized matrix P
+     * and the uniformization rate q, such that the same inputs as for uniformization can be used.
+     *
+     * @param env The environment that is used for the matrix-vector multiplications.
+     * @param uniformizedMatrix The (square) uniformized matrix P.
+     * @param addVector If given, the values are computed for the differential equation x' = Q*x + q*addVector, which matches uniformization with the
+     * add vector being added in every step.
+     * @param uniformizationRate The uniformization rate q.
+     * @param krylovDimension The (maximal) dimension of the Krylov subspaces.
+     */
+    KrylovExponentialHelper(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+                            ValueType const& uniformizationRate, uint64_t krylovDimension);
+
+    ~KrylovExponentialHelper();
+
+    /*!
+     * Computes the transient values for all given time points.
+     *
+     * @param timePoints The (non-negative) time points. They do not need to be sorted.
+     * @param values The values at time zero.
+     * @param precision The error (w.r.t. the Euclidean norm) that is tolerated for the values at the last time point.
+     * @return The values at the given time points (in the order of the given time points).
+     */
+    std::vector<std::vector<ValueType>> computeTransientValues(std::vector<ValueType> const& timePoints, std::vector<ValueType> const& values,
+                                                               ValueType const& precision);
+
+    /*!
+     * Retrieves the number of matrix-vector multiplications that were performed so far.
+     */
+    uint64_t getNumberOfMultiplications() const;
+
+   private:
+    /*!
+     * Computes result = Q*x for the (possibly augmented) generator Q.
+     */
+    void multiplyWithGenerator(std::vector<ValueType> const& x, std::vector<ValueType>& result);
+
+    Environment const& env;
+    std::vector<ValueType> const* addVector;
+    ValueType uniformizationRate;
+    uint64_t krylovDimension;
+    std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplier;
+
+    // The number of states. If an add vector is given, the vectors have one additional (constant) entry.
+    uint64_t numberOfStates;
+    // The maximum norm of the generator.
+    ValueType generatorNorm;
+    uint64_t numberOfMultiplications;
+
+    // Auxiliary vectors for the matrix-vector multiplications.
+    std::vector<ValueType> multiplicationInput;
+    std::vector<ValueType> multiplicationResult;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
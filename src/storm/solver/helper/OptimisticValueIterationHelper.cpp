@@ -50,6 +50,10 @@ class GSVIBackend {
         // intentionally left empty.
     }
 
+    void join(GSVIBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
     bool converged() const {
         return isConverged;
     }
@@ -152,6 +156,13 @@ class OVIBackend {
         // intentionally left empty.
     }
 
+    void join(OVIBackend const& other) {
+        isAllUp &= other.isAllUp;
+        isAllDown &= other.isAllDown;
+        crossed |= other.crossed;
+        errorValue &= other.errorValue;
+    }
+
     bool converged() const {
         return isAllDown || isAllUp;
     }
@@ -41,6 +41,10 @@ class RSBackend {
         // intentionally left empty.
     }
 
+    void join(RSBackend const& other) {
+        allEqual &= other.allEqual;
+    }
+
     bool converged() const {
         return allEqual;
     }
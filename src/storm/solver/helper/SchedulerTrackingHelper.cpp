@@ -48,6 +48,10 @@ class SchedulerTrackingBackend {
 
     void endOfIteration() const {}
 
+    void join(SchedulerTrackingBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
     bool converged() const {
         return isConverged;
     }
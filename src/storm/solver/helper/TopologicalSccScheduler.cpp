@@ -0,0 +1,167 @@
+#include "storm/solver/helper/TopologicalSccScheduler.h"
+
+#include <atomic>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+template<typename ValueType>
+TopologicalSccScheduler::TopologicalSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                 storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sortedSccs,
+                                                 uint64_t maxTrivialSccsPerTask) {
+    // Group the SCCs into tasks. Only consecutive trivial SCCs share a task, so the tasks are topologically sorted as well.
+    std::vector<uint64_t> stateToTask(matrix.getRowGroupCount());
+    taskSccIndices.push_back(0);
+    uint64_t trivialSccsInCurrentTask = 0;
+    for (uint64_t sccIndex = 0; sccIndex < sortedSccs.size(); ++sccIndex) {
+        auto const& scc = sortedSccs.getBlock(sccIndex);
+        bool const isTrivial = scc.size() == 1;
+        bool const appendToCurrentTask = isTrivial && trivialSccsInCurrentTask > 0 && trivialSccsInCurrentTask < maxTrivialSccsPerTask;
+        if (sccIndex > 0 && !appendToCurrentTask) {
+            taskSccIndices.push_back(sccIndex);
+            trivialSccsInCurrentTask = 0;
+        }
+        if (isTrivial) {
+            ++trivialSccsInCurrentTask;
+        }
+        uint64_t const currentTask = taskSccIndices.size() - 1;
+        for (auto const& state : scc) {
+            stateToTask[state] = currentTask;
+        }
+    }
+    taskSccIndices.push_back(sortedSccs.size());
+    uint64_t const numberOfTasks = taskSccIndices.size() - 1;
+
+    // Collect the (distinct) dependencies between the tasks.
+    std::vector<std::pair<uint64_t, uint64_t>> dependencies;  // pairs (dependency, dependent task)
+    std::vector<uint64_t> lastDependentTask(numberOfTasks, numberOfTasks);
+    numberOfDependencies.assign(numberOfTasks, 0);
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        for (uint64_t sccIndex = taskSccIndices[task]; sccIndex < taskSccIndices[task + 1]; ++sccIndex) {
+            for (auto const& state : sortedSccs.getBlock(sccIndex)) {
+                for (auto const& entry : matrix.getRows(rowGroupIndices[state], rowGroupIndices[state + 1])) {
+                    uint64_t const dependency = stateToTask[entry.getColumn()];
+                    if (dependency != task && lastDependentTask[dependency] != task) {
+                        STORM_LOG_ASSERT(dependency < task, "The given SCC decomposition is not sorted topologically.");
+                        lastDependentTask[dependency] = task;
+                        dependencies.emplace_back(dependency, task);
+                        ++numberOfDependencies[task];
+                    }
+                }
+            }
+        }
+    }
+
+    // Store the dependent tasks of each task consecutively.
+    dependentTaskIndices.assign(numberOfTasks + 1, 0);
+    for (auto const& dependency : dependencies) {
+        ++dependentTaskIndices[dependency.first + 1];
+    }
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        dependentTaskIndices[task + 1] += dependentTaskIndices[task];
+    }
+    dependentTasks.resize(dependencies.size());
+    std::vector<uint64_t> insertPositions(dependentTaskIndices.begin(), dependentTaskIndices.end() - 1);
+    for (auto const& dependency : dependencies) {
+        dependentTasks[insertPositions[dependency.first]++] = dependency.second;
+    }
+}
+
+bool TopologicalSccScheduler::analyzeSccs(uint64_t numberOfThreads, std::function<bool(uint64_t)> const& analyzeScc) const {
+    uint64_t const numberOfTasks = getNumberOfTasks();
+    uint64_t const numberOfSccs = taskSccIndices.back();
+    std::atomic<bool> result{true};
+    std::atomic<uint64_t> numberOfAnalyzedSccs{0};
+    auto processTaskSccs = [&](uint64_t task) {
+        for (uint64_t sccIndex = taskSccIndices[task]; sccIndex < taskSccIndices[task + 1]; ++sccIndex) {
+            if (!analyzeScc(sccIndex)) {
+                result.store(false, std::memory_order_relaxed);
+            }
+        }
+        numberOfAnalyzedSccs.fetch_add(taskSccIndices[task + 1] - taskSccIndices[task], std::memory_order_relaxed);
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    std::vector<std::atomic<uint64_t>> remainingDependencies(numberOfTasks);
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        remainingDependencies[task].store(numberOfDependencies[task], std::memory_order_relaxed);
+    }
+    std::atomic<bool> aborted{false};
+    tbb::task_group taskGroup;
+    std::function<void(uint64_t)> processTask = [&](uint64_t task) {
+        // After finishing a task, we directly continue with one of the tasks that became ready and spawn the remaining ones.
+        while (!aborted.load(std::memory_order_relaxed)) {
+            processTaskSccs(task);
+            if (storm::utility::resources::isTerminate()) {
+                aborted.store(true, std::memory_order_relaxed);
+                break;
+            }
+            uint64_t nextTask = numberOfTasks;
+            for (uint64_t i = dependentTaskIndices[task]; i < dependentTaskIndices[task + 1]; ++i) {
+                uint64_t const dependentTask = dependentTasks[i];
+                if (remainingDependencies[dependentTask].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    if (nextTask == numberOfTasks) {
+                        nextTask = dependentTask;
+                    } else {
+                        taskGroup.run([&processTask, dependentTask]() { processTask(dependentTask); });
+                    }
+                }
+            }
+            if (nextTask == numberOfTasks) {
+                break;
+            }
+            task = nextTask;
+        }
+    };
+    auto processAllTasks = [&]() {
+        for (uint64_t task = 0; task < numberOfTasks; ++task) {
+            if (numberOfDependencies[task] == 0) {
+                taskGroup.run([&processTask, task]() { processTask(task); });
+            }
+        }
+        taskGroup.wait();
+    };
+    if (numberOfThreads == 0) {
+        processAllTasks();
+    } else {
+        tbb::task_arena arena(static_cast<int>(numberOfThreads));
+        arena.execute(processAllTasks);
+    }
+#else
+    STORM_LOG_WARN_COND(numberOfThreads == 1, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        processTaskSccs(task);
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+#endif
+
+    if (numberOfAnalyzedSccs.load() < numberOfSccs) {
+        STORM_LOG_WARN("Topological solver aborted after analyzing " << numberOfAnalyzedSccs.load() << "/" << numberOfSccs << " SCCs.");
+    }
+    return result.load();
+}
+
+uint64_t TopologicalSccScheduler::getNumberOfTasks() const {
+    return taskSccIndices.size() - 1;
+}
+
+template TopologicalSccScheduler::TopologicalSccScheduler(storm::storage::SparseMatrix<double> const& matrix,
+                                                          storm::storage::StronglyConnectedComponentDecomposition<double> const& sortedSccs,
+                                                          uint64_t maxTrivialSccsPerTask);
+template TopologicalSccScheduler::TopologicalSccScheduler(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix,
+                                                          storm::storage::StronglyConnectedComponentDecomposition<storm::RationalNumber> const& sortedSccs,
+                                                          uint64_t maxTrivialSccsPerTask);
+template TopologicalSccScheduler::TopologicalSccScheduler(storm::storage::SparseMatrix<storm::RationalFunction> const& matrix,
+                                                          storm::storage::StronglyConnectedComponentDecomposition<storm::RationalFunction> const& sortedSccs,
+                                                          uint64_t maxTrivialSccsPerTask);
+
+}  // namespace storm::solver::helper
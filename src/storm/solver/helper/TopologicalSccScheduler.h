@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+
+template<typename ValueType>
+class StronglyConnectedComponentDecomposition;
+}  // namespace storage
+
+namespace solver::helper {
+
+/*!
+ * Schedules the analysis of the SCCs of a topologically sorted SCC decomposition on multiple threads.
+ * An SCC is analyzed as soon as all SCCs that contain a successor of one of its states have been analyzed.
+ * Independent SCCs are thus analyzed concurrently while each SCC still sees the final values of its successors.
+ * To keep the scheduling overhead low, consecutive trivial SCCs are grouped into a single task.
+ */
+class TopologicalSccScheduler {
+   public:
+    /*!
+     * Computes the dependencies between the SCCs of the given decomposition.
+     *
+     * @param matrix The matrix underlying the decomposition. Row groups correspond to states.
+     * @param sortedSccs The SCC decomposition of the matrix. Each SCC must occur after all SCCs that it can reach.
+     * @param maxTrivialSccsPerTask The maximal number of consecutive trivial SCCs that are grouped into a single task.
+     */
+    template<typename ValueType>
+    TopologicalSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix,
+                            storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sortedSccs, uint64_t maxTrivialSccsPerTask = 1024);
+
+    /*!
+     * Invokes the given function once for every SCC (identified by its index in the decomposition).
+     * The function is only invoked for an SCC once it returned for all SCCs the SCC depends on. It has to be safe to invoke the function concurrently
+     * for different SCCs. If Storm was built without Intel TBB, the SCCs are analyzed sequentially in the order of the decomposition.
+     *
+     * @param numberOfThreads The number of threads to use. A value of 0 means that all available cores are used.
+     * @param analyzeScc The function that analyzes a single SCC.
+     * @return True iff all invocations of the given function returned true. If the analysis is aborted, some SCCs might not have been analyzed.
+     */
+    bool analyzeSccs(uint64_t numberOfThreads, std::function<bool(uint64_t)> const& analyzeScc) const;
+
+    /*!
+     * @return the number of tasks that the SCCs are grouped into.
+     */
+    uint64_t getNumberOfTasks() const;
+
+   private:
+    // Task i analyzes the SCCs with indices taskSccIndices[i], ..., taskSccIndices[i+1]-1 (in this order).
+    std::vector<uint64_t> taskSccIndices;
+    // The tasks that depend on task i are dependentTasks[dependentTaskIndices[i]], ..., dependentTasks[dependentTaskIndices[i+1]-1].
+    std::vector<uint64_t> dependentTaskIndices;
+    std::vector<uint64_t> dependentTasks;
+    // The number of tasks that task i depends on.
+    std::vector<uint64_t> numberOfDependencies;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
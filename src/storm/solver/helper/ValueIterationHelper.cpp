@@ -40,6 +40,10 @@ class VIOperatorBackend {
         // intentionally left empty.
     }
 
+    void join(VIOperatorBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
     bool converged() const {
         return isConverged;
     }
@@ -3,6 +3,7 @@
 #include <optional>
 
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/storage/SparseMatrix.h"
 
 namespace storm::solver::helper {
@@ -24,33 +25,57 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrix(storm::sto
     }
     this->backwards = Backward;
     this->hasSkippedRows = false;
+    // Column indices and the number of skipped entries of ignored rows (bounded by the number of columns) have to fit into the lower bits.
+    this->compactColumns = matrix.getColumnCount() < SkipNumEntriesMask<CompactIndexType>;
+    if (compactColumns) {
+        matrixColumns = std::vector<IndexType>();
+        setMatrix<Backward, CompactIndexType>(matrix);
+    } else {
+        compactMatrixColumns = std::vector<CompactIndexType>();
+        setMatrix<Backward, IndexType>(matrix);
+    }
+    if (isParallelApplyEnabled()) {
+        if (compactColumns) {
+            computeParallelChunks<Backward, CompactIndexType>();
+        } else {
+            computeParallelChunks<Backward, IndexType>();
+        }
+    } else {
+        parallelChunks.clear();
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<bool Backward, typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
     auto const numRows = matrix.getRowCount();
+    auto& columns = getMatrixColumns<ColumnType>();
     matrixValues.clear();
-    matrixColumns.clear();
+    columns.clear();
     matrixValues.reserve(matrix.getNonzeroEntryCount());
-    matrixColumns.reserve(matrix.getNonzeroEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
+    columns.reserve(matrix.getNonzeroEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
     if constexpr (!TrivialRowGrouping) {
-        matrixColumns.push_back(StartOfRowGroupIndicator);  // indicate start of first row(group)
+        columns.push_back(StartOfRowGroupIndicator<ColumnType>);  // indicate start of first row(group)
         for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
             STORM_LOG_ASSERT(this->rowGroupIndices->at(groupIndex) != this->rowGroupIndices->at(groupIndex + 1),
                              "There is an empty row group. This is not expected.");
             for (auto rowIndex : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1])) {
                 for (auto const& entry : matrix.getRow(rowIndex)) {
                     matrixValues.push_back(entry.getValue());
-                    matrixColumns.push_back(entry.getColumn());
+                    columns.push_back(static_cast<ColumnType>(entry.getColumn()));
                 }
-                matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
+                columns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of next row
             }
-            matrixColumns.back() = StartOfRowGroupIndicator;  // This is the start of the next row group
+            columns.back() = StartOfRowGroupIndicator<ColumnType>;  // This is the start of the next row group
         }
     } else {
-        matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of first row
+        columns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of first row
         for (auto rowIndex : indexRange<Backward>(0, numRows)) {
             for (auto const& entry : matrix.getRow(rowIndex)) {
                 matrixValues.push_back(entry.getValue());
-                matrixColumns.push_back(entry.getColumn());
+                columns.push_back(static_cast<ColumnType>(entry.getColumn()));
             }
-            matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
+            columns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of next row
         }
     }
 }
@@ -69,40 +94,51 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrixBackwards(s
 
 template<typename ValueType, bool TrivialRowGrouping>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::unsetIgnoredRows() {
-    for (auto& c : matrixColumns) {
-        if (c >= StartOfRowIndicator) {
-            c &= StartOfRowGroupIndicator;
-        }
+    if (compactColumns) {
+        unsetIgnoredRows<CompactIndexType>();
+    } else {
+        unsetIgnoredRows<IndexType>();
     }
     hasSkippedRows = false;
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-template<bool Backward>
+template<typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::unsetIgnoredRows() {
+    for (auto& c : getMatrixColumns<ColumnType>()) {
+        if (c >= StartOfRowIndicator<ColumnType>) {
+            c &= StartOfRowGroupIndicator<ColumnType>;
+        }
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<bool Backward, typename ColumnType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore) {
     STORM_LOG_ASSERT(!TrivialRowGrouping, "Tried to ignroe rows but the row grouping is trivial.");
-    auto colIt = matrixColumns.begin();
+    auto& columns = getMatrixColumns<ColumnType>();
+    auto colIt = columns.begin();
     for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
-        STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(colIt != columns.end(), "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator<ColumnType>, "VI Operator in invalid state.");
         auto const rowIndexRange = useLocalRowIndices ? indexRange<false>(0ull, (*this->rowGroupIndices)[groupIndex + 1] - (*this->rowGroupIndices)[groupIndex])
                                                       : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1]);
         for (auto const rowIndex : rowIndexRange) {
             if (!ignore(groupIndex, rowIndex)) {
-                *colIt &= StartOfRowGroupIndicator;  // Clear number of skipped entries
-                moveToEndOfRow(colIt);
-            } else if ((*colIt & SkipNumEntriesMask) == 0) {  // i.e. should ignore but is not already ignored
+                *colIt &= StartOfRowGroupIndicator<ColumnType>;  // Clear number of skipped entries
+                moveToEndOfRow<ColumnType>(colIt);
+            } else if ((*colIt & SkipNumEntriesMask<ColumnType>) == 0) {  // i.e. should ignore but is not already ignored
                 auto currColIt = colIt;
-                moveToEndOfRow(colIt);
+                moveToEndOfRow<ColumnType>(colIt);
                 *currColIt += std::distance(currColIt, colIt);  // set number of skipped entries
             }
             STORM_LOG_ASSERT(
                 !std::all_of(rowIndexRange.begin(), rowIndexRange.end(), [&ignore, &groupIndex](IndexType rowIndex) { return ignore(groupIndex, rowIndex); }),
                 "All rows in row group " << groupIndex << " are ignored.");
-            STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(colIt != columns.end(), "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
         }
-        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator<ColumnType>, "VI Operator in invalid state.");
     }
     hasSkippedRows = true;
 }
@@ -110,9 +146,17 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setIgnoredRows(bool
 template<typename ValueType, bool TrivialRowGrouping>
 void ValueIterationOperator<ValueType, TrivialRowGrouping>::setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore) {
     if (backwards) {
-        setIgnoredRows<true>(useLocalRowIndices, ignore);
+        if (compactColumns) {
+            setIgnoredRows<true, CompactIndexType>(useLocalRowIndices, ignore);
+        } else {
+            setIgnoredRows<true, IndexType>(useLocalRowIndices, ignore);
+        }
     } else {
-        setIgnoredRows<false>(useLocalRowIndices, ignore);
+        if (compactColumns) {
+            setIgnoredRows<false, CompactIndexType>(useLocalRowIndices, ignore);
+        } else {
+            setIgnoredRows<false, IndexType>(useLocalRowIndices, ignore);
+        }
     }
 }
 
@@ -142,34 +186,93 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::freeAuxiliaryVector(
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-void ValueIterationOperator<ValueType, TrivialRowGrouping>::moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const {
-    do {
-        ++matrixColumnIt;
-    } while (*matrixColumnIt < StartOfRowIndicator);
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setNumberOfThreads(uint64_t numberOfThreads, uint64_t chunkSize) {
+    STORM_LOG_THROW(chunkSize > 0, storm::exceptions::InvalidArgumentException, "The chunk size for parallel application must be positive.");
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(numberOfThreads == 1, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+#else
+    // Only (re)create the arena if the number of threads changes as this is not for free.
+    if (numberOfThreads <= 1) {
+        taskArena.reset();
+    } else if (!taskArena || numberOfThreads != this->numberOfThreads) {
+        taskArena = std::make_unique<tbb::task_arena>(static_cast<int>(numberOfThreads));
+    }
+#endif
+    this->numberOfThreads = numberOfThreads;
+    this->parallelChunkSize = chunkSize;
+    parallelChunks.clear();
+    if (isParallelApplyEnabled() && !(matrixColumns.empty() && compactMatrixColumns.empty())) {
+        if (backwards) {
+            if (compactColumns) {
+                computeParallelChunks<true, CompactIndexType>();
+            } else {
+                computeParallelChunks<true, IndexType>();
+            }
+        } else {
+            if (compactColumns) {
+                computeParallelChunks<false, CompactIndexType>();
+            } else {
+                computeParallelChunks<false, IndexType>();
+            }
+        }
+    }
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-bool ValueIterationOperator<ValueType, TrivialRowGrouping>::skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                                                           typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    if (IndexType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask)) {
-        matrixColumnIt += entriesToSkip;
-        matrixValueIt += entriesToSkip - 1;
-        return true;
-    }
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping>::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping>::isParallelApplyEnabled() const {
+#ifdef STORM_HAVE_INTELTBB
+    return numberOfThreads != 1;
+#else
     return false;
+#endif
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
-uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping>::skipMultipleIgnoredRows(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                                                                        typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    IndexType result{0ull};
-    while (skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-        ++result;
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "Undexpected state of VI operator");
-        // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
-        STORM_LOG_ASSERT(*matrixColumnIt < StartOfRowGroupIndicator, "Undexpected state of VI operator");
+template<bool Backward, typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::computeParallelChunks() {
+    auto const& columns = getMatrixColumns<ColumnType>();
+    parallelChunks.clear();
+    uint64_t const numGroups = TrivialRowGrouping ? columns.size() - matrixValues.size() - 1 : this->rowGroupIndices->size() - 1;
+    IndexType columnPos{0}, valuePos{0};
+    IndexType chunkFirstGroup{0}, chunkColumnOffset{0}, chunkValueOffset{0};
+    bool chunkIsEmpty{true};
+    for (auto groupIndex : indexRange<Backward>(0, numGroups)) {
+        if (chunkIsEmpty) {
+            chunkFirstGroup = groupIndex;
+            chunkColumnOffset = columnPos;
+            chunkValueOffset = valuePos;
+            chunkIsEmpty = false;
+        }
+        // Move to the indicator of the next row group. Chunks never split a row group.
+        do {
+            for (++columnPos; columns[columnPos] < StartOfRowIndicator<ColumnType>; ++columnPos) {
+                ++valuePos;
+            }
+        } while (!TrivialRowGrouping && columns[columnPos] < StartOfRowGroupIndicator<ColumnType>);
+        if (columnPos - chunkColumnOffset >= parallelChunkSize || groupIndex == (Backward ? 0 : numGroups - 1)) {
+            if constexpr (Backward) {
+                parallelChunks.push_back({groupIndex, chunkFirstGroup + 1, chunkColumnOffset, chunkValueOffset});
+            } else {
+                parallelChunks.push_back({chunkFirstGroup, groupIndex + 1, chunkColumnOffset, chunkValueOffset});
+            }
+            chunkIsEmpty = true;
+        }
     }
-    return result;
+    STORM_LOG_ASSERT(columnPos + 1 == columns.size(), "Unexpected position in 'matrixColumns' after computing chunks.");
+    STORM_LOG_ASSERT(valuePos == matrixValues.size(), "Unexpected position in 'matrixValues' after computing chunks.");
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::moveToEndOfRow(typename std::vector<ColumnType>::iterator& matrixColumnIt) const {
+    do {
+        ++matrixColumnIt;
+    } while (*matrixColumnIt < StartOfRowIndicator<ColumnType>);
 }
 
 template class ValueIterationOperator<double, true>;
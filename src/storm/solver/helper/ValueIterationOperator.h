@@ -1,12 +1,17 @@
 #pragma once
+#include <atomic>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/irange.hpp>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"  // TODO
@@ -27,11 +32,15 @@ namespace solver::helper {
  * The application of the operator is heavily templated so that many different flavours of value iteration and related algorithms can be implemented using this.
  * @tparam ValueType The type of the matrix entries
  * @tparam TrivialRowGrouping True iff the underlying model is deterministic
+ *
+ * If the matrix has less than 2^30 columns, column indices are internally stored with 32 bits instead of 64 bits,
+ * which roughly reduces the amount of memory that is read in each application of the operator by a third (for double values).
  */
 template<typename ValueType, bool TrivialRowGrouping>
 class ValueIterationOperator {
    public:
     using IndexType = storm::storage::sparse::state_type;
+    using CompactIndexType = uint32_t;
 
     /*!
      * Initializes this operator with the given data
@@ -86,22 +95,21 @@ class ValueIterationOperator {
      * @param backend the backend
      * @return whatever backend.converged() returns
      *
+     * If parallel application is enabled (see `setNumberOfThreads`) and the backend provides a method
+     * * backend.join(otherBackend); merges the state of a backend that processed a different chunk of row groups into this backend
+     * the row groups are split into chunks that are processed concurrently, each by its own copy of the backend (copied after backend.startNewIteration()).
+     * The chunk backends are joined into the given backend (in the order in which the chunks would be processed sequentially) before
+     * backend.endOfIteration() is invoked. If operandIn and operandOut coincide, each chunk performs Gauss-Seidel updates on its own row groups and reads
+     * the values of all other row groups from the previous iteration. Backends without a join method are always applied sequentially.
+     *
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
     template<typename OperandType, typename OffsetType, typename BackendType>
     bool apply(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
-        if (hasSkippedRows) {
-            if (backwards) {
-                return apply<OperandType, OffsetType, BackendType, true, true>(operandOut, operandIn, offsets, backend);
-            } else {
-                return apply<OperandType, OffsetType, BackendType, false, true>(operandOut, operandIn, offsets, backend);
-            }
+        if (compactColumns) {
+            return apply<CompactIndexType>(operandIn, operandOut, offsets, backend);
         } else {
-            if (backwards) {
-                return apply<OperandType, OffsetType, BackendType, true, false>(operandOut, operandIn, offsets, backend);
-            } else {
-                return apply<OperandType, OffsetType, BackendType, false, false>(operandOut, operandIn, offsets, backend);
-            }
+            return apply<IndexType>(operandIn, operandOut, offsets, backend);
         }
     }
 
@@ -145,48 +153,236 @@ class ValueIterationOperator {
      */
     void freeAuxiliaryVector();
 
+    /*!
+     * Sets the number of threads used when applying the operator.
+     * @param numberOfThreads the number of threads. A value of 1 means that the operator is applied sequentially. A value of 0 uses all available cores.
+     * @param chunkSize the (approximate) number of entries of the 'matrixColumns' vector that are processed as one chunk. Chunks are the smallest unit of work
+     *                  that is distributed among the threads. The default is chosen such that the data of a chunk fits into the L2 cache.
+     * @note Parallel application requires Storm to be built with Intel TBB. Otherwise, the operator is always applied sequentially.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads, uint64_t chunkSize = DefaultParallelChunkSize);
+
+    /*!
+     * @return the number of threads used when applying the operator. A value of 0 means that all available cores are used.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * @return true iff the operator is applied using multiple threads
+     */
+    bool isParallelApplyEnabled() const;
+
+    /*!
+     * The default number of entries of the 'matrixColumns' vector that are processed as one chunk when applying the operator in parallel
+     */
+    static const uint64_t DefaultParallelChunkSize = 1ull << 15;
+
    private:
+    /*!
+     * Detects whether the given backend supports parallel application of the operator, i.e., whether it provides a method
+     * `void join(BackendType const& other)`
+     */
+    template<typename BackendType, typename = void>
+    struct SupportsParallelApply : std::false_type {};
+
+    template<typename BackendType>
+    struct SupportsParallelApply<BackendType, std::void_t<decltype(std::declval<BackendType&>().join(std::declval<BackendType const&>()))>>
+        : std::true_type {};
+
+    /*!
+     * A consecutive range of row groups that is processed as one unit of work during parallel application.
+     */
+    struct ParallelChunk {
+        IndexType groupBegin;    /// The first row group of this chunk (w.r.t. increasing row group indices)
+        IndexType groupEnd;      /// One past the last row group of this chunk (w.r.t. increasing row group indices)
+        IndexType columnOffset;  /// The position of the row group indicator of the first processed group in 'matrixColumns'
+        IndexType valueOffset;   /// The position of the first entry of the first processed group in 'matrixValues'
+    };
+
+    /*!
+     * View on an operand that is updated in place during a parallel application.
+     * Values of row groups within the current chunk are read from the current operand (Gauss-Seidel style),
+     * values of all other row groups are read from a snapshot that was taken at the beginning of the iteration (Jacobi style).
+     */
+    template<typename OperandType>
+    struct ChunkLocalOperand {
+        OperandType const& current;
+        OperandType const& snapshot;
+        IndexType const groupBegin;
+        IndexType const groupEnd;
+
+        OperandType const& select(IndexType column) const {
+            return (column >= groupBegin && column < groupEnd) ? current : snapshot;
+        }
+    };
+
+    /*!
+     * Variant of `apply` for the given type of the entries of the 'matrixColumns' vector
+     */
+    template<typename ColumnType, typename OperandType, typename OffsetType, typename BackendType>
+    bool apply(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
+        if constexpr (SupportsParallelApply<BackendType>::value) {
+            if (isParallelApplyEnabled()) {
+                if (hasSkippedRows) {
+                    if (backwards) {
+                        return applyParallel<ColumnType, OperandType, OffsetType, BackendType, true, true>(operandOut, operandIn, offsets, backend);
+                    } else {
+                        return applyParallel<ColumnType, OperandType, OffsetType, BackendType, false, true>(operandOut, operandIn, offsets, backend);
+                    }
+                } else {
+                    if (backwards) {
+                        return applyParallel<ColumnType, OperandType, OffsetType, BackendType, true, false>(operandOut, operandIn, offsets, backend);
+                    } else {
+                        return applyParallel<ColumnType, OperandType, OffsetType, BackendType, false, false>(operandOut, operandIn, offsets, backend);
+                    }
+                }
+            }
+        }
+        if (hasSkippedRows) {
+            if (backwards) {
+                return apply<ColumnType, OperandType, OffsetType, BackendType, true, true>(operandOut, operandIn, offsets, backend);
+            } else {
+                return apply<ColumnType, OperandType, OffsetType, BackendType, false, true>(operandOut, operandIn, offsets, backend);
+            }
+        } else {
+            if (backwards) {
+                return apply<ColumnType, OperandType, OffsetType, BackendType, true, false>(operandOut, operandIn, offsets, backend);
+            } else {
+                return apply<ColumnType, OperandType, OffsetType, BackendType, false, false>(operandOut, operandIn, offsets, backend);
+            }
+        }
+    }
+
+    /*!
+     * Internal variant of `apply` that processes the row groups in parallel
+     * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
+     */
+    template<typename ColumnType, typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows>
+    bool applyParallel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+#ifdef STORM_HAVE_INTELTBB
+        STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
+        STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == getSize(operandIn) + 1, "Dimension mismatch");
+        STORM_LOG_ASSERT(!parallelChunks.empty() || getSize(operandIn) == 0, "VI Operator in invalid state.");
+        backend.startNewIteration();
+        bool const inPlace = &operandIn == &operandOut;
+        if (inPlace) {
+            // Take a snapshot of the operand so that chunks do not observe intermediate values of other chunks.
+            auto& snapshot = getOperandSnapshot<OperandType>();
+            resizeOperand(snapshot, getSize(operandIn));
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, parallelChunks.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (auto chunkIndex = range.begin(); chunkIndex != range.end(); ++chunkIndex) {
+                    copyOperand(operandIn, snapshot, parallelChunks[chunkIndex].groupBegin, parallelChunks[chunkIndex].groupEnd);
+                }
+            });
+        }
+        std::vector<std::optional<BackendType>> chunkBackends(parallelChunks.size());
+        std::atomic<bool> aborted{false};
+        auto processChunks = [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto chunkIndex = range.begin(); chunkIndex != range.end() && !aborted.load(std::memory_order_relaxed); ++chunkIndex) {
+                auto const& chunk = parallelChunks[chunkIndex];
+                auto& chunkBackend = chunkBackends[chunkIndex].emplace(backend);
+                bool chunkAborted;
+                if (inPlace) {
+                    ChunkLocalOperand<OperandType> chunkOperand{operandOut, getOperandSnapshot<OperandType>(), chunk.groupBegin, chunk.groupEnd};
+                    chunkAborted = applyChunk<ColumnType, Backward, SkipIgnoredRows>(chunk, operandOut, chunkOperand, offsets, chunkBackend);
+                } else {
+                    chunkAborted = applyChunk<ColumnType, Backward, SkipIgnoredRows>(chunk, operandOut, operandIn, offsets, chunkBackend);
+                }
+                if (chunkAborted) {
+                    aborted.store(true, std::memory_order_relaxed);
+                }
+            }
+        };
+        if (numberOfThreads == 0) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, parallelChunks.size(), 1), processChunks);
+        } else {
+            STORM_LOG_ASSERT(taskArena, "No task arena for the requested number of threads.");
+            taskArena->execute([&]() { tbb::parallel_for(tbb::blocked_range<uint64_t>(0, parallelChunks.size(), 1), processChunks); });
+        }
+        // Merge the results of the individual chunks in the order in which a sequential application would have processed them.
+        for (auto& chunkBackend : chunkBackends) {
+            if (chunkBackend.has_value()) {
+                backend.join(*chunkBackend);
+            }
+        }
+        if (aborted.load()) {
+            return backend.converged();
+        }
+        backend.endOfIteration();
+        return backend.converged();
+#else
+        return apply<ColumnType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows>(operandOut, operandIn, offsets, backend);
+#endif
+    }
+
+    /*!
+     * Applies the operator on the row groups of the given chunk
+     * @return true iff the backend requested to abort
+     */
+    template<typename ColumnType, bool Backward, bool SkipIgnoredRows, typename OperandType, typename OperandInType, typename OffsetType,
+             typename BackendType>
+    bool applyChunk(ParallelChunk const& chunk, OperandType& operandOut, OperandInType const& operandIn, OffsetType const& offsets,
+                    BackendType& backend) const {
+        auto matrixValueIt = matrixValues.cbegin() + chunk.valueOffset;
+        auto matrixColumnIt = getMatrixColumns<ColumnType>().cbegin() + chunk.columnOffset;
+        for (auto groupIndex : indexRange<Backward>(chunk.groupBegin, chunk.groupEnd)) {
+            applyGroup<ColumnType, SkipIgnoredRows>(matrixColumnIt, matrixValueIt, groupIndex, operandOut, operandIn, offsets, backend);
+            if (backend.abort()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * Processes all rows of the given row group and invokes the backend accordingly. Advances the given iterators to the start of the next row group.
+     */
+    template<typename ColumnType, bool SkipIgnoredRows, typename OperandType, typename OperandInType, typename OffsetType, typename BackendType>
+    void applyGroup(typename std::vector<ColumnType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+                    IndexType groupIndex, OperandType& operandOut, OperandInType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        STORM_LOG_ASSERT(matrixColumnIt != getMatrixColumns<ColumnType>().end(), "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
+        if constexpr (TrivialRowGrouping) {
+            backend.firstRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
+        } else {
+            IndexType rowIndex = (*rowGroupIndices)[groupIndex];
+            if constexpr (SkipIgnoredRows) {
+                rowIndex += skipMultipleIgnoredRows<ColumnType>(matrixColumnIt, matrixValueIt);
+            }
+            backend.firstRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+            while (*matrixColumnIt < StartOfRowGroupIndicator<ColumnType>) {
+                ++rowIndex;
+                if (!SkipIgnoredRows || !skipIgnoredRow<ColumnType>(matrixColumnIt, matrixValueIt)) {
+                    backend.nextRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                }
+            }
+        }
+        if constexpr (isPair<OperandType>::value) {
+            backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
+        } else {
+            backend.applyUpdate(operandOut[groupIndex], groupIndex);
+        }
+    }
+
     /*!
      * Internal variant of `apply`
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
-    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows>
+    template<typename ColumnType, typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows>
     bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
         STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
         auto const operandSize = getSize(operandIn);
         STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
         backend.startNewIteration();
         auto matrixValueIt = matrixValues.cbegin();
-        auto matrixColumnIt = matrixColumns.cbegin();
+        auto matrixColumnIt = getMatrixColumns<ColumnType>().cbegin();
         for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
-            STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
-            //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
-            if constexpr (TrivialRowGrouping) {
-                backend.firstRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
-            } else {
-                IndexType rowIndex = (*rowGroupIndices)[groupIndex];
-                if constexpr (SkipIgnoredRows) {
-                    rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
-                }
-                backend.firstRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
-                while (*matrixColumnIt < StartOfRowGroupIndicator) {
-                    ++rowIndex;
-                    if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-                        backend.nextRow(applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
-                    }
-                }
-            }
-            if constexpr (isPair<OperandType>::value) {
-                backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
-            } else {
-                backend.applyUpdate(operandOut[groupIndex], groupIndex);
-            }
+            applyGroup<ColumnType, SkipIgnoredRows>(matrixColumnIt, matrixValueIt, groupIndex, operandOut, operandIn, offsets, backend);
             if (backend.abort()) {
                 return backend.converged();
             }
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == getMatrixColumns<ColumnType>().cend(), "Unexpected position of matrix column iterator.");
         STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
         backend.endOfIteration();
         return backend.converged();
@@ -211,20 +407,32 @@ class ValueIterationOperator {
         return {(*offsets.first)[offsetIndex], offsets.second};
     }
 
+    template<typename OperandType>
+    OperandType const& getOperand(OperandType const& operand, [[maybe_unused]] IndexType column) const {
+        return operand;
+    }
+
+    template<typename OperandType>
+    OperandType const& getOperand(ChunkLocalOperand<OperandType> const& operand, IndexType column) const {
+        return operand.select(column);
+    }
+
     /*!
      * Computes the result for a single row and advances the given iterators to the end of the row
      */
-    template<typename OperandType, typename OffsetType>
-    auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+    template<typename ColumnIterator, typename OperandType, typename OffsetType>
+    auto applyRow(ColumnIterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
                   OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
-        auto result{initializeRowRes(operand, offsets, offsetIndex)};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
-            if constexpr (isPair<OperandType>::value) {
-                result.first += operand.first[*matrixColumnIt] * (*matrixValueIt);
-                result.second += operand.second[*matrixColumnIt] * (*matrixValueIt);
+        using ColumnType = typename std::iterator_traits<ColumnIterator>::value_type;
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
+        auto result{initializeRowRes(getOperand(operand, 0), offsets, offsetIndex)};
+        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator<ColumnType>; ++matrixColumnIt, ++matrixValueIt) {
+            auto const& op = getOperand(operand, *matrixColumnIt);
+            if constexpr (isPair<std::decay_t<decltype(op)>>::value) {
+                result.first += op.first[*matrixColumnIt] * (*matrixValueIt);
+                result.second += op.second[*matrixColumnIt] * (*matrixValueIt);
             } else {
-                result += operand[*matrixColumnIt] * (*matrixValueIt);
+                result += op[*matrixColumnIt] * (*matrixValueIt);
             }
         }
         return result;
@@ -256,27 +464,114 @@ class ValueIterationOperator {
     template<typename T1, typename T2>
     struct isPair<std::pair<T1, T2>> : std::true_type {};
 
+    template<typename T>
+    void resizeOperand(std::vector<T>& vec, uint64_t size) const {
+        vec.resize(size);
+    }
+
+    template<typename T1, typename T2>
+    void resizeOperand(std::pair<T1, T2>& pairOfVec, uint64_t size) const {
+        pairOfVec.first.resize(size);
+        pairOfVec.second.resize(size);
+    }
+
+    template<typename T>
+    void copyOperand(std::vector<T> const& source, std::vector<T>& target, uint64_t begin, uint64_t end) const {
+        std::copy(source.begin() + begin, source.begin() + end, target.begin() + begin);
+    }
+
+    template<typename T1, typename T2>
+    void copyOperand(std::pair<T1, T2> const& source, std::pair<T1, T2>& target, uint64_t begin, uint64_t end) const {
+        copyOperand(source.first, target.first, begin, end);
+        copyOperand(source.second, target.second, begin, end);
+    }
+
+    template<typename OperandType>
+    OperandType& getOperandSnapshot() const {
+        if constexpr (isPair<OperandType>::value) {
+            return operandPairSnapshot;
+        } else {
+            return operandSnapshot;
+        }
+    }
+
+    template<typename ColumnType>
+    std::vector<ColumnType>& getMatrixColumns() {
+        if constexpr (std::is_same_v<ColumnType, CompactIndexType>) {
+            return compactMatrixColumns;
+        } else {
+            return matrixColumns;
+        }
+    }
+
+    template<typename ColumnType>
+    std::vector<ColumnType> const& getMatrixColumns() const {
+        if constexpr (std::is_same_v<ColumnType, CompactIndexType>) {
+            return compactMatrixColumns;
+        } else {
+            return matrixColumns;
+        }
+    }
+
+    /*!
+     * Internal variant of setMatrix that fills the 'matrixColumns' vector of the given type
+     */
+    template<bool Backward, typename ColumnType>
+    void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix);
+
     /*!
      * Internal variant of setIgnoredRows
      */
-    template<bool Backward = true>
+    template<bool Backward, typename ColumnType>
     void setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore);
 
+    /*!
+     * Internal variant of unsetIgnoredRows
+     */
+    template<typename ColumnType>
+    void unsetIgnoredRows();
+
+    /*!
+     * Splits the row groups into chunks for parallel application
+     */
+    template<bool Backward, typename ColumnType>
+    void computeParallelChunks();
+
     /*!
      * Moves the given iterator to the end of the current row
      */
-    void moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const;
+    template<typename ColumnType>
+    void moveToEndOfRow(typename std::vector<ColumnType>::iterator& matrixColumnIt) const;
 
     /*!
      * Skips the current row, if it is ignored. Advances the iterators accordingly
      */
-    bool skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    template<typename ColumnType>
+    bool skipIgnoredRow(typename std::vector<ColumnType>::const_iterator& matrixColumnIt,
+                        typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
+        if (ColumnType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask<ColumnType>)) {
+            matrixColumnIt += entriesToSkip;
+            matrixValueIt += entriesToSkip - 1;
+            return true;
+        }
+        return false;
+    }
 
     /*!
      * Skips all ignored rows, advancing the iterators to the first successor row that is not ignored
      */
-    uint64_t skipMultipleIgnoredRows(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                     typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    template<typename ColumnType>
+    uint64_t skipMultipleIgnoredRows(typename std::vector<ColumnType>::const_iterator& matrixColumnIt,
+                                     typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
+        IndexType result{0ull};
+        while (skipIgnoredRow<ColumnType>(matrixColumnIt, matrixValueIt)) {
+            ++result;
+            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "Undexpected state of VI operator");
+            // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
+            STORM_LOG_ASSERT(*matrixColumnIt < StartOfRowGroupIndicator<ColumnType>, "Undexpected state of VI operator");
+        }
+        return result;
+    }
 
     /*!
      * The non-zero matrix entries.
@@ -286,9 +581,20 @@ class ValueIterationOperator {
     /*!
      * Row indicators and columns of the matrix entries. Has size #non-zero matrix entries + #rows + 1
      * A row indicator is an index >= 1000...000. Before and after each row there is a row indicator.
+     * Only used if 'compactColumns' is false.
      */
     std::vector<IndexType> matrixColumns;
 
+    /*!
+     * Same as 'matrixColumns' but with 32 bit entries. Only used if 'compactColumns' is true.
+     */
+    std::vector<CompactIndexType> compactMatrixColumns;
+
+    /*!
+     * True iff the column indices are stored in 'compactMatrixColumns'
+     */
+    bool compactColumns{false};
+
     /*!
      * Row group indices as in the sparse matrix (even if the matrix is set in backwards order, this vector will not be reversed)
      */
@@ -314,20 +620,53 @@ class ValueIterationOperator {
      */
     bool auxiliaryVectorUsedExternally{false};
 
+    /*!
+     * The number of threads used when applying the operator (0 means all available cores)
+     */
+    uint64_t numberOfThreads{1};
+
+#ifdef STORM_HAVE_INTELTBB
+    /*!
+     * The arena in which the operator is applied if a fixed number of threads (other than one) is requested
+     */
+    std::unique_ptr<tbb::task_arena> taskArena;
+#endif
+
+    /*!
+     * The (approximate) number of entries of 'matrixColumns' that are processed as one chunk during parallel application
+     */
+    uint64_t parallelChunkSize{DefaultParallelChunkSize};
+
+    /*!
+     * The chunks considered during parallel application (in the order in which they would be processed sequentially). Empty if parallel application is
+     * disabled.
+     */
+    std::vector<ParallelChunk> parallelChunks;
+
+    /*!
+     * Storage for snapshots of the operand that are taken when applying the operator in place and in parallel
+     */
+    mutable std::vector<ValueType> operandSnapshot;
+    mutable std::pair<std::vector<ValueType>, std::vector<ValueType>> operandPairSnapshot;
+
     /*!
      * Bitmask that indicates the start of a row in the 'matrixColumns' vector
      */
-    IndexType const StartOfRowIndicator = 1ull << 63;  // 10000..0
+    template<typename ColumnType>
+    static constexpr ColumnType StartOfRowIndicator = ColumnType(1) << (std::numeric_limits<ColumnType>::digits - 1);  // 10000..0
 
     /*!
      * Bitmask that indicates the start of a row group in the 'matrixColumns' vector
      */
-    IndexType const StartOfRowGroupIndicator = StartOfRowIndicator + (1ull << 62);  // 11000..0
+    template<typename ColumnType>
+    static constexpr ColumnType StartOfRowGroupIndicator =
+        StartOfRowIndicator<ColumnType> + (ColumnType(1) << (std::numeric_limits<ColumnType>::digits - 2));  // 11000..0
 
     /*!
      * Ignored rows are encoded by adding the number of skipped entries to the row indicator. This Bitmask helps to get the number of skipped entries
      */
-    IndexType const SkipNumEntriesMask = ~StartOfRowGroupIndicator;  // 00111..1
+    template<typename ColumnType>
+    static constexpr ColumnType SkipNumEntriesMask = static_cast<ColumnType>(~StartOfRowGroupIndicator<ColumnType>);  // 00111..1
 };
 
 }  // namespace solver::helper
@@ -0,0 +1,219 @@
+#include "storm/solver/multiplier/SimdMultiplier.h"
+
+#include <limits>
+#include <type_traits>
+
+#include "storm-config.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : NativeMultiplier<ValueType>(matrix), kernelType(storm::solver::simd::SimdKernelType::Scalar) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        kernelType = storm::solver::simd::getSupportedSimdKernelType();
+        STORM_LOG_DEBUG("Using " << storm::solver::simd::toString(kernelType) << " kernels for matrix-vector multiplication.");
+    }
+}
+
+template<typename ValueType>
+storm::solver::simd::SimdKernelType SimdMultiplier<ValueType>::getKernelType() const {
+    return kernelType;
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::initialize() const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (!soaRowIndications.empty()) {
+            return;
+        }
+        // The 32 bit gathers of the vectorized kernels sign-extend their indices, so compact columns have to be below 2^31.
+        bool const compact = this->matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+        soaRowIndications.reserve(this->matrix.getRowCount() + 1);
+        if (compact) {
+            compactSoaColumns.reserve(this->matrix.getEntryCount());
+        } else {
+            soaColumns.reserve(this->matrix.getEntryCount());
+        }
+        soaValues.reserve(this->matrix.getEntryCount());
+        soaRowIndications.push_back(0);
+        for (uint64_t row = 0; row < this->matrix.getRowCount(); ++row) {
+            for (auto const& entry : this->matrix.getRow(row)) {
+                if (compact) {
+                    compactSoaColumns.push_back(static_cast<uint32_t>(entry.getColumn()));
+                } else {
+                    soaColumns.push_back(entry.getColumn());
+                }
+                soaValues.push_back(entry.getValue());
+            }
+            soaRowIndications.push_back(soaValues.size());
+        }
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::clearCache() const {
+    soaRowIndications = std::vector<uint64_t>();
+    soaColumns = std::vector<uint64_t>();
+    compactSoaColumns = std::vector<uint32_t>();
+    soaValues = std::vector<double>();
+    NativeMultiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+bool SimdMultiplier<ValueType>::parallelize(Environment const&) const {
+#ifdef STORM_HAVE_INTELTBB
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+    return false;
+#endif
+}
+
+template<typename ValueType>
+template<typename Function>
+void SimdMultiplier<ValueType>::withMatrixView(Function const& function) const {
+    initialize();
+    if (soaColumns.empty()) {
+        function(storm::solver::simd::SoaMatrixView<uint32_t>{soaRowIndications.data(), compactSoaColumns.data(), soaValues.data()});
+    } else {
+        function(storm::solver::simd::SoaMatrixView<uint64_t>{soaRowIndications.data(), soaColumns.data(), soaValues.data()});
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        std::vector<ValueType>* target = &result;
+        if (&x == &result) {
+            if (this->cachedVector) {
+                this->cachedVector->resize(x.size());
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            }
+            target = this->cachedVector.get();
+        }
+        multAdd(x, b, *target, parallelize(env));
+        if (&x == &result) {
+            std::swap(result, *this->cachedVector);
+        }
+    } else {
+        NativeMultiplier<ValueType>::multiply(env, x, b, result);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        withMatrixView([&](auto const& matrixView) {
+            storm::solver::simd::multiplyAdd(kernelType, matrixView, 0, this->matrix.getRowCount(), x.data(), b ? b->data() : nullptr, x.data(), backwards);
+        });
+    } else {
+        NativeMultiplier<ValueType>::multiplyGaussSeidel(env, x, b, backwards);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        std::vector<ValueType>* target = &result;
+        if (&x == &result) {
+            if (this->cachedVector) {
+                this->cachedVector->resize(x.size());
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            }
+            target = this->cachedVector.get();
+        }
+        multAddReduce(dir, rowGroupIndices, x, b, *target, choices, parallelize(env));
+        if (&x == &result) {
+            std::swap(result, *this->cachedVector);
+        }
+    } else {
+        NativeMultiplier<ValueType>::multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                             std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                             std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        withMatrixView([&](auto const& matrixView) {
+            storm::solver::simd::multiplyAndReduce(kernelType, storm::solver::minimize(dir), matrixView, rowGroupIndices.data(), 0, rowGroupIndices.size() - 1,
+                                                   x.data(), b ? b->data() : nullptr, x.data(), choices ? choices->data() : nullptr, backwards);
+        });
+    } else {
+        NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, choices, backwards);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                        bool parallel) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        double const* summand = b ? b->data() : nullptr;
+        withMatrixView([&](auto const& matrixView) {
+            if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, result.size(), 100), [&](tbb::blocked_range<uint64_t> const& range) {
+                    storm::solver::simd::multiplyAdd(kernelType, matrixView, range.begin(), range.end(), x.data(), summand, result.data());
+                });
+                return;
+#else
+                STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+#endif
+            }
+            storm::solver::simd::multiplyAdd(kernelType, matrixView, 0, result.size(), x.data(), summand, result.data());
+        });
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                              std::vector<uint64_t>* choices, bool parallel) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        bool const minimize = storm::solver::minimize(dir);
+        double const* summand = b ? b->data() : nullptr;
+        uint64_t* choicesData = choices ? choices->data() : nullptr;
+        withMatrixView([&](auto const& matrixView) {
+            if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, rowGroupIndices.size() - 1, 100), [&](tbb::blocked_range<uint64_t> const& range) {
+                    storm::solver::simd::multiplyAndReduce(kernelType, minimize, matrixView, rowGroupIndices.data(), range.begin(), range.end(), x.data(),
+                                                           summand, result.data(), choicesData);
+                });
+                return;
+#else
+                STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+#endif
+            }
+            storm::solver::simd::multiplyAndReduce(kernelType, minimize, matrixView, rowGroupIndices.data(), 0, rowGroupIndices.size() - 1, x.data(), summand,
+                                                   result.data(), choicesData);
+        });
+    }
+}
+
+template class SimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class SimdMultiplier<storm::RationalNumber>;
+template class SimdMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "storm/solver/multiplier/NativeMultiplier.h"
+
+#include "storm/solver/multiplier/simd/SimdKernels.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * A multiplier that uses vectorized (AVX2 or AVX-512) kernels for matrix-vector multiplications over doubles.
+ * The instruction set is selected at runtime depending on the capabilities of the CPU, falling back to a scalar kernel if neither is available.
+ * For this, the matrix is stored in a structure-of-arrays layout (i.e., columns and values are stored in separate arrays).
+ * If the number of columns allows it, column indices are stored with 32 bits, reducing the memory traffic per multiplication.
+ * For value types other than double, this multiplier behaves like the NativeMultiplier.
+ *
+ * @note the vectorized kernels sum up the products of a row in a different order than the native multiplier,
+ *       so results might differ in the last bits due to floating point rounding.
+ */
+template<typename ValueType>
+class SimdMultiplier : public NativeMultiplier<ValueType> {
+   public:
+    SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~SimdMultiplier() = default;
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void clearCache() const override;
+
+    /*!
+     * @return the instruction set that is used by this multiplier.
+     */
+    storm::solver::simd::SimdKernelType getKernelType() const;
+
+   private:
+    void initialize() const;
+
+    bool parallelize(Environment const& env) const;
+
+    /*!
+     * Invokes the given function with a view on the matrix in structure-of-arrays layout (with 32 or 64 bit column indices).
+     */
+    template<typename Function>
+    void withMatrixView(Function const& function) const;
+
+    void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool parallel) const;
+    void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                       std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, bool parallel) const;
+
+    storm::solver::simd::SimdKernelType kernelType;
+
+    // The matrix in structure-of-arrays layout. Only filled for double and computed lazily.
+    mutable std::vector<uint64_t> soaRowIndications;
+    mutable std::vector<uint64_t> soaColumns;         // Only used if the column indices do not fit into 31 bits
+    mutable std::vector<uint32_t> compactSoaColumns;  // Only used if the column indices fit into 31 bits
+    mutable std::vector<double> soaValues;
+};
+
+}  // namespace solver
+}  // namespace storm
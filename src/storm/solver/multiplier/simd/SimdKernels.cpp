@@ -0,0 +1,93 @@
+#include "storm/solver/multiplier/simd/SimdKernels.h"
+
+#include "storm/solver/multiplier/simd/SimdKernelsImpl.h"
+
+namespace storm {
+namespace solver {
+namespace simd {
+
+std::string toString(SimdKernelType const& type) {
+    switch (type) {
+        case SimdKernelType::Scalar:
+            return "scalar";
+        case SimdKernelType::Avx2:
+            return "AVX2";
+        case SimdKernelType::Avx512:
+            return "AVX-512";
+    }
+    return "unknown";
+}
+
+SimdKernelType getSupportedSimdKernelType() {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    if (avx512::isCompiled() && __builtin_cpu_supports("avx512f")) {
+        return SimdKernelType::Avx512;
+    }
+    if (avx2::isCompiled() && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdKernelType::Avx2;
+    }
+#endif
+    return SimdKernelType::Scalar;
+}
+
+template<typename ColumnType>
+void multiplyAdd(SimdKernelType const& type, SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x,
+                 double const* summand, double* result, bool backward) {
+    switch (type) {
+        case SimdKernelType::Avx512:
+            avx512::multiplyAdd(matrix, beginRow, endRow, x, summand, result, backward);
+            break;
+        case SimdKernelType::Avx2:
+            avx2::multiplyAdd(matrix, beginRow, endRow, x, summand, result, backward);
+            break;
+        default:
+            scalar::multiplyAdd(matrix, beginRow, endRow, x, summand, result, backward);
+    }
+}
+
+template<typename ColumnType>
+void multiplyAndReduce(SimdKernelType const& type, bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices,
+                       uint64_t beginGroup, uint64_t endGroup, double const* x, double const* summand, double* result, uint64_t* choices, bool backward) {
+    switch (type) {
+        case SimdKernelType::Avx512:
+            avx512::multiplyAndReduce(minimize, matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices, backward);
+            break;
+        case SimdKernelType::Avx2:
+            avx2::multiplyAndReduce(minimize, matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices, backward);
+            break;
+        default:
+            scalar::multiplyAndReduce(minimize, matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices, backward);
+    }
+}
+
+template void multiplyAdd(SimdKernelType const&, SoaMatrixView<uint32_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAdd(SimdKernelType const&, SoaMatrixView<uint64_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAndReduce(SimdKernelType const&, bool, SoaMatrixView<uint32_t> const&, uint64_t const*, uint64_t, uint64_t, double const*,
+                                double const*, double*, uint64_t*, bool);
+template void multiplyAndReduce(SimdKernelType const&, bool, SoaMatrixView<uint64_t> const&, uint64_t const*, uint64_t, uint64_t, double const*,
+                                double const*, double*, uint64_t*, bool);
+
+namespace scalar {
+template<typename ColumnType>
+void multiplyAdd(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                 bool backward) {
+    multiplyAddImpl<ScalarDot>(matrix, beginRow, endRow, x, summand, result, backward);
+}
+
+template<typename ColumnType>
+void multiplyAndReduce(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                       double const* x, double const* summand, double* result, uint64_t* choices, bool backward) {
+    multiplyAndReduceImpl<ScalarDot>(minimize, matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices, backward);
+}
+
+template void multiplyAdd(SoaMatrixView<uint32_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAdd(SoaMatrixView<uint64_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint32_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint64_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+}  // namespace scalar
+
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
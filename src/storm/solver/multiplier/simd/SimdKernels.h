@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace storm {
+namespace solver {
+namespace simd {
+
+/*!
+ * The instruction set that is used by the kernels of the SimdMultiplier.
+ */
+enum class SimdKernelType { Scalar, Avx2, Avx512 };
+
+std::string toString(SimdKernelType const& type);
+
+/*!
+ * Determines (at runtime) the most efficient kernel type that is supported by the current CPU and for which kernels were compiled.
+ */
+SimdKernelType getSupportedSimdKernelType();
+
+/*!
+ * The matrix data as consumed by the kernels, i.e., a CSR matrix whose columns and values are stored in separate arrays.
+ * @tparam ColumnType the type of the column indices. Either uint64_t or uint32_t (if the number of columns allows it).
+ *         32 bit column indices must be below 2^31 as the vectorized kernels gather with sign-extended 32 bit offsets.
+ */
+template<typename ColumnType>
+struct SoaMatrixView {
+    uint64_t const* rowIndications;  /// rowIndications[r] is the position of the first entry of row r. Has one more entry than there are rows.
+    ColumnType const* columns;       /// The column of each entry.
+    double const* values;            /// The value of each entry.
+};
+
+/*!
+ * Computes result[r] = summand[r] + (row r of the matrix) * x for all rows r in [beginRow, endRow).
+ * The rows are processed in ascending (or descending if backward is set) order. If result and x coincide, this performs a Gauss-Seidel step.
+ * @param summand can be nullptr in which case no summand is added
+ */
+template<typename ColumnType>
+void multiplyAdd(SimdKernelType const& type, SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x,
+                 double const* summand, double* result, bool backward = false);
+
+/*!
+ * Computes result[g] = opt_{r in group g} summand[r] + (row r of the matrix) * x for all row groups g in [beginGroup, endGroup),
+ * where opt is min or max. The row groups are processed in ascending (or descending if backward is set) order.
+ * Empty row groups are skipped, i.e., the corresponding result entry is not changed.
+ * If choices is not nullptr, the choice of each group is only updated if the optimal row is strictly better than the previously selected row.
+ * @param summand can be nullptr in which case no summand is added
+ */
+template<typename ColumnType>
+void multiplyAndReduce(SimdKernelType const& type, bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices,
+                       uint64_t beginGroup, uint64_t endGroup, double const* x, double const* summand, double* result, uint64_t* choices,
+                       bool backward = false);
+
+// The implementations for the individual instruction sets. These are compiled in separate translation units with the corresponding compiler flags
+// and are explicitly instantiated for uint32_t and uint64_t column indices.
+namespace scalar {
+template<typename ColumnType>
+void multiplyAdd(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                 bool backward);
+template<typename ColumnType>
+void multiplyAndReduce(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                       double const* x, double const* summand, double* result, uint64_t* choices, bool backward);
+}  // namespace scalar
+
+namespace avx2 {
+/// True iff the AVX2 kernels were compiled (requires an x86-64 target and a compiler that supports the corresponding flags).
+bool isCompiled();
+template<typename ColumnType>
+void multiplyAdd(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                 bool backward);
+template<typename ColumnType>
+void multiplyAndReduce(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                       double const* x, double const* summand, double* result, uint64_t* choices, bool backward);
+}  // namespace avx2
+
+namespace avx512 {
+/// True iff the AVX-512 kernels were compiled (requires an x86-64 target and a compiler that supports the corresponding flags).
+bool isCompiled();
+template<typename ColumnType>
+void multiplyAdd(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                 bool backward);
+template<typename ColumnType>
+void multiplyAndReduce(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                       double const* x, double const* summand, double* result, uint64_t* choices, bool backward);
+}  // namespace avx512
+
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,108 @@
+/*
+ * This file is compiled with AVX2 and FMA support (see src/storm/CMakeLists.txt).
+ * The kernels must only be invoked if the CPU supports these instruction sets.
+ */
+#include "storm/solver/multiplier/simd/SimdKernels.h"
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+#include <immintrin.h>
+
+#include "storm/solver/multiplier/simd/SimdKernelsImpl.h"
+
+namespace storm {
+namespace solver {
+namespace simd {
+namespace avx2 {
+namespace {
+struct Avx2Dot {
+    static inline __m256d gather(double const* x, uint64_t const* columns) {
+        return _mm256_i64gather_pd(x, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns)), 8);
+    }
+
+    static inline __m256d gather(double const* x, uint32_t const* columns) {
+        // The masked variant with an explicit source avoids spurious -Wmaybe-uninitialized warnings on some gcc versions.
+        __m256d const allLanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns)), allLanes, 8);
+    }
+
+    template<typename ColumnType>
+    static inline double dot(double initialValue, ColumnType const* columns, double const* values, uint64_t numEntries, double const* x) {
+        uint64_t i = 0;
+        if (numEntries >= 4) {
+            __m256d accumulator = _mm256_setzero_pd();
+            for (; i + 4 <= numEntries; i += 4) {
+                accumulator = _mm256_fmadd_pd(_mm256_loadu_pd(values + i), gather(x, columns + i), accumulator);
+            }
+            __m128d const sum = _mm_add_pd(_mm256_castpd256_pd128(accumulator), _mm256_extractf128_pd(accumulator, 1));
+            initialValue += _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+        }
+        for (; i < numEntries; ++i) {
+            initialValue += values[i] * x[columns[i]];
+        }
+        return initialValue;
+    }
+};
+}  // namespace
+
+bool isCompiled() {
+    return true;
+}
+
+template<typename ColumnType>
+void multiplyAdd(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                 bool backward) {
+    multiplyAddImpl<Avx2Dot>(matrix, beginRow, endRow, x, summand, result, backward);
+}
+
+template<typename ColumnType>
+void multiplyAndReduce(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                       double const* x, double const* summand, double* result, uint64_t* choices, bool backward) {
+    multiplyAndReduceImpl<Avx2Dot>(minimize, matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices, backward);
+}
+
+template void multiplyAdd(SoaMatrixView<uint32_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAdd(SoaMatrixView<uint64_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint32_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint64_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+}  // namespace avx2
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
+
+#else
+
+namespace storm {
+namespace solver {
+namespace simd {
+namespace avx2 {
+bool isCompiled() {
+    return false;
+}
+
+template<typename ColumnType>
+void multiplyAdd(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                 bool backward) {
+    scalar::multiplyAdd(matrix, beginRow, endRow, x, summand, result, backward);
+}
+
+template<typename ColumnType>
+void multiplyAndReduce(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                       double const* x, double const* summand, double* result, uint64_t* choices, bool backward) {
+    scalar::multiplyAndReduce(minimize, matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices, backward);
+}
+
+template void multiplyAdd(SoaMatrixView<uint32_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAdd(SoaMatrixView<uint64_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint32_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint64_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+}  // namespace avx2
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
+
+#endif
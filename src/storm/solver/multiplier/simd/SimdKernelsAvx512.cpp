@@ -0,0 +1,118 @@
+/*
+ * This file is compiled with AVX-512 (foundation) support (see src/storm/CMakeLists.txt).
+ * The kernels must only be invoked if the CPU supports these instruction sets.
+ */
+#include "storm/solver/multiplier/simd/SimdKernels.h"
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+#include "storm/solver/multiplier/simd/SimdKernelsImpl.h"
+
+namespace storm {
+namespace solver {
+namespace simd {
+namespace avx512 {
+namespace {
+struct Avx512Dot {
+    static inline __m512d gather(double const* x, uint64_t const* columns) {
+        return _mm512_i64gather_pd(_mm512_loadu_si512(columns), x, 8);
+    }
+
+    static inline __m512d gather(double const* x, uint32_t const* columns) {
+        return _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns)), x, 8);
+    }
+
+    static inline __m512d maskedGather(__mmask8 mask, double const* x, uint64_t const* columns) {
+        return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask, _mm512_maskz_loadu_epi64(mask, columns), x, 8);
+    }
+
+    static inline __m512d maskedGather(__mmask8 mask, double const* x, uint32_t const* columns) {
+        __m256i const indices = _mm512_castsi512_si256(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(mask), columns));
+        return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, x, 8);
+    }
+
+    template<typename ColumnType>
+    static inline double dot(double initialValue, ColumnType const* columns, double const* values, uint64_t numEntries, double const* x) {
+        if (numEntries < 4) {
+            for (uint64_t i = 0; i < numEntries; ++i) {
+                initialValue += values[i] * x[columns[i]];
+            }
+            return initialValue;
+        }
+        __m512d accumulator = _mm512_setzero_pd();
+        uint64_t i = 0;
+        for (; i + 8 <= numEntries; i += 8) {
+            accumulator = _mm512_fmadd_pd(_mm512_loadu_pd(values + i), gather(x, columns + i), accumulator);
+        }
+        if (i < numEntries) {
+            __mmask8 const mask = static_cast<__mmask8>((1u << (numEntries - i)) - 1u);
+            accumulator = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, values + i), maskedGather(mask, x, columns + i), accumulator);
+        }
+        return initialValue + _mm512_reduce_add_pd(accumulator);
+    }
+};
+}  // namespace
+
+bool isCompiled() {
+    return true;
+}
+
+template<typename ColumnType>
+void multiplyAdd(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                 bool backward) {
+    multiplyAddImpl<Avx512Dot>(matrix, beginRow, endRow, x, summand, result, backward);
+}
+
+template<typename ColumnType>
+void multiplyAndReduce(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                       double const* x, double const* summand, double* result, uint64_t* choices, bool backward) {
+    multiplyAndReduceImpl<Avx512Dot>(minimize, matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices, backward);
+}
+
+template void multiplyAdd(SoaMatrixView<uint32_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAdd(SoaMatrixView<uint64_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint32_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint64_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+}  // namespace avx512
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
+
+#else
+
+namespace storm {
+namespace solver {
+namespace simd {
+namespace avx512 {
+bool isCompiled() {
+    return false;
+}
+
+template<typename ColumnType>
+void multiplyAdd(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                 bool backward) {
+    scalar::multiplyAdd(matrix, beginRow, endRow, x, summand, result, backward);
+}
+
+template<typename ColumnType>
+void multiplyAndReduce(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                       double const* x, double const* summand, double* result, uint64_t* choices, bool backward) {
+    scalar::multiplyAndReduce(minimize, matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices, backward);
+}
+
+template void multiplyAdd(SoaMatrixView<uint32_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAdd(SoaMatrixView<uint64_t> const&, uint64_t, uint64_t, double const*, double const*, double*, bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint32_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+template void multiplyAndReduce(bool, SoaMatrixView<uint64_t> const&, uint64_t const*, uint64_t, uint64_t, double const*, double const*, double*, uint64_t*,
+                                bool);
+}  // namespace avx512
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
+
+#endif
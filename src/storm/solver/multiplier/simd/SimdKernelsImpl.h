@@ -0,0 +1,117 @@
+#pragma once
+
+/*
+ * This header must only be included by the translation units that implement the kernels for a specific instruction set.
+ * These translation units are compiled with different instruction set flags. We therefore put all templates into an unnamed namespace
+ * to make sure that the linker does not merge instantiations that were compiled for different instruction sets.
+ */
+
+#include <cstdint>
+
+#include "storm/solver/multiplier/simd/SimdKernels.h"
+
+namespace storm {
+namespace solver {
+namespace simd {
+namespace {
+
+/*!
+ * Computes summand[row] + (row of the matrix) * x, where the dot product is computed with the given Dot implementation.
+ */
+template<typename Dot, typename ColumnType>
+inline double rowValue(SoaMatrixView<ColumnType> const& matrix, uint64_t row, double const* x, double const* summand) {
+    uint64_t const firstEntry = matrix.rowIndications[row];
+    return Dot::dot(summand ? summand[row] : 0.0, matrix.columns + firstEntry, matrix.values + firstEntry, matrix.rowIndications[row + 1] - firstEntry, x);
+}
+
+template<typename Dot, bool Backward, typename ColumnType>
+inline void multiplyAddLoop(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand,
+                            double* result) {
+    for (uint64_t i = beginRow; i < endRow; ++i) {
+        uint64_t const row = Backward ? endRow - 1 - (i - beginRow) : i;
+        result[row] = rowValue<Dot>(matrix, row, x, summand);
+    }
+}
+
+template<bool Minimize>
+inline bool better(double newValue, double oldValue) {
+    return Minimize ? newValue < oldValue : newValue > oldValue;
+}
+
+template<typename Dot, bool Minimize, bool Backward, typename ColumnType>
+inline void multiplyAndReduceLoop(SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup, uint64_t endGroup,
+                                  double const* x, double const* summand, double* result, uint64_t* choices) {
+    for (uint64_t i = beginGroup; i < endGroup; ++i) {
+        uint64_t const group = Backward ? endGroup - 1 - (i - beginGroup) : i;
+        uint64_t const firstRow = rowGroupIndices[group];
+        uint64_t const endRow = rowGroupIndices[group + 1];
+        if (firstRow == endRow) {
+            continue;
+        }
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        double bestValue = rowValue<Dot>(matrix, firstRow, x, summand);
+        double oldSelectedChoiceValue = bestValue;
+        uint64_t selectedChoice = 0;
+        for (uint64_t row = firstRow + 1; row < endRow; ++row) {
+            double const value = rowValue<Dot>(matrix, row, x, summand);
+            if (choices && row - firstRow == choices[group]) {
+                oldSelectedChoiceValue = value;
+            }
+            if (better<Minimize>(value, bestValue)) {
+                bestValue = value;
+                selectedChoice = row - firstRow;
+            }
+        }
+        result[group] = bestValue;
+        if (choices && better<Minimize>(bestValue, oldSelectedChoiceValue)) {
+            choices[group] = selectedChoice;
+        }
+    }
+}
+
+template<typename Dot, typename ColumnType>
+inline void multiplyAddImpl(SoaMatrixView<ColumnType> const& matrix, uint64_t beginRow, uint64_t endRow, double const* x, double const* summand,
+                            double* result, bool backward) {
+    if (backward) {
+        multiplyAddLoop<Dot, true>(matrix, beginRow, endRow, x, summand, result);
+    } else {
+        multiplyAddLoop<Dot, false>(matrix, beginRow, endRow, x, summand, result);
+    }
+}
+
+template<typename Dot, typename ColumnType>
+inline void multiplyAndReduceImpl(bool minimize, SoaMatrixView<ColumnType> const& matrix, uint64_t const* rowGroupIndices, uint64_t beginGroup,
+                                  uint64_t endGroup, double const* x, double const* summand, double* result, uint64_t* choices, bool backward) {
+    if (minimize) {
+        if (backward) {
+            multiplyAndReduceLoop<Dot, true, true>(matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices);
+        } else {
+            multiplyAndReduceLoop<Dot, true, false>(matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices);
+        }
+    } else {
+        if (backward) {
+            multiplyAndReduceLoop<Dot, false, true>(matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices);
+        } else {
+            multiplyAndReduceLoop<Dot, false, false>(matrix, rowGroupIndices, beginGroup, endGroup, x, summand, result, choices);
+        }
+    }
+}
+
+/*!
+ * Sums up the products in the same order as the native multiplier, i.e., the results coincide with the ones of the SparseMatrix.
+ */
+struct ScalarDot {
+    template<typename ColumnType>
+    static inline double dot(double initialValue, ColumnType const* columns, double const* values, uint64_t numEntries, double const* x) {
+        for (uint64_t i = 0; i < numEntries; ++i) {
+            initialValue += values[i] * x[columns[i]];
+        }
+        return initialValue;
+    }
+};
+
+}  // namespace
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
+
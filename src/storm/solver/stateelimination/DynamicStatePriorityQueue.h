@@ -31,14 +31,21 @@ class DynamicStatePriorityQueue : public StatePriorityQueue {
         storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities)>
         PenaltyFunctionType;
 
+    /*!
+     * Creates a queue of the given states ordered by the given penalty function.
+     *
+     * @param updateSuccessors If set, the penalties of the successors of an eliminated state are updated as well (in addition to the ones of
+     * its predecessors). This is required for penalty functions that depend on the predecessors of a state.
+     */
     DynamicStatePriorityQueue(std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> const& sortedStatePenaltyPairs,
                               storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
                               storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities,
-                              PenaltyFunctionType const& penaltyFunction);
+                              PenaltyFunctionType const& penaltyFunction, bool updateSuccessors = false);
 
     virtual bool hasNext() const override;
     virtual storm::storage::sparse::state_type pop() override;
     virtual void update(storm::storage::sparse::state_type state) override;
+    virtual void updateSuccessor(storm::storage::sparse::state_type state) override;
     virtual std::size_t size() const override;
 
    private:
@@ -51,6 +58,7 @@ class DynamicStatePriorityQueue : public StatePriorityQueue {
     PriorityQueue priorityQueue;
     StatePriorityQueueEntryMap stateToPriorityQueueEntry;
     PenaltyFunctionType penaltyFunction;
+    bool updateSuccessors;
 };
 
 }  // namespace stateelimination
@@ -1,5 +1,8 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -74,12 +77,10 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
     // in the column equal to the current row.
     FlexibleRowType rowsKeepingEntryInColumnEqualRow;
 
-    // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-    // column d.
-    std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-    for (auto& backwardEntry : newBackwardEntries) {
-        backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
-    }
+    // For each entry in the row d, we need to collect the other rows that will contain an element in the column d. The entries are collected
+    // in a single buffer (tagged with the offset of the successor in the row) and are sorted by the successor afterwards.
+    newBackwardEntries.clear();
+    updatedStates.clear();
 
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
     // the elements of this row unless the elimination is filtered.
@@ -123,13 +124,12 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
-        newSuccessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+        FlexibleRowType& newSuccessors = prepareRowBuffer(getMergedRowSize(first1, last1, first2, last2, column), (last1 - first1) + (last2 - first2));
 
         uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
         // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
-        for (; first1 != last1; ++result) {
+        // As the old transitions of the predecessor are dropped afterwards, their values are moved rather than copied.
+        for (; first1 != last1;) {
             // Skip the transitions to the state that is currently being eliminated.
             if (first1->getColumn() == column || (first2 != last2 && first2->getColumn() == column)) {
                 if (first1->getColumn() == column) {
@@ -142,29 +142,28 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
             }
 
             if (first2 == last2) {
-                std::copy_if(first1, last1, result,
-                             [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
-                                                             typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) {
-                                 return a.getColumn() != column;
-                             });
+                for (; first1 != last1; ++first1) {
+                    if (first1->getColumn() != column) {
+                        newSuccessors.push_back(std::move(*first1));
+                    }
+                }
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
                 auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                *result = successorEntry;
-                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
+                newBackwardEntries.emplace_back(successorOffsetInNewBackwardTransitions, predecessor, successorEntry.getValue());
+                newSuccessors.push_back(std::move(successorEntry));
                 ++first2;
                 ++successorOffsetInNewBackwardTransitions;
             } else if (first1->getColumn() < first2->getColumn()) {
-                *result = *first1;
+                newSuccessors.push_back(std::move(*first1));
                 ++first1;
             } else {
                 ValueType sprod = multiplyFactor * first2->getValue();
                 ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
                 auto probability = storm::utility::simplify(sum);
-                *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
-                                                      typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
-                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
+                newBackwardEntries.emplace_back(successorOffsetInNewBackwardTransitions, predecessor, probability);
+                newSuccessors.emplace_back(first1->getColumn(), std::move(probability));
                 ++first1;
                 ++first2;
                 ++successorOffsetInNewBackwardTransitions;
@@ -173,21 +172,41 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
                 auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                *result = stateProbability;
-                newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
+                newBackwardEntries.emplace_back(successorOffsetInNewBackwardTransitions, predecessor, stateProbability.getValue());
+                newSuccessors.push_back(std::move(stateProbability));
                 ++successorOffsetInNewBackwardTransitions;
             }
         }
 
-        // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        // Now move the new transitions in place. The old storage of the row is kept as the buffer for the next merge.
+        predecessorForwardTransitions.swap(newSuccessors);
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
-
-        STORM_LOG_TRACE("Updating priority of predecessor.");
-        updatePriority(predecessor);
+        updatedStates.push_back(predecessor);
+    }
+    uint_fast64_t numberOfUpdatedPredecessors = updatedStates.size();
+
+    // Sort the new backward entries by their successor. As the predecessors are processed in ascending order, this (stable) counting sort
+    // leaves the entries for each successor sorted by the predecessor.
+    uint_fast64_t numberOfSuccessors = entriesInRow.size();
+    newBackwardEntryOffsets.assign(numberOfSuccessors + 1, 0);
+    for (auto const& entry : newBackwardEntries) {
+        ++newBackwardEntryOffsets[std::get<0>(entry) + 1];
+    }
+    for (uint_fast64_t successorOffset = 0; successorOffset < numberOfSuccessors; ++successorOffset) {
+        newBackwardEntryOffsets[successorOffset + 1] += newBackwardEntryOffsets[successorOffset];
     }
+    sortedNewBackwardEntries.resize(newBackwardEntries.size());
+    {
+        std::vector<uint_fast64_t> insertPositions(newBackwardEntryOffsets.begin(), newBackwardEntryOffsets.end() - 1);
+        for (auto& entry : newBackwardEntries) {
+            sortedNewBackwardEntries[insertPositions[std::get<0>(entry)]++] = storm::storage::MatrixEntry<
+                typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(
+                std::get<1>(entry), std::move(std::get<2>(entry)));
+        }
+    }
+    newBackwardEntries.clear();
 
     // Finally, we need to add the predecessor to the set of predecessors of every successor.
     uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
@@ -199,68 +218,65 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowType& successorBackwardTransitions = transposedMatrix.getRow(successorEntry.getColumn());
 
         // Delete the current state as a predecessor of the successor state only if we are going to remove the
-        // current state's forward transitions.
-        if (clearRow) {
-            FlexibleRowIterator elimIt =
-                std::find_if(successorBackwardTransitions.begin(), successorBackwardTransitions.end(),
-                             [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
-                                                             typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) {
-                                 return a.getColumn() == row;
-                             });
-            STORM_LOG_ASSERT(elimIt != successorBackwardTransitions.end(),
-                             "Expected a proper backward transition from " << successorEntry.getColumn() << " to " << column << ", but found none.");
-            successorBackwardTransitions.erase(elimIt);
-        }
+        // current state's forward transitions. This is done while merging to avoid shifting the remaining entries.
+        bool foundCurrentState = false;
 
         FlexibleRowIterator first1 = successorBackwardTransitions.begin();
         FlexibleRowIterator last1 = successorBackwardTransitions.end();
-        FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
-        FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
+        FlexibleRowIterator first2 = sortedNewBackwardEntries.begin() + newBackwardEntryOffsets[successorOffsetInNewBackwardTransitions];
+        FlexibleRowIterator last2 = sortedNewBackwardEntries.begin() + newBackwardEntryOffsets[successorOffsetInNewBackwardTransitions + 1];
 
-        FlexibleRowType newPredecessors;
-        newPredecessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
+        // The new entries never refer to the eliminated state, so the size is only an upper bound if the row is not cleared.
+        FlexibleRowType& newPredecessors = prepareRowBuffer(
+            getMergedRowSize(first1, last1, first2, last2, clearRow ? row : std::numeric_limits<uint64_t>::max()), (last1 - first1) + (last2 - first2));
 
-        for (; first1 != last1; ++result) {
+        for (; first1 != last1;) {
+            if (clearRow && first1->getColumn() == row) {
+                foundCurrentState = true;
+                ++first1;
+                continue;
+            }
             if (first2 == last2) {
-                std::copy(first1, last1, result);
+                for (; first1 != last1; ++first1) {
+                    if (clearRow && first1->getColumn() == row) {
+                        foundCurrentState = true;
+                    } else {
+                        newPredecessors.push_back(std::move(*first1));
+                    }
+                }
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
                 if (first2->getColumn() != row) {
-                    *result = *first2;
+                    newPredecessors.push_back(std::move(*first2));
                 }
                 ++first2;
             } else if (first1->getColumn() == first2->getColumn()) {
                 if (estimateComplexity(first1->getValue()) > estimateComplexity(first2->getValue())) {
-                    *result = *first1;
+                    newPredecessors.push_back(std::move(*first1));
                 } else {
-                    *result = *first2;
+                    newPredecessors.push_back(std::move(*first2));
                 }
                 ++first1;
                 ++first2;
             } else {
-                *result = *first1;
+                newPredecessors.push_back(std::move(*first1));
                 ++first1;
             }
         }
-        if (isFilterPredecessor()) {
-            std::copy_if(first2, last2, result,
-                         [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
-                                                         typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) {
-                             return a.getColumn() != row && filterPredecessor(a.getColumn());
-                         });
-        } else {
-            std::copy_if(first2, last2, result,
-                         [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
-                                                         typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) {
-                             return a.getColumn() != row;
-                         });
+        for (; first2 != last2; ++first2) {
+            if (first2->getColumn() != row && (!isFilterPredecessor() || filterPredecessor(first2->getColumn()))) {
+                newPredecessors.push_back(std::move(*first2));
+            }
         }
-        // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        STORM_LOG_ASSERT(!clearRow || foundCurrentState,
+                         "Expected a proper backward transition from " << successorEntry.getColumn() << " to " << column << ", but found none.");
+        // Now move the new predecessors in place. The old storage of the row is kept as the buffer for the next merge.
+        successorBackwardTransitions.swap(newPredecessors);
         ++successorOffsetInNewBackwardTransitions;
+        updatedStates.push_back(successorEntry.getColumn());
     }
+    sortedNewBackwardEntries.clear();
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
 
     // Clear the row if requested.
@@ -276,6 +292,62 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         elementsWithEntryInColumnEqualRow.clear();
         elementsWithEntryInColumnEqualRow.shrink_to_fit();
     }
+
+    // Only now that both the forward and the backward transitions are up-to-date, the priorities may be updated, because they can depend on the
+    // transitions of the neighbours of a state. This also matters for penalties that only read the rows of the state itself (e.g. the dynamic
+    // penalty and the regular expression order): a predecessor that is also a successor of the eliminated state only obtains its new backward
+    // transitions after its forward transitions were rewritten, and these orders do not update the priorities of successors.
+    STORM_LOG_TRACE("Updating priorities of predecessors and successors.");
+    for (uint_fast64_t index = 0; index < numberOfUpdatedPredecessors; ++index) {
+        updatePriority(updatedStates[index]);
+    }
+    for (uint_fast64_t index = numberOfUpdatedPredecessors; index < updatedStates.size(); ++index) {
+        updateSuccessorPriority(updatedStates[index]);
+    }
+    updatedStates.clear();
+}
+
+template<typename ValueType, ScalingMode Mode>
+uint64_t EliminatorBase<ValueType, Mode>::getMergedRowSize(FlexibleRowIterator first1, FlexibleRowIterator last1, FlexibleRowIterator first2,
+                                                            FlexibleRowIterator last2, uint64_t ignoredColumn) {
+    uint64_t size = 0;
+    while (first1 != last1 && first2 != last2) {
+        uint64_t column1 = first1->getColumn();
+        uint64_t column2 = first2->getColumn();
+        if (std::min(column1, column2) != ignoredColumn) {
+            ++size;
+        }
+        if (column1 <= column2) {
+            ++first1;
+        }
+        if (column2 <= column1) {
+            ++first2;
+        }
+    }
+    for (; first1 != last1; ++first1) {
+        if (first1->getColumn() != ignoredColumn) {
+            ++size;
+        }
+    }
+    for (; first2 != last2; ++first2) {
+        if (first2->getColumn() != ignoredColumn) {
+            ++size;
+        }
+    }
+    return size;
+}
+
+template<typename ValueType, ScalingMode Mode>
+typename EliminatorBase<ValueType, Mode>::FlexibleRowType& EliminatorBase<ValueType, Mode>::prepareRowBuffer(uint64_t requiredSize, uint64_t maximalSize) {
+    // The buffer becomes the storage of a row of the matrix. Buffers that are larger than a freshly allocated row are released, buffers that are too
+    // small are grown to exactly the required size.
+    if (rowBuffer.capacity() > maximalSize) {
+        FlexibleRowType().swap(rowBuffer);
+    } else {
+        rowBuffer.clear();
+    }
+    rowBuffer.reserve(requiredSize);
+    return rowBuffer;
 }
 
 template<typename ValueType, ScalingMode Mode>
@@ -335,6 +407,11 @@ void EliminatorBase<ValueType, Mode>::updatePriority(storm::storage::sparse::sta
     // Intentionally left empty.
 }
 
+template<typename ValueType, ScalingMode Mode>
+void EliminatorBase<ValueType, Mode>::updateSuccessorPriority(storm::storage::sparse::state_type const&) {
+    // Intentionally left empty.
+}
+
 template<typename ValueType, ScalingMode Mode>
 bool EliminatorBase<ValueType, Mode>::filterPredecessor(storm::storage::sparse::state_type const&) {
     STORM_LOG_ASSERT(false, "Must not filter predecessors.");
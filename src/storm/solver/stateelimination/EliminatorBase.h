@@ -1,5 +1,8 @@
 #pragma once
 
+#include <tuple>
+#include <vector>
+
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/FlexibleSparseMatrix.h"
@@ -28,12 +31,40 @@ class EliminatorBase {
     virtual void updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability,
                                    storm::storage::sparse::state_type const& state);
     virtual void updatePriority(storm::storage::sparse::state_type const& state);
+    virtual void updateSuccessorPriority(storm::storage::sparse::state_type const& state);
     virtual bool filterPredecessor(storm::storage::sparse::state_type const& state);
     virtual bool isFilterPredecessor() const;
 
    protected:
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+   private:
+    /*!
+     * Computes the number of distinct columns of the two given (sorted) ranges of entries, not counting entries in the ignored column.
+     */
+    static uint64_t getMergedRowSize(FlexibleRowIterator first1, FlexibleRowIterator last1, FlexibleRowIterator first2, FlexibleRowIterator last2,
+                                     uint64_t ignoredColumn);
+
+    /*!
+     * Retrieves the (empty) buffer into which two rows are merged, with space for the given number of entries.
+     * After the merge, the buffer is swapped with the merged row, such that the old storage of the row is reused in the next merge.
+     *
+     * @param requiredSize The number of entries of the merged row.
+     * @param maximalSize The number of entries of both rows, i.e. the capacity a freshly allocated merged row would get. The buffer never has a larger
+     * capacity, so reusing buffers does not increase the memory held by the rows of the matrix.
+     */
+    FlexibleRowType& prepareRowBuffer(uint64_t requiredSize, uint64_t maximalSize);
+
+    // Buffers that are reused across eliminations to avoid (re)allocations.
+    FlexibleRowType rowBuffer;
+    // The new backward entries as (offset of the successor in the eliminated row, predecessor, value).
+    std::vector<std::tuple<uint64_t, uint64_t, ValueType>> newBackwardEntries;
+    // The new backward entries sorted by the successor and the offsets of the entries of each successor.
+    FlexibleRowType sortedNewBackwardEntries;
+    std::vector<uint64_t> newBackwardEntryOffsets;
+    // The predecessors followed by the successors of the eliminated state whose priorities need to be updated.
+    std::vector<uint64_t> updatedStates;
 };
 
 }  // namespace stateelimination
@@ -41,6 +41,11 @@ void PrioritizedStateEliminator<ValueType>::updatePriority(storm::storage::spars
     priorityQueue->update(state);
 }
 
+template<typename ValueType>
+void PrioritizedStateEliminator<ValueType>::updateSuccessorPriority(storm::storage::sparse::state_type const& state) {
+    priorityQueue->updateSuccessor(state);
+}
+
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::eliminateAll(bool removeForwardTransitions) {
     while (priorityQueue->hasNext()) {
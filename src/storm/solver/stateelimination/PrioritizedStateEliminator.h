@@ -26,6 +26,7 @@ class PrioritizedStateEliminator : public StateEliminator<ValueType> {
     virtual void updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability,
                                    storm::storage::sparse::state_type const& state) override;
     virtual void updatePriority(storm::storage::sparse::state_type const& state) override;
+    virtual void updateSuccessorPriority(storm::storage::sparse::state_type const& state) override;
 
     virtual void eliminateAll(bool eliminateForwardTransitions = true);
     virtual void clearStateValues(storm::storage::sparse::state_type const& state);
@@ -8,6 +8,10 @@ void StatePriorityQueue::update(storm::storage::sparse::state_type) {
     // Intentionally left empty.
 }
 
+void StatePriorityQueue::updateSuccessor(storm::storage::sparse::state_type) {
+    // Intentionally left empty.
+}
+
 }  // namespace stateelimination
 }  // namespace solver
 }  // namespace storm
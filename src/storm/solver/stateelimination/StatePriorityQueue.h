@@ -15,6 +15,11 @@ class StatePriorityQueue {
     virtual bool hasNext() const = 0;
     virtual storm::storage::sparse::state_type pop() = 0;
     virtual void update(storm::storage::sparse::state_type state);
+
+    /*!
+     * Notifies the queue that the predecessors of the given state changed, because one of them was eliminated.
+     */
+    virtual void updateSuccessor(storm::storage::sparse::state_type state);
     virtual std::size_t size() const = 0;
 };
 
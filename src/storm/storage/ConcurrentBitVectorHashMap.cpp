@@ -0,0 +1,308 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+// The number of buckets that a thread moves to the next table at once when the size of the map is increased.
+static uint64_t const bucketsPerChunk = 4096;
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map,
+                                                                                                                    uint64_t bucket)
+    : map(map), bucket(bucket) {
+    skipUnoccupiedBuckets();
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) const {
+    return &map == &other.map && bucket == other.bucket;
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+    ++bucket;
+    skipUnoccupiedBuckets();
+    return *this;
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+    Table const& table = *map.currentTable.load(std::memory_order_acquire);
+    return std::make_pair(table.buckets.get(bucket * map.bucketSize, map.bucketSize), table.values[bucket]);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::skipUnoccupiedBuckets() {
+    Table const& table = *map.currentTable.load(std::memory_order_acquire);
+    while (bucket < table.capacity() && table.states[bucket].load(std::memory_order_acquire) != Occupied) {
+        ++bucket;
+    }
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t bucketSize, uint64_t sizeExponent)
+    : sizeExponent(sizeExponent),
+      buckets(bucketSize * (1ull << sizeExponent)),
+      states(new std::atomic<uint8_t>[1ull << sizeExponent]()),
+      values(1ull << sizeExponent),
+      next(nullptr),
+      resizeStarted(false),
+      nextChunkToMove(0),
+      numberOfMovedChunks(0) {
+    // Intentionally left empty.
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::Table::capacity() const {
+    return 1ull << sizeExponent;
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : loadFactor(loadFactor), bucketSize(bucketSize), numberOfElements(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    STORM_LOG_ASSERT(loadFactor > 0 && loadFactor < 1, "Load factor must be in (0,1).");
+
+    uint64_t sizeExponent = 1;
+    while (initialSize > 0) {
+        ++sizeExponent;
+        initialSize >>= 1;
+    }
+
+    tables.push_back(std::make_unique<Table>(bucketSize, sizeExponent));
+    currentTable.store(tables.back().get());
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    return numberOfElements.load();
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    return currentTable.load()->capacity();
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddImpl(key, [&value]() { return value; });
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key,
+                                                                                  std::function<ValueType()> const& valueGenerator) {
+    return findOrAddImpl(key, valueGenerator);
+}
+
+template<class ValueType, class Hash>
+template<typename ValueGenerator>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddImpl(storm::storage::BitVector const& key,
+                                                                                      ValueGenerator const& valueGenerator) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t hash = hasher(key);
+
+    while (true) {
+        Table& table = *currentTable.load(std::memory_order_acquire);
+        uint64_t bucket = getFirstBucket(table, hash);
+        bool restart = false;
+        for (uint64_t probes = 0; probes < table.capacity() && !restart;) {
+            uint8_t state = getStateOfBucket(table, bucket);
+            if (state == Empty) {
+                // Try to claim the bucket. If another thread was faster, we need to inspect the bucket again.
+                if (table.states[bucket].compare_exchange_strong(state, Busy, std::memory_order_acq_rel)) {
+                    table.buckets.set(bucket * bucketSize, key);
+                    ValueType value = valueGenerator();
+                    table.values[bucket] = value;
+                    table.states[bucket].store(Occupied, std::memory_order_release);
+
+                    // If the load of the map is too high, we increase the size (or help with that if another thread already started).
+                    if (numberOfElements.fetch_add(1, std::memory_order_relaxed) + 1 >= loadFactor * table.capacity()) {
+                        startIncreaseSize(table);
+                        helpIncreaseSize(table);
+                    }
+                    return std::make_pair(value, true);
+                }
+            } else if (state == Moved) {
+                restart = true;
+            } else {
+                if (table.buckets.matches(bucket * bucketSize, key)) {
+                    return std::make_pair(table.values[bucket], false);
+                }
+                ++probes;
+                bucket = (bucket + 1) & (table.capacity() - 1);
+            }
+        }
+
+        // Either the entries are currently moved to a larger table or the table is completely full (which can only happen if many threads insert
+        // simultaneously into a small table). In both cases, we continue with the next table.
+        startIncreaseSize(table);
+        helpIncreaseSize(table);
+    }
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    uint64_t hash = hasher(key);
+    while (true) {
+        Table& table = *currentTable.load(std::memory_order_acquire);
+        boost::optional<uint64_t> bucket = findBucket(table, key, hash);
+        if (bucket) {
+            STORM_LOG_ASSERT(bucket.get() < table.capacity(), "Unknown key.");
+            return table.values[bucket.get()];
+        }
+        helpIncreaseSize(table);
+    }
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    uint64_t hash = hasher(key);
+    while (true) {
+        Table& table = *currentTable.load(std::memory_order_acquire);
+        boost::optional<uint64_t> bucket = findBucket(table, key, hash);
+        if (bucket) {
+            return bucket.get() < table.capacity();
+        }
+        helpIncreaseSize(table);
+    }
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+    return const_iterator(*this, capacity());
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::releaseRetiredStorage() {
+    Table* current = currentTable.load();
+    tables.erase(std::remove_if(tables.begin(), tables.end(), [current](std::unique_ptr<Table> const& table) { return table.get() != current; }),
+                 tables.end());
+}
+
+template<class ValueType, class Hash>
+uint8_t ConcurrentBitVectorHashMap<ValueType, Hash>::getStateOfBucket(Table const& table, uint64_t bucket) {
+    uint8_t state = table.states[bucket].load(std::memory_order_acquire);
+    while (state == Busy) {
+        std::this_thread::yield();
+        state = table.states[bucket].load(std::memory_order_acquire);
+    }
+    return state;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getFirstBucket(Table const& table, uint64_t hash) const {
+    // As in the BitVectorHashMap, we use the most significant bits of the hash value.
+    return hash >> (sizeof(decltype(hasher(storm::storage::BitVector()))) * 8 - table.sizeExponent);
+}
+
+template<class ValueType, class Hash>
+boost::optional<uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findBucket(Table const& table, storm::storage::BitVector const& key,
+                                                                                  uint64_t hash) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t bucket = getFirstBucket(table, hash);
+    for (uint64_t probes = 0; probes < table.capacity(); ++probes) {
+        uint8_t state = getStateOfBucket(table, bucket);
+        if (state == Empty) {
+            return table.capacity();
+        } else if (state == Moved) {
+            return boost::none;
+        } else if (table.buckets.matches(bucket * bucketSize, key)) {
+            return bucket;
+        }
+        bucket = (bucket + 1) & (table.capacity() - 1);
+    }
+    // The table is full, so the key is only found if the entries are moved to the next table in the meantime.
+    return table.next.load(std::memory_order_acquire) == nullptr ? boost::optional<uint64_t>(table.capacity()) : boost::none;
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::startIncreaseSize(Table& table) const {
+    bool expected = false;
+    if (table.resizeStarted.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        STORM_LOG_TRACE("Increasing size of hash map from " << table.capacity() << " to " << 2 * table.capacity() << ".");
+        auto nextTable = std::make_unique<Table>(bucketSize, table.sizeExponent + 1);
+        Table* nextTablePointer = nextTable.get();
+        {
+            std::lock_guard<std::mutex> lock(tablesMutex);
+            tables.push_back(std::move(nextTable));
+        }
+        table.next.store(nextTablePointer, std::memory_order_release);
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::helpIncreaseSize(Table& table) const {
+    // Wait until the thread that started increasing the size has created the next table.
+    Table* nextTable = table.next.load(std::memory_order_acquire);
+    while (nextTable == nullptr) {
+        std::this_thread::yield();
+        nextTable = table.next.load(std::memory_order_acquire);
+    }
+
+    // Move chunks of buckets until all chunks are taken. The thread that moves the last chunk replaces the table.
+    uint64_t const numberOfChunks = (table.capacity() + bucketsPerChunk - 1) / bucketsPerChunk;
+    for (uint64_t chunk = table.nextChunkToMove.fetch_add(1, std::memory_order_relaxed); chunk < numberOfChunks;
+         chunk = table.nextChunkToMove.fetch_add(1, std::memory_order_relaxed)) {
+        uint64_t const lastBucket = std::min((chunk + 1) * bucketsPerChunk, table.capacity());
+        for (uint64_t bucket = chunk * bucketsPerChunk; bucket < lastBucket; ++bucket) {
+            moveBucket(table, *nextTable, bucket);
+        }
+        if (table.numberOfMovedChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == numberOfChunks) {
+            currentTable.store(nextTable, std::memory_order_release);
+        }
+    }
+
+    // Wait until the other threads have moved their chunks.
+    while (currentTable.load(std::memory_order_acquire) == &table) {
+        std::this_thread::yield();
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::moveBucket(Table& table, Table& nextTable, uint64_t bucket) const {
+    uint8_t state = getStateOfBucket(table, bucket);
+    if (state == Empty) {
+        // Mark the bucket as moved so no thread can claim it anymore. If this fails, some thread just claimed the bucket and we need to wait for it.
+        if (!table.states[bucket].compare_exchange_strong(state, Moved, std::memory_order_acq_rel)) {
+            state = getStateOfBucket(table, bucket);
+        }
+    }
+    if (state == Occupied) {
+        // Since all keys are distinct, the key can be inserted into the first free bucket. Other threads only insert into the next table
+        // once all buckets are moved, but the buckets of the next table may still be claimed by other threads that move entries.
+        storm::storage::BitVector key = table.buckets.get(bucket * bucketSize, bucketSize);
+        uint64_t nextBucket = getFirstBucket(nextTable, hasher(key));
+        while (true) {
+            uint8_t expected = Empty;
+            if (nextTable.states[nextBucket].compare_exchange_strong(expected, Busy, std::memory_order_acq_rel)) {
+                break;
+            }
+            nextBucket = (nextBucket + 1) & (nextTable.capacity() - 1);
+        }
+        nextTable.buckets.set(nextBucket * bucketSize, key);
+        nextTable.values[nextBucket] = table.values[bucket];
+        nextTable.states[nextBucket].store(Occupied, std::memory_order_release);
+        table.states[bucket].store(Moved, std::memory_order_release);
+    }
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,246 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <atomic>
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash-map whose keys are bit vectors and that can be queried and extended by multiple threads concurrently. Like the
+ * BitVectorHashMap, it stores the keys densely in one bit vector and resolves collisions by linear probing. Buckets are claimed atomically, so inserting
+ * and finding keys does not require locks. If the load of the map becomes too high, the entries are moved to a larger storage. All threads that access
+ * the map in the meantime help with moving the entries instead of waiting for a single thread to rehash everything.
+ *
+ * As in the BitVectorHashMap, only queries and insertions are supported and the keys must be bit vectors with a length that is a multiple of 64.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+class ConcurrentBitVectorHashMap {
+   private:
+    struct Table;
+
+   public:
+    class ConcurrentBitVectorHashMapIterator {
+       public:
+        /*! Creates an iterator that points to the first occupied bucket of the current table of the map at or after the given bucket.
+         *
+         * @param map The map of the iterator.
+         * @param bucket The index of the bucket at which to start searching for an occupied bucket.
+         */
+        ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket);
+
+        // Methods to compare two iterators.
+        bool operator==(ConcurrentBitVectorHashMapIterator const& other) const;
+        bool operator!=(ConcurrentBitVectorHashMapIterator const& other) const;
+
+        // Method to move iterator forward.
+        ConcurrentBitVectorHashMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        // Moves the iterator to the next occupied bucket (including the current one).
+        void skipUnoccupiedBuckets();
+
+        // The map this iterator refers to.
+        ConcurrentBitVectorHashMap const& map;
+
+        // The bucket this iterator points to.
+        uint64_t bucket;
+    };
+
+    typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available.
+     * @param loadFactor The load factor that determines at which point the size of the underlying storage is
+     * increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the provided new value otherwise and whose second component indicates whether the key was inserted.
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with a value obtained from the given generator. This may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param valueGenerator Is invoked exactly once if (and only if) the key is inserted to obtain its value.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the generated value otherwise and whose second component indicates whether the key was inserted.
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined. This may be called concurrently.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map. This may be called concurrently.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves an iterator to the elements of the map. The map must not be modified while it is iterated.
+     *
+     * @return The iterator.
+     */
+    const_iterator begin() const;
+
+    /*!
+     * Retrieves an iterator that points one past the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the capacity of the underlying container.
+     *
+     * @return The capacity of the underlying container.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Frees the storage that was used before the size of the map was last increased. As other threads might still read the old storage while the size
+     * is increased, it is only freed by this method or upon destruction. This must not be called concurrently with other methods.
+     */
+    void releaseRetiredStorage();
+
+   private:
+    // The possible states of a bucket. A bucket is busy while the thread that claimed it writes its key and value and moved once its content was
+    // transferred to the next (larger) table.
+    enum BucketState : uint8_t { Empty = 0, Busy = 1, Occupied = 2, Moved = 3 };
+
+    struct Table {
+        Table(uint64_t bucketSize, uint64_t sizeExponent);
+
+        uint64_t capacity() const;
+
+        // The number of buckets is 2^sizeExponent.
+        uint64_t sizeExponent;
+
+        // The buckets that hold the keys.
+        storm::storage::BitVector buckets;
+
+        // The states of the buckets.
+        std::unique_ptr<std::atomic<uint8_t>[]> states;
+
+        // The mapped-to values. The entry at position i is the "target" of the key in bucket i.
+        std::vector<ValueType> values;
+
+        // The table to which the entries are moved once this table is too full (or null).
+        std::atomic<Table*> next;
+
+        // Whether some thread has started to increase the size.
+        std::atomic<bool> resizeStarted;
+
+        // The next chunk of buckets whose entries need to be moved to the next table and the number of chunks that were already moved.
+        std::atomic<uint64_t> nextChunkToMove;
+        std::atomic<uint64_t> numberOfMovedChunks;
+    };
+
+    /*!
+     * Searches for the given key and inserts it with the value returned by the given generator if it is not found.
+     */
+    template<typename ValueGenerator>
+    std::pair<ValueType, bool> findOrAddImpl(storm::storage::BitVector const& key, ValueGenerator const& valueGenerator);
+
+    /*!
+     * Waits until the given bucket is not busy anymore and returns its state.
+     */
+    static uint8_t getStateOfBucket(Table const& table, uint64_t bucket);
+
+    /*!
+     * Retrieves the bucket at which the search for the given hash value starts in the given table.
+     */
+    uint64_t getFirstBucket(Table const& table, uint64_t hash) const;
+
+    /*!
+     * Searches for the bucket with the given key in the given table.
+     *
+     * @return The bucket with the given key, the capacity of the table if the key is not contained in the table, or none if the entries are moved to
+     * another table and the search needs to be repeated there.
+     */
+    boost::optional<uint64_t> findBucket(Table const& table, storm::storage::BitVector const& key, uint64_t hash) const;
+
+    /*!
+     * Makes sure that the entries of the given table are moved to a larger table.
+     */
+    void startIncreaseSize(Table& table) const;
+
+    /*!
+     * Helps moving the entries of the given table to the next table and returns once the next table has replaced the given one.
+     */
+    void helpIncreaseSize(Table& table) const;
+
+    /*!
+     * Moves the entry of the given bucket to the next table and marks the bucket as moved.
+     */
+    void moveBucket(Table& table, Table& nextTable, uint64_t bucket) const;
+
+    // The load factor determining when the size of the map is increased.
+    double loadFactor;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The table that currently holds the elements of the map.
+    mutable std::atomic<Table*> currentTable;
+
+    // All tables that were created. Old tables are kept until they are explicitly released, because other threads might still read them.
+    mutable std::vector<std::unique_ptr<Table>> tables;
+
+    // Protects the list of tables.
+    mutable std::mutex tablesMutex;
+
+    // The number of elements in this map.
+    std::atomic<uint64_t> numberOfElements;
+
+    // Functor object that are used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
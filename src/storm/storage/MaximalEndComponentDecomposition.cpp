@@ -1,12 +1,16 @@
 #include <list>
 #include <numeric>
 #include <queue>
+#include <type_traits>
+
+#include "storm-config.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -19,35 +23,39 @@ MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition()
 template<typename ValueType>
 template<typename RewardModelType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(
-    storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model) {
-    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions());
+    storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model, MaximalEndComponentDecompositionOptions const& options) {
+    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), nullptr, nullptr, options);
 }
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
-    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                              MaximalEndComponentDecompositionOptions const& options) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, nullptr, nullptr, options);
 }
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                               storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-                                                                              storm::storage::BitVector const& states) {
-    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states);
+                                                                              storm::storage::BitVector const& states,
+                                                                              MaximalEndComponentDecompositionOptions const& options) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, nullptr, options);
 }
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                               storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                               storm::storage::BitVector const& states,
-                                                                              storm::storage::BitVector const& choices) {
-    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices);
+                                                                              storm::storage::BitVector const& choices,
+                                                                              MaximalEndComponentDecompositionOptions const& options) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices, options);
 }
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model,
-                                                                              storm::storage::BitVector const& states) {
-    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), &states);
+                                                                              storm::storage::BitVector const& states,
+                                                                              MaximalEndComponentDecompositionOptions const& options) {
+    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), &states, nullptr, options);
 }
 
 template<typename ValueType>
@@ -76,7 +84,8 @@ template<typename ValueType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                           storm::storage::SparseMatrix<ValueType> backwardTransitions,
                                                                                           storm::storage::BitVector const* states,
-                                                                                          storm::storage::BitVector const* choices) {
+                                                                                          storm::storage::BitVector const* choices,
+                                                                                          MaximalEndComponentDecompositionOptions const& options) {
     // Get some data for convenient access.
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
@@ -106,18 +115,23 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
         includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
     }
     storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
+    uint64_t const numberOfThreads = storm::utility::parallel::getNumberOfThreads<ValueType>(options.threads, "Parallel decomposition of end components");
 
     for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
         StateBlock const& mec = *mecIterator;
-        currMecAsBitVector.clear();
         currMecAsBitVector.set(mec.begin(), mec.end(), true);
         // Keep track of whether the MEC changed during this iteration.
         bool mecChanged = false;
 
-        // Get an SCC decomposition of the current MEC candidate.
-
-        StronglyConnectedComponentDecomposition<ValueType> sccs(
-            transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
+        // Get an SCC decomposition of the current MEC candidate. As the decomposition is restricted to the candidate, its cost is proportional to the size
+        // of the candidate rather than to the size of the whole system. Only large candidates are decomposed in parallel.
+        auto sccOptions = StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs();
+        if (numberOfThreads != 1 && mec.size() >= options.minimalParallelSize) {
+            sccOptions.numberOfThreads(numberOfThreads);
+        }
+        StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, sccOptions);
+        // Unset the bits of the candidate individually, which avoids clearing the complete bit vector for every candidate.
+        currMecAsBitVector.set(mec.begin(), mec.end(), false);
 
         // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
         // the MEC canditate itself.
@@ -236,16 +250,17 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
 
 // Explicitly instantiate the MEC decomposition.
 template class MaximalEndComponentDecomposition<double>;
-template MaximalEndComponentDecomposition<double>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<double> const& model);
+template MaximalEndComponentDecomposition<double>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<double> const& model,
+                                                                                   MaximalEndComponentDecompositionOptions const& options);
 
 #ifdef STORM_HAVE_CARL
 template class MaximalEndComponentDecomposition<storm::RationalNumber>;
 template MaximalEndComponentDecomposition<storm::RationalNumber>::MaximalEndComponentDecomposition(
-    storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model);
+    storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model, MaximalEndComponentDecompositionOptions const& options);
 
 template class MaximalEndComponentDecomposition<storm::RationalFunction>;
 template MaximalEndComponentDecomposition<storm::RationalFunction>::MaximalEndComponentDecomposition(
-    storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model);
+    storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model, MaximalEndComponentDecompositionOptions const& options);
 #endif
 }  // namespace storage
 }  // namespace storm
@@ -8,6 +8,22 @@
 namespace storm {
 namespace storage {
 
+struct MaximalEndComponentDecompositionOptions {
+    /// Sets the number of threads used to decompose large MEC candidates into SCCs (0 uses all available cores). Values other than 1 require Intel TBB.
+    MaximalEndComponentDecompositionOptions& numberOfThreads(uint64_t value) {
+        threads = value;
+        return *this;
+    }
+    /// Sets the minimal number of states of a MEC candidate that is decomposed into SCCs using multiple threads.
+    MaximalEndComponentDecompositionOptions& minimalSizeForParallelSccDecomposition(uint64_t value) {
+        minimalParallelSize = value;
+        return *this;
+    }
+
+    uint64_t threads = 1;
+    uint64_t minimalParallelSize = 100000;
+};
+
 /*!
  * This class represents the decomposition of a nondeterministic model into its maximal end components.
  */
@@ -23,18 +39,22 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * Creates an MEC decomposition of the given model.
      *
      * @param model The model to decompose into MECs.
+     * @param options The options for the decomposition.
      */
     template<typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
-    MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model);
+    MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model,
+                                     MaximalEndComponentDecompositionOptions const& options = MaximalEndComponentDecompositionOptions());
 
     /*
      * Creates an MEC decomposition of the given model (represented by a row-grouped matrix).
      *
      * @param transitionMatrix The transition relation of model to decompose into MECs.
      * @param backwardTransition The reversed transition relation.
+     * @param options The options for the decomposition.
      */
     MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions);
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                     MaximalEndComponentDecompositionOptions const& options = MaximalEndComponentDecompositionOptions());
 
     /*
      * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
@@ -42,9 +62,11 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param transitionMatrix The transition relation of model to decompose into MECs.
      * @param backwardTransition The reversed transition relation.
      * @param states The states of the subsystem to decompose.
+     * @param options The options for the decomposition.
      */
     MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
+                                     MaximalEndComponentDecompositionOptions const& options = MaximalEndComponentDecompositionOptions());
 
     /*
      * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
@@ -53,18 +75,22 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param backwardTransition The reversed transition relation.
      * @param states The states of the subsystem to decompose.
      * @param choices The choices of the subsystem to decompose.
+     * @param options The options for the decomposition.
      */
     MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
-                                     storm::storage::BitVector const& choices);
+                                     storm::storage::BitVector const& choices,
+                                     MaximalEndComponentDecompositionOptions const& options = MaximalEndComponentDecompositionOptions());
 
     /*!
      * Creates an MEC decomposition of the given subsystem in the given model.
      *
      * @param model The model whose subsystem to decompose into MECs.
      * @param states The states of the subsystem to decompose.
+     * @param options The options for the decomposition.
      */
-    MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model, storm::storage::BitVector const& states);
+    MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model, storm::storage::BitVector const& states,
+                                     MaximalEndComponentDecompositionOptions const& options = MaximalEndComponentDecompositionOptions());
 
     /*!
      * Creates an MEC decomposition by copying the contents of the given MEC decomposition.
@@ -103,10 +129,11 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param backwardTransitions The reversed transition relation.
      * @param states The states of the subsystem to decompose.
      * @param choices The choices of the subsystem to decompose.
+     * @param options The options for the decomposition.
      */
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                 storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr,
-                                                 storm::storage::BitVector const* choices = nullptr);
+                                                 storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states,
+                                                 storm::storage::BitVector const* choices, MaximalEndComponentDecompositionOptions const& options);
 };
 }  // namespace storage
 }  // namespace storm
@@ -1,5 +1,10 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include <storm/utility/vector.h>
+
+#include <atomic>
+#include <limits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -74,8 +79,8 @@ template<typename ValueType>
 void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint_fast64_t startState,
                                 storm::storage::BitVector& nonTrivialStates, storm::storage::BitVector const* subsystem,
                                 storm::storage::BitVector const* choices, uint_fast64_t& currentIndex, storm::storage::BitVector& hasPreorderNumber,
-                                std::vector<uint_fast64_t>& preorderNumbers, std::vector<uint_fast64_t>& recursionStateStack, std::vector<uint_fast64_t>& s,
-                                std::vector<uint_fast64_t>& p, storm::storage::BitVector& stateHasScc, std::vector<uint_fast64_t>& stateToSccMapping,
+                                uint_fast64_t* preorderNumbers, std::vector<uint_fast64_t>& recursionStateStack, std::vector<uint_fast64_t>& s,
+                                std::vector<uint_fast64_t>& p, storm::storage::BitVector& stateHasScc, uint_fast64_t* stateToSccMapping,
                                 uint_fast64_t& sccCount, bool /*forceTopologicalSort*/, std::vector<uint_fast64_t>* sccDepths) {
     // The forceTopologicalSort flag can be ignored as this method always generates a topological sort.
 
@@ -166,6 +171,513 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Computes a mapping of states to their SCCs using multiple threads. The algorithm follows the FW-BW-Trim scheme (McLendon et al., "Finding strongly
+ * connected components in distributed graphs", 2005): States that have no predecessor or no successor within their partition are trivial SCCs and are
+ * removed iteratively. The remaining states are split by a forward and a backward search from a pivot state into the SCC of the pivot and three
+ * independent partitions, which are then processed concurrently.
+ *
+ * Internally, the considered states are numbered consecutively, such that the work and memory are proportional to the size of the subsystem rather than
+ * to the size of the whole system.
+ */
+template<typename ValueType>
+class ParallelSccDecomposition {
+   public:
+    /*!
+     * @param transitionMatrix The transition matrix of the system to decompose.
+     * @param subsystem An optional bit vector indicating which subsystem to consider.
+     * @param choices An optional bit vector indicating which choices belong to the subsystem.
+     */
+    ParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem,
+                             storm::storage::BitVector const* choices)
+        : transitionMatrix(transitionMatrix),
+          subsystem(subsystem),
+          choices(choices),
+          localIndices(new uint64_t[transitionMatrix.getRowGroupCount()]) {
+        // Only the entries of considered states are written and read, so the mapping to local indices does not need to be initialized.
+        if (subsystem) {
+            consideredStates.reserve(subsystem->getNumberOfSetBits());
+            for (auto state : *subsystem) {
+                localIndices[state] = consideredStates.size();
+                consideredStates.push_back(state);
+            }
+        } else {
+            consideredStates.resize(transitionMatrix.getRowGroupCount());
+            for (uint64_t state = 0; state < consideredStates.size(); ++state) {
+                localIndices[state] = state;
+                consideredStates[state] = state;
+            }
+        }
+        numberOfStates = consideredStates.size();
+        partitionOf = std::vector<std::atomic<uint64_t>>(numberOfStates);
+        inDegrees = std::vector<std::atomic<uint32_t>>(numberOfStates);
+        outDegrees = std::vector<std::atomic<uint32_t>>(numberOfStates);
+        sccSizes.reset(new uint64_t[numberOfStates]);
+        preorderNumbers.reset(new uint64_t[numberOfStates]);
+    }
+
+    /*!
+     * Performs the decomposition. The arguments have the same meaning as for performSccDecompositionGCM. Unless a topological sort or the SCC depths are
+     * requested, the SCC indices are assigned in an arbitrary order.
+     */
+    void perform(bool forceTopologicalSort, storm::storage::BitVector& nonTrivialStates, uint_fast64_t* stateToSccMapping, uint_fast64_t& sccCount,
+                 std::vector<uint_fast64_t>* sccDepths) {
+        this->stateToSccMapping = stateToSccMapping;
+        buildBackwardTransitions();
+
+        std::vector<uint64_t> initialStates(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            partitionOf[state].store(0, std::memory_order_relaxed);
+            initialStates[state] = state;
+        }
+        nextPartition.store(1);
+        nextSccIndex.store(0);
+        processPartition(0, std::move(initialStates));
+        taskGroup.wait();
+        sccCount = nextSccIndex.load();
+
+        // A state is non-trivial if its SCC is not a singleton or if it has a selfloop. As neighbouring states may share a bucket of the bit vector, the
+        // bits are set sequentially.
+        std::vector<char> isNonTrivial(numberOfStates);
+        forEachIndex(0, numberOfStates, [&](uint64_t state) { isNonTrivial[state] = sccSizes[getScc(state)] > 1 || hasSelfLoop(state); });
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (isNonTrivial[state]) {
+                nonTrivialStates.set(consideredStates[state], true);
+            }
+        }
+
+        if (forceTopologicalSort || sccDepths) {
+            sortTopologically(sccCount, sccDepths);
+        }
+    }
+
+   private:
+    // A buffer of fixed capacity to which multiple threads can append concurrently.
+    struct ConcurrentBuffer {
+        explicit ConcurrentBuffer(uint64_t capacity) : entries(new uint64_t[capacity]), size(0) {}
+        void push_back(uint64_t value) {
+            entries[size.fetch_add(1, std::memory_order_relaxed)] = value;
+        }
+        std::unique_ptr<uint64_t[]> entries;
+        std::atomic<uint64_t> size;
+    };
+
+    // Marks states that are either not considered or have already been assigned to an SCC.
+    static constexpr uint64_t Assigned = std::numeric_limits<uint64_t>::max();
+    // Ranges with less elements than this are processed sequentially. Partitions with less states than this are decomposed sequentially.
+    static constexpr uint64_t SequentialThreshold = 1024;
+
+    // Retrieves whether the given state (of the whole system) is considered.
+    bool isConsidered(uint64_t globalState) const {
+        return !subsystem || subsystem->get(globalState);
+    }
+
+    uint64_t getScc(uint64_t state) const {
+        return stateToSccMapping[consideredStates[state]];
+    }
+
+    void setScc(uint64_t state, uint64_t sccIndex) {
+        stateToSccMapping[consideredStates[state]] = sccIndex;
+    }
+
+    template<typename Function>
+    void forEachIndex(uint64_t begin, uint64_t end, Function const& function) const {
+        if (end - begin < SequentialThreshold) {
+            for (uint64_t index = begin; index < end; ++index) {
+                function(index);
+            }
+        } else {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(begin, end), [&function](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    function(index);
+                }
+            });
+        }
+    }
+
+    // Invokes the given function for every considered successor of the given state except for the state itself. Successors reached by
+    // multiple transitions are reported multiple times.
+    template<typename Function>
+    void forEachSuccessor(uint64_t state, Function const& function) const {
+        uint64_t const globalState = consideredStates[state];
+        auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+        for (uint64_t row = rowGroupIndices[globalState], rowEnd = rowGroupIndices[globalState + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if (successor.getColumn() != globalState && isConsidered(successor.getColumn()) &&
+                    successor.getValue() != storm::utility::zero<ValueType>()) {
+                    function(localIndices[successor.getColumn()]);
+                }
+            }
+        }
+    }
+
+    // Invokes the given function for every predecessor that corresponds to a transition reported by forEachSuccessor.
+    template<typename Function>
+    void forEachPredecessor(uint64_t state, Function const& function) const {
+        for (uint64_t index = backwardIndices[state], end = backwardIndices[state + 1]; index != end; ++index) {
+            function(backwardStates[index]);
+        }
+    }
+
+    bool hasSelfLoop(uint64_t state) const {
+        uint64_t const globalState = consideredStates[state];
+        auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+        for (uint64_t row = rowGroupIndices[globalState], rowEnd = rowGroupIndices[globalState + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if (successor.getColumn() == globalState && successor.getValue() != storm::utility::zero<ValueType>()) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void buildBackwardTransitions() {
+        // First count the predecessors of each state and then insert them at the corresponding positions.
+        std::vector<std::atomic<uint64_t>> positions(numberOfStates + 1);
+        forEachIndex(0, numberOfStates, [&](uint64_t state) {
+            forEachSuccessor(state, [&](uint64_t successor) { positions[successor + 1].fetch_add(1, std::memory_order_relaxed); });
+        });
+        backwardIndices.resize(numberOfStates + 1);
+        backwardIndices[0] = 0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            backwardIndices[state + 1] = backwardIndices[state] + positions[state + 1].load(std::memory_order_relaxed);
+            positions[state].store(backwardIndices[state], std::memory_order_relaxed);
+        }
+        backwardStates.resize(backwardIndices.back());
+        forEachIndex(0, numberOfStates, [&](uint64_t state) {
+            forEachSuccessor(state, [&](uint64_t successor) { backwardStates[positions[successor].fetch_add(1, std::memory_order_relaxed)] = state; });
+        });
+    }
+
+    // Tries to move the given state from one partition to another. Returns true iff this thread moved the state.
+    bool tryMove(uint64_t state, uint64_t from, uint64_t to) {
+        return partitionOf[state].compare_exchange_strong(from, to, std::memory_order_relaxed);
+    }
+
+    // Assigns the given state to a new singleton SCC. The state must already be marked as assigned.
+    void assignToSingletonScc(uint64_t state) {
+        uint64_t sccIndex = nextSccIndex.fetch_add(1, std::memory_order_relaxed);
+        setScc(state, sccIndex);
+        sccSizes[sccIndex] = 1;
+    }
+
+    // Performs a breadth-first search starting from the states in the buffer. The given function is invoked for every state in the buffer and may append
+    // new states to the buffer.
+    template<typename Function>
+    void search(ConcurrentBuffer& buffer, Function const& expand) {
+        uint64_t begin = 0;
+        while (begin < buffer.size.load()) {
+            uint64_t end = buffer.size.load();
+            forEachIndex(begin, end, [&](uint64_t index) { expand(buffer.entries[index]); });
+            begin = end;
+        }
+    }
+
+    // Collects the given states that belong to the given partition.
+    std::vector<uint64_t> collect(uint64_t const* states, uint64_t numberOfCandidates, uint64_t partition) const {
+        std::vector<uint64_t> result;
+        for (uint64_t index = 0; index < numberOfCandidates; ++index) {
+            if (partitionOf[states[index]].load(std::memory_order_relaxed) == partition) {
+                result.push_back(states[index]);
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Iteratively removes the states of the given partition that have no predecessor or no successor within the partition and assigns them to singleton
+     * SCCs. Returns the states that remain in the partition.
+     */
+    std::vector<uint64_t> trim(uint64_t partition, std::vector<uint64_t>&& states) {
+        forEachIndex(0, states.size(), [&](uint64_t index) {
+            uint64_t state = states[index];
+            uint32_t numberOfSuccessors = 0;
+            uint32_t numberOfPredecessors = 0;
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (partitionOf[successor].load(std::memory_order_relaxed) == partition) {
+                    ++numberOfSuccessors;
+                }
+            });
+            forEachPredecessor(state, [&](uint64_t predecessor) {
+                if (partitionOf[predecessor].load(std::memory_order_relaxed) == partition) {
+                    ++numberOfPredecessors;
+                }
+            });
+            outDegrees[state].store(numberOfSuccessors, std::memory_order_relaxed);
+            inDegrees[state].store(numberOfPredecessors, std::memory_order_relaxed);
+        });
+
+        ConcurrentBuffer removedStates(states.size());
+        forEachIndex(0, states.size(), [&](uint64_t index) {
+            uint64_t state = states[index];
+            if (outDegrees[state].load(std::memory_order_relaxed) == 0 || inDegrees[state].load(std::memory_order_relaxed) == 0) {
+                partitionOf[state].store(Assigned, std::memory_order_relaxed);
+                removedStates.push_back(state);
+            }
+        });
+        search(removedStates, [&](uint64_t state) {
+            assignToSingletonScc(state);
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (partitionOf[successor].load(std::memory_order_relaxed) == partition && inDegrees[successor].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                    tryMove(successor, partition, Assigned)) {
+                    removedStates.push_back(successor);
+                }
+            });
+            forEachPredecessor(state, [&](uint64_t predecessor) {
+                if (partitionOf[predecessor].load(std::memory_order_relaxed) == partition &&
+                    outDegrees[predecessor].fetch_sub(1, std::memory_order_relaxed) == 1 && tryMove(predecessor, partition, Assigned)) {
+                    removedStates.push_back(predecessor);
+                }
+            });
+        });
+
+        if (removedStates.size.load() == 0) {
+            return std::move(states);
+        }
+        return collect(states.data(), states.size(), partition);
+    }
+
+    /*!
+     * Decomposes the given partition using the algorithm by Gabow/Cheriyan/Mehlhorn restricted to the states of the partition. This is used for partitions
+     * that are too small to benefit from parallelism and for partitions on which the forward-backward search is not effective (e.g. for long chains of
+     * small SCCs, where every search only splits off a single SCC).
+     */
+    void decomposeSequentially(uint64_t partition, std::vector<uint64_t> const& states) {
+        // States that are visited but not yet assigned to an SCC are moved to a fresh partition.
+        uint64_t const visitedPartition = nextPartition.fetch_add(1, std::memory_order_relaxed);
+        uint64_t currentIndex = 0;
+        std::vector<uint64_t> s, p, recursionStateStack;
+        for (auto const& startState : states) {
+            if (partitionOf[startState].load(std::memory_order_relaxed) != partition) {
+                continue;
+            }
+            recursionStateStack.push_back(startState);
+            while (!recursionStateStack.empty()) {
+                uint64_t currentState = recursionStateStack.back();
+                if (partitionOf[currentState].load(std::memory_order_relaxed) == partition) {
+                    partitionOf[currentState].store(visitedPartition, std::memory_order_relaxed);
+                    preorderNumbers[currentState] = currentIndex++;
+                    s.push_back(currentState);
+                    p.push_back(currentState);
+                    forEachSuccessor(currentState, [&](uint64_t successor) {
+                        uint64_t const successorPartition = partitionOf[successor].load(std::memory_order_relaxed);
+                        if (successorPartition == partition) {
+                            recursionStateStack.push_back(successor);
+                        } else if (successorPartition == visitedPartition) {
+                            while (preorderNumbers[p.back()] > preorderNumbers[successor]) {
+                                p.pop_back();
+                            }
+                        }
+                    });
+                } else {
+                    // The state is either finished or one of its successors was explored. In the latter case, we need to update the stack p.
+                    if (partitionOf[currentState].load(std::memory_order_relaxed) == visitedPartition && p.back() == currentState) {
+                        p.pop_back();
+                        uint64_t sccIndex = nextSccIndex.fetch_add(1, std::memory_order_relaxed);
+                        uint64_t sccSize = 0;
+                        uint64_t poppedState = 0;
+                        do {
+                            poppedState = s.back();
+                            s.pop_back();
+                            partitionOf[poppedState].store(Assigned, std::memory_order_relaxed);
+                            setScc(poppedState, sccIndex);
+                            ++sccSize;
+                        } while (poppedState != currentState);
+                        sccSizes[sccIndex] = sccSize;
+                    }
+                    recursionStateStack.pop_back();
+                }
+            }
+        }
+    }
+
+    void spawnPartition(uint64_t partition, std::vector<uint64_t>&& states, bool sequential) {
+        auto partitionStates = std::make_shared<std::vector<uint64_t>>(std::move(states));
+        taskGroup.run([this, partition, partitionStates, sequential]() {
+            if (sequential) {
+                decomposeSequentially(partition, *partitionStates);
+            } else {
+                processPartition(partition, std::move(*partitionStates));
+            }
+        });
+    }
+
+    void processPartition(uint64_t partition, std::vector<uint64_t>&& states) {
+        std::vector<uint64_t> currentStates = trim(partition, std::move(states));
+        if (currentStates.size() < SequentialThreshold) {
+            decomposeSequentially(partition, currentStates);
+            return;
+        }
+
+        // Pick the state with the most predecessors and successors as pivot, as it is likely to be part of a large SCC.
+        uint64_t pivot = currentStates.front();
+        uint64_t pivotDegree = 0;
+        for (auto const& state : currentStates) {
+            uint64_t degree = static_cast<uint64_t>(inDegrees[state].load(std::memory_order_relaxed)) * outDegrees[state].load(std::memory_order_relaxed);
+            if (degree > pivotDegree) {
+                pivot = state;
+                pivotDegree = degree;
+            }
+        }
+
+        // Forward search: the states reachable from the pivot are moved to a new partition.
+        uint64_t forwardPartition = nextPartition.fetch_add(2, std::memory_order_relaxed);
+        uint64_t backwardPartition = forwardPartition + 1;
+        ConcurrentBuffer forwardStates(currentStates.size());
+        partitionOf[pivot].store(forwardPartition, std::memory_order_relaxed);
+        forwardStates.push_back(pivot);
+        search(forwardStates, [&](uint64_t state) {
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (tryMove(successor, partition, forwardPartition)) {
+                    forwardStates.push_back(successor);
+                }
+            });
+        });
+
+        // Backward search: the reached states that are also reachable from the pivot form the SCC of the pivot. The others are moved to a new partition.
+        uint64_t sccIndex = nextSccIndex.fetch_add(1, std::memory_order_relaxed);
+        std::atomic<uint64_t> sccSize{1};
+        ConcurrentBuffer backwardStates(currentStates.size());
+        partitionOf[pivot].store(Assigned, std::memory_order_relaxed);
+        setScc(pivot, sccIndex);
+        backwardStates.push_back(pivot);
+        search(backwardStates, [&](uint64_t state) {
+            forEachPredecessor(state, [&](uint64_t predecessor) {
+                if (tryMove(predecessor, forwardPartition, Assigned)) {
+                    setScc(predecessor, sccIndex);
+                    sccSize.fetch_add(1, std::memory_order_relaxed);
+                    backwardStates.push_back(predecessor);
+                } else if (tryMove(predecessor, partition, backwardPartition)) {
+                    backwardStates.push_back(predecessor);
+                }
+            });
+        });
+        sccSizes[sccIndex] = sccSize.load();
+
+        // The three remaining partitions are independent of each other. If one of them still contains almost all states, the search did not split the
+        // partition effectively and further searches are unlikely to do so. We then fall back to the sequential algorithm for this partition.
+        std::pair<uint64_t, std::vector<uint64_t>> newPartitions[] = {
+            {forwardPartition, collect(forwardStates.entries.get(), forwardStates.size.load(), forwardPartition)},
+            {backwardPartition, collect(backwardStates.entries.get(), backwardStates.size.load(), backwardPartition)},
+            {partition, collect(currentStates.data(), currentStates.size(), partition)}};
+        for (auto& newPartition : newPartitions) {
+            if (newPartition.second.size() < SequentialThreshold) {
+                decomposeSequentially(newPartition.first, newPartition.second);
+            } else {
+                bool const isSplitIneffective = newPartition.second.size() > currentStates.size() - currentStates.size() / 8;
+                spawnPartition(newPartition.first, std::move(newPartition.second), isSplitIneffective);
+            }
+        }
+    }
+
+    /*!
+     * Renumbers the SCCs such that every SCC has a larger index than the SCCs reachable from it and computes the SCC depths, if requested.
+     * The SCCs are processed in rounds, where the SCCs of the i-th round are exactly the SCCs of depth i.
+     */
+    void sortTopologically(uint64_t sccCount, std::vector<uint_fast64_t>* sccDepths) {
+        // Gather the states of each SCC.
+        std::vector<uint64_t> sccStateIndices(sccCount + 1);
+        sccStateIndices[0] = 0;
+        for (uint64_t sccIndex = 0; sccIndex < sccCount; ++sccIndex) {
+            sccStateIndices[sccIndex + 1] = sccStateIndices[sccIndex] + sccSizes[sccIndex];
+        }
+        std::vector<std::atomic<uint64_t>> counters(sccCount);
+        forEachIndex(0, sccCount, [&](uint64_t sccIndex) { counters[sccIndex].store(sccStateIndices[sccIndex], std::memory_order_relaxed); });
+        std::vector<uint64_t> sccStates(sccStateIndices.back());
+        forEachIndex(0, numberOfStates,
+                     [&](uint64_t state) { sccStates[counters[getScc(state)].fetch_add(1, std::memory_order_relaxed)] = state; });
+
+        // Count the transitions leaving each SCC.
+        forEachIndex(0, sccCount, [&](uint64_t sccIndex) { counters[sccIndex].store(0, std::memory_order_relaxed); });
+        forEachIndex(0, numberOfStates, [&](uint64_t state) {
+            uint64_t const sccIndex = getScc(state);
+            uint64_t numberOfLeavingTransitions = 0;
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (getScc(successor) != sccIndex) {
+                    ++numberOfLeavingTransitions;
+                }
+            });
+            if (numberOfLeavingTransitions > 0) {
+                counters[sccIndex].fetch_add(numberOfLeavingTransitions, std::memory_order_relaxed);
+            }
+        });
+
+        // Process the SCCs once all SCCs reachable from them are processed.
+        ConcurrentBuffer order(sccCount);
+        forEachIndex(0, sccCount, [&](uint64_t sccIndex) {
+            if (counters[sccIndex].load(std::memory_order_relaxed) == 0) {
+                order.push_back(sccIndex);
+            }
+        });
+        std::vector<uint64_t> depths(sccCount);
+        uint64_t begin = 0;
+        for (uint64_t depth = 0; begin < order.size.load(); ++depth) {
+            uint64_t end = order.size.load();
+            forEachIndex(begin, end, [&](uint64_t orderIndex) {
+                uint64_t sccIndex = order.entries[orderIndex];
+                depths[sccIndex] = depth;
+                for (uint64_t stateIndex = sccStateIndices[sccIndex]; stateIndex < sccStateIndices[sccIndex + 1]; ++stateIndex) {
+                    forEachPredecessor(sccStates[stateIndex], [&](uint64_t predecessor) {
+                        uint64_t predecessorScc = getScc(predecessor);
+                        if (predecessorScc != sccIndex && counters[predecessorScc].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                            order.push_back(predecessorScc);
+                        }
+                    });
+                }
+            });
+            begin = end;
+        }
+        STORM_LOG_ASSERT(order.size.load() == sccCount, "Unexpected number of SCCs in topological order.");
+
+        // Renumber the SCCs according to the computed order.
+        std::vector<uint64_t> newSccIndices(sccCount);
+        forEachIndex(0, sccCount, [&](uint64_t orderIndex) { newSccIndices[order.entries[orderIndex]] = orderIndex; });
+        forEachIndex(0, numberOfStates, [&](uint64_t state) { setScc(state, newSccIndices[getScc(state)]); });
+        if (sccDepths) {
+            sccDepths->resize(sccCount);
+            forEachIndex(0, sccCount, [&](uint64_t orderIndex) { (*sccDepths)[orderIndex] = depths[order.entries[orderIndex]]; });
+        }
+    }
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    storm::storage::BitVector const* subsystem;
+    storm::storage::BitVector const* choices;
+
+    // The considered states (in ascending order) and the inverse mapping, which is only valid for considered states. All other members refer to the
+    // considered states by their position in this vector.
+    std::vector<uint64_t> consideredStates;
+    std::unique_ptr<uint64_t[]> localIndices;
+    uint64_t numberOfStates;
+
+    // The predecessors of state i are backwardStates[backwardIndices[i]], ..., backwardStates[backwardIndices[i+1]-1].
+    std::vector<uint64_t> backwardIndices;
+    std::vector<uint64_t> backwardStates;
+
+    // The partition each state currently belongs to (or Assigned).
+    std::vector<std::atomic<uint64_t>> partitionOf;
+    // The number of predecessors and successors of each state within its partition.
+    std::vector<std::atomic<uint32_t>> inDegrees;
+    std::vector<std::atomic<uint32_t>> outDegrees;
+    // The number of states in each SCC.
+    std::unique_ptr<uint64_t[]> sccSizes;
+    // The preorder numbers of the states in partitions that are decomposed sequentially.
+    std::unique_ptr<uint64_t[]> preorderNumbers;
+
+    uint_fast64_t* stateToSccMapping;
+    std::atomic<uint64_t> nextPartition;
+    std::atomic<uint64_t> nextSccIndex;
+    tbb::task_group taskGroup;
+};
+#endif
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
@@ -177,68 +689,98 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
     // We need to keep of trivial states (singleton SCCs without selfloop).
     storm::storage::BitVector nonTrivialStates(numberOfStates, false);
 
-    // Obtain a mapping from states to the SCC it belongs to
-    std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-    {
+    // Obtain a mapping from states to the SCC it belongs to.
+    // Only entries of states in the subsystem are written and read, so we do not need to initialize the mapping. The same holds for the preorder numbers.
+    // This way, the decomposition of a small subsystem of a large system does not need to touch memory for every state.
+    std::unique_ptr<uint_fast64_t[]> stateToSccMapping(new uint_fast64_t[numberOfStates]);
+
+    // Store scc depths if requested
+    std::vector<uint_fast64_t>* sccDepthsPtr = nullptr;
+    sccDepths = boost::none;
+    if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+        sccDepths = std::vector<uint_fast64_t>();
+        sccDepthsPtr = &sccDepths.get();
+    }
+
+    bool useParallelDecomposition = options.threads != 1;
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!useParallelDecomposition, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    useParallelDecomposition = false;
+#endif
+
+    if (useParallelDecomposition) {
+#ifdef STORM_HAVE_INTELTBB
+        auto decompose = [&]() {
+            ParallelSccDecomposition<ValueType> parallelDecomposition(transitionMatrix, options.subsystemPtr, options.choicesPtr);
+            parallelDecomposition.perform(options.isTopologicalSortForced, nonTrivialStates, stateToSccMapping.get(), sccCount, sccDepthsPtr);
+        };
+        if (options.threads == 0) {
+            decompose();
+        } else {
+            tbb::task_arena arena(static_cast<int>(options.threads));
+            arena.execute(decompose);
+        }
+#endif
+    } else {
         // Set up the environment of the algorithm.
         // Start with the two stacks it maintains.
         // This is to reduce memory (re-)allocations
+        uint_fast64_t numberOfConsideredStates = options.subsystemPtr ? options.subsystemPtr->getNumberOfSetBits() : numberOfStates;
         std::vector<uint_fast64_t> s;
-        s.reserve(numberOfStates);
+        s.reserve(numberOfConsideredStates);
         std::vector<uint_fast64_t> p;
-        p.reserve(numberOfStates);
+        p.reserve(numberOfConsideredStates);
         std::vector<uint_fast64_t> recursionStateStack;
-        recursionStateStack.reserve(numberOfStates);
+        recursionStateStack.reserve(numberOfConsideredStates);
 
         // We also need to store the preorder numbers of states and which states have been assigned to which SCC.
-        std::vector<uint_fast64_t> preorderNumbers(numberOfStates);
+        std::unique_ptr<uint_fast64_t[]> preorderNumbers(new uint_fast64_t[numberOfStates]);
         storm::storage::BitVector hasPreorderNumber(numberOfStates);
         storm::storage::BitVector stateHasScc(numberOfStates);
 
-        // Store scc depths if requested
-        std::vector<uint_fast64_t>* sccDepthsPtr = nullptr;
-        sccDepths = boost::none;
-        if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
-            sccDepths = std::vector<uint_fast64_t>();
-            sccDepthsPtr = &sccDepths.get();
-        }
-
         // Start the search for SCCs from every state in the block.
         uint_fast64_t currentIndex = 0;
         if (options.subsystemPtr) {
             for (auto state : *options.subsystemPtr) {
                 if (!hasPreorderNumber.get(state)) {
                     performSccDecompositionGCM(transitionMatrix, state, nonTrivialStates, options.subsystemPtr, options.choicesPtr, currentIndex,
-                                               hasPreorderNumber, preorderNumbers, recursionStateStack, s, p, stateHasScc, stateToSccMapping, sccCount,
-                                               options.isTopologicalSortForced, sccDepthsPtr);
+                                               hasPreorderNumber, preorderNumbers.get(), recursionStateStack, s, p, stateHasScc, stateToSccMapping.get(),
+                                               sccCount, options.isTopologicalSortForced, sccDepthsPtr);
                 }
             }
         } else {
             for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
                 if (!hasPreorderNumber.get(state)) {
                     performSccDecompositionGCM(transitionMatrix, state, nonTrivialStates, options.subsystemPtr, options.choicesPtr, currentIndex,
-                                               hasPreorderNumber, preorderNumbers, recursionStateStack, s, p, stateHasScc, stateToSccMapping, sccCount,
-                                               options.isTopologicalSortForced, sccDepthsPtr);
+                                               hasPreorderNumber, preorderNumbers.get(), recursionStateStack, s, p, stateHasScc, stateToSccMapping.get(),
+                                               sccCount, options.isTopologicalSortForced, sccDepthsPtr);
                 }
             }
         }
     }
     // After we obtained the state-to-SCC mapping, we build the actual blocks.
     this->blocks.resize(sccCount);
-    for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+    auto addStateToBlock = [&](uint64_t state) {
         // Check if this state (and is SCC) should be considered in this decomposition.
-        if ((!options.subsystemPtr || options.subsystemPtr->get(state))) {
-            if (!options.areNaiveSccsDropped || nonTrivialStates.get(state)) {
-                uint_fast64_t sccIndex = stateToSccMapping[state];
-                if (!options.areOnlyBottomSccsConsidered || sccDepths.get()[sccIndex] == 0) {
-                    this->blocks[sccIndex].insert(state);
-                    if (!nonTrivialStates.get(state)) {
-                        this->blocks[sccIndex].setIsTrivial(true);
-                        STORM_LOG_ASSERT(this->blocks[sccIndex].size() == 1, "Unexpected number of states in a trivial SCC.");
-                    }
+        if (!options.areNaiveSccsDropped || nonTrivialStates.get(state)) {
+            uint_fast64_t sccIndex = stateToSccMapping[state];
+            if (!options.areOnlyBottomSccsConsidered || sccDepths.get()[sccIndex] == 0) {
+                this->blocks[sccIndex].insert(state);
+                if (!nonTrivialStates.get(state)) {
+                    this->blocks[sccIndex].setIsTrivial(true);
+                    STORM_LOG_ASSERT(this->blocks[sccIndex].size() == 1, "Unexpected number of states in a trivial SCC.");
                 }
             }
         }
+    };
+    if (options.subsystemPtr) {
+        for (auto state : *options.subsystemPtr) {
+            addStateToBlock(state);
+        }
+    } else {
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            addStateToBlock(state);
+        }
     }
 
     // If requested, we need to delete all naive SCCs.
@@ -49,6 +49,11 @@ struct StronglyConnectedComponentDecompositionOptions {
         isComputeSccDepthsSet = value;
         return *this;
     }
+    /// Sets the number of threads used for the decomposition (0 uses all available cores). Values other than 1 require Intel TBB.
+    StronglyConnectedComponentDecompositionOptions& numberOfThreads(uint64_t value) {
+        threads = value;
+        return *this;
+    }
 
     storm::storage::BitVector const* subsystemPtr = nullptr;
     storm::storage::BitVector const* choicesPtr = nullptr;
@@ -56,6 +61,7 @@ struct StronglyConnectedComponentDecompositionOptions {
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    uint64_t threads = 1;
 };
 
 /*!
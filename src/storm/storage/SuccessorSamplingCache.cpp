@@ -0,0 +1,71 @@
+#include "storm/storage/SuccessorSamplingCache.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+SuccessorSamplingCache<ValueType>::SuccessorSamplingCache(uint64_t capacity, uint64_t minimalRowSize)
+    : capacity(capacity), minimalRowSize(std::max<uint64_t>(minimalRowSize, 1)), numberOfCachedValues(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+uint64_t SuccessorSamplingCache<ValueType>::getNumberOfCachedRows() const {
+    return cachedRows.size();
+}
+
+template<typename ValueType>
+uint64_t SuccessorSamplingCache<ValueType>::getNumberOfCachedValues() const {
+    return numberOfCachedValues;
+}
+
+template<typename ValueType>
+void SuccessorSamplingCache<ValueType>::clear() {
+    cachedRows.clear();
+    recentlyUsedRows.clear();
+    numberOfCachedValues = 0;
+}
+
+template<typename ValueType>
+std::vector<ValueType> const* SuccessorSamplingCache<ValueType>::lookup(uint64_t row, uint64_t rowSize) {
+    auto it = cachedRows.find(row);
+    if (it == cachedRows.end()) {
+        return nullptr;
+    }
+    if (it->second.cumulativeProbabilities.size() != rowSize) {
+        // The row has changed since it was cached.
+        numberOfCachedValues -= it->second.cumulativeProbabilities.size();
+        recentlyUsedRows.erase(it->second.position);
+        cachedRows.erase(it);
+        return nullptr;
+    }
+    recentlyUsedRows.splice(recentlyUsedRows.begin(), recentlyUsedRows, it->second.position);
+    return &it->second.cumulativeProbabilities;
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& SuccessorSamplingCache<ValueType>::insert(uint64_t row, std::vector<ValueType>&& cumulativeProbabilities) {
+    STORM_LOG_ASSERT(cachedRows.count(row) == 0, "Row " << row << " is already cached.");
+    STORM_LOG_ASSERT(cumulativeProbabilities.size() <= capacity, "Row " << row << " exceeds the capacity of the cache.");
+    while (numberOfCachedValues + cumulativeProbabilities.size() > capacity) {
+        auto evicted = cachedRows.find(recentlyUsedRows.back());
+        numberOfCachedValues -= evicted->second.cumulativeProbabilities.size();
+        cachedRows.erase(evicted);
+        recentlyUsedRows.pop_back();
+    }
+    numberOfCachedValues += cumulativeProbabilities.size();
+    recentlyUsedRows.push_front(row);
+    CachedRow& cachedRow = cachedRows[row];
+    cachedRow.cumulativeProbabilities = std::move(cumulativeProbabilities);
+    cachedRow.position = recentlyUsedRows.begin();
+    return cachedRow.cumulativeProbabilities;
+}
+
+template class SuccessorSamplingCache<double>;
+template class SuccessorSamplingCache<storm::RationalNumber>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Selects successors from the rows of a (probability) matrix. For rows with many entries, the cumulative probabilities of the entries are computed
+ * once and cached, such that a successor can be selected via binary search instead of a linear scan over the row. The selected successor coincides
+ * with the one that is found by the linear scan.
+ *
+ * The memory consumption of the cache is bounded: If caching a row would exceed the capacity, the least recently used rows are evicted. Rows are
+ * identified by their index, so the entries of a row must not change while the row is cached.
+ */
+template<typename ValueType>
+class SuccessorSamplingCache {
+   public:
+    /*!
+     * Creates an empty cache.
+     *
+     * @param capacity The maximal number of cumulative probabilities that are cached (over all rows).
+     * @param minimalRowSize Rows with fewer entries are always scanned linearly.
+     */
+    SuccessorSamplingCache(uint64_t capacity = 1ull << 20, uint64_t minimalRowSize = 16);
+
+    /*!
+     * Selects the entry of the given row at which the cumulative probability of the entries reaches the given value.
+     *
+     * @param row The index of the row, which identifies the row in the cache.
+     * @param first An iterator to the first entry of the row. The entries need to provide getValue().
+     * @param last An iterator past the last entry of the row.
+     * @param probability The value that the cumulative probability has to reach.
+     * @return The offset of the selected entry within the row or the number of entries of the row if the cumulative probability does not reach the
+     * given value.
+     */
+    template<typename IteratorType>
+    uint64_t selectEntry(uint64_t row, IteratorType first, IteratorType last, ValueType const& probability) {
+        uint64_t const rowSize = std::distance(first, last);
+        if (rowSize < minimalRowSize || rowSize > capacity) {
+            ValueType sum = storm::utility::zero<ValueType>();
+            uint64_t offset = 0;
+            for (; first != last; ++first, ++offset) {
+                sum += first->getValue();
+                if (sum >= probability) {
+                    break;
+                }
+            }
+            return offset;
+        }
+
+        std::vector<ValueType> const* cumulativeProbabilities = lookup(row, rowSize);
+        if (cumulativeProbabilities == nullptr) {
+            std::vector<ValueType> newCumulativeProbabilities;
+            newCumulativeProbabilities.reserve(rowSize);
+            ValueType sum = storm::utility::zero<ValueType>();
+            for (; first != last; ++first) {
+                sum += first->getValue();
+                newCumulativeProbabilities.push_back(sum);
+            }
+            cumulativeProbabilities = &insert(row, std::move(newCumulativeProbabilities));
+        }
+        // As the probabilities are non-negative, the first cumulative probability that is not below the given value is the one found by the scan.
+        return std::distance(cumulativeProbabilities->begin(), std::lower_bound(cumulativeProbabilities->begin(), cumulativeProbabilities->end(), probability));
+    }
+
+    /*!
+     * Retrieves the number of rows that are currently cached.
+     */
+    uint64_t getNumberOfCachedRows() const;
+
+    /*!
+     * Retrieves the number of cumulative probabilities that are currently cached.
+     */
+    uint64_t getNumberOfCachedValues() const;
+
+    /*!
+     * Removes all rows from the cache.
+     */
+    void clear();
+
+   private:
+    struct CachedRow {
+        std::vector<ValueType> cumulativeProbabilities;
+        // The position of the row in the list of recently used rows.
+        std::list<uint64_t>::iterator position;
+    };
+
+    /*!
+     * Retrieves the cumulative probabilities of the given row (if it is cached with the given size) and marks the row as recently used.
+     */
+    std::vector<ValueType> const* lookup(uint64_t row, uint64_t rowSize);
+
+    /*!
+     * Caches the cumulative probabilities of the given row, evicting the least recently used rows as necessary.
+     */
+    std::vector<ValueType> const& insert(uint64_t row, std::vector<ValueType>&& cumulativeProbabilities);
+
+    uint64_t capacity;
+    uint64_t minimalRowSize;
+    uint64_t numberOfCachedValues;
+    std::unordered_map<uint64_t, CachedRow> cachedRows;
+    // The indices of the cached rows, starting with the most recently used one.
+    std::list<uint64_t> recentlyUsedRows;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -25,6 +26,7 @@
 
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -60,6 +62,8 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      signatureRefinement(false),
+      numberOfThreads(1),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -198,6 +202,20 @@ BisimulationDecomposition<ModelType, BlockDataType>::BisimulationDecomposition(M
     STORM_LOG_THROW(options.getType() != BisimulationType::Weak || !options.getBounded(), storm::exceptions::IllegalFunctionCallException,
                     "Weak bisimulation cannot preserve bounded properties.");
 
+    if (this->options.signatureRefinement && this->options.getType() == BisimulationType::Weak) {
+        STORM_LOG_WARN("Signature-based refinement is not supported for weak bisimulation, falling back to splitter-based refinement.");
+        this->options.signatureRefinement = false;
+    }
+    if (this->options.numberOfThreads != 1) {
+#ifdef STORM_HAVE_INTELTBB
+        this->options.numberOfThreads =
+            storm::utility::parallel::getNumberOfThreads<ValueType>(this->options.numberOfThreads, "Parallel bisimulation minimization");
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        this->options.numberOfThreads = 1;
+#endif
+    }
+
     // Fix the respected atomic propositions if they were not explicitly given.
     if (!this->options.respectedAtomicPropositions) {
         this->options.respectedAtomicPropositions = model.getStateLabeling().getLabels();
@@ -256,6 +274,11 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
 
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+    if (options.signatureRefinement) {
+        this->performSignatureBasedPartitionRefinement();
+        return;
+    }
+
     // Insert all blocks into the splitter queue as a (potential) splitter.
     std::vector<Block<BlockDataType>*> splitterQueue;
     std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&](std::unique_ptr<Block<BlockDataType>> const& block) {
@@ -288,6 +311,135 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedPartitionRefinement() {
+    // Make sure the row grouping exists before it is accessed concurrently.
+    this->model.getTransitionMatrix().getRowGroupIndices();
+
+    auto possiblyNeedsRefinement = [](Block<BlockDataType> const& block) { return block.getNumberOfStates() > 1 && !block.data().absorbing(); };
+    auto signatureLess = [this](std::vector<storm::storage::DistributionWithReward<ValueType>> const& signature1,
+                                std::vector<storm::storage::DistributionWithReward<ValueType>> const& signature2) {
+        return std::lexicographical_compare(
+            signature1.begin(), signature1.end(), signature2.begin(), signature2.end(),
+            [this](storm::storage::DistributionWithReward<ValueType> const& distribution1,
+                   storm::storage::DistributionWithReward<ValueType> const& distribution2) { return distribution1.less(distribution2, this->comparator); });
+    };
+
+    std::vector<std::vector<storm::storage::DistributionWithReward<ValueType>>> signatures(this->model.getNumberOfStates());
+    uint_fast64_t iterations = 0;
+    bool partitionChanged = true;
+    while (partitionChanged) {
+        ++iterations;
+
+        // Compute the signatures of all states whose block may be split wrt. the current partition.
+        this->forEachIndex(0, this->model.getNumberOfStates(), [&](uint64_t state) {
+            if (possiblyNeedsRefinement(partition.getBlock(state))) {
+                this->computeSignature(state, signatures[state]);
+            }
+        });
+
+        // Sort the states of every block according to their signatures and determine the ranges of states with equal signatures. As the blocks
+        // occupy disjoint ranges of the partition, this can be done for all blocks concurrently.
+        std::vector<Block<BlockDataType>*> blocksToRefine;
+        for (auto const& block : partition.getBlocks()) {
+            if (possiblyNeedsRefinement(*block)) {
+                blocksToRefine.push_back(block.get());
+            }
+        }
+        std::vector<std::vector<uint_fast64_t>> rangesOfEqualSignatures(blocksToRefine.size());
+        this->forEachIndex(0, blocksToRefine.size(), [&](uint64_t blockIndex) {
+            Block<BlockDataType> const& block = *blocksToRefine[blockIndex];
+            auto less = [&signatures, &signatureLess](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                return signatureLess(signatures[state1], signatures[state2]);
+            };
+            partition.sortRange(block.getBeginIndex(), block.getEndIndex(), less);
+            rangesOfEqualSignatures[blockIndex] = partition.computeRangesOfEqualValue(block.getBeginIndex(), block.getEndIndex(), less);
+        });
+
+        // Finally, split the blocks. This modifies the list of blocks and is therefore done sequentially.
+        partitionChanged = false;
+        for (uint64_t blockIndex = 0; blockIndex < blocksToRefine.size(); ++blockIndex) {
+            auto const& ranges = rangesOfEqualSignatures[blockIndex];
+            // The first and the last entry are the bounds of the block itself.
+            for (uint64_t rangeIndex = 1; rangeIndex + 1 < ranges.size(); ++rangeIndex) {
+                partition.splitBlock(*blocksToRefine[blockIndex], ranges[rangeIndex]);
+                partitionChanged = true;
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " rounds of signature-based partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+            break;
+        }
+    }
+    STORM_LOG_DEBUG("Signature-based partition refinement finished after " << iterations << " rounds with " << partition.size() << " blocks.");
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::computeSignature(storm::storage::sparse::state_type state,
+                                                                           std::vector<storm::storage::DistributionWithReward<ValueType>>& signature) const {
+    auto const& rowGroupIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    signature.clear();
+    for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+        signature.push_back(this->computeQuotientDistribution(choice));
+    }
+
+    // Since the choices of a state form a set, we order them and drop duplicates.
+    std::sort(signature.begin(), signature.end(),
+              [this](storm::storage::DistributionWithReward<ValueType> const& distribution1,
+                     storm::storage::DistributionWithReward<ValueType> const& distribution2) { return distribution1.less(distribution2, this->comparator); });
+    signature.erase(std::unique(signature.begin(), signature.end(),
+                                [this](storm::storage::DistributionWithReward<ValueType> const& distribution1,
+                                       storm::storage::DistributionWithReward<ValueType> const& distribution2) {
+                                    return distribution1.equals(distribution2, this->comparator);
+                                }),
+                    signature.end());
+}
+
+template<typename ModelType, typename BlockDataType>
+storm::storage::DistributionWithReward<typename BisimulationDecomposition<ModelType, BlockDataType>::ValueType>
+BisimulationDecomposition<ModelType, BlockDataType>::computeQuotientDistribution(uint64_t choice) const {
+    storm::storage::DistributionWithReward<ValueType> distribution;
+    if (this->options.getKeepRewards() && this->model.hasRewardModel()) {
+        auto const& rewardModel = this->model.getUniqueRewardModel();
+        if (rewardModel.hasStateActionRewards()) {
+            distribution.setReward(rewardModel.getStateActionReward(choice));
+        }
+    }
+    for (auto const& entry : this->model.getTransitionMatrix().getRow(choice)) {
+        if (!this->comparator.isZero(entry.getValue())) {
+            distribution.addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+        }
+    }
+    return distribution;
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::forEachIndex(uint64_t begin, uint64_t end, std::function<void(uint64_t)> const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (this->options.numberOfThreads != 1) {
+        auto execute = [&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(begin, end), [&function](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    function(index);
+                }
+            });
+        };
+        if (this->options.numberOfThreads == 0) {
+            execute();
+        } else {
+            tbb::task_arena arena(static_cast<int>(this->options.numberOfThreads));
+            arena.execute(execute);
+        }
+        return;
+    }
+#endif
+    for (uint64_t index = begin; index < end; ++index) {
+        function(index);
+    }
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
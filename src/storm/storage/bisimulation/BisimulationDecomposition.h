@@ -5,6 +5,7 @@
 #include "storm/settings/modules/BisimulationSettings.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/Decomposition.h"
+#include "storm/storage/DistributionWithReward.h"
 #include "storm/storage/StateBlock.h"
 #include "storm/storage/bisimulation/BisimulationType.h"
 #include "storm/storage/bisimulation/Partition.h"
@@ -126,6 +127,14 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// A flag that indicates whether the partition is refined by splitting all blocks according to the signatures of their states (in rounds)
+        /// rather than by processing one splitter at a time. This only applies to strong bisimulation.
+        bool signatureRefinement;
+
+        /// The number of threads that are used to compute signatures and to build the quotient. A value of 0 means that all available cores are
+        /// used, a value of 1 means that everything is done sequentially.
+        uint64_t numberOfThreads;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -208,6 +217,40 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement in rounds. In every round, the signatures of all states (wrt. the current partition) are computed and
+     * all blocks are split according to the signatures of their states. Both steps are performed in parallel if multiple threads are requested.
+     */
+    void performSignatureBasedPartitionRefinement();
+
+    /*!
+     * Computes the signature of the given state wrt. the current partition, i.e. the ordered set of distinct quotient distributions of its
+     * choices.
+     *
+     * @param state The state whose signature to compute.
+     * @param signature The vector that is to hold the signature. Its previous content is discarded.
+     */
+    void computeSignature(storm::storage::sparse::state_type state, std::vector<storm::storage::DistributionWithReward<ValueType>>& signature) const;
+
+    /*!
+     * Computes the distribution of the given choice over the blocks of the current partition. If rewards are to be kept, the state-action
+     * reward of the choice is attached to the distribution.
+     *
+     * @param choice The (row) index of the choice.
+     * @return The quotient distribution of the choice.
+     */
+    storm::storage::DistributionWithReward<ValueType> computeQuotientDistribution(uint64_t choice) const;
+
+    /*!
+     * Invokes the given function for all indices in the given range. The function is called concurrently if multiple threads are requested,
+     * so it may only modify data that is exclusive to the given index.
+     *
+     * @param begin The first index.
+     * @param end The index past the last index.
+     * @param function The function to call.
+     */
+    void forEachIndex(uint64_t begin, uint64_t end, std::function<void(uint64_t)> const& function) const;
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -617,8 +617,11 @@ void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
         stateRewards = std::vector<ValueType>(this->blocks.size());
     }
 
-    // Now build (a) and (b) by traversing all blocks.
-    for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
+    // Compute the representative state and the outgoing transitions of every block. This only reads the partition, so it can be done for all
+    // blocks concurrently.
+    std::vector<storm::storage::sparse::state_type> representativeStates(this->blocks.size());
+    std::vector<std::vector<std::pair<storm::storage::sparse::state_type, ValueType>>> blockTransitions(this->blocks.size());
+    this->forEachIndex(0, this->blocks.size(), [&](uint64_t blockIndex) {
         auto const& block = this->blocks[blockIndex];
 
         // Pick one representative state. For strong bisimulation it doesn't matter which state it is, because
@@ -637,23 +640,16 @@ void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
         }
 
         Block<BlockDataType> const& oldBlock = this->partition.getBlock(representativeState);
+        auto& transitions = blockTransitions[blockIndex];
 
         // If the block is absorbing, we simply add a self-loop.
         if (oldBlock.data().absorbing()) {
-            builder.addNextValue(blockIndex, blockIndex, storm::utility::one<ValueType>());
+            transitions.emplace_back(blockIndex, storm::utility::one<ValueType>());
 
             // If the block has a special representative state, we retrieve it now.
             if (oldBlock.data().hasRepresentativeState()) {
                 representativeState = oldBlock.data().representativeState();
             }
-
-            // Add all of the selected atomic propositions that hold in the representative state to the state
-            // representing the block.
-            for (auto const& ap : atomicPropositions) {
-                if (this->model.getStateLabeling().getStateHasLabel(ap, representativeState)) {
-                    newLabeling.addLabelToState(ap, blockIndex);
-                }
-            }
         } else {
             // Compute the outgoing transitions of the block.
             std::map<storm::storage::sparse::state_type, ValueType> blockProbability;
@@ -673,25 +669,17 @@ void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
                 }
             }
 
-            // Now add them to the actual matrix.
             for (auto const& probabilityEntry : blockProbability) {
                 if (this->options.getType() == BisimulationType::Weak && this->model.getType() == storm::models::ModelType::Dtmc &&
                     !oldBlock.data().hasRewards()) {
-                    builder.addNextValue(blockIndex, probabilityEntry.first,
-                                         probabilityEntry.second / (storm::utility::one<ValueType>() - getSilentProbability(representativeState)));
+                    transitions.emplace_back(probabilityEntry.first,
+                                             probabilityEntry.second / (storm::utility::one<ValueType>() - getSilentProbability(representativeState)));
                 } else {
-                    builder.addNextValue(blockIndex, probabilityEntry.first, probabilityEntry.second);
-                }
-            }
-
-            // Otherwise add all atomic propositions to the equivalence class that the representative state
-            // satisfies.
-            for (auto const& ap : atomicPropositions) {
-                if (this->model.getStateLabeling().getStateHasLabel(ap, representativeState)) {
-                    newLabeling.addLabelToState(ap, blockIndex);
+                    transitions.push_back(probabilityEntry);
                 }
             }
         }
+        representativeStates[blockIndex] = representativeState;
 
         // If the model has state rewards, we simply copy the state reward of the representative state, because
         // all states in a block are guaranteed to have the same state reward.
@@ -704,6 +692,21 @@ void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
                 stateRewards.value()[blockIndex] += rewardModel.getStateActionRewardVector()[representativeState];
             }
         }
+    });
+
+    // Now build (a) and (b) by traversing all blocks.
+    for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
+        for (auto const& transition : blockTransitions[blockIndex]) {
+            builder.addNextValue(blockIndex, transition.first, transition.second);
+        }
+
+        // Add all of the selected atomic propositions that hold in the representative state to the state
+        // representing the block.
+        for (auto const& ap : atomicPropositions) {
+            if (this->model.getStateLabeling().getStateHasLabel(ap, representativeStates[blockIndex])) {
+                newLabeling.addLabelToState(ap, blockIndex);
+            }
+        }
     }
 
     // Now check which of the blocks of the partition contain at least one initial state.
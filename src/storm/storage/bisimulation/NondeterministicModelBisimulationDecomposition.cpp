@@ -43,8 +43,11 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> Nondeterministic
 
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::initialize() {
-    this->createChoiceToStateMapping();
-    this->initializeQuotientDistributions();
+    // The auxiliary data structures are only needed by the splitter-based refinement.
+    if (!this->options.signatureRefinement) {
+        this->createChoiceToStateMapping();
+        this->initializeQuotientDistributions();
+    }
 }
 
 template<typename ModelType>
@@ -137,75 +140,76 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::buildQuotient()
         }
     }
 
-    // Now build (a) and (b) by traversing all blocks.
-    uint_fast64_t currentRow = 0;
+    // Compute the representative state and the outgoing choices of every block. The choices are derived from the final partition rather than
+    // from the quotient distributions maintained during refinement, so this works independently of the refinement method and can be done
+    // for all blocks concurrently.
+    std::vector<storm::storage::sparse::state_type> representativeStates(this->blocks.size());
+    std::vector<std::vector<storm::storage::DistributionWithReward<ValueType>>> blockChoices(this->blocks.size());
     std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
-    for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
+    this->forEachIndex(0, this->blocks.size(), [&](uint64_t blockIndex) {
         auto const& block = this->blocks[blockIndex];
 
-        // Open new row group for the new meta state.
-        builder.newRowGroup(currentRow);
-
         // Pick one representative state. For strong bisimulation it doesn't matter which state it is, because
         // they all behave equally.
         storm::storage::sparse::state_type representativeState = *block.begin();
         Block<BlockDataType> const& oldBlock = this->partition.getBlock(representativeState);
+        auto& choices = blockChoices[blockIndex];
 
-        // If the block is absorbing, we simply add a self-loop.
+        // If the block is absorbing, we simply add a self-loop. The choice gets a reward of zero as we
+        // artificially introduced that the block is absorbing.
         if (oldBlock.data().absorbing()) {
-            builder.addNextValue(currentRow, blockIndex, storm::utility::one<ValueType>());
-            ++currentRow;
+            choices.emplace_back();
+            choices.back().addProbability(blockIndex, storm::utility::one<ValueType>());
 
             // If the block has a special representative state, we retrieve it now.
             if (oldBlock.data().hasRepresentativeState()) {
                 representativeState = oldBlock.data().representativeState();
             }
-
-            // Give the choice a reward of zero as we artificially introduced that the block is absorbing.
-            if (this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards()) {
-                stateActionRewards.value().push_back(storm::utility::zero<ValueType>());
-            }
-
-            // Add all of the selected atomic propositions that hold in the representative state to the state
-            // representing the block.
-            for (auto const& ap : atomicPropositions) {
-                if (this->model.getStateLabeling().getStateHasLabel(ap, representativeState)) {
-                    newLabeling.addLabelToState(ap, blockIndex);
-                }
-            }
         } else {
             // Add the outgoing choices of the block.
             for (uint_fast64_t choice = nondeterministicChoiceIndices[representativeState]; choice < nondeterministicChoiceIndices[representativeState + 1];
                  ++choice) {
+                storm::storage::DistributionWithReward<ValueType> distribution = this->computeQuotientDistribution(choice);
+
                 // If the choice is the same as the last one, we do not need to add it.
-                if (choice > nondeterministicChoiceIndices[representativeState] &&
-                    quotientDistributions[choice - 1].equals(quotientDistributions[choice], this->comparator)) {
+                if (!choices.empty() && choices.back().equals(distribution, this->comparator)) {
                     continue;
                 }
-
-                for (auto entry : quotientDistributions[choice]) {
-                    builder.addNextValue(currentRow, entry.first, entry.second);
-                }
-                if (this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards()) {
-                    stateActionRewards.value().push_back(quotientDistributions[choice].getReward());
-                }
-                ++currentRow;
-            }
-
-            // Otherwise add all atomic propositions to the equivalence class that the representative state
-            // satisfies.
-            for (auto const& ap : atomicPropositions) {
-                if (this->model.getStateLabeling().getStateHasLabel(ap, representativeState)) {
-                    newLabeling.addLabelToState(ap, blockIndex);
-                }
+                choices.push_back(std::move(distribution));
             }
         }
+        representativeStates[blockIndex] = representativeState;
 
         // If the model has state rewards, we simply copy the state reward of the representative state, because
         // all states in a block are guaranteed to have the same state reward.
         if (this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateRewards()) {
             stateRewards.value()[blockIndex] = this->model.getUniqueRewardModel().getStateRewardVector()[representativeState];
         }
+    });
+
+    // Now build (a) and (b) by traversing all blocks.
+    uint_fast64_t currentRow = 0;
+    for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
+        // Open new row group for the new meta state.
+        builder.newRowGroup(currentRow);
+
+        for (auto const& distribution : blockChoices[blockIndex]) {
+            for (auto const& entry : distribution) {
+                builder.addNextValue(currentRow, entry.first, entry.second);
+            }
+            if (stateActionRewards) {
+                stateActionRewards.value().push_back(distribution.getReward());
+            }
+            ++currentRow;
+        }
+
+        // Add all of the selected atomic propositions that hold in the representative state to the state
+        // representing the block.
+        for (auto const& ap : atomicPropositions) {
+            if (this->model.getStateLabeling().getStateHasLabel(ap, representativeStates[blockIndex])) {
+                newLabeling.addLabelToState(ap, blockIndex);
+            }
+        }
     }
 
     // Now check which of the blocks of the partition contain at least one initial state.
@@ -4,6 +4,10 @@
 
 #include "storm/storage/dd/DdManager.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
 
@@ -11,18 +15,53 @@ namespace storm {
 namespace dd {
 namespace bisimulation {
 
+static bool useIncrementalRefinement() {
+    auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+    if (bisimulationSettings.getRefinementMode() == storm::settings::modules::BisimulationSettings::RefinementMode::Incremental) {
+        // Without reusing block numbers, the blocks of (almost) all states change in every refinement, so nothing can be saved.
+        if (bisimulationSettings.getReuseMode() == storm::settings::modules::BisimulationSettings::ReuseMode::BlockNumbers) {
+            return true;
+        }
+        STORM_LOG_WARN("Incremental refinement requires reusing block numbers, falling back to full refinement.");
+    }
+    return false;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 PartitionRefiner<DdType, ValueType>::PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model,
                                                       Partition<DdType, ValueType> const& initialStatePartition)
+    : PartitionRefiner(model, initialStatePartition, useIncrementalRefinement()) {
+    // Intentionally left empty.
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+PartitionRefiner<DdType, ValueType>::PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                      Partition<DdType, ValueType> const& initialStatePartition, bool incrementalRefinement)
     : status(Status::Initialized),
       refinements(0),
       statePartition(initialStatePartition),
       signatureComputer(model),
       signatureRefiner(model.getManager(), statePartition.getBlockVariable(), model.getRowAndNondeterminismVariables(), model.getColumnVariables(),
                        !model.isNondeterministicModel(), model.getNondeterminismVariables()),
+      incrementalRefinement(incrementalRefinement),
+      refinedPartitionIsShifted(!model.isNondeterministicModel()),
       totalSignatureTime(0),
       totalRefinementTime(0) {
-    // Intentionally left empty.
+    // The signature refiner takes the reuse mode from the settings, so we need to make sure block numbers are reused.
+    STORM_LOG_THROW(!incrementalRefinement || storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getReuseMode() ==
+                                                  storm::settings::modules::BisimulationSettings::ReuseMode::BlockNumbers,
+                    storm::exceptions::InvalidArgumentException, "Incremental refinement requires reusing block numbers.");
+    if (incrementalRefinement) {
+        qualitativeTransitionMatrix = model.getQualitativeTransitionMatrix();
+        columnVariables = model.getColumnVariables();
+        sourceVariables = refinedPartitionIsShifted ? model.getColumnVariables() : model.getRowAndNondeterminismVariables();
+        rowColumnMetaVariablePairs = model.getRowColumnMetaVariablePairs();
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+bool PartitionRefiner<DdType, ValueType>::isIncrementalRefinementUsed() const {
+    return incrementalRefinement;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -56,7 +95,7 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
         bool refined = false;
         uint64_t index = 0;
         Partition<DdType, ValueType> newPartition;
-        auto signatureIterator = signatureComputer.compute(targetPartition);
+        auto signatureIterator = signatureComputer.compute(targetPartition, computeRefinementRestriction(oldPartition, targetPartition));
         while (signatureIterator.hasNext() && !refined) {
             auto signatureStart = std::chrono::high_resolution_clock::now();
             auto signature = signatureIterator.next();
@@ -78,6 +117,16 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
             }
         }
 
+        // The signatures of the next refinement can only be restricted if the blocks of the new partition agree on all signatures wrt. the
+        // target partition, which is not the case if the (lazy) enumeration of signatures stopped early.
+        if (incrementalRefinement) {
+            if (signatureIterator.hasNext()) {
+                lastTargetPartition = boost::none;
+            } else {
+                lastTargetPartition = targetPartition;
+            }
+        }
+
         auto totalTimeInRefinement = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
         STORM_LOG_INFO("Refinement " << refinements << " produced " << newPartition.getNumberOfBlocks() << " blocks and was completed in "
                                      << totalTimeInRefinement << "ms (signature: " << signatureTime << "ms, refinement: " << refinementTime << "ms).");
@@ -102,6 +151,41 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
     return newPartition;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Bdd<DdType> getPartitionAsBdd(Partition<DdType, ValueType> const& partition) {
+    return partition.storedAsBdd() ? partition.asBdd() : partition.asAdd().notZero();
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+boost::optional<storm::dd::Bdd<DdType>> PartitionRefiner<DdType, ValueType>::computeRefinementRestriction(
+    Partition<DdType, ValueType> const& oldPartition, Partition<DdType, ValueType> const& targetPartition) const {
+    if (!incrementalRefinement || !lastTargetPartition) {
+        return boost::none;
+    }
+
+    // Since block numbers are reused, the states whose block changed are exactly the ones that were moved to a new block.
+    storm::dd::Bdd<DdType> changedStates = (getPartitionAsBdd(targetPartition) && !getPartitionAsBdd(lastTargetPartition.get()))
+                                               .existsAbstract({targetPartition.getBlockVariable()});
+
+    // Only sources that have a transition to a changed state can obtain a different signature.
+    storm::dd::Bdd<DdType> affectedSources = qualitativeTransitionMatrix.andExists(changedStates, columnVariables);
+    if (refinedPartitionIsShifted) {
+        affectedSources = affectedSources.swapVariables(rowColumnMetaVariablePairs);
+    }
+
+    // Signatures are compared within blocks, so the signatures of all sources in blocks with an affected source need to be recomputed. All other
+    // sources get the same (empty) signature and therefore keep their block.
+    storm::dd::Bdd<DdType> oldPartitionBdd = getPartitionAsBdd(oldPartition);
+    storm::dd::Bdd<DdType> affectedBlocks = oldPartitionBdd.andExists(affectedSources, sourceVariables);
+    storm::dd::Bdd<DdType> restriction = oldPartitionBdd.andExists(affectedBlocks, {oldPartition.getBlockVariable()});
+    if (refinedPartitionIsShifted) {
+        restriction = restriction.swapVariables(rowColumnMetaVariablePairs);
+    }
+
+    STORM_LOG_TRACE("Recomputing signatures of " << restriction.getNonZeroCount() << " sources.");
+    return restriction;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 bool PartitionRefiner<DdType, ValueType>::refineWrtRewardModel(storm::models::symbolic::StandardRewardModel<DdType, ValueType> const& rewardModel) {
     STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException,
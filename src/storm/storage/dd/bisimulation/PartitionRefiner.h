@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "storm/storage/dd/bisimulation/Partition.h"
 #include "storm/storage/dd/bisimulation/Status.h"
 
@@ -22,8 +24,22 @@ class PartitionRefiner {
    public:
     PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition);
 
+    /*!
+     * Creates a refiner that uses the given refinement mode instead of the one set in the bisimulation settings.
+     *
+     * @param incrementalRefinement If set, signatures are only recomputed for blocks with changed successors. This requires the signature refiner to
+     * reuse block numbers, otherwise an InvalidArgumentException is thrown.
+     */
+    PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition,
+                     bool incrementalRefinement);
+
     virtual ~PartitionRefiner() = default;
 
+    /*!
+     * Retrieves whether signatures are only recomputed for blocks with changed successors.
+     */
+    bool isIncrementalRefinementUsed() const;
+
     /*!
      * Refines the partition.
      *
@@ -63,6 +79,16 @@ class PartitionRefiner {
     Partition<DdType, ValueType> internalRefine(Signature<DdType, ValueType> const& signature, SignatureRefiner<DdType, ValueType>& signatureRefiner,
                                                 Partition<DdType, ValueType> const& oldPartition);
 
+    /*!
+     * In incremental refinement mode, computes the sources (over the row and potentially the nondeterminism variables) whose signatures need to be
+     * recomputed when refining the old partition wrt. the target partition. These are all sources in blocks of the old partition that contain a
+     * source with a transition to a state whose block changed since the last signature computation.
+     *
+     * @return The sources to restrict the signature computation to or none if the full signatures need to be computed.
+     */
+    boost::optional<storm::dd::Bdd<DdType>> computeRefinementRestriction(Partition<DdType, ValueType> const& oldPartition,
+                                                                         Partition<DdType, ValueType> const& targetPartition) const;
+
     virtual bool refineWrtStateRewards(storm::dd::Add<DdType, ValueType> const& stateRewards);
     virtual bool refineWrtStateActionRewards(storm::dd::Add<DdType, ValueType> const& stateActionRewards);
 
@@ -81,6 +107,21 @@ class PartitionRefiner {
     // The object used to refine the state partition based on the signatures.
     SignatureRefiner<DdType, ValueType> signatureRefiner;
 
+    // A flag indicating whether signatures are only recomputed for blocks with changed successors.
+    bool incrementalRefinement;
+
+    // The information about the model needed for the incremental refinement (only set in incremental mode).
+    storm::dd::Bdd<DdType> qualitativeTransitionMatrix;
+    std::set<storm::expressions::Variable> columnVariables;
+    std::set<storm::expressions::Variable> sourceVariables;
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+
+    // A flag indicating whether the partitions refined by the signature refiner of this class are over the column variables.
+    bool refinedPartitionIsShifted;
+
+    // The target partition of the last (complete) signature computation. Only used in incremental mode.
+    boost::optional<Partition<DdType, ValueType>> lastTargetPartition;
+
     // Time measurements.
     std::chrono::high_resolution_clock::duration totalSignatureTime;
     std::chrono::high_resolution_clock::duration totalRefinementTime;
@@ -1,6 +1,11 @@
 #include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 
+#include <exception>
+#include <functional>
 #include <numeric>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/dd/DdManager.h"
 
@@ -25,6 +30,7 @@
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -433,7 +439,7 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
    public:
     InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::CUDD, ValueType> const& model,
                                     storm::dd::Bdd<storm::dd::DdType::CUDD> const& partitionBdd, storm::expressions::Variable const& blockVariable,
-                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::CUDD> const& representatives)
+                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::CUDD> const& representatives, bool = true)
         : InternalSparseQuotientExtractorBase<storm::dd::DdType::CUDD, ValueType>(model, partitionBdd, blockVariable, numberOfBlocks, representatives),
           ddman(this->manager.getInternalDdManager().getCuddManager().getManager()) {
         this->createBlockToOffsetMapping();
@@ -675,26 +681,74 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
     phmap::flat_hash_map<DdNode const*, uint64_t> blockToOffset;
 };
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+VOID_TASK_3(sylvan_quotient_parallel_for, uint64_t, first, uint64_t, count, std::function<void(uint64_t)> const*, job) {
+    if (count > 1) {
+        SPAWN(sylvan_quotient_parallel_for, first, count / 2, job);
+        CALL(sylvan_quotient_parallel_for, first + count / 2, count - count / 2, job);
+        SYNC(sylvan_quotient_parallel_for);
+    } else if (count == 1) {
+        (*job)(first);
+    }
+}
+
+#pragma GCC diagnostic pop
+#pragma clang diagnostic pop
+
 template<typename ValueType, typename ExportValueType>
 class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, ExportValueType>
     : public InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType> {
    public:
     InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, ValueType> const& model,
                                     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& partitionBdd, storm::expressions::Variable const& blockVariable,
-                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives)
+                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives,
+                                    bool parallelExtraction = true)
         : InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType>(model, partitionBdd, blockVariable, numberOfBlocks,
-                                                                                                     representatives) {
+                                                                                                     representatives),
+          parallelExtraction(parallelExtraction) {
         this->createBlockToOffsetMapping();
     }
 
    private:
     virtual storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& matrix) override {
         this->createMatrixEntryStorage();
+
+        // First descend sequentially to the split variables and collect the sub-DDs that remain to be extracted.
+        BDD variables = this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD();
+        splitVariables = getSplitVariables(variables);
         extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0,
                                    this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(),
-                                   this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(),
-                                   this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr,
-                                   0);
+                                   variables, this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(),
+                                   this->isNondeterministic ? &this->odd : nullptr, 0);
+        splitVariables = sylvan_false;
+
+        if (!matrixTasks.empty()) {
+            // Sub-DDs for the same rows (which only differ in the target block) must not be extracted concurrently, so we group them by their rows.
+            std::stable_sort(matrixTasks.begin(), matrixTasks.end(),
+                             [](MatrixExtractionTask const& a, MatrixExtractionTask const& b) { return a.sourceOffset < b.sourceOffset; });
+            std::vector<uint64_t> groupStarts;
+            for (uint64_t task = 0; task < matrixTasks.size(); ++task) {
+                if (task == 0 || matrixTasks[task].sourceOffset != matrixTasks[task - 1].sourceOffset) {
+                    groupStarts.push_back(task);
+                }
+            }
+            groupStarts.push_back(matrixTasks.size());
+
+            executeInParallel(groupStarts.size() - 1, [&](uint64_t group) {
+                for (uint64_t task = groupStarts[group]; task < groupStarts[group + 1]; ++task) {
+                    MatrixExtractionTask const& t = matrixTasks[task];
+                    extractTransitionMatrixRec(t.transitionMatrixNode, *t.sourceOdd, t.sourceOffset, t.targetPartitionNode, t.representativesNode, t.variables,
+                                               t.nondeterminismVariables, t.stateOdd, t.stateOffset);
+                }
+            });
+            matrixTasks.clear();
+            matrixTasks.shrink_to_fit();
+        }
+
         return this->createMatrixFromEntries();
     }
 
@@ -702,17 +756,87 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
                                                                storm::dd::Bdd<storm::dd::DdType::Sylvan> const& variablesCube,
                                                                storm::dd::Odd const& odd) override {
         std::vector<ExportValueType> result(odd.getTotalOffset());
-        extractVectorRec(vector.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(),
-                         variablesCube.getInternalBdd().getSylvanBdd().GetBDD(), odd, 0, result);
+
+        // Sub-DDs at the split variables cover disjoint parts of the vector, so they can be extracted concurrently.
+        BDD variables = variablesCube.getInternalBdd().getSylvanBdd().GetBDD();
+        splitVariables = getSplitVariables(variables);
+        extractVectorRec(vector.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), variables, odd,
+                         0, result);
+        splitVariables = sylvan_false;
+
+        if (!vectorTasks.empty()) {
+            executeInParallel(vectorTasks.size(), [&](uint64_t task) {
+                VectorExtractionTask const& t = vectorTasks[task];
+                extractVectorRec(t.vectorNode, t.representativesNode, t.variables, *t.odd, t.offset, result);
+            });
+            vectorTasks.clear();
+            vectorTasks.shrink_to_fit();
+        }
         return result;
     }
 
+    /*!
+     * Retrieves the suffix of the given variables at which the (recursive) extraction is split into tasks that are executed by the sylvan workers.
+     * If parallel extraction is disabled, only a single worker is available, there are too few variables or the values are rational functions,
+     * sylvan_false is returned.
+     */
+    BDD getSplitVariables(BDD variables) const {
+        if (!parallelExtraction) {
+            return sylvan_false;
+        }
+
+        if (!storm::utility::parallel::isThreadSafe<ValueType>() || !storm::utility::parallel::isThreadSafe<ExportValueType>()) {
+            return sylvan_false;
+        }
+
+        uint64_t numberOfWorkers = lace_workers();
+        if (numberOfWorkers <= 1) {
+            return sylvan_false;
+        }
+
+        // Aim for (at least) 16 tasks per worker to compensate for the irregular shape of the DDs.
+        uint64_t depth = 4;
+        for (; numberOfWorkers > 1; numberOfWorkers >>= 1) {
+            ++depth;
+        }
+        for (uint64_t level = 0; level < depth && !sylvan_isconst(variables); ++level) {
+            variables = sylvan_high(variables);
+        }
+        return sylvan_isconst(variables) ? sylvan_false : variables;
+    }
+
+    /*!
+     * Executes the given job for all indices in [0, numberOfJobs) as tasks of the sylvan workers.
+     */
+    void executeInParallel(uint64_t numberOfJobs, std::function<void(uint64_t)> const& job) const {
+        // Exceptions must not pass through the task scheduler, so they are rethrown afterwards.
+        std::vector<std::exception_ptr> exceptions(numberOfJobs);
+        std::function<void(uint64_t)> guardedJob = [&](uint64_t index) {
+            try {
+                job(index);
+            } catch (...) {
+                exceptions[index] = std::current_exception();
+            }
+        };
+        RUN(sylvan_quotient_parallel_for, 0, numberOfJobs, &guardedJob);
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
     void extractVectorRec(MTBDD vector, BDD representativesNode, BDD variables, storm::dd::Odd const& odd, uint64_t offset,
                           std::vector<ExportValueType>& result) {
         if (representativesNode == sylvan_false || mtbdd_iszero(vector)) {
             return;
         }
 
+        if (variables == splitVariables) {
+            vectorTasks.push_back({vector, representativesNode, variables, &odd, offset});
+            return;
+        }
+
         if (sylvan_isconst(variables)) {
             result[offset] = storm::utility::convertNumber<ExportValueType>(storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(vector));
         } else {
@@ -790,6 +914,13 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
             return;
         }
 
+        // Defer the extraction of the sub-DD if it is to be done in parallel.
+        if (variables == splitVariables) {
+            matrixTasks.push_back({transitionMatrixNode, &sourceOdd, sourceOffset, targetPartitionNode, representativesNode, variables, nondeterminismVariables,
+                                   stateOdd, stateOffset});
+            return;
+        }
+
         // If we have moved through all source variables, we must have arrived at a target block encoding.
         if (sylvan_isconst(variables)) {
             STORM_LOG_ASSERT(mtbdd_isleaf(transitionMatrixNode), "Expected constant node.");
@@ -896,11 +1027,44 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
 
     // A mapping from blocks (stored in terms of a DD node) to the offset of the corresponding block.
     phmap::flat_hash_map<BDD, uint64_t> blockToOffset;
+
+    // The arguments of a deferred call to extractTransitionMatrixRec.
+    struct MatrixExtractionTask {
+        MTBDD transitionMatrixNode;
+        storm::dd::Odd const* sourceOdd;
+        uint64_t sourceOffset;
+        BDD targetPartitionNode;
+        BDD representativesNode;
+        BDD variables;
+        BDD nondeterminismVariables;
+        storm::dd::Odd const* stateOdd;
+        uint64_t stateOffset;
+    };
+
+    // The arguments of a deferred call to extractVectorRec.
+    struct VectorExtractionTask {
+        MTBDD vectorNode;
+        BDD representativesNode;
+        BDD variables;
+        storm::dd::Odd const* odd;
+        uint64_t offset;
+    };
+
+    // A flag indicating whether the extraction may be distributed over the sylvan workers.
+    bool parallelExtraction;
+
+    // The (suffix of the) source variables at which the extraction is deferred to tasks. While this is sylvan_false, nothing is deferred.
+    BDD splitVariables = sylvan_false;
+
+    // The deferred extractions.
+    std::vector<MatrixExtractionTask> matrixTasks;
+    std::vector<VectorExtractionTask> vectorTasks;
 };
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
-QuotientExtractor<DdType, ValueType, ExportValueType>::QuotientExtractor(storm::dd::bisimulation::QuotientFormat const& quotientFormat)
-    : useRepresentatives(false), quotientFormat(quotientFormat) {
+QuotientExtractor<DdType, ValueType, ExportValueType>::QuotientExtractor(storm::dd::bisimulation::QuotientFormat const& quotientFormat,
+                                                                         bool parallelExtraction)
+    : useRepresentatives(false), parallelExtraction(parallelExtraction), quotientFormat(quotientFormat) {
     auto const& settings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
     this->useRepresentatives = settings.isUseRepresentativesSet();
     this->useOriginalVariables = settings.isUseOriginalVariablesSet();
@@ -942,7 +1106,7 @@ std::shared_ptr<storm::models::sparse::Model<ExportValueType>> QuotientExtractor
     STORM_LOG_ASSERT((representatives && partitionAsBdd).existsAbstract(model.getRowVariables()) == partitionAsBdd.existsAbstract(model.getRowVariables()),
                      "Representatives do not cover all blocks.");
     InternalSparseQuotientExtractor<DdType, ValueType, ExportValueType> sparseExtractor(model, partitionAsBdd, partition.getBlockVariable(),
-                                                                                        partition.getNumberOfBlocks(), representatives);
+                                                                                        partition.getNumberOfBlocks(), representatives, parallelExtraction);
     storm::storage::SparseMatrix<ExportValueType> quotientTransitionMatrix = sparseExtractor.extractTransitionMatrix(model.getTransitionMatrix());
     auto end = std::chrono::high_resolution_clock::now();
     STORM_LOG_INFO("Quotient transition matrix extracted in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
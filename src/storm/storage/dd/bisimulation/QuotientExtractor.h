@@ -19,7 +19,13 @@ namespace bisimulation {
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
 class QuotientExtractor {
    public:
-    QuotientExtractor(storm::dd::bisimulation::QuotientFormat const& quotientFormat);
+    /*!
+     * Creates a quotient extractor for the given format.
+     *
+     * @param quotientFormat The format of the extracted quotients.
+     * @param parallelExtraction If set, sparse quotients of sylvan models are extracted by all sylvan workers.
+     */
+    QuotientExtractor(storm::dd::bisimulation::QuotientFormat const& quotientFormat, bool parallelExtraction = true);
 
     std::shared_ptr<storm::models::Model<ExportValueType>> extract(storm::models::symbolic::Model<DdType, ValueType> const& model,
                                                                    Partition<DdType, ValueType> const& partition,
@@ -42,6 +48,7 @@ class QuotientExtractor {
 
     bool useRepresentatives;
     bool useOriginalVariables;
+    bool parallelExtraction;
     storm::dd::bisimulation::QuotientFormat quotientFormat;
 };
 
@@ -14,8 +14,9 @@ namespace bisimulation {
 
 template<storm::dd::DdType DdType, typename ValueType>
 SignatureIterator<DdType, ValueType>::SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer,
-                                                        Partition<DdType, ValueType> const& partition)
-    : signatureComputer(signatureComputer), partition(partition), position(0) {
+                                                        Partition<DdType, ValueType> const& partition,
+                                                        boost::optional<storm::dd::Bdd<DdType>> const& restriction)
+    : signatureComputer(signatureComputer), partition(partition), restriction(restriction), position(0) {
     // Intentionally left empty.
 }
 
@@ -41,17 +42,17 @@ Signature<DdType, ValueType> SignatureIterator<DdType, ValueType>::next() {
 
     if (mode == SignatureMode::Eager) {
         if (position == 0) {
-            result = signatureComputer.getFullSignature(partition);
+            result = signatureComputer.getFullSignature(partition, restriction);
         }
     } else if (mode == SignatureMode::Lazy) {
         if (position == 0) {
-            result = signatureComputer.getQualitativeSignature(partition);
+            result = signatureComputer.getQualitativeSignature(partition, restriction);
         } else {
-            result = signatureComputer.getFullSignature(partition);
+            result = signatureComputer.getFullSignature(partition, restriction);
         }
     } else if (mode == SignatureMode::Qualitative) {
         if (position == 0) {
-            result = signatureComputer.getQualitativeSignature(partition);
+            result = signatureComputer.getQualitativeSignature(partition, restriction);
         }
     } else {
         STORM_LOG_ASSERT(false, "Unknown signature mode.");
@@ -105,8 +106,9 @@ SignatureComputer<DdType, ValueType>::SignatureComputer(storm::dd::Add<DdType, V
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-SignatureIterator<DdType, ValueType> SignatureComputer<DdType, ValueType>::compute(Partition<DdType, ValueType> const& partition) {
-    return SignatureIterator<DdType, ValueType>(*this, partition);
+SignatureIterator<DdType, ValueType> SignatureComputer<DdType, ValueType>::compute(Partition<DdType, ValueType> const& partition,
+                                                                                  boost::optional<storm::dd::Bdd<DdType>> const& restriction) {
+    return SignatureIterator<DdType, ValueType>(*this, partition, restriction);
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -120,24 +122,27 @@ SignatureMode const& SignatureComputer<DdType, ValueType>::getSignatureMode() co
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getFullSignature(Partition<DdType, ValueType> const& partition) const {
+Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getFullSignature(Partition<DdType, ValueType> const& partition,
+                                                                                    boost::optional<storm::dd::Bdd<DdType>> const& restriction) const {
+    storm::dd::Add<DdType, ValueType> matrix = restriction ? this->getRestrictedTransitionMatrix(restriction.get()) : this->transitionMatrix;
     if (partition.storedAsBdd()) {
         if (partition.hasChangedStates()) {
-            return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asBdd() && partition.changedStatesAsBdd(), columnVariables));
+            return Signature<DdType, ValueType>(matrix.multiplyMatrix(partition.asBdd() && partition.changedStatesAsBdd(), columnVariables));
         } else {
-            return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asBdd(), columnVariables));
+            return Signature<DdType, ValueType>(matrix.multiplyMatrix(partition.asBdd(), columnVariables));
         }
     } else {
         if (partition.hasChangedStates()) {
-            return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asAdd() * partition.changedStatesAsAdd(), columnVariables));
+            return Signature<DdType, ValueType>(matrix.multiplyMatrix(partition.asAdd() * partition.changedStatesAsAdd(), columnVariables));
         } else {
-            return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asAdd(), columnVariables));
+            return Signature<DdType, ValueType>(matrix.multiplyMatrix(partition.asAdd(), columnVariables));
         }
     }
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getQualitativeSignature(Partition<DdType, ValueType> const& partition) const {
+Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getQualitativeSignature(Partition<DdType, ValueType> const& partition,
+                                                                                           boost::optional<storm::dd::Bdd<DdType>> const& restriction) const {
     if (!transitionMatrix01) {
         if (DdType == storm::dd::DdType::Sylvan || this->ensureQualitative) {
             this->transitionMatrix01 = this->transitionMatrix.notZero();
@@ -146,18 +151,39 @@ Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getQualitativ
         }
     }
 
-    if (partition.storedAsBdd()) {
-        return this->getQualitativeTransitionMatrixAsBdd().andExists(partition.asBdd(), columnVariables).template toAdd<ValueType>();
+    if (this->qualitativeTransitionMatrixIsBdd()) {
+        storm::dd::Bdd<DdType> matrix = this->getQualitativeTransitionMatrixAsBdd();
+        if (restriction) {
+            matrix &= restriction.get();
+        }
+        if (partition.storedAsBdd()) {
+            return Signature<DdType, ValueType>(matrix.andExists(partition.asBdd(), columnVariables).template toAdd<ValueType>());
+        } else {
+            return Signature<DdType, ValueType>(matrix.andExists(partition.asAdd().toBdd(), columnVariables).template toAdd<ValueType>());
+        }
     } else {
-        if (this->qualitativeTransitionMatrixIsBdd()) {
-            return Signature<DdType, ValueType>(
-                this->getQualitativeTransitionMatrixAsBdd().andExists(partition.asAdd().toBdd(), columnVariables).template toAdd<ValueType>());
+        storm::dd::Add<DdType, ValueType> matrix = this->getQualitativeTransitionMatrixAsAdd();
+        if (restriction) {
+            matrix *= restriction.get().template toAdd<ValueType>();
+        }
+        if (partition.storedAsBdd()) {
+            return Signature<DdType, ValueType>(matrix.multiplyMatrix(partition.asBdd(), columnVariables));
         } else {
-            return Signature<DdType, ValueType>(this->getQualitativeTransitionMatrixAsAdd().multiplyMatrix(partition.asAdd(), columnVariables));
+            return Signature<DdType, ValueType>(matrix.multiplyMatrix(partition.asAdd(), columnVariables));
         }
     }
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SignatureComputer<DdType, ValueType>::getRestrictedTransitionMatrix(storm::dd::Bdd<DdType> const& restriction) const {
+    // For Sylvan, the transition matrix uses the undefined value as background (see constructor), so this must be kept for the sources that are cut off.
+    if (DdType == storm::dd::DdType::Sylvan) {
+        return restriction.ite(this->transitionMatrix, this->transitionMatrix.getDdManager().template getAddUndefined<ValueType>());
+    } else {
+        return this->transitionMatrix * restriction.template toAdd<ValueType>();
+    }
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 bool SignatureComputer<DdType, ValueType>::qualitativeTransitionMatrixIsBdd() const {
     return transitionMatrix01.get().which() == 0;
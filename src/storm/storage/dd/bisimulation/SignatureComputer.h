@@ -20,7 +20,8 @@ class SignatureComputer;
 template<storm::dd::DdType DdType, typename ValueType>
 class SignatureIterator {
    public:
-    SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition);
+    SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition,
+                      boost::optional<storm::dd::Bdd<DdType>> const& restriction = boost::none);
 
     bool hasNext() const;
 
@@ -33,6 +34,9 @@ class SignatureIterator {
     // The current partition.
     Partition<DdType, ValueType> const& partition;
 
+    // If given, the signatures are only computed for the sources in this set.
+    boost::optional<storm::dd::Bdd<DdType>> restriction;
+
     // The position in the enumeration.
     uint64_t position;
 };
@@ -54,11 +58,18 @@ class SignatureComputer {
 
     void setSignatureMode(SignatureMode const& newMode);
 
-    SignatureIterator<DdType, ValueType> compute(Partition<DdType, ValueType> const& partition);
+    /*!
+     * Computes the signatures wrt. the given partition. If a restriction (over the source variables) is given, only the sources in the restriction
+     * obtain their actual signature, whereas all other sources share the signature of sources without any transitions.
+     */
+    SignatureIterator<DdType, ValueType> compute(Partition<DdType, ValueType> const& partition,
+                                                 boost::optional<storm::dd::Bdd<DdType>> const& restriction = boost::none);
 
     /// Methods to compute the signatures.
-    Signature<DdType, ValueType> getFullSignature(Partition<DdType, ValueType> const& partition) const;
-    Signature<DdType, ValueType> getQualitativeSignature(Partition<DdType, ValueType> const& partition) const;
+    Signature<DdType, ValueType> getFullSignature(Partition<DdType, ValueType> const& partition,
+                                                  boost::optional<storm::dd::Bdd<DdType>> const& restriction = boost::none) const;
+    Signature<DdType, ValueType> getQualitativeSignature(Partition<DdType, ValueType> const& partition,
+                                                         boost::optional<storm::dd::Bdd<DdType>> const& restriction = boost::none) const;
 
    private:
     bool qualitativeTransitionMatrixIsBdd() const;
@@ -67,6 +78,8 @@ class SignatureComputer {
 
     SignatureMode const& getSignatureMode() const;
 
+    storm::dd::Add<DdType, ValueType> getRestrictedTransitionMatrix(storm::dd::Bdd<DdType> const& restriction) const;
+
     /// The transition matrix to use for the signature computation.
     storm::dd::Add<DdType, ValueType> transitionMatrix;
 
@@ -0,0 +1,41 @@
+#include "storm/storage/sparse/ConcurrentStateStorage.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+template<typename StateType>
+ConcurrentStateStorage<StateType>::ConcurrentStateStorage(uint64_t bitsPerState, uint64_t initialSize)
+    : stateToId(std::make_unique<storm::storage::ConcurrentBitVectorHashMap<StateType>>(bitsPerState, initialSize)),
+      numberOfStates(0),
+      bitsPerState(bitsPerState) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+std::pair<StateType, bool> ConcurrentStateStorage<StateType>::findOrAdd(storm::storage::BitVector const& state) {
+    return stateToId->findOrAdd(state, [this]() { return static_cast<StateType>(numberOfStates.fetch_add(1, std::memory_order_relaxed)); });
+}
+
+template<typename StateType>
+uint64_t ConcurrentStateStorage<StateType>::getNumberOfStates() const {
+    return numberOfStates.load();
+}
+
+template<typename StateType>
+void ConcurrentStateStorage<StateType>::moveTo(storm::storage::BitVectorHashMap<StateType>& stateToId,
+                                               std::function<StateType(StateType const&)> const& remapping) {
+    for (auto const& stateIndexPair : *this->stateToId) {
+        stateToId.findOrAdd(stateIndexPair.first, remapping(stateIndexPair.second));
+    }
+    // Release the memory of the map.
+    this->stateToId = std::make_unique<storm::storage::ConcurrentBitVectorHashMap<StateType>>(bitsPerState, 1);
+    numberOfStates.store(0);
+}
+
+template class ConcurrentStateStorage<uint32_t>;
+template class ConcurrentStateStorage<uint_fast64_t>;
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+/*!
+ * A mapping of states to their indices that can be accessed by multiple threads concurrently while building the state space. Indices are assigned
+ * consecutively in the order in which the states are added.
+ */
+template<typename StateType>
+class ConcurrentStateStorage {
+   public:
+    /*!
+     * Creates an empty storage for states of the given bit width.
+     *
+     * @param bitsPerState The number of bits of each state.
+     * @param initialSize The number of states for which storage is initially reserved.
+     */
+    ConcurrentStateStorage(uint64_t bitsPerState, uint64_t initialSize = 100000);
+
+    /*!
+     * Retrieves the index of the given state. If the state is not yet stored, it is added with the next free index.
+     *
+     * @return The index of the state and a flag that indicates whether the state was added by this call.
+     */
+    std::pair<StateType, bool> findOrAdd(storm::storage::BitVector const& state);
+
+    /*!
+     * Retrieves the number of stored states.
+     */
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * Inserts all stored states into the given map. The stored index of each state is transformed by the given remapping. Afterwards, this storage is
+     * empty. This must not be called concurrently with other methods.
+     *
+     * @param stateToId The map into which the states are inserted.
+     * @param remapping The remapping that is applied to the indices.
+     */
+    void moveTo(storm::storage::BitVectorHashMap<StateType>& stateToId, std::function<StateType(StateType const&)> const& remapping);
+
+   private:
+    // The mapping of states to their indices. As the map can not be moved, it is stored via a pointer.
+    std::unique_ptr<storm::storage::ConcurrentBitVectorHashMap<StateType>> stateToId;
+
+    // The number of stored states.
+    std::atomic<uint64_t> numberOfStates;
+
+    // The number of bits of each state.
+    uint64_t bitsPerState;
+};
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
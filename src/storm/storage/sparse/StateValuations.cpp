@@ -289,8 +289,9 @@ bool StateValuations::assertValuation(StateValuation const& valuation) const {
     return true;
 }
 
-StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations)
-    : variableToIndexMap(variableToIndexMap), valuations(valuations) {
+StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations,
+                                 std::shared_ptr<storm::expressions::ExpressionManager const> const& manager)
+    : variableToIndexMap(variableToIndexMap), valuations(valuations), manager(manager) {
     // Intentionally left empty
 }
 
@@ -313,7 +314,7 @@ std::size_t StateValuations::hash() const {
 }
 
 StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates), manager);
 }
 
 StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
@@ -326,7 +327,7 @@ StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse
             selectedValuations.emplace_back();
         }
     }
-    return StateValuations(variableToIndexMap, std::move(selectedValuations));
+    return StateValuations(variableToIndexMap, std::move(selectedValuations), manager);
 }
 
 StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
@@ -334,7 +335,7 @@ StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld
     for (auto const& oldState : mapNewToOld) {
         newValuations.push_back(valuations[oldState]);
     }
-    return StateValuations(variableToIndexMap, std::move(newValuations));
+    return StateValuations(variableToIndexMap, std::move(newValuations), manager);
 }
 
 StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -359,6 +360,10 @@ void StateValuationsBuilder::addObservationLabel(const std::string& label) {
     currentStateValuations.observationLabels[label] = labelCount++;
 }
 
+void StateValuationsBuilder::setExpressionManager(std::shared_ptr<storm::expressions::ExpressionManager const> const& manager) {
+    currentStateValuations.manager = manager;
+}
+
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                       std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) {
     if (state > currentStateValuations.valuations.size()) {
@@ -2,6 +2,7 @@
 
 #include <boost/optional.hpp>
 #include <cstdint>
+#include <memory>
 #include <string>
 
 #include "storm/adapters/JsonForward.h"
@@ -138,7 +139,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     virtual std::size_t hash() const;
 
    private:
-    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
+    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations,
+                    std::shared_ptr<storm::expressions::ExpressionManager const> const& manager);
     bool assertValuation(StateValuation const& valuation) const;
     StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
 
@@ -146,6 +148,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     std::map<std::string, uint64_t> observationLabels;
     // A mapping from state indices to their variable valuations.
     std::vector<StateValuation> valuations;
+    // If set, the valuations share the ownership of the manager of the variables.
+    std::shared_ptr<storm::expressions::ExpressionManager const> manager;
 };
 
 class StateValuationsBuilder {
@@ -159,6 +163,12 @@ class StateValuationsBuilder {
 
     void addObservationLabel(std::string const& label);
 
+    /*!
+     * Lets the state valuations share the ownership of the manager of the variables. This is needed if the manager is not owned elsewhere, for
+     * example if the valuations were loaded from a file.
+     */
+    void setExpressionManager(std::shared_ptr<storm::expressions::ExpressionManager const> const& manager);
+
     /*!
      * Adds a new state.
      * The variable values have to be given in the same order as the variables have been added.
@@ -17,6 +17,8 @@
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/jani/Property.h"
 
@@ -50,6 +52,8 @@ std::string toString(Engine const& engine) {
             return "expl";
         case Engine::Blackbox:
             return "blackbox";
+        case Engine::Statistical:
+            return "smc";
         case Engine::AbstractionRefinement:
             return "abs";
         case Engine::Automatic:
@@ -95,6 +99,8 @@ storm::builder::BuilderType getBuilderType(Engine const& engine) {
             return storm::builder::BuilderType::Explicit;
         case Engine::Blackbox:
             return storm::builder::BuilderType::Explicit;
+        case Engine::Statistical:
+            return storm::builder::BuilderType::Explicit;
         case Engine::AbstractionRefinement:
             return storm::builder::BuilderType::Dd;
         default:
@@ -171,6 +177,21 @@ bool canHandle(storm::utility::Engine const& engine, storm::storage::SymbolicMod
                 case ModelType::SMG:
                     return false;
             }
+        case Engine::Statistical:
+            switch (modelType) {
+                case ModelType::DTMC:
+                    // The statistical engine only supports floating point numbers.
+                    return std::is_same<ValueType, double>::value &&
+                           storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>>::canHandleStatic(
+                               checkTask.template convertValueType<double>());
+                case ModelType::MDP:
+                case ModelType::CTMC:
+                case ModelType::MA:
+                case ModelType::POMDP:
+                case ModelType::SMG:
+                    return false;
+            }
+            break;
         default:
             STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
     }
@@ -38,6 +38,7 @@ enum class Engine {
     AbstractionRefinement,
     Automatic,
     Blackbox,
+    Statistical,
     Unknown
 };
 
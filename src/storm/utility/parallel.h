@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionForward.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * Checks whether values of the given type can be processed concurrently by multiple threads.
+ * This is not the case for rational functions as their polynomials share global caches that are not thread-safe.
+ */
+template<typename ValueType>
+constexpr bool isThreadSafe() {
+    return !std::is_same<ValueType, storm::RationalFunction>::value;
+}
+
+/*!
+ * Retrieves the number of threads that can be used to process values of the given type, i.e., the requested number of threads if the values are
+ * thread-safe and one otherwise. In the latter case, a warning is issued if more than one thread was requested.
+ *
+ * @param requestedNumberOfThreads The requested number of threads (0 means all available cores).
+ * @param task A description of the task that is reported in the warning, e.g. "Parallel decomposition of end components".
+ */
+template<typename ValueType>
+uint64_t getNumberOfThreads(uint64_t requestedNumberOfThreads, std::string const& task) {
+    if (!isThreadSafe<ValueType>() && requestedNumberOfThreads != 1) {
+        STORM_LOG_WARN(task << " is not supported for rational functions, defaulting to sequential version.");
+        return 1;
+    }
+    return requestedNumberOfThreads;
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
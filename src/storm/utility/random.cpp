@@ -34,6 +34,50 @@ uint64_t RandomProbabilityGenerator<RationalNumber>::random_uint(uint64_t min, u
     return std::uniform_int_distribution<uint64_t>(min, max)(engine);
 }
 
+namespace {
+// The finalizer of SplitMix64, a bijective function with good avalanche properties.
+uint64_t mix(uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+uint64_t const goldenGamma = 0x9e3779b97f4a7c15ull;
+}  // namespace
+
+CounterBasedRandomGenerator::CounterBasedRandomGenerator(uint64_t seed, uint64_t stream) : seed(seed) {
+    setStream(stream);
+}
+
+void CounterBasedRandomGenerator::setStream(uint64_t stream) {
+    key = mix(seed ^ mix(stream + goldenGamma));
+    counter = 0;
+}
+
+uint64_t CounterBasedRandomGenerator::nextBits() {
+    return mix(key + (++counter) * goldenGamma);
+}
+
+double CounterBasedRandomGenerator::random() {
+    // Use the upper 53 bits, so every value is exactly representable.
+    return static_cast<double>(nextBits() >> 11) * 0x1.0p-53;
+}
+
+uint64_t CounterBasedRandomGenerator::random_uint(uint64_t min, uint64_t max) {
+    uint64_t const range = max - min;
+    if (range == std::numeric_limits<uint64_t>::max()) {
+        return nextBits();
+    }
+    // Reject the values that would bias the result towards small numbers.
+    uint64_t const numberOfValues = range + 1;
+    uint64_t const limit = std::numeric_limits<uint64_t>::max() - std::numeric_limits<uint64_t>::max() % numberOfValues;
+    uint64_t bits;
+    do {
+        bits = nextBits();
+    } while (bits >= limit);
+    return min + bits % numberOfValues;
+}
+
 BernoulliDistributionGenerator::BernoulliDistributionGenerator(double prob) : distribution(prob) {}
 
 bool BernoulliDistributionGenerator::random(boost::mt19937& engine) {
@@ -41,6 +41,38 @@ class RandomProbabilityGenerator<storm::RationalNumber> {
     std::mt19937 engine;
 };
 
+/*!
+ * A counter-based random number generator. The drawn numbers only depend on a seed, the index of a stream and the number of values that were
+ * drawn from the stream before. Thus, independent streams (e.g., one for every sampled path) are available without sharing any state between
+ * threads, and the numbers drawn for a stream do not depend on the thread that draws them.
+ */
+class CounterBasedRandomGenerator {
+   public:
+    CounterBasedRandomGenerator(uint64_t seed = 0, uint64_t stream = 0);
+
+    /*!
+     * Restarts the generator at the beginning of the given stream.
+     */
+    void setStream(uint64_t stream);
+
+    /*!
+     * Draws a value from [0,1) uniformly at random.
+     */
+    double random();
+
+    /*!
+     * Draws a value from {min, ..., max} uniformly at random.
+     */
+    uint64_t random_uint(uint64_t min, uint64_t max);
+
+   private:
+    uint64_t nextBits();
+
+    uint64_t seed;
+    uint64_t key;
+    uint64_t counter;
+};
+
 class BernoulliDistributionGenerator {
    public:
     BernoulliDistributionGenerator(double prob);
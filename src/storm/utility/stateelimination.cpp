@@ -1,5 +1,6 @@
 #include "storm/utility/stateelimination.h"
 
+#include <algorithm>
 #include <random>
 
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
@@ -41,7 +42,9 @@ bool eliminationOrderNeedsReversedDistances(storm::settings::modules::Eliminatio
 bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
     return order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
            order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicPenalty ||
-           order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression;
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumFill;
 }
 
 bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
@@ -100,6 +103,107 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
     return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
 }
 
+template<typename ValueType>
+bool hasSelfLoop(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix) {
+    auto const& row = transitionMatrix.getRow(state);
+    auto entryIt = std::lower_bound(row.begin(), row.end(), state, [](auto const& entry, storm::storage::sparse::state_type const& column) {
+        return entry.getColumn() < column;
+    });
+    return entryIt != row.end() && entryIt->getColumn() == state;
+}
+
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state,
+                                               storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                               storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const&) {
+    uint_fast64_t numberOfPredecessors = backwardTransitions.getRow(state).size();
+    uint_fast64_t numberOfSuccessors = transitionMatrix.getRow(state).size();
+    if (hasSelfLoop(state, transitionMatrix)) {
+        --numberOfSuccessors;
+        if (numberOfPredecessors > 0) {
+            --numberOfPredecessors;
+        }
+    }
+    return numberOfPredecessors * numberOfSuccessors;
+}
+
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyMinimumFill(storm::storage::sparse::state_type const& state,
+                                             storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                             storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                             std::vector<ValueType> const& oneStepProbabilities) {
+    // The maximal number of entries that are visited to count the fill-in exactly.
+    uint_fast64_t const maximalNumberOfVisitedEntries = 1ull << 16;
+    // The cost of a new transition in addition to the complexity of its value.
+    uint_fast64_t const fillInCost = 2;
+
+    auto const& successors = transitionMatrix.getRow(state);
+    auto const& predecessors = backwardTransitions.getRow(state);
+
+    // The successor probabilities are scaled with the probability to leave the self-loop (if any), which makes them more complex.
+    uint_fast64_t selfLoopComplexity = 1;
+    uint_fast64_t successorComplexity = 0;
+    uint_fast64_t numberOfSuccessors = 0;
+    for (auto const& successor : successors) {
+        if (successor.getColumn() == state) {
+            if (!storm::utility::isZero(successor.getValue())) {
+                selfLoopComplexity = estimateComplexity(successor.getValue());
+            }
+        } else {
+            successorComplexity += estimateComplexity(successor.getValue());
+            ++numberOfSuccessors;
+        }
+    }
+    successorComplexity *= selfLoopComplexity;
+    uint_fast64_t valueComplexity = estimateComplexity(oneStepProbabilities[state]) * selfLoopComplexity;
+
+    uint_fast64_t predecessorComplexity = 0;
+    uint_fast64_t numberOfPredecessors = 0;
+    uint_fast64_t numberOfVisitedEntries = 0;
+    for (auto const& predecessor : predecessors) {
+        if (predecessor.getColumn() != state) {
+            predecessorComplexity += estimateComplexity(predecessor.getValue());
+            ++numberOfPredecessors;
+            numberOfVisitedEntries += transitionMatrix.getRow(predecessor.getColumn()).size() + successors.size();
+        }
+    }
+
+    // The value of every predecessor is updated.
+    uint_fast64_t penalty = predecessorComplexity * valueComplexity;
+
+    if (numberOfVisitedEntries > maximalNumberOfVisitedEntries) {
+        // Assume that all transitions from the predecessors to the successors are new.
+        return penalty + predecessorComplexity * successorComplexity + fillInCost * numberOfPredecessors * numberOfSuccessors;
+    }
+
+    for (auto const& predecessor : predecessors) {
+        if (predecessor.getColumn() == state) {
+            continue;
+        }
+        uint_fast64_t probabilityComplexity = estimateComplexity(predecessor.getValue());
+
+        // Merge the (sorted) successors of the predecessor with the ones of the state.
+        auto const& predecessorSuccessors = transitionMatrix.getRow(predecessor.getColumn());
+        auto first1 = predecessorSuccessors.begin();
+        auto last1 = predecessorSuccessors.end();
+        for (auto const& successor : successors) {
+            if (successor.getColumn() == state) {
+                continue;
+            }
+            while (first1 != last1 && first1->getColumn() < successor.getColumn()) {
+                ++first1;
+            }
+            uint_fast64_t productComplexity = probabilityComplexity * estimateComplexity(successor.getValue()) * selfLoopComplexity;
+            if (first1 != last1 && first1->getColumn() == successor.getColumn()) {
+                penalty += productComplexity + estimateComplexity(first1->getValue());
+            } else {
+                penalty += productComplexity + fillInCost;
+            }
+        }
+    }
+    return penalty;
+}
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -129,9 +233,14 @@ std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std
             return std::make_unique<StaticStatePriorityQueue>(sortedStates);
         } else if (eliminationOrderIsPenaltyBased(order)) {
             std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties(sortedStates.size());
-            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction =
-                order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ? computeStatePenaltyRegularExpression<ValueType>
-                                                                                                            : computeStatePenalty<ValueType>;
+            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = computeStatePenalty<ValueType>;
+            if (order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression) {
+                penaltyFunction = computeStatePenaltyRegularExpression<ValueType>;
+            } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree) {
+                penaltyFunction = computeStatePenaltyMinimumDegree<ValueType>;
+            } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumFill) {
+                penaltyFunction = computeStatePenaltyMinimumFill<ValueType>;
+            }
             for (uint_fast64_t index = 0; index < sortedStates.size(); ++index) {
                 statePenalties[index] =
                     std::make_pair(sortedStates[index], penaltyFunction(sortedStates[index], transitionMatrix, backwardTransitions, oneStepProbabilities));
@@ -149,9 +258,12 @@ std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std
                 }
                 return std::make_unique<StaticStatePriorityQueue>(sortedStates);
             } else {
-                // For the dynamic penalty version, we need to give the full state-penalty pairs.
+                // For the dynamic penalty version, we need to give the full state-penalty pairs. The degree- and fill-based penalties also depend on
+                // the predecessors of a state, so they need to be updated for the successors of eliminated states as well.
+                bool updateSuccessors = order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree ||
+                                        order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumFill;
                 return std::make_unique<DynamicStatePriorityQueue<ValueType>>(statePenalties, transitionMatrix, backwardTransitions, oneStepProbabilities,
-                                                                              penaltyFunction);
+                                                                              penaltyFunction, updateSuccessors);
             }
         }
     }
@@ -241,6 +353,14 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
                                                             std::vector<double> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state,
+                                                        storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
+                                                        storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+                                                        std::vector<double> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyMinimumFill(storm::storage::sparse::state_type const& state,
+                                                      storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
+                                                      storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+                                                      std::vector<double> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<double> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates, std::vector<double> const& oneStepProbabilities,
@@ -265,6 +385,14 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                             std::vector<storm::RationalNumber> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state,
+                                                        storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                        storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                        std::vector<storm::RationalNumber> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyMinimumFill(storm::storage::sparse::state_type const& state,
+                                                      storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                      storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                      std::vector<storm::RationalNumber> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates,
@@ -287,6 +415,14 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                             std::vector<storm::RationalFunction> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state,
+                                                        storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                        storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                        std::vector<storm::RationalFunction> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyMinimumFill(storm::storage::sparse::state_type const& state,
+                                                      storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                      storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                      std::vector<storm::RationalFunction> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates,
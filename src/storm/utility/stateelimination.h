@@ -58,6 +58,27 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
                                                    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
                                                    std::vector<ValueType> const& oneStepProbabilities);
 
+/*!
+ * Computes the number of transitions that are introduced or updated when eliminating the given state, i.e., the product of its number of
+ * predecessors and its number of successors (both without the state itself). This is the degree used in minimum degree orderings.
+ */
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state,
+                                               storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                               storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                               std::vector<ValueType> const& oneStepProbabilities);
+
+/*!
+ * Estimates the cost of eliminating the given state. Every transition (and value) that is updated costs the (estimated) complexity of the
+ * resulting value. Every transition that is newly introduced (fill-in) additionally costs two for the new forward and backward entries.
+ * If counting the fill-in exactly is too expensive, all transitions are assumed to be new.
+ */
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyMinimumFill(storm::storage::sparse::state_type const& state,
+                                             storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                             storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                             std::vector<ValueType> const& oneStepProbabilities);
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -145,6 +145,49 @@ class PreprocessedRefineDoubleVIEnvironment {
     }
 };
 
+class ParallelRefineDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.explorationThreads = 2;
+        options.explorationBatchSize = 4;
+    }
+};
+
+class IncrementalRefineDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.incrementalRefinement = true;
+    }
+};
+
 class DefaultDoubleOVIEnvironment {
    public:
     typedef double ValueType;
@@ -293,7 +336,8 @@ class BeliefExplorationTest : public ::testing::Test {
 
 typedef ::testing::Types<DefaultDoubleVIEnvironment, SelfloopReductionDefaultDoubleVIEnvironment, QualitativeReductionDefaultDoubleVIEnvironment,
                          PreprocessedDefaultDoubleVIEnvironment, FineDoubleVIEnvironment, RefineDoubleVIEnvironment, PreprocessedRefineDoubleVIEnvironment,
-                         DefaultDoubleOVIEnvironment, DefaultRationalPIEnvironment, PreprocessedDefaultRationalPIEnvironment>
+                         ParallelRefineDoubleVIEnvironment, IncrementalRefineDoubleVIEnvironment, DefaultDoubleOVIEnvironment, DefaultRationalPIEnvironment,
+                         PreprocessedDefaultRationalPIEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(BeliefExplorationTest, TestingTypes, );
@@ -409,6 +453,10 @@ TYPED_TEST(BeliefExplorationTest, simple_slippery_Pmax) {
     EXPECT_LE(result.diff(), this->precision())
         << "Result [" << result.lowerBound << ", " << result.upperBound
         << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
+    if (this->options().incrementalRefinement) {
+        // The belief MDP is infinite, so several refinement steps are needed, which have to reuse the results of the previous steps.
+        EXPECT_GT(checker.getNumberOfIncrementalChecks(), 0ul);
+    }
 }
 
 TYPED_TEST(BeliefExplorationTest, simple_slippery_Pmax_SE) {
@@ -0,0 +1,235 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <random>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace {
+
+class CompiledStateExpressionTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        manager = std::make_shared<storm::expressions::ExpressionManager>();
+        b = manager->declareBooleanVariable("b");
+        x = manager->declareIntegerVariable("x");
+        y = manager->declareIntegerVariable("y");
+        // b is stored in bit 0, x in [-2, 5] in bits 1-3 and y in [0, 3] in bits 4-5.
+        variableInformation.booleanVariables.emplace_back(b, 0, true, true);
+        variableInformation.integerVariables.emplace_back(x, -2, 5, 1, 3, true);
+        variableInformation.integerVariables.emplace_back(y, 0, 3, 4, 2, true);
+    }
+
+    /*!
+     * Evaluates the given expression with the compiled evaluator and with the ExprTk-based evaluator in all valuations of the variables and checks that
+     * the results coincide.
+     */
+    void checkAllStates(storm::expressions::Expression const& expression) {
+        storm::generator::CompiledStateExpression compiledExpression(expression, variableInformation);
+        std::vector<double> stack(compiledExpression.getRequiredStackSize());
+        storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+        storm::generator::CompressedState state(6);
+        for (bool bValue : {false, true}) {
+            for (int64_t xValue = -2; xValue <= 5; ++xValue) {
+                for (int64_t yValue = 0; yValue <= 3; ++yValue) {
+                    state.set(0, bValue);
+                    state.setFromInt(1, 3, xValue + 2);
+                    state.setFromInt(4, 2, yValue);
+                    evaluator.setBooleanValue(b, bValue);
+                    evaluator.setIntegerValue(x, xValue);
+                    evaluator.setIntegerValue(y, yValue);
+                    std::string const valuation = "b=" + std::to_string(bValue) + ", x=" + std::to_string(xValue) + ", y=" + std::to_string(yValue);
+                    if (expression.hasBooleanType()) {
+                        EXPECT_EQ(evaluator.asBool(expression), compiledExpression.evaluateAsBool(state, stack.data())) << expression << " at " << valuation;
+                    } else {
+                        EXPECT_EQ(evaluator.asRational(expression), compiledExpression.evaluate(state, stack.data())) << expression << " at " << valuation;
+                    }
+                }
+            }
+        }
+    }
+
+    std::shared_ptr<storm::expressions::ExpressionManager> manager;
+    storm::expressions::Variable b;
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::generator::VariableInformation variableInformation;
+};
+
+TEST_F(CompiledStateExpressionTest, Arithmetic) {
+    checkAllStates(x + y);
+    checkAllStates(x - manager->integer(3) * y);
+    checkAllStates(-x + manager->rational(0.5));
+    checkAllStates(x / (y + 1));
+    checkAllStates(storm::expressions::minimum(x, y) + storm::expressions::maximum(x, manager->integer(2)));
+    checkAllStates(storm::expressions::pow(x, y, true));
+    checkAllStates(storm::expressions::modulo(x + 2, y + 1));
+    checkAllStates(storm::expressions::floor(x / manager->rational(3.0)) + storm::expressions::ceil(y / manager->rational(2.0)));
+}
+
+TEST_F(CompiledStateExpressionTest, Relations) {
+    checkAllStates(x == y);
+    checkAllStates(x != manager->integer(0));
+    checkAllStates(x < y);
+    checkAllStates(x <= 2);
+    checkAllStates(x > y);
+    checkAllStates(y >= 1);
+    // Equality is checked with the tolerance of ExprTk.
+    checkAllStates(x / manager->rational(3.0) * manager->rational(3.0) == x);
+}
+
+TEST_F(CompiledStateExpressionTest, BooleanOperators) {
+    checkAllStates(b && x > 0);
+    checkAllStates(b || x + y == 5);
+    checkAllStates(!b);
+    checkAllStates(storm::expressions::implies(b, y >= 2));
+    checkAllStates(storm::expressions::iff(b, x < 0));
+    checkAllStates(storm::expressions::xclusiveor(b, y == 3));
+    checkAllStates((x + y == 5) || (b && (y > 1 || x != 0)));
+    checkAllStates(storm::expressions::ite(b, x, y - 1));
+    checkAllStates(storm::expressions::ite(b && x > 2, storm::expressions::ite(y == 0, manager->boolean(true), x == y), !b || y < 2));
+}
+
+TEST_F(CompiledStateExpressionTest, ShortCircuit) {
+    // The second operand must not be evaluated if the first one determines the result, so x / 0 must not influence the result.
+    checkAllStates((y == 0) || (x / y > 1));
+    checkAllStates((y != 0) && (x / y > 1));
+    checkAllStates(storm::expressions::implies(y != 0, x / y > 1));
+    checkAllStates(storm::expressions::ite(y == 0, x, x / y));
+}
+
+TEST_F(CompiledStateExpressionTest, UnsupportedVariable) {
+    storm::expressions::Variable z = manager->declareIntegerVariable("z");
+    STORM_SILENT_EXPECT_THROW(storm::generator::CompiledStateExpression(x + z, variableInformation), storm::exceptions::NotSupportedException);
+}
+
+TEST(CompiledStateExpressionBenchmark, DISABLED_Guard) {
+    // Run with: bin/test-builder --gtest_filter=CompiledStateExpressionBenchmark.DISABLED_Guard --gtest_also_run_disabled_tests
+    // Evaluates a typical guard on 1024 random states, once with the compiled evaluator and once by unpacking every state into the ExprTk-based
+    // evaluator as the next-state generator does without compiled expressions.
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable c = manager->declareBooleanVariable("c");
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    // b and c are stored in bits 0 and 1, x and y in [0, 15] in bits 2-5 and 6-9, respectively.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(b, 0, true, true);
+    variableInformation.booleanVariables.emplace_back(c, 1, true, true);
+    variableInformation.integerVariables.emplace_back(x, 0, 15, 2, 4, true);
+    variableInformation.integerVariables.emplace_back(y, 0, 15, 6, 4, true);
+    storm::expressions::Expression const guard = (x + y == 10) || (b && (c || x != 0));
+
+    uint64_t const numberOfStates = 1024;
+    std::mt19937 randomGenerator(42);
+    std::uniform_int_distribution<uint64_t> bitsDistribution(0, (1ull << 10) - 1);
+    std::vector<storm::generator::CompressedState> states;
+    for (uint64_t index = 0; index < numberOfStates; ++index) {
+        states.emplace_back(10);
+        states.back().setFromInt(0, 10, bitsDistribution(randomGenerator));
+    }
+
+    storm::generator::CompiledStateExpression compiledGuard(guard, variableInformation);
+    std::vector<double> stack(compiledGuard.getRequiredStackSize());
+    storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+    uint64_t const rounds = 1000;
+    uint64_t compiledSatisfied = 0;
+    uint64_t evaluatorSatisfied = 0;
+    uint64_t compiledNanoseconds = std::numeric_limits<uint64_t>::max();
+    uint64_t evaluatorNanoseconds = std::numeric_limits<uint64_t>::max();
+    for (uint64_t run = 0; run < 5; ++run) {
+        compiledSatisfied = 0;
+        storm::utility::Stopwatch compiledWatch(true);
+        for (uint64_t round = 0; round < rounds; ++round) {
+            for (auto const& state : states) {
+                compiledSatisfied += compiledGuard.evaluateAsBool(state, stack.data()) ? 1 : 0;
+            }
+        }
+        compiledWatch.stop();
+        compiledNanoseconds = std::min<uint64_t>(compiledNanoseconds, compiledWatch.getTimeInNanoseconds());
+
+        evaluatorSatisfied = 0;
+        storm::utility::Stopwatch evaluatorWatch(true);
+        for (uint64_t round = 0; round < rounds; ++round) {
+            for (auto const& state : states) {
+                evaluator.setBooleanValue(b, state.get(0));
+                evaluator.setBooleanValue(c, state.get(1));
+                evaluator.setIntegerValue(x, state.getAsInt(2, 4));
+                evaluator.setIntegerValue(y, state.getAsInt(6, 4));
+                evaluatorSatisfied += evaluator.asBool(guard) ? 1 : 0;
+            }
+        }
+        evaluatorWatch.stop();
+        evaluatorNanoseconds = std::min<uint64_t>(evaluatorNanoseconds, evaluatorWatch.getTimeInNanoseconds());
+    }
+    EXPECT_EQ(evaluatorSatisfied, compiledSatisfied);
+    double const evaluations = static_cast<double>(rounds * numberOfStates);
+    std::cout << "Guard " << guard << " on " << numberOfStates << " random states: unpacking and ExprTk " << evaluatorNanoseconds / evaluations
+              << "ns per state, compiled " << compiledNanoseconds / evaluations << "ns per state\n";
+}
+
+TEST(CompiledStateExpressionRandomTest, FourteenExpressions) {
+    // Compares the compiled evaluator with the ExprTk-based evaluator on random states of a layout whose variables have larger domains than the one
+    // of the exhaustive tests above.
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable c = manager->declareBooleanVariable("c");
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    // b and c are stored in bits 0 and 1, x in [-100, 155] in bits 2-9 and y in [1, 1024] in bits 10-19.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(b, 0, true, true);
+    variableInformation.booleanVariables.emplace_back(c, 1, true, true);
+    variableInformation.integerVariables.emplace_back(x, -100, 155, 2, 8, true);
+    variableInformation.integerVariables.emplace_back(y, 1, 1024, 10, 10, true);
+    std::vector<storm::expressions::Expression> const expressions = {
+        (x + y == 10) || (b && (c || x != 0)),
+        x * y - manager->integer(7) * x,
+        x / y + manager->rational(0.25),
+        storm::expressions::modulo(y, manager->integer(7)) + storm::expressions::minimum(x, y),
+        storm::expressions::maximum(x, y) - storm::expressions::floor(y / manager->rational(3.0)),
+        storm::expressions::ceil(x / manager->rational(4.0)) * manager->integer(2),
+        storm::expressions::pow(x, manager->integer(2), true) - y,
+        x < y && !c,
+        x >= manager->integer(50) || y <= manager->integer(10),
+        storm::expressions::implies(b, x + 3 > y),
+        storm::expressions::iff(b, c) && x != y,
+        storm::expressions::xclusiveor(c, x < 0),
+        storm::expressions::ite(b, x, y) + storm::expressions::ite(c && x > 0, y, manager->integer(1)),
+        storm::expressions::ite(x == 0, manager->boolean(false), y / x > 2)};
+
+    std::mt19937 randomGenerator(42);
+    std::uniform_int_distribution<uint64_t> bitsDistribution(0, (1ull << 20) - 1);
+    storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+    storm::generator::CompressedState state(20);
+    for (auto const& expression : expressions) {
+        storm::generator::CompiledStateExpression compiledExpression(expression, variableInformation);
+        std::vector<double> stack(compiledExpression.getRequiredStackSize());
+        for (uint64_t index = 0; index < 2000; ++index) {
+            state.setFromInt(0, 20, bitsDistribution(randomGenerator));
+            int64_t const xValue = static_cast<int64_t>(state.getAsInt(2, 8)) - 100;
+            int64_t const yValue = static_cast<int64_t>(state.getAsInt(10, 10)) + 1;
+            evaluator.setBooleanValue(b, state.get(0));
+            evaluator.setBooleanValue(c, state.get(1));
+            evaluator.setIntegerValue(x, xValue);
+            evaluator.setIntegerValue(y, yValue);
+            std::string const valuation = "b=" + std::to_string(state.get(0)) + ", c=" + std::to_string(state.get(1)) + ", x=" + std::to_string(xValue) +
+                                          ", y=" + std::to_string(yValue);
+            if (expression.hasBooleanType()) {
+                EXPECT_EQ(evaluator.asBool(expression), compiledExpression.evaluateAsBool(state, stack.data())) << expression << " at " << valuation;
+            } else {
+                EXPECT_EQ(evaluator.asRational(expression), compiledExpression.evaluate(state, stack.data())) << expression << " at " << valuation;
+            }
+        }
+    }
+}
+
+}  // namespace
@@ -5,6 +5,7 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/Stopwatch.h"
 #include "test/storm_gtest.h"
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -107,6 +108,108 @@ TEST(ExplicitPrismModelBuilderTest, Mdp) {
     EXPECT_EQ(36ul, model->getInitialStates().getNumberOfSetBits());
 }
 
+namespace {
+
+/*!
+ * Checks that the given models coincide, including their labelings, reward models and (if present) state valuations.
+ */
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual, std::string const& file) {
+    EXPECT_EQ(expected.getTransitionMatrix(), actual.getTransitionMatrix()) << file;
+    EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling()) << file;
+    ASSERT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling()) << file;
+    if (expected.hasChoiceLabeling()) {
+        EXPECT_EQ(expected.getChoiceLabeling(), actual.getChoiceLabeling()) << file;
+    }
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first)) << file;
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector()) << file;
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector()) << file;
+        }
+    }
+    ASSERT_EQ(expected.hasStateValuations(), actual.hasStateValuations()) << file;
+    if (expected.hasStateValuations()) {
+        for (uint64_t state = 0; state < expected.getNumberOfStates(); ++state) {
+            EXPECT_EQ(expected.getStateValuations().getStateInfo(state), actual.getStateValuations().getStateInfo(state)) << file;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::BuilderOptions generatorOptions;
+    generatorOptions.setBuildAllRewardModels().setBuildAllLabels().setBuildChoiceLabels().setBuildStateValuations();
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.numberOfThreads = 2;
+    parallelOptions.reproducibleStateOrder = true;
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/leader3.nm", "/mdp/csma2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+
+        // With a reproducible state order, the models have to coincide.
+        expectEqualModels(*model, *parallelModel, file);
+    }
+
+    // Without a reproducible state order, only the size of the model is fixed.
+    parallelOptions.reproducibleStateOrder = false;
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm");
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+    EXPECT_EQ(4093ul, model->getNumberOfStates());
+    EXPECT_EQ(5585ul, model->getNumberOfTransitions());
+}
+
+TEST(ExplicitPrismModelBuilderTest, CompiledExpressions) {
+    storm::builder::BuilderOptions generatorOptions;
+    generatorOptions.setBuildAllRewardModels().setBuildAllLabels().setBuildChoiceLabels();
+    storm::builder::BuilderOptions compiledGeneratorOptions = generatorOptions;
+    compiledGeneratorOptions.setCompileExpressions();
+
+    for (std::string const& file : {"/dtmc/brp-16-2.pm", "/dtmc/crowds-5-5.pm", "/mdp/two_dice.nm", "/mdp/csma2-2.nm", "/mdp/wlan0-2-4.nm",
+                                     "/ctmc/embedded2.sm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto compiledModel = storm::builder::ExplicitModelBuilder<double>(program, compiledGeneratorOptions).build();
+
+        // The compiled expressions have to yield exactly the same model.
+        expectEqualModels(*model, *compiledModel, file);
+    }
+}
+
+// Measures the time for building models with and without compiled expressions. Run with --gtest_also_run_disabled_tests.
+TEST(ExplicitPrismModelBuilderTest, DISABLED_CompiledExpressionsBenchmark) {
+    storm::builder::BuilderOptions generatorOptions;
+    generatorOptions.setBuildAllRewardModels().setBuildAllLabels();
+    storm::builder::BuilderOptions compiledGeneratorOptions = generatorOptions;
+    compiledGeneratorOptions.setCompileExpressions();
+    uint64_t const numberOfRuns = 5;
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/mdp/firewire3-0.5.nm", "/mdp/wlan0-2-4.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        uint64_t numberOfStates = 0;
+        // Report the fastest of several runs to reduce the influence of noise.
+        for (bool compile : {false, true}) {
+            uint64_t fastestRun = std::numeric_limits<uint64_t>::max();
+            for (uint64_t run = 0; run < numberOfRuns; ++run) {
+                storm::utility::Stopwatch stopwatch(true);
+                auto model = storm::builder::ExplicitModelBuilder<double>(program, compile ? compiledGeneratorOptions : generatorOptions).build();
+                stopwatch.stop();
+                fastestRun = std::min<uint64_t>(fastestRun, stopwatch.getTimeInMilliseconds());
+                if (numberOfStates == 0) {
+                    numberOfStates = model->getNumberOfStates();
+                }
+                EXPECT_EQ(numberOfStates, model->getNumberOfStates()) << file;
+            }
+            std::cout << file << " (" << numberOfStates << " states), " << (compile ? "compiled" : "evaluator") << ": " << fastestRun << "ms\n";
+        }
+    }
+}
+
 TEST(ExplicitPrismModelBuilderTest, Ma) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
 
@@ -0,0 +1,182 @@
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "storm/modelchecker/blackbox/storage/CompactStorage.h"
+#include "storm/modelchecker/blackbox/storage/HashStorage.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace {
+
+/*!
+ * Adds 5M random visits over 1M states with 4 actions each to the given storage. Successors are close to the sampled state, which yields about 4.6M
+ * distinct transitions. Reports the time needed to add the visits. The resident memory is best measured by running the benchmark for one storage at
+ * a time, e.g., with /usr/bin/time -v.
+ */
+template<typename StorageType>
+StorageType runStorageBenchmark(std::string const& name) {
+    uint64_t const numberOfStates = 1000000;
+    uint64_t const numberOfVisits = 5000000;
+    StorageType storage;
+    std::mt19937 engine(42);
+    storm::utility::Stopwatch stopwatch(true);
+    for (uint64_t visit = 0; visit < numberOfVisits; ++visit) {
+        uint_fast64_t state = engine() % numberOfStates;
+        uint_fast64_t action = engine() % 4;
+        uint_fast64_t succ = (state + engine() % 8) % numberOfStates;
+        storage.incTrans(state, action, succ, 1);
+    }
+    stopwatch.stop();
+    std::cout << name << ": " << storage.getTotalTransitionCount() << " transitions in " << stopwatch.getTimeInMilliseconds() << "ms\n";
+    return storage;
+}
+
+}  // namespace
+
+TEST(CompactStorage, incTrans) {
+    auto storage = storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>();
+    storage.addState(1);
+    ASSERT_TRUE(storage.stateExists(1));
+    storage.incTrans(1, 2, 3, 10);
+    storage.incTrans(1, 2, 4, 11);
+    storage.incTrans(1, 2, 3, 9);
+    ASSERT_TRUE(storage.stateExists(3));
+    ASSERT_FALSE(storage.stateExists(2));
+    EXPECT_EQ(19ul, storage.getSuccSamples(1, 2, 3));
+    EXPECT_EQ(30ul, storage.getTotalSamples(1, 2));
+    EXPECT_EQ(static_cast<uint64_t>(-1), storage.getSuccSamples(1, 2, 5));
+    EXPECT_EQ(static_cast<uint64_t>(-1), storage.getTotalSamples(1, 5));
+}
+
+TEST(CompactStorage, logTotals) {
+    auto storage = storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>();
+    storage.incTrans(1, 30, 2, 1);
+    storage.incTrans(1, 30, 3, 1);
+    storage.incTrans(1, 30, 4, 1);
+    storage.incTrans(1, 30, 5, 1);
+    storage.incTrans(1, 30, 5, 10);
+    storage.incTrans(2, 30, 1, 10);
+    storage.addUnsampledAction(1, 40);
+    storage.addStateActions(6, {3, 1, 2});
+    storage.addStateActions(6, {4});  // Ignored as the state already has actions
+
+    EXPECT_EQ(6ul, storage.getTotalStateCount());
+    EXPECT_EQ(5ul, storage.getTotalTransitionCount());
+    EXPECT_EQ(6ul, storage.gettotalStateActionPairCount());
+    // Actions and successors are sorted
+    EXPECT_EQ(std::vector<uint_fast64_t>({1, 2, 3}), storage.getStateActionVec(6));
+    EXPECT_EQ(std::vector<uint_fast64_t>({2, 3, 4, 5}), storage.getStateActionSuccVec(1, 30));
+    EXPECT_EQ(0ul, storage.getTotalSamples(1, 40));
+}
+
+TEST(CompactStorage, reverseMap) {
+    auto storage = storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>();
+    storage.incTrans(3, 10, 1, 1);
+    storage.incTrans(2, 10, 1, 1);
+    storage.incTrans(2, 11, 1, 1);
+    storage.incTrans(1, 10, 2, 1);
+
+    EXPECT_TRUE(storage.getPredecessors(1).empty());
+    storage.createReverseMapping();
+    EXPECT_EQ(3ul, storage.getPredecessors(1).size());
+    EXPECT_EQ(std::vector<std::pair<uint_fast64_t, uint_fast64_t>>({{1, 10}}), storage.getPredecessors(2));
+    EXPECT_TRUE(storage.getPredecessors(3).empty());
+}
+
+TEST(CompactStorage, succCount) {
+    auto storage = storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>();
+    storage.addUnsampledAction(1, 0);
+    EXPECT_EQ(-1, storage.getSuccCount(std::make_pair(1ul, 0ul)));
+    storage.setSuccCount(std::make_pair(1ul, 0ul), 3);
+    storage.incTrans(1, 0, 2, 1);
+    EXPECT_EQ(3, storage.getSuccCount(std::make_pair(1ul, 0ul)));
+    EXPECT_EQ(-1, storage.getSuccCount(std::make_pair(2ul, 0ul)));
+}
+
+TEST(CompactStorage, sampleCountMatrix) {
+    auto storage = storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>();
+    storage.incTrans(0, 1, 1, 2);
+    storage.incTrans(0, 1, 0, 3);
+    storage.incTrans(0, 0, 1, 4);
+    storage.addUnsampledAction(1, 0);
+
+    auto matrix = storage.createSampleCountMatrix();
+    ASSERT_EQ(2ul, matrix.getRowGroupCount());
+    ASSERT_EQ(3ul, matrix.getRowCount());
+    EXPECT_EQ(2ul, matrix.getRowGroupSize(0));
+    EXPECT_EQ(4ul, matrix.getRow(0).begin()->getValue());
+    EXPECT_EQ(5ul, matrix.getRowSum(1));
+    EXPECT_EQ(0ul, matrix.getRow(2).getNumberOfEntries());
+}
+
+TEST(CompactStorage, agreesWithHashStorage) {
+    auto compactStorage = storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>();
+    auto hashStorage = storm::modelchecker::blackbox::storage::HashStorage<uint_fast64_t>();
+    std::mt19937 engine(42);
+    for (uint64_t sample = 0; sample < 20000; ++sample) {
+        uint_fast64_t state = engine() % 100;
+        uint_fast64_t action = engine() % 4;
+        uint_fast64_t succ = engine() % 120;
+        if (sample % 10 == 0) {
+            compactStorage.addUnsampledAction(state, action);
+            hashStorage.addUnsampledAction(state, action);
+        } else {
+            compactStorage.incTrans(state, action, succ, 1 + sample % 3);
+            hashStorage.incTrans(state, action, succ, 1 + sample % 3);
+        }
+    }
+    ASSERT_EQ(hashStorage.getTotalStateCount(), compactStorage.getTotalStateCount());
+    ASSERT_EQ(hashStorage.gettotalStateActionPairCount(), compactStorage.gettotalStateActionPairCount());
+    ASSERT_EQ(hashStorage.getTotalTransitionCount(), compactStorage.getTotalTransitionCount());
+    for (auto state : compactStorage.getStateVec()) {
+        ASSERT_TRUE(hashStorage.stateExists(state));
+        auto actions = hashStorage.getStateActionVec(state);
+        std::sort(actions.begin(), actions.end());
+        ASSERT_EQ(actions, compactStorage.getStateActionVec(state));
+        for (auto action : actions) {
+            EXPECT_EQ(hashStorage.getTotalSamples(state, action), compactStorage.getTotalSamples(state, action));
+            for (auto succ : hashStorage.getStateActionSuccVec(state, action)) {
+                EXPECT_EQ(hashStorage.getSuccSamples(state, action, succ), compactStorage.getSuccSamples(state, action, succ));
+            }
+        }
+    }
+}
+
+TEST(CompactStorage, join) {
+    auto storage = storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>();
+    storage.incTrans(0, 0, 1, 2);
+    storage.addUnsampledAction(1, 0);
+
+    auto other = storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>();
+    other.incTrans(0, 0, 1, 3);  // becomes (0,0,2)
+    other.incTrans(0, 0, 2, 1);  // becomes (0,0,1)
+    other.incTrans(2, 1, 0, 4);  // becomes (1,1,0)
+    other.setSuccCount(std::make_pair(1ul, 0ul), 2);
+
+    storage.join(other, {0, 2, 1});
+    EXPECT_EQ(3ul, storage.getTotalStateCount());
+    EXPECT_EQ(3ul, storage.getTotalTransitionCount());
+    EXPECT_EQ(4ul, storage.gettotalStateActionPairCount());
+    EXPECT_EQ(std::vector<uint_fast64_t>({1, 2}), storage.getStateActionSuccVec(0, 0));
+    EXPECT_EQ(3ul, storage.getSuccSamples(0, 0, 1));
+    EXPECT_EQ(3ul, storage.getSuccSamples(0, 0, 2));
+    EXPECT_EQ(6ul, storage.getTotalSamples(0, 0));
+    EXPECT_EQ(std::vector<uint_fast64_t>({0, 1}), storage.getStateActionVec(1));
+    EXPECT_EQ(4ul, storage.getSuccSamples(1, 1, 0));
+    EXPECT_EQ(2, storage.getSuccCount(std::make_pair(2ul, 0ul)));
+}
+
+// Run with: bin/test-modelchecker-blackbox --gtest_filter=CompactStorage.DISABLED_Benchmark* --gtest_also_run_disabled_tests
+TEST(CompactStorage, DISABLED_BenchmarkHashStorage) {
+    auto storage = runStorageBenchmark<storm::modelchecker::blackbox::storage::HashStorage<uint_fast64_t>>("HashStorage");
+    EXPECT_GT(storage.getTotalTransitionCount(), 0ul);
+}
+
+TEST(CompactStorage, DISABLED_BenchmarkCompactStorage) {
+    auto storage = runStorageBenchmark<storm::modelchecker::blackbox::storage::CompactStorage<uint_fast64_t>>("CompactStorage");
+    EXPECT_GT(storage.getTotalTransitionCount(), 0ul);
+    std::cout << "CompactStorage: " << storage.getAllocatedBytes() / (1024 * 1024) << "MB allocated\n";
+}
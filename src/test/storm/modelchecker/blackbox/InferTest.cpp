@@ -105,3 +105,27 @@ TEST(Infer, intervalsCorrect) {
 }
 
 
+
+TEST(Infer, incrementalMatchesFull) {
+    storm::prism::Program program;
+    EXPECT_NO_THROW(program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm"));
+    auto blackboxMDP = std::static_pointer_cast<BlackboxMDP<uint32_t, double>>(std::make_shared<BlackboxWrapperOnWhitebox<uint32_t, double>>(program));
+    Simulator<uint32_t, double> simulator(blackboxMDP, std::static_pointer_cast<heuristicSim::HeuristicSim<uint32_t, double>>(std::make_shared<heuristicSim::NaiveHeuristicSim<uint32_t, double>>(blackboxMDP)));
+
+    HoeffDingBound<double> boundfunc;
+    UniformDelta<uint32_t> delta;
+    IncrementalInfer<uint32_t, double, uint32_t> incrementalInfer(boundfunc, delta, 0.01, 0.01, false, blackboxMDP);
+
+    EMdp<uint32_t> eMDP;
+    for (int round = 0; round < 10; round++) {
+        simulator.simulate(eMDP, 5);
+        auto const& bMDP = incrementalInfer.infer(eMDP);
+        auto expected = infer(eMDP, boundfunc, delta, 0.01, 0.01, false, blackboxMDP);
+        ASSERT_EQ(expected.getTransitionMatrix(), bMDP.getTransitionMatrix());
+        ASSERT_EQ(expected.getStates("done"), bMDP.getStates("done"));
+    }
+
+    // nothing has to be recomputed without new samples
+    incrementalInfer.infer(eMDP);
+    EXPECT_EQ(0ul, incrementalInfer.getNumberOfRecomputedPairs());
+}
@@ -30,3 +30,46 @@ TEST(Simulator, simulateSimplePath) {
         ASSERT_EQ(eMDP.getSampleCount(i, flipAction), 1);
     }
 }
+
+TEST(Simulator, simulateParallelReproducible) {
+    typedef storm::modelchecker::blackbox::BlackboxMDP<uint32_t, double> BlackboxMDP;
+    typedef storm::modelchecker::blackbox::heuristicSim::HeuristicSim<uint32_t, double> HeuristicSim;
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin_flips.nm");
+
+    auto simulateWithWorkers = [&program](storm::modelchecker::blackbox::EMdp<uint32_t>& eMDP) {
+        std::seed_seq seed({0});
+        auto blackboxMDP = std::static_pointer_cast<BlackboxMDP>(std::make_shared<storm::modelchecker::blackbox::BlackboxWrapperOnWhitebox<uint32_t, double>>(program));
+        auto heuristic = std::static_pointer_cast<HeuristicSim>(std::make_shared<storm::modelchecker::blackbox::heuristicSim::NaiveHeuristicSim<uint32_t, double>>(blackboxMDP, seed));
+        storm::modelchecker::blackbox::Simulator<uint32_t, double> simulator(blackboxMDP, heuristic);
+        for (uint32_t w = 0; w < 3; w++) {
+            std::seed_seq wrapperSeed({2 * w + 1});
+            std::seed_seq heuristicSeed({2 * w + 2});
+            auto workerMDP = std::static_pointer_cast<BlackboxMDP>(std::make_shared<storm::modelchecker::blackbox::BlackboxWrapperOnWhitebox<uint32_t, double>>(program, wrapperSeed));
+            simulator.addWorker(workerMDP, std::make_shared<storm::modelchecker::blackbox::heuristicSim::NaiveHeuristicSim<uint32_t, double>>(workerMDP, heuristicSeed));
+        }
+        simulator.simulate(eMDP, 10);
+        simulator.simulate(eMDP, 20);
+    };
+
+    storm::modelchecker::blackbox::EMdp<uint32_t> eMDP1;
+    storm::modelchecker::blackbox::EMdp<uint32_t> eMDP2;
+    simulateWithWorkers(eMDP1);
+    simulateWithWorkers(eMDP2);
+
+    ASSERT_EQ(0u, eMDP1.getInitialState());
+    ASSERT_EQ(eMDP1.getTotalStateCount(), eMDP2.getTotalStateCount());
+    ASSERT_EQ(eMDP1.getTotalTransitionCount(), eMDP2.getTotalTransitionCount());
+    for (uint32_t state = 0; state < eMDP1.getTotalStateCount(); state++) {
+        ASSERT_TRUE(eMDP1.isStateKnown(state));
+        EXPECT_EQ(eMDP1.getStateLabels(state), eMDP2.getStateLabels(state));
+        for (auto actionItr = eMDP1.getStateActionsItr(state); actionItr.hasNext();) {
+            auto action = actionItr.next();
+            EXPECT_EQ(eMDP1.getSampleCount(state, action), eMDP2.getSampleCount(state, action));
+            EXPECT_EQ(eMDP1.getActionLabels(state, action), eMDP2.getActionLabels(state, action));
+            for (auto succItr = eMDP1.getStateActionsSuccItr(state, action); succItr.hasNext();) {
+                auto succ = succItr.next();
+                EXPECT_EQ(eMDP1.getSampleCount(state, action, succ), eMDP2.getSampleCount(state, action, succ));
+            }
+        }
+    }
+}
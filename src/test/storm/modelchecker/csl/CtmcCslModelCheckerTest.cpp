@@ -11,6 +11,7 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
@@ -26,6 +27,11 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/Stopwatch.h"
+
+#include <iostream>
+#include <limits>
+#include <string>
 
 namespace {
 
@@ -115,6 +121,24 @@ class SparseNativeSorEnvironment {
     }
 };
 
+class SparseKrylovEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const CtmcEngine engine = CtmcEngine::PrismSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Ctmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+        env.solver().gmmxx().setMethod(storm::solver::GmmxxLinearEquationSolverMethod::Gmres);
+        env.solver().gmmxx().setPreconditioner(storm::solver::GmmxxLinearEquationSolverPreconditioner::Ilu);
+        env.solver().gmmxx().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Krylov);
+        return env;
+    }
+};
+
 class HybridCuddGmmxxGmresEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
@@ -281,7 +305,8 @@ class CtmcCslModelCheckerTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, JaniSparseGmmxxGmresIluEnvironment, SparseEigenDGmresEnvironment, SparseEigenDoubleLUEnvironment,
-                         SparseNativeSorEnvironment, HybridCuddGmmxxGmresEnvironment, JaniHybridCuddGmmxxGmresEnvironment, HybridSylvanGmmxxGmresEnvironment>
+                         SparseNativeSorEnvironment, SparseKrylovEnvironment, HybridCuddGmmxxGmresEnvironment, JaniHybridCuddGmmxxGmresEnvironment,
+                         HybridSylvanGmmxxGmresEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(CtmcCslModelCheckerTest, TestingTypes, );
@@ -437,6 +462,102 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, BoundedUntilProbabilitiesForTimeBounds) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [ F<=100 !\"minimum\"]", program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    storm::storage::BitVector phiStates(ctmc->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = ~ctmc->getStates("minimum");
+    uint64_t initialState = *ctmc->getInitialStates().begin();
+
+    storm::Environment env;
+    env.solver().timeBounded().setRelativeTerminationCriterion(false);
+    std::vector<double> timeBounds = {0.0, 10.0, 100.0, 2000.0};
+    auto results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+        env, ctmc->getTransitionMatrix(), ctmc->getBackwardTransitions(), phiStates, psiStates, ctmc->getExitRateVector(), timeBounds);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    EXPECT_NEAR(5.5461254704419085E-5, results[2][initialState], 1e-6);
+
+    // The results coincide with the ones for the individual time bounds (computed without steady-state detection).
+    storm::Environment envWithoutSteadyState = env;
+    envWithoutSteadyState.solver().timeBounded().setSteadyStateDetection(false);
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            envWithoutSteadyState, storm::solver::SolveGoal<double>(), ctmc->getTransitionMatrix(), ctmc->getBackwardTransitions(), phiStates, psiStates,
+            ctmc->getExitRateVector(), false, 0.0, timeBounds[timeBoundIndex]);
+        for (uint64_t state = 0; state < ctmc->getNumberOfStates(); ++state) {
+            EXPECT_NEAR(result[state], results[timeBoundIndex][state], 1e-6);
+        }
+    }
+}
+
+TEST(CtmcCslModelCheckerTest, BoundedUntilProbabilitiesForTimeBoundsInChecker) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    // The first three formulas share their subformulas, the last two are checked individually.
+    std::string formulasString = "P=? [ F<=10 !\"minimum\"]; P=? [ F<=100 !\"minimum\"]; P=? [ F<=2000 !\"minimum\"]";
+    formulasString += "; P=? [ F[3,7] !\"minimum\"]; P=? [ F<=100 \"premium\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    uint64_t initialState = *ctmc->getInitialStates().begin();
+
+    storm::Environment env;
+    env.solver().timeBounded().setRelativeTerminationCriterion(false);
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
+    std::vector<storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, double>> checkTasks;
+    for (auto const& formula : formulas) {
+        checkTasks.emplace_back(formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+    }
+    auto results = checker.computeBoundedUntilProbabilitiesForTimeBounds(env, checkTasks);
+    ASSERT_EQ(formulas.size(), results.size());
+    EXPECT_NEAR(5.5461254704419085E-5, results[1]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+
+    // The results coincide with the ones obtained by checking the formulas one by one.
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formulas[formulaIndex]);
+        for (uint64_t state = 0; state < ctmc->getNumberOfStates(); ++state) {
+            EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[state], results[formulaIndex]->asExplicitQuantitativeCheckResult<double>()[state],
+                        1e-6);
+        }
+    }
+}
+
+TEST(CtmcCslModelCheckerTest, DISABLED_BoundedUntilProbabilitiesForTimeBoundsBenchmark) {
+    // Run with: bin/test-modelchecker-csl --gtest_filter=CtmcCslModelCheckerTest.DISABLED_BoundedUntilProbabilitiesForTimeBoundsBenchmark
+    // --gtest_also_run_disabled_tests
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    std::string formulasString;
+    for (uint64_t timeBound = 100; timeBound <= 5000; timeBound += 100) {
+        formulasString += "P=? [ F<=" + std::to_string(timeBound) + " !\"minimum\"];";
+    }
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+
+    storm::Environment env;
+    env.solver().timeBounded().setRelativeTerminationCriterion(false);
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
+    std::vector<storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, double>> checkTasks;
+    for (auto const& formula : formulas) {
+        checkTasks.emplace_back(formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+    }
+
+    uint64_t individualTime = std::numeric_limits<uint64_t>::max();
+    uint64_t combinedTime = std::numeric_limits<uint64_t>::max();
+    for (uint64_t run = 0; run < 5; ++run) {
+        storm::utility::Stopwatch individualWatch(true);
+        for (auto const& checkTask : checkTasks) {
+            checker.computeBoundedUntilProbabilities(env, checkTask);
+        }
+        individualWatch.stop();
+        individualTime = std::min<uint64_t>(individualTime, individualWatch.getTimeInMilliseconds());
+
+        storm::utility::Stopwatch combinedWatch(true);
+        checker.computeBoundedUntilProbabilitiesForTimeBounds(env, checkTasks);
+        combinedWatch.stop();
+        combinedTime = std::min<uint64_t>(combinedTime, combinedWatch.getTimeInMilliseconds());
+    }
+    std::cout << checkTasks.size() << " time bounds: individually " << individualTime << "ms, in a single pass " << combinedTime << "ms\n";
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
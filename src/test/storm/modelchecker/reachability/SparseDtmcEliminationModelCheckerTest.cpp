@@ -9,8 +9,16 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/Stopwatch.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
 
 TEST(SparseDtmcEliminationModelCheckerTest, Die) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
@@ -139,3 +147,152 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+namespace {
+
+class SparseDtmcEliminationModelCheckerParallelTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#ifndef STORM_HAVE_INTELTBB
+        GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+        // Use small SCCs to obtain many independent sub-SCCs that can be treated in parallel.
+        auto& settings = storm::settings::mutableEliminationSettings();
+        settings.setEliminationMethod(storm::settings::modules::EliminationSettings::EliminationMethod::Hybrid);
+        settings.setMaximalSccSize(5);
+    }
+
+    void TearDown() override {
+        storm::settings::mutableEliminationSettings().restoreDefaults();
+    }
+};
+
+/*!
+ * Builds a DTMC in which the initial state leads to the given number of clusters, each of which is a bidirectional ring of the given size. Every
+ * state of a cluster leaves to one of the two absorbing states labeled "target" and "sink" with a small probability.
+ */
+std::shared_ptr<storm::models::sparse::Dtmc<double>> buildClusterDtmc(uint64_t numberOfClusters, uint64_t clusterSize) {
+    uint64_t const numberOfStates = 3 + numberOfClusters * clusterSize;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    for (uint64_t cluster = 0; cluster < numberOfClusters; ++cluster) {
+        builder.addNextValue(0, 3 + cluster * clusterSize, 1.0 / numberOfClusters);
+    }
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(2, 2, 1.0);
+    for (uint64_t cluster = 0; cluster < numberOfClusters; ++cluster) {
+        uint64_t const offset = 3 + cluster * clusterSize;
+        for (uint64_t state = 0; state < clusterSize; ++state) {
+            // The exit probabilities differ among the states, so the clusters do not all have the same value.
+            double const targetProbability = 0.01 + 0.04 * ((state + cluster) % 7) / 6.0;
+            std::vector<std::pair<uint64_t, double>> successors = {{1, targetProbability},
+                                                                   {2, 0.05},
+                                                                   {offset + (state + 1) % clusterSize, 0.6},
+                                                                   {offset + (state + clusterSize - 1) % clusterSize, 0.35 - targetProbability}};
+            std::sort(successors.begin(), successors.end());
+            for (auto const& successor : successors) {
+                builder.addNextValue(offset + state, successor.first, successor.second);
+            }
+        }
+    }
+
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("target");
+    labeling.addLabelToState("target", 1);
+    return std::make_shared<storm::models::sparse::Dtmc<double>>(builder.build(), std::move(labeling));
+}
+
+}  // namespace
+
+TEST_F(SparseDtmcEliminationModelCheckerParallelTest, Crowds) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    storm::settings::mutableEliminationSettings().setNumberOfThreads(1);
+    std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = checker.check(*formula);
+    storm::settings::mutableEliminationSettings().setNumberOfThreads(4);
+    std::unique_ptr<storm::modelchecker::CheckResult> parallelResult = checker.check(*formula);
+
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& sequentialValues = sequentialResult->asExplicitQuantitativeCheckResult<double>();
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& parallelValues = parallelResult->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(0.3328800375801578281, sequentialValues[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    for (uint64_t state = 0; state < dtmc->getNumberOfStates(); ++state) {
+        EXPECT_DOUBLE_EQ(sequentialValues[state], parallelValues[state]);
+    }
+}
+
+TEST_F(SparseDtmcEliminationModelCheckerParallelTest, ParametricCrowds) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::parser::FormulaParser formulaParser(program);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>> checker(*dtmc);
+
+    storm::settings::mutableEliminationSettings().setNumberOfThreads(1);
+    std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult =
+        checker.check(storm::modelchecker::CheckTask<storm::logic::Formula>(*formula).setOnlyInitialStatesRelevant(true));
+    storm::settings::mutableEliminationSettings().setNumberOfThreads(4);
+    std::unique_ptr<storm::modelchecker::CheckResult> parallelResult =
+        checker.check(storm::modelchecker::CheckTask<storm::logic::Formula>(*formula).setOnlyInitialStatesRelevant(true));
+
+    // The functions may be represented differently, so we compare their values for some instantiations.
+    uint64_t const initialState = *dtmc->getInitialStates().begin();
+    storm::RationalFunction const& sequentialFunction = sequentialResult->asExplicitQuantitativeCheckResult<storm::RationalFunction>()[initialState];
+    storm::RationalFunction const& parallelFunction = parallelResult->asExplicitQuantitativeCheckResult<storm::RationalFunction>()[initialState];
+    std::set<storm::RationalFunctionVariable> variables = storm::models::sparse::getProbabilityParameters(*dtmc);
+    ASSERT_EQ(2ull, variables.size());
+    for (std::string const& value : {"1/10", "1/2", "4/5"}) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> instantiation;
+        for (auto const& variable : variables) {
+            instantiation.emplace(variable, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+        }
+        EXPECT_EQ(sequentialFunction.evaluate(instantiation), parallelFunction.evaluate(instantiation));
+    }
+}
+
+TEST_F(SparseDtmcEliminationModelCheckerParallelTest, DISABLED_Benchmark) {
+    // Run with: bin/test-modelchecker-reachability --gtest_filter=SparseDtmcEliminationModelCheckerParallelTest.DISABLED_Benchmark
+    // --gtest_also_run_disabled_tests
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = buildClusterDtmc(256, 2000);
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"target\"]");
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    // The clusters are eliminated directly, so the independent SCCs are the clusters on the first level of the SCC hierarchy.
+    storm::settings::mutableEliminationSettings().setMaximalSccSize(10000);
+    uint64_t sequentialTime = 0;
+    double sequentialValue = 0.0;
+    for (uint64_t numberOfThreads : {1, 2, 4, 8}) {
+        storm::settings::mutableEliminationSettings().setNumberOfThreads(numberOfThreads);
+        uint64_t fastestTime = std::numeric_limits<uint64_t>::max();
+        double value = 0.0;
+        for (uint64_t run = 0; run < 3; ++run) {
+            storm::utility::Stopwatch stopwatch(true);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formula);
+            stopwatch.stop();
+            fastestTime = std::min<uint64_t>(fastestTime, stopwatch.getTimeInMilliseconds());
+            value = result->asExplicitQuantitativeCheckResult<double>()[0];
+        }
+        if (numberOfThreads == 1) {
+            sequentialTime = fastestTime;
+            sequentialValue = value;
+        }
+        EXPECT_NEAR(sequentialValue, value, 1e-10);
+        std::cout << numberOfThreads << " threads: " << fastestTime << "ms (speedup "
+                  << static_cast<double>(sequentialTime) / static_cast<double>(std::max<uint64_t>(1, fastestTime)) << ")\n";
+    }
+}
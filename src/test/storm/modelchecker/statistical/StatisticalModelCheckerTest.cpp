@@ -0,0 +1,112 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/statistical/StatisticalModelChecker.h"
+#include "storm/modelchecker/statistical/StatisticalModelCheckingMethod.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+typedef storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> StatisticalModelChecker;
+
+class StatisticalModelCheckerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        env.modelchecker().statistical().setSeed(42);
+    }
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> parseFormulas(std::string const& formulasString) const {
+        return storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    }
+
+    double checkQuantitative(StatisticalModelChecker& checker, storm::logic::Formula const& formula, uint64_t state = 0) const {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(formula, true));
+        return result->asExplicitQuantitativeCheckResult<double>()[state];
+    }
+
+    bool checkQualitative(StatisticalModelChecker& checker, storm::logic::Formula const& formula) const {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(formula, true));
+        return result->asExplicitQualitativeCheckResult()[0];
+    }
+
+    storm::prism::Program program;
+    storm::Environment env;
+};
+
+TEST_F(StatisticalModelCheckerTest, ProgramProbabilities) {
+    auto formulas = parseFormulas("P=? [F \"one\"]; P=? [F<=3 \"done\"]; P=? [X s=1]; P=? [s<3 U s=7]");
+    StatisticalModelChecker checker(program);
+    double const precision = env.modelchecker().statistical().getPrecision();
+
+    EXPECT_NEAR(1.0 / 6.0, checkQuantitative(checker, *formulas[0]), precision);
+    EXPECT_NEAR(0.75, checkQuantitative(checker, *formulas[1]), precision);
+    EXPECT_NEAR(0.5, checkQuantitative(checker, *formulas[2]), precision);
+    EXPECT_NEAR(0.0, checkQuantitative(checker, *formulas[3]), precision);
+
+    env.modelchecker().statistical().setMethod(storm::modelchecker::statistical::StatisticalMethod::ClopperPearson);
+    EXPECT_NEAR(1.0 / 6.0, checkQuantitative(checker, *formulas[0]), precision);
+    EXPECT_NEAR(0.75, checkQuantitative(checker, *formulas[1]), precision);
+}
+
+TEST_F(StatisticalModelCheckerTest, ProgramRewards) {
+    auto formulas = parseFormulas("R{\"coin_flips\"}=? [F \"done\"]; R{\"coin_flips\"}=? [C<=2]; R{\"coin_flips\"}=? [C<=100]");
+    StatisticalModelChecker checker(program);
+    env.modelchecker().statistical().setPrecision(0.05);
+
+    EXPECT_NEAR(11.0 / 3.0, checkQuantitative(checker, *formulas[0]), 0.05);
+    EXPECT_NEAR(2.0, checkQuantitative(checker, *formulas[1]), 0.05);
+    EXPECT_NEAR(11.0 / 3.0, checkQuantitative(checker, *formulas[2]), 0.05);
+}
+
+TEST_F(StatisticalModelCheckerTest, ProgramSequentialProbabilityRatioTest) {
+    auto formulas = parseFormulas("P>=0.1 [F \"one\"]; P<0.1 [F \"one\"]; P>0.25 [F \"one\"]; P<=0.25 [F \"one\"]");
+    StatisticalModelChecker checker(program);
+    env.modelchecker().statistical().setMethod(storm::modelchecker::statistical::StatisticalMethod::Sprt);
+
+    EXPECT_TRUE(checkQualitative(checker, *formulas[0]));
+    EXPECT_FALSE(checkQualitative(checker, *formulas[1]));
+    EXPECT_FALSE(checkQualitative(checker, *formulas[2]));
+    EXPECT_TRUE(checkQualitative(checker, *formulas[3]));
+}
+
+TEST_F(StatisticalModelCheckerTest, SparseModel) {
+    auto formulas = parseFormulas("P=? [F \"one\"]; P=? [F<=3 \"done\"]; R{\"coin_flips\"}=? [F \"done\"]");
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+    uint64_t const initialState = *model->getInitialStates().begin();
+    StatisticalModelChecker checker(*model);
+    double const precision = env.modelchecker().statistical().getPrecision();
+
+    EXPECT_NEAR(1.0 / 6.0, checkQuantitative(checker, *formulas[0], initialState), precision);
+    EXPECT_NEAR(0.75, checkQuantitative(checker, *formulas[1], initialState), precision);
+    env.modelchecker().statistical().setPrecision(0.05);
+    EXPECT_NEAR(11.0 / 3.0, checkQuantitative(checker, *formulas[2], initialState), 0.05);
+}
+
+TEST_F(StatisticalModelCheckerTest, IndependentOfNumberOfThreads) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    auto formulas = parseFormulas("P=? [F \"one\"]");
+    StatisticalModelChecker checker(program);
+
+    env.modelchecker().statistical().setNumberOfThreads(1);
+    double const sequentialResult = checkQuantitative(checker, *formulas[0]);
+    env.modelchecker().statistical().setNumberOfThreads(4);
+    double const parallelResult = checkQuantitative(checker, *formulas[0]);
+    // Every path uses its own random number stream, so the same paths are sampled.
+    EXPECT_EQ(sequentialResult, parallelResult);
+}
+
+}  // namespace
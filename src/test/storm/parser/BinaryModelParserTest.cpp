@@ -0,0 +1,181 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::Model<double>> exportAndReload(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm-binary-model-parser-test.drb").string();
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::binaryExportSparseModel(stream, model);
+    }
+    auto result = storm::parser::BinaryModelParser::parseModel(filename);
+    std::filesystem::remove(filename);
+    return result;
+}
+
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    ASSERT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+    EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+    EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasTransitionRewards(), actualRewardModel.hasTransitionRewards());
+        if (rewardModel.second.hasTransitionRewards()) {
+            EXPECT_TRUE(rewardModel.second.getTransitionRewardMatrix() == actualRewardModel.getTransitionRewardMatrix());
+        }
+    }
+    ASSERT_EQ(expected.hasStateValuations(), actual.hasStateValuations());
+    if (expected.hasStateValuations()) {
+        for (uint64_t state = 0; state < expected.getNumberOfStates(); ++state) {
+            EXPECT_EQ(expected.getStateValuations().getStateInfo(state), actual.getStateValuations().getStateInfo(state));
+        }
+    }
+}
+
+/*!
+ * Exports a DTMC with three states, where state 0 moves to states 1 and 2 which are absorbing, and returns the content of the file. The offset of the
+ * header of the first section (the transition matrix) is stored in the given variable.
+ */
+std::string exportSmallDtmc(uint64_t& matrixSectionOffset) {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(2, 2, 1.0);
+    storm::models::sparse::StateLabeling labeling(3);
+    labeling.addLabel("init", storm::storage::BitVector(3, std::vector<uint_fast64_t>{0}));
+    auto model = std::make_shared<storm::models::sparse::Dtmc<double>>(builder.build(), std::move(labeling));
+
+    std::stringstream stream;
+    storm::exporter::binaryExportSparseModel(stream, model);
+    // The header consists of the magic number, the version and value type, the model type "DTMC" (padded to 8 bytes) and the numbers of states and
+    // choices.
+    matrixSectionOffset = 8 + 8 + (8 + 8) + 8 + 8;
+    return stream.str();
+}
+
+template<typename T>
+void overwrite(std::string& content, uint64_t offset, T value) {
+    ASSERT_LE(offset + sizeof(T), content.size());
+    std::memcpy(&content[offset], &value, sizeof(T));
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> parseContent(std::string const& content) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm-binary-model-parser-test-content.drb").string();
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        stream << content;
+    }
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    try {
+        result = storm::parser::BinaryModelParser::parseModel(filename);
+    } catch (...) {
+        std::filesystem::remove(filename);
+        throw;
+    }
+    std::filesystem::remove(filename);
+    return result;
+}
+
+}  // namespace
+
+TEST(BinaryModelParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto loaded = exportAndReload(model);
+    expectEqualModels(*model, *loaded);
+}
+
+TEST(BinaryModelParserTest, MdpRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    auto loaded = exportAndReload(model);
+    expectEqualModels(*model, *loaded);
+    EXPECT_TRUE(loaded->getRewardModel("coinflips").hasStateActionRewards());
+}
+
+TEST(BinaryModelParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto loaded = exportAndReload(model);
+    expectEqualModels(*model, *loaded);
+    auto const& expectedRates = model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+    auto const& actualRates = loaded->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+    EXPECT_EQ(expectedRates, actualRates);
+}
+
+TEST(BinaryModelParserTest, MarkovAutomatonRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto loaded = exportAndReload(model);
+    expectEqualModels(*model, *loaded);
+    auto ma = loaded->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(model->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates(), ma->getMarkovianStates());
+    EXPECT_EQ(5, ma->getMaximalExitRate());
+}
+
+TEST(BinaryModelParserTest, WrongFormat) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm-binary-model-parser-test-wrong.drb").string();
+    {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        stream << "This is not a binary model file.";
+    }
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+    std::filesystem::remove(filename);
+}
+
+TEST(BinaryModelParserTest, SectionHeader) {
+    uint64_t matrixSectionOffset;
+    std::string content = exportSmallDtmc(matrixSectionOffset);
+    auto model = parseContent(content);
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(4ul, model->getNumberOfTransitions());
+
+    // The kind of the section occupies 32 bits, the remaining 32 bits are reserved and ignored.
+    EXPECT_EQ(static_cast<uint32_t>(storm::exporter::binary::SectionKind::TransitionMatrix),
+              *reinterpret_cast<uint32_t const*>(content.data() + matrixSectionOffset));
+    overwrite<uint32_t>(content, matrixSectionOffset + 4, 42);
+    model = parseContent(content);
+    EXPECT_EQ(4ul, model->getNumberOfTransitions());
+
+    // A section must not exceed the end of the file.
+    overwrite<uint64_t>(content, matrixSectionOffset + 8, content.size());
+    STORM_SILENT_EXPECT_THROW(parseContent(content), storm::exceptions::WrongFormatException);
+    overwrite<uint64_t>(content, matrixSectionOffset + 8, std::numeric_limits<uint64_t>::max());
+    STORM_SILENT_EXPECT_THROW(parseContent(content), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryModelParserTest, NonMonotoneRowIndications) {
+    uint64_t matrixSectionOffset;
+    std::string content = exportSmallDtmc(matrixSectionOffset);
+    // The section header is followed by the numbers of rows, columns, entries and row groups and the row indications 0, 2, 3 and 4.
+    uint64_t const rowIndicationsOffset = matrixSectionOffset + 16 + 4 * 8;
+    EXPECT_EQ(2ul, *reinterpret_cast<uint64_t const*>(content.data() + rowIndicationsOffset + 8));
+    overwrite<uint64_t>(content, rowIndicationsOffset + 8, 4);
+    STORM_SILENT_EXPECT_THROW(parseContent(content), storm::exceptions::WrongFormatException);
+}
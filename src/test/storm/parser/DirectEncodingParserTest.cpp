@@ -1,11 +1,50 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <filesystem>
+#include <fstream>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/DirectEncodingExporter.h"
+#include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+namespace {
+
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual,
+                       std::string const& description) {
+    ASSERT_EQ(expected.getType(), actual.getType()) << description;
+    EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix()) << description;
+    EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling()) << description;
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels()) << description;
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first)) << description;
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards()) << description;
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector()) << description;
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards()) << description;
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector()) << description;
+        }
+    }
+    if (expected.getType() == storm::models::ModelType::Ctmc) {
+        EXPECT_EQ(expected.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+                  actual.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector())
+            << description;
+    } else if (expected.getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto const& expectedMa = *expected.as<storm::models::sparse::MarkovAutomaton<double>>();
+        auto const& actualMa = *actual.as<storm::models::sparse::MarkovAutomaton<double>>();
+        EXPECT_EQ(expectedMa.getMarkovianStates(), actualMa.getMarkovianStates()) << description;
+        EXPECT_EQ(expectedMa.getExitRates(), actualMa.getExitRates()) << description;
+    }
+}
+
+}  // namespace
+
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
         storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
@@ -87,3 +126,67 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    // With small chunks, every file is split into as many chunks as possible, which are stitched together afterwards. The reference is the sequential
+    // parser, which parses the states as a single chunk.
+    storm::parser::DirectEncodingParserOptions parallelOptions;
+    parallelOptions.numberOfThreads = 4;
+    parallelOptions.minimalChunkSize = 64;
+    for (std::string file :
+         {"/dtmc/crowds-5-5.drn", "/mdp/two_dice.drn", "/ctmc/cluster2.drn", "/ma/jobscheduler.drn", "/ma/chain_elimination1.drn"}) {
+        std::shared_ptr<storm::models::sparse::Model<double>> sequential =
+            storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR + file);
+        std::shared_ptr<storm::models::sparse::Model<double>> parallel =
+            storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR + file, parallelOptions);
+        expectEqualModels(*sequential, *parallel, file);
+    }
+}
+
+TEST(DirectEncodingParserTest, ParallelParsingExportedMdp) {
+    // An MDP with 2000 states, two choices per state, state-action rewards and labels, whose probabilities are exactly representable in the DRN file.
+    uint64_t const numberOfStates = 2000;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    std::vector<double> stateActionRewards;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(2 * state);
+        uint64_t const first = (state + 1) % numberOfStates;
+        uint64_t const second = (state * 7 + 3) % numberOfStates;
+        if (first == second) {
+            builder.addNextValue(2 * state, first, 1.0);
+        } else {
+            builder.addNextValue(2 * state, std::min(first, second), 0.5);
+            builder.addNextValue(2 * state, std::max(first, second), 0.5);
+        }
+        uint64_t const third = (state + 2) % numberOfStates;
+        builder.addNextValue(2 * state + 1, std::min(state, third), state < third ? 0.25 : 0.75);
+        builder.addNextValue(2 * state + 1, std::max(state, third), state < third ? 0.75 : 0.25);
+        stateActionRewards.push_back(static_cast<double>(state % 3));
+        stateActionRewards.push_back(1.0);
+    }
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init", storm::storage::BitVector(numberOfStates, std::vector<uint_fast64_t>{0}));
+    storm::storage::BitVector evenStates(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; state += 2) {
+        evenStates.set(state);
+    }
+    labeling.addLabel("even", std::move(evenStates));
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("steps", storm::models::sparse::StandardRewardModel<double>(std::nullopt, std::move(stateActionRewards)));
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        std::make_shared<storm::models::sparse::Mdp<double>>(builder.build(), std::move(labeling), std::move(rewardModels));
+
+    std::string filename = (std::filesystem::temp_directory_path() / "storm-direct-encoding-parser-test.drn").string();
+    {
+        std::ofstream stream(filename);
+        storm::exporter::explicitExportSparseModel(stream, model, {});
+    }
+    storm::parser::DirectEncodingParserOptions parallelOptions;
+    parallelOptions.numberOfThreads = 4;
+    parallelOptions.minimalChunkSize = 1024;
+    std::shared_ptr<storm::models::sparse::Model<double>> sequential = storm::parser::DirectEncodingParser<double>::parseModel(filename);
+    std::shared_ptr<storm::models::sparse::Model<double>> parallel = storm::parser::DirectEncodingParser<double>::parseModel(filename, parallelOptions);
+    std::filesystem::remove(filename);
+    expectEqualModels(*model, *sequential, "sequential");
+    expectEqualModels(*model, *parallel, "parallel");
+}
@@ -0,0 +1,119 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/solver/helper/KrylovExponentialHelper.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace {
+
+/*!
+ * Builds the uniformized matrix I + R/q - diag(E)/q of the CTMC with the given rates, where E are the exit rates. The rates of every state need to
+ * be sorted by their target state and must not contain self-loops.
+ */
+storm::storage::SparseMatrix<double> buildUniformizedMatrix(std::vector<std::vector<std::pair<uint64_t, double>>> const& rates, double uniformizationRate) {
+    storm::storage::SparseMatrixBuilder<double> builder(rates.size(), rates.size());
+    for (uint64_t state = 0; state < rates.size(); ++state) {
+        double exitRate = 0.0;
+        for (auto const& successor : rates[state]) {
+            exitRate += successor.second;
+        }
+        bool diagonalAdded = false;
+        for (auto const& successor : rates[state]) {
+            if (!diagonalAdded && successor.first > state) {
+                builder.addNextValue(state, state, 1.0 - exitRate / uniformizationRate);
+                diagonalAdded = true;
+            }
+            builder.addNextValue(state, successor.first, successor.second / uniformizationRate);
+        }
+        if (!diagonalAdded) {
+            builder.addNextValue(state, state, 1.0 - exitRate / uniformizationRate);
+        }
+    }
+    return builder.build();
+}
+
+TEST(KrylovExponentialHelperTest, TwoStates) {
+    // For the CTMC with rate a from state 0 to 1 and rate b back, the probability to be in state 0 at time t is b/(a+b) + a/(a+b)*exp(-(a+b)*t)
+    // when starting in state 0 and b/(a+b) - b/(a+b)*exp(-(a+b)*t) when starting in state 1.
+    double const a = 3.0;
+    double const b = 0.5;
+    double const uniformizationRate = 1.02 * a;
+    auto const uniformizedMatrix = buildUniformizedMatrix({{{1, a}}, {{0, b}}}, uniformizationRate);
+
+    storm::Environment env;
+    storm::solver::helper::KrylovExponentialHelper<double> krylovHelper(env, uniformizedMatrix, nullptr, uniformizationRate, 30);
+    std::vector<double> const timePoints = {2.0, 0.0, 0.25, 10.0};
+    auto const results = krylovHelper.computeTransientValues(timePoints, {1.0, 0.0}, 1e-10);
+    ASSERT_EQ(timePoints.size(), results.size());
+    for (uint64_t index = 0; index < timePoints.size(); ++index) {
+        double const decay = std::exp(-(a + b) * timePoints[index]);
+        EXPECT_NEAR(b / (a + b) + a / (a + b) * decay, results[index][0], 1e-8);
+        EXPECT_NEAR(b / (a + b) - b / (a + b) * decay, results[index][1], 1e-8);
+    }
+    EXPECT_LT(0ull, krylovHelper.getNumberOfMultiplications());
+}
+
+TEST(KrylovExponentialHelperTest, DISABLED_StiffBenchmark) {
+    // Run with: bin/test-solver --gtest_filter=KrylovExponentialHelperTest.DISABLED_StiffBenchmark --gtest_also_run_disabled_tests
+    // A random CTMC whose rates span four orders of magnitude. The time bound is chosen such that q*t = 2e6 for the uniformization rate q.
+    uint64_t const numberOfStates = 1000;
+    std::mt19937 randomGenerator(42);
+    std::uniform_int_distribution<uint64_t> stateDistribution(0, numberOfStates - 1);
+    std::uniform_real_distribution<double> exponentDistribution(-2.0, 2.0);
+    std::vector<std::vector<std::pair<uint64_t, double>>> rates(numberOfStates);
+    double maximalExitRate = 0.0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        double exitRate = 0.0;
+        for (uint64_t successor = 0; successor < 4; ++successor) {
+            uint64_t const target = stateDistribution(randomGenerator);
+            if (target != state) {
+                rates[state].emplace_back(target, std::pow(10.0, exponentDistribution(randomGenerator)));
+                exitRate += rates[state].back().second;
+            }
+        }
+        std::sort(rates[state].begin(), rates[state].end());
+        rates[state].erase(std::unique(rates[state].begin(), rates[state].end(), [](auto const& a, auto const& b) { return a.first == b.first; }),
+                           rates[state].end());
+        maximalExitRate = std::max(maximalExitRate, exitRate);
+    }
+    double const uniformizationRate = 1.02 * maximalExitRate;
+    double const timeBound = 2e6 / uniformizationRate;
+    auto const uniformizedMatrix = buildUniformizedMatrix(rates, uniformizationRate);
+    std::vector<double> values(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        values[state] = static_cast<double>(state % 10) / 9.0;
+    }
+
+    storm::Environment env;
+    env.solver().timeBounded().setSteadyStateDetection(false);
+    storm::utility::Stopwatch uniformizationWatch(true);
+    std::vector<double> const reference = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double>(
+        env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, 1e-12);
+    uniformizationWatch.stop();
+
+    storm::utility::Stopwatch krylovWatch(true);
+    storm::solver::helper::KrylovExponentialHelper<double> krylovHelper(env, uniformizedMatrix, nullptr, uniformizationRate, 30);
+    std::vector<double> const result = krylovHelper.computeTransientValues({timeBound}, values, 1e-10).front();
+    krylovWatch.stop();
+
+    double maximalDifference = 0.0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        maximalDifference = std::max(maximalDifference, std::abs(reference[state] - result[state]));
+    }
+    EXPECT_LT(maximalDifference, 1e-8);
+    std::cout << "q*t = 2e6: uniformization " << uniformizationWatch.getTimeInMilliseconds() << "ms (at least 2e6 multiplications), Krylov "
+              << krylovWatch.getTimeInMilliseconds() << "ms (" << krylovHelper.getNumberOfMultiplications()
+              << " multiplications), maximal difference " << maximalDifference << "\n";
+}
+
+}  // namespace
@@ -307,6 +307,22 @@ class TopologicalEigenRationalLUEnvironment {
     }
 };
 
+class TopologicalParallelGmmGmresIluEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+        env.solver().topological().setNumberOfThreads(2);
+        env.solver().gmmxx().setMethod(storm::solver::GmmxxLinearEquationSolverMethod::Gmres);
+        env.solver().gmmxx().setPreconditioner(storm::solver::GmmxxLinearEquationSolverPreconditioner::Ilu);
+        env.solver().gmmxx().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+        return env;
+    }
+};
+
 template<typename TestType>
 class LinearEquationSolverTest : public ::testing::Test {
    public:
@@ -332,7 +348,7 @@ typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultE
                          NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment, GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment,
                          GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment, EigenDGmresDiagonalEnvironment,
                          EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment, EigenRationalLUEnvironment,
-                         TopologicalEigenRationalLUEnvironment>
+                         TopologicalEigenRationalLUEnvironment, TopologicalParallelGmmGmresIluEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LinearEquationSolverTest, TestingTypes, );
@@ -373,4 +389,42 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
+
+TYPED_TEST(LinearEquationSolverTest, solveEquationSystemMultipleSccs) {
+    typedef typename TestFixture::ValueType ValueType;
+    // States 2 and 3 are independent of each other and both are reachable from the SCC {0, 1}.
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("1/2")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("1/4")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 3, this->parseNumber("1/4")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/2")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1/4")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("1/2")));
+    ASSERT_NO_THROW(builder.addNextValue(3, 3, this->parseNumber("1/2")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<ValueType> x(4);
+    std::vector<ValueType> b = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("1/2")};
+
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+    if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+        A.convertToEquationSystem();
+    }
+
+    auto requirements = factory.getRequirements(this->env());
+    requirements.clearUpperBounds();
+    requirements.clearLowerBounds();
+    ASSERT_FALSE(requirements.hasEnabledRequirement());
+    auto solver = factory.create(this->env(), A);
+    solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+    EXPECT_NEAR(x[0], this->parseNumber("4/3"), this->precision());
+    EXPECT_NEAR(x[1], this->parseNumber("7/6"), this->precision());
+    EXPECT_NEAR(x[2], this->parseNumber("2"), this->precision());
+    EXPECT_NEAR(x[3], this->parseNumber("1"), this->precision());
+}
 }  // namespace
\ No newline at end of file
@@ -37,6 +37,19 @@ class DoubleViRegMultEnvironment {
     }
 };
 
+class DoubleViParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setNumberOfThreads(2);
+        return env;
+    }
+};
+
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -63,6 +76,20 @@ class DoubleIntervalIterationEnvironment {
     }
 };
 
+class DoubleSoundViParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::SoundValueIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().minMax().setNumberOfThreads(2);
+        return env;
+    }
+};
+
 class DoubleOptimisticViEnvironment {
    public:
     typedef double ValueType;
@@ -89,6 +116,20 @@ class DoubleTopologicalViEnvironment {
     }
 };
 
+class DoubleTopologicalViParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().topological().setNumberOfThreads(2);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DoubleTopologicalCudaViEnvironment {
    public:
     typedef double ValueType;
@@ -154,9 +195,10 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment,
-                         DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment,
-                         RationalPIEnvironment, RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleViParallelEnvironment, DoubleSoundViEnvironment,
+                         DoubleSoundViParallelEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment,
+                         DoubleTopologicalViParallelEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
+                         RationalRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -188,4 +230,50 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsMultipleSccs) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    // States 2 and 3 are independent of each other and both are reachable from the SCC {0, 1}.
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 3, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(4));
+    ASSERT_NO_THROW(builder.addNextValue(4, 3, this->parseNumber("0.5")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build(5, 4, 4));
+
+    std::vector<ValueType> x(4);
+    std::vector<ValueType> b = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0.25"),
+                                this->parseNumber("0.625")};
+
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+    auto solver = factory.create(this->env(), A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(this->parseNumber("0"), this->parseNumber("2"));
+    storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(this->env());
+    req.clearBounds();
+    ASSERT_FALSE(req.hasEnabledRequirement());
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_NEAR(x[0], this->parseNumber("0.5"), this->precision());
+    EXPECT_NEAR(x[1], this->parseNumber("0.5"), this->precision());
+    EXPECT_NEAR(x[2], this->parseNumber("0.5"), this->precision());
+    EXPECT_NEAR(x[3], this->parseNumber("1.25"), this->precision());
+
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
+    EXPECT_NEAR(x[1], this->parseNumber("0.75"), this->precision());
+    EXPECT_NEAR(x[2], this->parseNumber("0.5"), this->precision());
+    EXPECT_NEAR(x[3], this->parseNumber("1.25"), this->precision());
+}
 }  // namespace
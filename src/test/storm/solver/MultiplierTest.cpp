@@ -1,9 +1,18 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <random>
+
+#include <sys/mman.h>
+
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/multiplier/simd/SimdKernels.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Stopwatch.h"
 
 #include "storm/utility/vector.h"
 namespace {
@@ -30,6 +39,17 @@ class GmmxxEnvironment {
     }
 };
 
+class SimdEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+        return env;
+    }
+};
+
 template<typename TestType>
 class MultiplierTest : public ::testing::Test {
    public:
@@ -49,7 +69,7 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment, SimdEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -123,4 +143,220 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
 }
 
-}  // namespace
\ No newline at end of file
+TYPED_TEST(MultiplierTest, longRowsTest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    // Rows with different lengths to cover both the vectorized part and the remainder of the vectorized kernels.
+    uint64_t const numColumns = 21;
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numColumns; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+            uint64_t const rowLength = (group + choice) % numColumns + 1;
+            for (uint64_t column = 0; column < rowLength; ++column) {
+                builder.addNextValue(row, column, storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(rowLength + choice));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<ValueType> x(numColumns), b(A.getRowCount());
+    for (uint64_t i = 0; i < numColumns; ++i) {
+        x[i] = storm::utility::convertNumber<ValueType>(i + 1) / storm::utility::convertNumber<ValueType>(numColumns);
+    }
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        b[i] = storm::utility::convertNumber<ValueType>(i % 3) / storm::utility::convertNumber<ValueType>(10);
+    }
+
+    std::vector<ValueType> expected(A.getRowCount());
+    A.multiplyWithVector(x, expected, &b);
+    std::vector<ValueType> expectedReduced(A.getRowGroupCount());
+    std::vector<uint64_t> expectedChoices(A.getRowGroupCount(), 0);
+    A.multiplyAndReduce(storm::OptimizationDirection::Maximize, A.getRowGroupIndices(), x, &b, expectedReduced, &expectedChoices);
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+
+    std::vector<ValueType> result(A.getRowCount());
+    ASSERT_NO_THROW(multiplier->multiply(this->env(), x, &b, result));
+    for (uint64_t i = 0; i < result.size(); ++i) {
+        EXPECT_NEAR(expected[i], result[i], this->parseNumber("1e-12")) << "in row " << i;
+    }
+
+    std::vector<ValueType> reduced(A.getRowGroupCount());
+    std::vector<uint64_t> choices(A.getRowGroupCount(), 0);
+    ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), storm::OptimizationDirection::Maximize, x, &b, reduced, &choices));
+    for (uint64_t i = 0; i < reduced.size(); ++i) {
+        EXPECT_NEAR(expectedReduced[i], reduced[i], this->parseNumber("1e-12")) << "in row group " << i;
+        EXPECT_EQ(expectedChoices[i], choices[i]) << "in row group " << i;
+    }
+}
+
+TEST(SimdMultiplierTest, wideColumnsTest) {
+    // The SIMD multiplier only stores column indices with 32 bits if the matrix has at most 2^31 - 1 columns. Actually referencing a larger column would
+    // require an operand vector with more than 2^31 entries, so the wide layout is triggered by overriding the column count of the matrix instead.
+    // Columns that are actually referenced beyond 2^31 are covered by largeColumnIndicesTest.
+    uint64_t const numColumns = 21;
+    uint64_t const wideColumnCount = (1ull << 31) + 1;
+    auto buildMatrix = [&numColumns](uint64_t columnCount) {
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t group = 0; group < numColumns; ++group) {
+            builder.newRowGroup(row);
+            for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+                uint64_t const rowLength = (group + choice) % numColumns + 1;
+                for (uint64_t column = 0; column < rowLength; ++column) {
+                    builder.addNextValue(row, column, 1.0 / static_cast<double>(rowLength + choice));
+                }
+            }
+        }
+        return builder.build(0, columnCount, 0);
+    };
+    auto const compactMatrix = buildMatrix(0);
+    auto const wideMatrix = buildMatrix(wideColumnCount);
+    ASSERT_EQ(wideColumnCount, wideMatrix.getColumnCount());
+
+    std::vector<double> x(numColumns), b(compactMatrix.getRowCount());
+    for (uint64_t i = 0; i < numColumns; ++i) {
+        x[i] = static_cast<double>(i + 1) / static_cast<double>(numColumns);
+    }
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<double>(i % 3) / 10.0;
+    }
+
+    storm::Environment env = SimdEnvironment::createEnvironment();
+    auto factory = storm::solver::MultiplierFactory<double>();
+    auto compactMultiplier = factory.create(env, compactMatrix);
+    auto wideMultiplier = factory.create(env, wideMatrix);
+
+    std::vector<double> compactResult(compactMatrix.getRowCount()), wideResult(wideMatrix.getRowCount());
+    ASSERT_NO_THROW(compactMultiplier->multiply(env, x, &b, compactResult));
+    ASSERT_NO_THROW(wideMultiplier->multiply(env, x, &b, wideResult));
+    EXPECT_EQ(compactResult, wideResult);
+
+    std::vector<double> compactReduced(compactMatrix.getRowGroupCount()), wideReduced(wideMatrix.getRowGroupCount());
+    std::vector<uint64_t> compactChoices(compactMatrix.getRowGroupCount(), 0), wideChoices(wideMatrix.getRowGroupCount(), 0);
+    ASSERT_NO_THROW(compactMultiplier->multiplyAndReduce(env, storm::OptimizationDirection::Minimize, x, &b, compactReduced, &compactChoices));
+    ASSERT_NO_THROW(wideMultiplier->multiplyAndReduce(env, storm::OptimizationDirection::Minimize, x, &b, wideReduced, &wideChoices));
+    EXPECT_EQ(compactReduced, wideReduced);
+    EXPECT_EQ(compactChoices, wideChoices);
+}
+
+TEST(SimdMultiplierTest, largeColumnIndicesTest) {
+    // Columns beyond 2^31 and 2^32 need an operand with more than 2^32 entries. The operand is therefore mapped without reserving memory such that
+    // only the pages of the referenced entries are backed by physical memory.
+    uint64_t const operandSize = (1ull << 32) + 16;
+    void* mapping = mmap(nullptr, operandSize * sizeof(double), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED) {
+        GTEST_SKIP() << "Could not map an operand with " << operandSize << " entries.";
+    }
+    double* x = static_cast<double*>(mapping);
+
+    // The rows are long enough to be processed by the vectorized part of all kernels.
+    std::vector<uint64_t> const columns = {1,           (1ull << 31) - 1, 1ull << 31,       (1ull << 31) + 7, 3ull << 30,       (1ull << 32) - 1,
+                                           1ull << 32,  (1ull << 32) + 5, 2,                (1ull << 31) + 1, (1ull << 32) + 9, (1ull << 32) + 15};
+    std::vector<double> values;
+    for (uint64_t i = 0; i < columns.size(); ++i) {
+        x[columns[i]] = static_cast<double>(i + 1);
+        values.push_back(1.0 / static_cast<double>(i + 2));
+    }
+    std::vector<uint64_t> const rowIndications = {0, 8, 12};
+    std::vector<uint64_t> const rowGroupIndices = {0, 2};
+    storm::solver::simd::SoaMatrixView<uint64_t> const matrix{rowIndications.data(), columns.data(), values.data()};
+
+    std::vector<double> expected(2, 0.0);
+    for (uint64_t row = 0; row < 2; ++row) {
+        for (uint64_t i = rowIndications[row]; i < rowIndications[row + 1]; ++i) {
+            expected[row] += values[i] * static_cast<double>(i + 1);
+        }
+    }
+
+    using storm::solver::simd::SimdKernelType;
+    for (auto const& type : {SimdKernelType::Scalar, SimdKernelType::Avx2, SimdKernelType::Avx512}) {
+        if (type > storm::solver::simd::getSupportedSimdKernelType()) {
+            continue;
+        }
+        std::vector<double> result(2, 0.0);
+        storm::solver::simd::multiplyAdd(type, matrix, 0, 2, x, nullptr, result.data());
+        EXPECT_NEAR(expected[0], result[0], 1e-12) << storm::solver::simd::toString(type);
+        EXPECT_NEAR(expected[1], result[1], 1e-12) << storm::solver::simd::toString(type);
+
+        double reduced = 0.0;
+        uint64_t choice = 0;
+        storm::solver::simd::multiplyAndReduce(type, false, matrix, rowGroupIndices.data(), 0, 1, x, nullptr, &reduced, &choice);
+        EXPECT_NEAR(std::max(expected[0], expected[1]), reduced, 1e-12) << storm::solver::simd::toString(type);
+        EXPECT_EQ(expected[1] > expected[0] ? 1ul : 0ul, choice) << storm::solver::simd::toString(type);
+    }
+    munmap(mapping, operandSize * sizeof(double));
+}
+
+TEST(SimdMultiplierTest, DISABLED_Benchmark) {
+    // Run with: bin/test-solver --gtest_filter=SimdMultiplierTest.DISABLED_Benchmark --gtest_also_run_disabled_tests
+    // The matrix has the size of a large QVBS instance: 1M states with 3 choices and up to 6 (mostly local) successors each, i.e., about 18M entries.
+    uint64_t const numberOfGroups = 1000000;
+    uint64_t const numberOfChoices = 3;
+    uint64_t const numberOfSuccessors = 6;
+    uint64_t const numberOfIterations = 10;
+    uint64_t const numberOfRuns = 5;
+
+    std::mt19937 engine(42);
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfGroups, 0, false, true);
+    std::vector<uint64_t> successors;
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+            successors.clear();
+            for (uint64_t successor = 0; successor < numberOfSuccessors; ++successor) {
+                // Every tenth successor is far away, the others are close to the state.
+                uint64_t const distance = (engine() % 10 == 0) ? engine() : engine() % 1024;
+                successors.push_back((group + distance) % numberOfGroups);
+            }
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            for (auto const& successor : successors) {
+                builder.addNextValue(row, successor, 1.0 / static_cast<double>(successors.size()));
+            }
+        }
+    }
+    auto const matrix = builder.build();
+    std::cout << matrix.getRowCount() << " rows, " << matrix.getEntryCount() << " entries\n";
+
+    std::vector<double> x(numberOfGroups);
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        x[group] = static_cast<double>(engine() % 1000) / 1000.0;
+    }
+    std::vector<double> result(matrix.getRowCount());
+    std::vector<double> reducedResult(numberOfGroups);
+    std::vector<uint64_t> choices(numberOfGroups);
+
+    // Report the fastest of several runs to reduce the influence of noise.
+    for (auto const& type : {storm::solver::MultiplierType::Native, storm::solver::MultiplierType::Simd}) {
+        storm::Environment env;
+        env.solver().multiplier().setType(type);
+        auto multiplier = storm::solver::MultiplierFactory<double>().create(env, matrix);
+        uint64_t fastestMultiply = std::numeric_limits<uint64_t>::max();
+        uint64_t fastestMultiplyAndReduce = std::numeric_limits<uint64_t>::max();
+        for (uint64_t run = 0; run < numberOfRuns; ++run) {
+            storm::utility::Stopwatch multiplyWatch(true);
+            for (uint64_t iteration = 0; iteration < numberOfIterations; ++iteration) {
+                multiplier->multiply(env, x, nullptr, result);
+            }
+            multiplyWatch.stop();
+            fastestMultiply = std::min<uint64_t>(fastestMultiply, multiplyWatch.getTimeInMilliseconds());
+
+            storm::utility::Stopwatch reduceWatch(true);
+            for (uint64_t iteration = 0; iteration < numberOfIterations; ++iteration) {
+                multiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, reducedResult, &choices);
+            }
+            reduceWatch.stop();
+            fastestMultiplyAndReduce = std::min<uint64_t>(fastestMultiplyAndReduce, reduceWatch.getTimeInMilliseconds());
+        }
+        std::cout << (type == storm::solver::MultiplierType::Native ? "native" : "simd") << ": multiply " << fastestMultiply / numberOfIterations
+                  << "ms, multiplyAndReduce (with choices) " << fastestMultiplyAndReduce / numberOfIterations << "ms per iteration\n";
+    }
+}
+
+}  // namespace
@@ -0,0 +1,99 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+using ValueIterationOperator = storm::solver::helper::ValueIterationOperator<double, false>;
+
+/*!
+ * Builds a (discounted) MDP matrix with the given number of row groups, two rows per group and two successors per row.
+ * If a column count is given, the dimensions of the matrix are overridden accordingly.
+ */
+storm::storage::SparseMatrix<double> buildMdpMatrix(uint64_t numberOfGroups, uint64_t columnCount = 0) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+            uint64_t const first = (group * 7919 + choice * 104729) % numberOfGroups;
+            uint64_t const second = (first + 1 + group % 13) % numberOfGroups;
+            builder.addNextValue(row, std::min(first, second), 0.45);
+            if (first != second) {
+                builder.addNextValue(row, std::max(first, second), 0.45);
+            }
+        }
+    }
+    return builder.build(0, columnCount, 0);
+}
+
+std::vector<double> buildOffsets(uint64_t numberOfRows) {
+    std::vector<double> offsets(numberOfRows);
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        offsets[row] = static_cast<double>(row % 17) / 16.0;
+    }
+    return offsets;
+}
+
+std::vector<double> solve(storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& offsets, uint64_t numberOfThreads,
+                          uint64_t chunkSize, storm::solver::MultiplicationStyle mult) {
+    auto viOperator = std::make_shared<ValueIterationOperator>();
+    viOperator->setMatrixBackwards(matrix);
+    viOperator->setNumberOfThreads(numberOfThreads, chunkSize);
+    storm::solver::helper::ValueIterationHelper<double, false> viHelper(viOperator);
+    std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged,
+              viHelper.VI(result, offsets, false, 1e-10, storm::OptimizationDirection::Minimize, {}, mult));
+    return result;
+}
+
+TEST(ValueIterationOperatorTest, ParallelApplyMultipleChunks) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    // With 2000 row groups, the operator stores about 12000 column entries, i.e., the small chunk size yields more than a hundred chunks.
+    auto const matrix = buildMdpMatrix(2000);
+    auto const offsets = buildOffsets(matrix.getRowCount());
+    uint64_t const chunkSize = 64;
+
+    // Without Gauss-Seidel updates, every row is computed from the same values as in the sequential version.
+    auto const sequentialResult = solve(matrix, offsets, 1, chunkSize, storm::solver::MultiplicationStyle::Regular);
+    auto const parallelResult = solve(matrix, offsets, 2, chunkSize, storm::solver::MultiplicationStyle::Regular);
+    EXPECT_EQ(sequentialResult, parallelResult);
+
+    // In place, every chunk reads the values of the other chunks from the previous iteration, so only the fixpoint coincides.
+    auto const gaussSeidelResult = solve(matrix, offsets, 2, chunkSize, storm::solver::MultiplicationStyle::GaussSeidel);
+    ASSERT_EQ(sequentialResult.size(), gaussSeidelResult.size());
+    for (uint64_t group = 0; group < sequentialResult.size(); ++group) {
+        EXPECT_NEAR(sequentialResult[group], gaussSeidelResult[group], 1e-8);
+    }
+}
+
+TEST(ValueIterationOperatorTest, WideColumnIndices) {
+    // Column indices are only stored with 32 bits if the matrix has less than 2^30 columns. Actually referencing a column beyond 2^32 would require
+    // operand vectors with more than 2^32 entries, so the wide layout is triggered by overriding the column count of the matrix instead.
+    uint64_t const wideColumnCount = (1ull << 32) + 1;
+    auto const compactMatrix = buildMdpMatrix(100);
+    auto const wideMatrix = buildMdpMatrix(100, wideColumnCount);
+    ASSERT_EQ(wideColumnCount, wideMatrix.getColumnCount());
+    auto const offsets = buildOffsets(compactMatrix.getRowCount());
+
+    for (auto mult : {storm::solver::MultiplicationStyle::Regular, storm::solver::MultiplicationStyle::GaussSeidel}) {
+        auto const compactResult = solve(compactMatrix, offsets, 1, ValueIterationOperator::DefaultParallelChunkSize, mult);
+        auto const wideResult = solve(wideMatrix, offsets, 1, ValueIterationOperator::DefaultParallelChunkSize, mult);
+        EXPECT_EQ(compactResult, wideResult);
+    }
+#ifdef STORM_HAVE_INTELTBB
+    auto const compactResult = solve(compactMatrix, offsets, 2, 64, storm::solver::MultiplicationStyle::Regular);
+    auto const wideResult = solve(wideMatrix, offsets, 2, 64, storm::solver::MultiplicationStyle::Regular);
+    EXPECT_EQ(compactResult, wideResult);
+#endif
+}
+
+}  // namespace
@@ -0,0 +1,156 @@
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/utility/Stopwatch.h"
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    EXPECT_EQ(std::make_pair(1ul, true), map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    EXPECT_EQ(std::make_pair(2ul, true), map.findOrAdd(second, 2));
+
+    EXPECT_EQ(std::make_pair(1ul, false), map.findOrAdd(first, 3));
+    EXPECT_EQ(std::make_pair(2ul, false), map.findOrAdd(second, 3));
+
+    // Insert enough keys to force several increases of the size.
+    for (uint64_t index = 0; index < 1000; ++index) {
+        storm::storage::BitVector key(64);
+        key.setFromInt(0, 64, index << 20);
+        EXPECT_TRUE(map.findOrAdd(key, index + 10).second);
+    }
+    EXPECT_EQ(1002ul, map.size());
+    EXPECT_GT(map.capacity(), 1002ul);
+
+    EXPECT_EQ(1ul, map.getValue(first));
+    EXPECT_EQ(2ul, map.getValue(second));
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    EXPECT_FALSE(map.contains(third));
+    EXPECT_TRUE(map.contains(first));
+
+    uint64_t numberOfEntries = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(keyValuePair.second, map.getValue(keyValuePair.first));
+        ++numberOfEntries;
+    }
+    EXPECT_EQ(1002ul, numberOfEntries);
+
+    map.releaseRetiredStorage();
+    EXPECT_EQ(1ul, map.findOrAdd(first, 0).first);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    uint64_t const numberOfKeys = 20000;
+    uint64_t const numberOfThreads = 4;
+    std::vector<storm::storage::BitVector> keys;
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, index * 7919);
+        key.setFromInt(64, 64, index);
+        keys.push_back(std::move(key));
+    }
+
+    // All threads insert all keys (in different orders) into a small map such that the size is increased while the threads insert.
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 4);
+    std::atomic<uint32_t> nextValue(0);
+    std::vector<std::vector<uint32_t>> values(numberOfThreads, std::vector<uint32_t>(numberOfKeys));
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (uint64_t step = 0; step < numberOfKeys; ++step) {
+                uint64_t index = (thread % 2 == 0) ? step : numberOfKeys - step - 1;
+                values[thread][index] = map.findOrAdd(keys[index], [&nextValue]() { return nextValue++; }).first;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every key must have been inserted exactly once and all threads must agree on its value.
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_EQ(numberOfKeys, nextValue.load());
+    storm::storage::BitVector seenValues(numberOfKeys);
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(values[0][index], values[thread][index]);
+        }
+        ASSERT_LT(values[0][index], numberOfKeys);
+        EXPECT_FALSE(seenValues.get(values[0][index]));
+        seenValues.set(values[0][index]);
+        EXPECT_EQ(values[0][index], map.getValue(keys[index]));
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, DISABLED_Benchmark) {
+    // Run with: bin/test-storage --gtest_filter=ConcurrentBitVectorHashMapTest.DISABLED_Benchmark --gtest_also_run_disabled_tests
+    uint64_t const numberOfKeys = 1000000;
+    std::vector<storm::storage::BitVector> keys;
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, index * 7919);
+        key.setFromInt(64, 64, index);
+        keys.push_back(std::move(key));
+    }
+
+    for (uint64_t numberOfThreads : {1, 2, 4}) {
+        // Every thread inserts all keys in its own random order, so many insertions race on the same keys.
+        std::vector<std::vector<uint64_t>> orders(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            std::iota(orders[thread].begin(), orders[thread].end(), 0);
+            std::shuffle(orders[thread].begin(), orders[thread].end(), std::mt19937(thread));
+        }
+        auto runThreads = [&](auto const& insert) {
+            storm::utility::Stopwatch stopwatch(true);
+            std::vector<std::thread> threads;
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                threads.emplace_back([&, thread]() {
+                    for (auto index : orders[thread]) {
+                        insert(keys[index], index);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            stopwatch.stop();
+            return static_cast<double>(numberOfThreads * numberOfKeys) / (1000.0 * std::max<uint64_t>(1, stopwatch.getTimeInMilliseconds()));
+        };
+
+        storm::storage::ConcurrentBitVectorHashMap<uint64_t> concurrentMap(128);
+        double const concurrentThroughput =
+            runThreads([&concurrentMap](storm::storage::BitVector const& key, uint64_t value) { concurrentMap.findOrAdd(key, value); });
+        EXPECT_EQ(numberOfKeys, concurrentMap.size());
+
+        storm::storage::BitVectorHashMap<uint64_t> lockedMap(128);
+        std::mutex mutex;
+        double const lockedThroughput = runThreads([&lockedMap, &mutex](storm::storage::BitVector const& key, uint64_t value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            lockedMap.findOrAdd(key, value);
+        });
+        EXPECT_EQ(numberOfKeys, lockedMap.size());
+
+        std::cout << numberOfThreads << " threads: concurrent map " << concurrentThroughput << " Mops/s, mutex + BitVectorHashMap " << lockedThroughput
+                  << " Mops/s\n";
+    }
+}
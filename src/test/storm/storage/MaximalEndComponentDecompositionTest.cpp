@@ -179,3 +179,32 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, ParallelSccDecomposition) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> markovAutomaton = abstractModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+
+    // Setting the minimal size to zero decomposes every candidate into SCCs in parallel.
+    auto options = storm::storage::MaximalEndComponentDecompositionOptions().numberOfThreads(2).minimalSizeForParallelSccDecomposition(0);
+    storm::storage::MaximalEndComponentDecomposition<double> sequentialDecomposition(*markovAutomaton);
+    storm::storage::MaximalEndComponentDecomposition<double> parallelDecomposition(*markovAutomaton, options);
+
+    // The order of the MECs is not fixed, so we compare the sets of MECs.
+    ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+    for (auto const& mec : sequentialDecomposition) {
+        bool found = false;
+        for (auto const& otherMec : parallelDecomposition) {
+            if (mec.getStateSet() == otherMec.getStateSet()) {
+                found = true;
+                for (auto const& stateChoicesPair : mec) {
+                    EXPECT_TRUE(stateChoicesPair.second == otherMec.getChoicesForState(stateChoicesPair.first));
+                }
+            }
+        }
+        EXPECT_TRUE(found);
+    }
+}
@@ -90,3 +90,68 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+    // A chain of 300 blocks with 10 states each. Every fifth block is a chain of trivial SCCs, all other blocks form a cycle.
+    uint64_t const numberOfBlocks = 300;
+    uint64_t const blockSize = 10;
+    uint64_t const numberOfStates = numberOfBlocks * blockSize;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t const block = state / blockSize;
+        bool const isCycle = block % 5 != 0;
+        bool const isLastStateOfBlock = state % blockSize == blockSize - 1;
+        if (isLastStateOfBlock) {
+            if (isCycle) {
+                ASSERT_NO_THROW(matrixBuilder.addNextValue(state, block * blockSize, 0.5));
+            }
+            if (block + 1 < numberOfBlocks) {
+                ASSERT_NO_THROW(matrixBuilder.addNextValue(state, state + 1, 0.5));
+            }
+        } else {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(state, state + 1, 1.0));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+    options.numberOfThreads(2).forceTopologicalSort();
+    storm::storage::StronglyConnectedComponentDecomposition<double> sccDecomposition;
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options));
+    ASSERT_EQ(840ul, sccDecomposition.size());
+
+    // Every SCC may only reach SCCs with a smaller index.
+    std::vector<uint64_t> stateToScc(numberOfStates);
+    for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+        for (auto state : sccDecomposition.getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto const& entry : matrix.getRow(state)) {
+            EXPECT_LE(stateToScc[entry.getColumn()], stateToScc[state]);
+        }
+    }
+
+    options.dropNaiveSccs();
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options));
+    ASSERT_EQ(240ul, sccDecomposition.size());
+    for (auto const& scc : sccDecomposition) {
+        EXPECT_EQ(blockSize, scc.size());
+    }
+
+    options.onlyBottomSccs();
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options));
+    ASSERT_EQ(1ul, sccDecomposition.size());
+    EXPECT_TRUE(sccDecomposition.getBlock(0).containsState(numberOfStates - 1));
+
+    // Restrict the decomposition to the second half of the system.
+    storm::storage::BitVector subsystem(numberOfStates, false);
+    for (uint64_t state = numberOfStates / 2; state < numberOfStates; ++state) {
+        subsystem.set(state);
+    }
+    options = storm::storage::StronglyConnectedComponentDecompositionOptions().numberOfThreads(2).subsystem(&subsystem).dropNaiveSccs();
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options));
+    ASSERT_EQ(120ul, sccDecomposition.size());
+}
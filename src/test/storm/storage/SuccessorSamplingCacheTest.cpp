@@ -0,0 +1,92 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <random>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SuccessorSamplingCache.h"
+
+namespace {
+
+typedef std::vector<storm::storage::MatrixEntry<uint64_t, double>> Row;
+
+Row createRow(uint64_t size, std::mt19937& engine) {
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::vector<double> weights(size);
+    double sum = 0.0;
+    for (auto& weight : weights) {
+        weight = distribution(engine);
+        sum += weight;
+    }
+    Row row;
+    for (uint64_t column = 0; column < size; ++column) {
+        row.emplace_back(column, weights[column] / sum);
+    }
+    return row;
+}
+
+uint64_t selectLinearly(Row const& row, double probability) {
+    double sum = 0.0;
+    for (uint64_t offset = 0; offset < row.size(); ++offset) {
+        sum += row[offset].getValue();
+        if (sum >= probability) {
+            return offset;
+        }
+    }
+    return row.size();
+}
+
+}  // namespace
+
+TEST(SuccessorSamplingCacheTest, SelectsSameEntryAsLinearScan) {
+    std::mt19937 engine(17);
+    std::vector<Row> rows;
+    for (uint64_t size : {1, 3, 15, 16, 50, 200, 1000}) {
+        rows.push_back(createRow(size, engine));
+    }
+
+    storm::storage::SuccessorSamplingCache<double> cache;
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    for (uint64_t sample = 0; sample < 10000; ++sample) {
+        uint64_t rowIndex = sample % rows.size();
+        Row const& row = rows[rowIndex];
+        double probability = distribution(engine);
+        EXPECT_EQ(selectLinearly(row, probability), cache.selectEntry(rowIndex, row.begin(), row.end(), probability));
+    }
+    // Only the rows with at least 16 entries are cached.
+    EXPECT_EQ(4ull, cache.getNumberOfCachedRows());
+    EXPECT_EQ(16ull + 50ull + 200ull + 1000ull, cache.getNumberOfCachedValues());
+
+    // Values that are not reached by the cumulative probability.
+    EXPECT_EQ(rows.back().size(), cache.selectEntry(rows.size() - 1, rows.back().begin(), rows.back().end(), 2.0));
+    EXPECT_EQ(0ull, cache.selectEntry(rows.size() - 1, rows.back().begin(), rows.back().end(), 0.0));
+}
+
+TEST(SuccessorSamplingCacheTest, EvictsLeastRecentlyUsedRows) {
+    std::mt19937 engine(42);
+    std::vector<Row> rows;
+    for (uint64_t rowIndex = 0; rowIndex < 10; ++rowIndex) {
+        rows.push_back(createRow(100, engine));
+    }
+
+    // The cache can hold three rows at a time.
+    storm::storage::SuccessorSamplingCache<double> cache(350);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    for (uint64_t sample = 0; sample < 1000; ++sample) {
+        uint64_t rowIndex = (sample * 7) % rows.size();
+        Row const& row = rows[rowIndex];
+        double probability = distribution(engine);
+        EXPECT_EQ(selectLinearly(row, probability), cache.selectEntry(rowIndex, row.begin(), row.end(), probability));
+        EXPECT_LE(cache.getNumberOfCachedValues(), 350ull);
+    }
+    EXPECT_EQ(3ull, cache.getNumberOfCachedRows());
+
+    // Rows that exceed the capacity are never cached.
+    Row largeRow = createRow(500, engine);
+    EXPECT_EQ(selectLinearly(largeRow, 0.5), cache.selectEntry(rows.size(), largeRow.begin(), largeRow.end(), 0.5));
+    EXPECT_EQ(3ull, cache.getNumberOfCachedRows());
+
+    cache.clear();
+    EXPECT_EQ(0ull, cache.getNumberOfCachedRows());
+    EXPECT_EQ(0ull, cache.getNumberOfCachedValues());
+}
@@ -6,12 +6,17 @@
 
 #include "storm/builder/DdPrismModelBuilder.h"
 
+#include "storm/environment/Environment.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/dd/BisimulationDecomposition.h"
+#include "storm/storage/dd/bisimulation/PartitionRefiner.h"
+#include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
@@ -21,6 +26,7 @@
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
 
+#include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -495,3 +501,91 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+namespace {
+
+template<storm::dd::DdType DdType>
+std::shared_ptr<storm::models::symbolic::Model<DdType, double>> buildCrowdsModel() {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    smd = smd.preprocess();
+    return storm::builder::DdPrismModelBuilder<DdType, double>().build(smd.asPrismProgram());
+}
+
+double checkInitialState(storm::models::sparse::Dtmc<double> const& dtmc, storm::logic::Formula const& formula) {
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(dtmc);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::Environment(), formula);
+    return result->asExplicitQuantitativeCheckResult<double>()[*dtmc.getInitialStates().begin()];
+}
+
+template<storm::dd::DdType DdType>
+void testIncrementalRefinement() {
+    std::shared_ptr<storm::models::symbolic::Model<DdType, double>> model = buildCrowdsModel<DdType>();
+
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]"));
+    storm::dd::bisimulation::PreservationInformation<DdType, double> preservationInformation(*model, formulas);
+    auto initialPartition = storm::dd::bisimulation::Partition<DdType, double>::create(*model, storm::storage::BisimulationType::Strong, formulas);
+
+    storm::dd::bisimulation::PartitionRefiner<DdType, double> fullRefiner(*model, initialPartition, false);
+    storm::dd::bisimulation::PartitionRefiner<DdType, double> incrementalRefiner(*model, initialPartition, true);
+    EXPECT_FALSE(fullRefiner.isIncrementalRefinementUsed());
+    EXPECT_TRUE(incrementalRefiner.isIncrementalRefinementUsed());
+
+    // Both refiners have to produce the same partitions in every step.
+    bool refined = true;
+    while (refined) {
+        refined = fullRefiner.refine();
+        EXPECT_EQ(refined, incrementalRefiner.refine());
+        EXPECT_EQ(fullRefiner.getStatePartition().getNumberOfBlocks(), incrementalRefiner.getStatePartition().getNumberOfBlocks());
+    }
+    EXPECT_EQ(65ul, incrementalRefiner.getStatePartition().getNumberOfBlocks());
+
+    storm::dd::bisimulation::QuotientExtractor<DdType, double> extractor(storm::dd::bisimulation::QuotientFormat::Sparse);
+    auto fullQuotient = extractor.extract(*model, fullRefiner.getStatePartition(), preservationInformation)->template as<storm::models::sparse::Dtmc<double>>();
+    auto incrementalQuotient =
+        extractor.extract(*model, incrementalRefiner.getStatePartition(), preservationInformation)->template as<storm::models::sparse::Dtmc<double>>();
+
+    EXPECT_EQ(fullQuotient->getNumberOfStates(), incrementalQuotient->getNumberOfStates());
+    EXPECT_EQ(fullQuotient->getNumberOfTransitions(), incrementalQuotient->getNumberOfTransitions());
+    EXPECT_NEAR(checkInitialState(*fullQuotient, *formulas.front()), checkInitialState(*incrementalQuotient, *formulas.front()), 1e-6);
+}
+
+}  // namespace
+
+TEST(SymbolicModelBisimulationDecomposition, IncrementalRefinement_Cudd) {
+    testIncrementalRefinement<storm::dd::DdType::CUDD>();
+}
+
+TEST(SymbolicModelBisimulationDecomposition, IncrementalRefinement_Sylvan) {
+    testIncrementalRefinement<storm::dd::DdType::Sylvan>();
+}
+
+TEST(SymbolicModelBisimulationDecomposition, ParallelQuotientExtraction_Sylvan) {
+    // The sylvan workers are started once with as many workers as there are processing units (unless set otherwise), so on machines with more
+    // than one core, the parallel extraction is compared against the one performed by a single worker.
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model = buildCrowdsModel<storm::dd::DdType::Sylvan>();
+
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::Sylvan, double> preservationInformation(*model);
+    auto partition = storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double>::create(*model, storm::storage::BisimulationType::Strong,
+                                                                                                     preservationInformation);
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::Sylvan, double> refiner(*model, partition);
+    while (refiner.refine()) {
+        // Refine until the fixpoint is reached.
+    }
+
+    storm::dd::bisimulation::QuotientExtractor<storm::dd::DdType::Sylvan, double> sequentialExtractor(storm::dd::bisimulation::QuotientFormat::Sparse, false);
+    storm::dd::bisimulation::QuotientExtractor<storm::dd::DdType::Sylvan, double> parallelExtractor(storm::dd::bisimulation::QuotientFormat::Sparse, true);
+    auto sequentialQuotient = sequentialExtractor.extract(*model, refiner.getStatePartition(), preservationInformation)
+                                  ->as<storm::models::sparse::Dtmc<double>>();
+    auto parallelQuotient = parallelExtractor.extract(*model, refiner.getStatePartition(), preservationInformation)
+                                ->as<storm::models::sparse::Dtmc<double>>();
+
+    EXPECT_EQ(2007ul, parallelQuotient->getNumberOfStates());
+    EXPECT_EQ(3738ul, parallelQuotient->getNumberOfTransitions());
+    EXPECT_EQ(sequentialQuotient->getTransitionMatrix(), parallelQuotient->getTransitionMatrix());
+    EXPECT_EQ(sequentialQuotient->getInitialStates(), parallelQuotient->getInitialStates());
+    for (auto const& label : sequentialQuotient->getStateLabeling().getLabels()) {
+        EXPECT_EQ(sequentialQuotient->getStates(label), parallelQuotient->getStates(label));
+    }
+}
@@ -0,0 +1,304 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <random>
+
+#include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/stateelimination.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> buildTransitionMatrix() {
+    // State 0 moves to states 1 and 2, which move to each other and (with the remaining probability) to the target or a sink.
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 2, 0.5);
+    builder.addNextValue(2, 1, 0.5);
+    return builder.build();
+}
+
+/*!
+ * Eliminates all states (including their forward transitions) in the order given by the penalty function, where the priorities of successors of
+ * eliminated states are not updated, and returns the order.
+ */
+std::vector<storm::storage::sparse::state_type> computeEliminationOrder(
+    storm::storage::SparseMatrix<double> const& matrix, std::vector<double> values,
+    storm::solver::stateelimination::DynamicStatePriorityQueue<double>::PenaltyFunctionType const& penaltyFunction) {
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+    std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties;
+    for (storm::storage::sparse::state_type state = 0; state < matrix.getRowCount(); ++state) {
+        statePenalties.emplace_back(state, penaltyFunction(state, flexibleMatrix, flexibleBackwardTransitions, values));
+    }
+    std::sort(statePenalties.begin(), statePenalties.end(), storm::solver::stateelimination::PriorityComparator());
+
+    auto priorityQueue = std::make_shared<storm::solver::stateelimination::DynamicStatePriorityQueue<double>>(
+        statePenalties, flexibleMatrix, flexibleBackwardTransitions, values, penaltyFunction, false);
+    storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, values);
+    std::vector<storm::storage::sparse::state_type> eliminationOrder;
+    while (priorityQueue->hasNext()) {
+        storm::storage::sparse::state_type state = priorityQueue->pop();
+        eliminationOrder.push_back(state);
+        eliminator.eliminateState(state, true);
+    }
+    return eliminationOrder;
+}
+
+/*!
+ * Builds a random substochastic matrix in which every state has the given number of successors and moves to the target with the missing probability,
+ * which is stored in the given vector. Every row sums up to at most 0.9, so iterating the equation system converges quickly.
+ */
+storm::storage::SparseMatrix<double> buildRandomTransitionMatrix(uint64_t numberOfStates, uint64_t numberOfSuccessors, std::vector<double>& targetValues) {
+    std::mt19937 randomGenerator(42);
+    std::uniform_int_distribution<uint64_t> stateDistribution(0, numberOfStates - 1);
+    std::uniform_real_distribution<double> weightDistribution(0.1, 1.0);
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    targetValues.resize(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::vector<uint64_t> successors;
+        for (uint64_t successor = 0; successor < numberOfSuccessors; ++successor) {
+            successors.push_back(stateDistribution(randomGenerator));
+        }
+        std::sort(successors.begin(), successors.end());
+        successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+        std::vector<double> weights;
+        double weightSum = weightDistribution(randomGenerator);
+        for (uint64_t index = 0; index < successors.size(); ++index) {
+            weights.push_back(weightDistribution(randomGenerator));
+            weightSum += weights.back();
+        }
+        double remainingProbability = 1.0;
+        for (uint64_t index = 0; index < successors.size(); ++index) {
+            double const probability = 0.9 * weights[index] / weightSum;
+            builder.addNextValue(state, successors[index], probability);
+            remainingProbability -= probability;
+        }
+        targetValues[state] = remainingProbability;
+    }
+    return builder.build();
+}
+
+/*!
+ * Solves the equation system x = A x + b restricted to the given states by iterating it.
+ */
+std::vector<double> solveByIteration(storm::storage::FlexibleSparseMatrix<double> const& matrix, std::vector<double> const& values,
+                                     storm::storage::BitVector const& states) {
+    std::vector<double> result(values.size(), 0.0);
+    std::vector<double> nextResult(values.size(), 0.0);
+    for (uint64_t iteration = 0; iteration < 1000; ++iteration) {
+        for (auto state : states) {
+            nextResult[state] = values[state];
+            for (auto const& entry : matrix.getRow(state)) {
+                nextResult[state] += entry.getValue() * result[entry.getColumn()];
+            }
+        }
+        std::swap(result, nextResult);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(StateEliminationTest, Penalties) {
+    storm::storage::SparseMatrix<double> matrix = buildTransitionMatrix();
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+    std::vector<double> values = {0.0, 0.25, 0.5};
+
+    EXPECT_EQ(0ul, storm::utility::stateelimination::computeStatePenaltyMinimumDegree(0, flexibleMatrix, flexibleBackwardTransitions, values));
+    EXPECT_EQ(2ul, storm::utility::stateelimination::computeStatePenaltyMinimumDegree(1, flexibleMatrix, flexibleBackwardTransitions, values));
+    EXPECT_EQ(2ul, storm::utility::stateelimination::computeStatePenaltyMinimumDegree(2, flexibleMatrix, flexibleBackwardTransitions, values));
+
+    // Eliminating state 1 updates the values of states 0 and 2 and the transition from 0 to 2, and it introduces a self-loop at state 2.
+    EXPECT_EQ(0ul, storm::utility::stateelimination::computeStatePenaltyMinimumFill(0, flexibleMatrix, flexibleBackwardTransitions, values));
+    EXPECT_EQ(7ul, storm::utility::stateelimination::computeStatePenaltyMinimumFill(1, flexibleMatrix, flexibleBackwardTransitions, values));
+    EXPECT_EQ(7ul, storm::utility::stateelimination::computeStatePenaltyMinimumFill(2, flexibleMatrix, flexibleBackwardTransitions, values));
+}
+
+TEST(StateEliminationTest, MinimumFillOrder) {
+    storm::storage::SparseMatrix<double> matrix = buildTransitionMatrix();
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+    std::vector<double> values = {0.0, 0.25, 0.5};
+
+    std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties;
+    for (storm::storage::sparse::state_type state = 0; state < 3; ++state) {
+        statePenalties.emplace_back(
+            state, storm::utility::stateelimination::computeStatePenaltyMinimumFill(state, flexibleMatrix, flexibleBackwardTransitions, values));
+    }
+    std::sort(statePenalties.begin(), statePenalties.end(), storm::solver::stateelimination::PriorityComparator());
+
+    auto priorityQueue = std::make_shared<storm::solver::stateelimination::DynamicStatePriorityQueue<double>>(
+        statePenalties, flexibleMatrix, flexibleBackwardTransitions, values, storm::utility::stateelimination::computeStatePenaltyMinimumFill<double>, true);
+    storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, values);
+    eliminator.eliminateAll(false);
+
+    EXPECT_NEAR(0.75, values[0], 1e-6);
+    EXPECT_NEAR(2.0 / 3.0, values[1], 1e-6);
+    EXPECT_NEAR(5.0 / 6.0, values[2], 1e-6);
+}
+
+TEST(StateEliminationTest, MinimumFillOrderWithUpdatedPenalties) {
+    // State 0 moves to states 1, 2 and 3, state 1 moves to states 0 and 2, state 2 moves to state 1 and state 3 moves to state 0. All states move to
+    // the target with the remaining probability.
+    storm::storage::SparseMatrixBuilder<double> builder(4, 4);
+    builder.addNextValue(0, 1, 0.25);
+    builder.addNextValue(0, 2, 0.25);
+    builder.addNextValue(0, 3, 0.25);
+    builder.addNextValue(1, 0, 0.5);
+    builder.addNextValue(1, 2, 0.25);
+    builder.addNextValue(2, 1, 0.5);
+    builder.addNextValue(3, 0, 0.5);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+    std::vector<double> values = {0.25, 0.25, 0.5, 0.5};
+
+    std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties;
+    for (storm::storage::sparse::state_type state = 0; state < 4; ++state) {
+        statePenalties.emplace_back(
+            state, storm::utility::stateelimination::computeStatePenaltyMinimumFill(state, flexibleMatrix, flexibleBackwardTransitions, values));
+    }
+    std::sort(statePenalties.begin(), statePenalties.end(), storm::solver::stateelimination::PriorityComparator());
+
+    auto priorityQueue = std::make_shared<storm::solver::stateelimination::DynamicStatePriorityQueue<double>>(
+        statePenalties, flexibleMatrix, flexibleBackwardTransitions, values, storm::utility::stateelimination::computeStatePenaltyMinimumFill<double>, true);
+    storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, values);
+    std::vector<storm::storage::sparse::state_type> eliminationOrder;
+    while (priorityQueue->hasNext()) {
+        storm::storage::sparse::state_type state = priorityQueue->pop();
+        eliminationOrder.push_back(state);
+        eliminator.eliminateState(state, false);
+    }
+
+    // The initial penalties are 19, 13, 7 and 4, so state 3 is eliminated first. This adds a self-loop to state 0 and leaves the penalties of the
+    // states 0, 1 and 2 at 13, 13 and 7. Eliminating state 2 redirects the states 0 and 1 to state 1, after which both states 0 and 1 have penalty 7,
+    // so state 0 is eliminated before state 1. If the penalty of state 0 was computed before the row of state 1 was updated, it would be 8 instead.
+    std::vector<storm::storage::sparse::state_type> expectedEliminationOrder = {3, 2, 0, 1};
+    EXPECT_EQ(expectedEliminationOrder, eliminationOrder);
+    for (auto const& value : values) {
+        EXPECT_NEAR(1.0, value, 1e-6);
+    }
+}
+
+TEST(StateEliminationTest, PenaltiesOfPredecessorsThatAreSuccessors) {
+    // State 0 moves to state 1, which moves to state 0 and itself, and state 2 only has a self-loop. All states move to the target with the
+    // remaining probability.
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 0, 0.25);
+    builder.addNextValue(1, 1, 0.25);
+    builder.addNextValue(2, 2, 0.5);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    std::vector<double> values = {0.5, 0.5, 0.5};
+
+    // The regular expression penalties (number of predecessors times number of successors) are initially 1, 4 and 1, so state 0 is eliminated
+    // first. Its predecessor 1 is also its successor: its forward transitions become {1} before its backward transitions lose state 0. The penalty of
+    // state 1 is thus 1 and not 2 as it would be if it was computed between both updates, so state 1 is eliminated before state 2.
+    std::vector<storm::storage::sparse::state_type> expectedEliminationOrder = {0, 1, 2};
+    EXPECT_EQ(expectedEliminationOrder,
+              computeEliminationOrder(matrix, values, storm::utility::stateelimination::computeStatePenaltyRegularExpression<double>));
+
+    // For doubles, the dynamic penalty is the number of predecessors times the number of successors plus one. After eliminating state 0, the
+    // penalty of state 1 is 2 (and not 4) and ties with the one of state 2.
+    EXPECT_EQ(expectedEliminationOrder, computeEliminationOrder(matrix, values, storm::utility::stateelimination::computeStatePenalty<double>));
+}
+
+TEST(StateEliminationTest, RandomMatrixWithFillIn) {
+    // Every elimination merges the rows of many predecessors and updates the backward transitions of many successors, so the merged rows grow
+    // and shrink and the reused row buffers are handed out with varying sizes.
+    uint64_t const numberOfStates = 300;
+    std::vector<double> targetValues;
+    storm::storage::SparseMatrix<double> matrix = buildRandomTransitionMatrix(numberOfStates, 6, targetValues);
+    storm::storage::BitVector allStates(numberOfStates, true);
+    storm::storage::FlexibleSparseMatrix<double> referenceMatrix(matrix);
+    std::vector<double> const reference = solveByIteration(referenceMatrix, targetValues, allStates);
+
+    // Keeping the forward transitions, the values of all states are the reachability probabilities afterwards.
+    {
+        storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+        storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+        std::vector<double> values = targetValues;
+        std::vector<storm::storage::sparse::state_type> statesToEliminate;
+        for (storm::storage::sparse::state_type state = 0; state < numberOfStates; ++state) {
+            statesToEliminate.push_back((state * 7) % numberOfStates);
+        }
+        storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, statesToEliminate,
+                                                                                       values);
+        eliminator.eliminateAll(false);
+        for (storm::storage::sparse::state_type state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(reference[state], values[state], 1e-8) << "at state " << state;
+        }
+    }
+
+    // Removing the forward transitions of every other state, the remaining states form an equivalent equation system whose backward transitions
+    // are the transposed forward transitions.
+    {
+        storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+        storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+        std::vector<double> values = targetValues;
+        std::vector<storm::storage::sparse::state_type> statesToEliminate;
+        storm::storage::BitVector remainingStates(numberOfStates, true);
+        for (storm::storage::sparse::state_type state = 0; state < numberOfStates; state += 2) {
+            statesToEliminate.push_back(state);
+            remainingStates.set(state, false);
+        }
+        storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, statesToEliminate,
+                                                                                       values);
+        eliminator.eliminateAll(true);
+
+        std::vector<std::vector<storm::storage::sparse::state_type>> expectedPredecessors(numberOfStates);
+        for (auto state : remainingStates) {
+            for (auto const& entry : flexibleMatrix.getRow(state)) {
+                EXPECT_TRUE(remainingStates.get(entry.getColumn())) << "transition from " << state << " to eliminated state " << entry.getColumn();
+                expectedPredecessors[entry.getColumn()].push_back(state);
+            }
+        }
+        for (auto state : remainingStates) {
+            std::vector<storm::storage::sparse::state_type> predecessors;
+            for (auto const& entry : flexibleBackwardTransitions.getRow(state)) {
+                predecessors.push_back(entry.getColumn());
+            }
+            EXPECT_EQ(expectedPredecessors[state], predecessors) << "at state " << state;
+        }
+
+        std::vector<double> const result = solveByIteration(flexibleMatrix, values, remainingStates);
+        for (auto state : remainingStates) {
+            EXPECT_NEAR(reference[state], result[state], 1e-8) << "at state " << state;
+        }
+    }
+}
+
+TEST(StateEliminationTest, DISABLED_RandomMatrixBenchmark) {
+    // Run with: bin/test-utility --gtest_filter=StateEliminationTest.DISABLED_RandomMatrixBenchmark --gtest_also_run_disabled_tests
+    // Eliminates all states of a random matrix in the order of their indices and reports the fastest of five runs.
+    uint64_t const numberOfStates = 3000;
+    std::vector<double> targetValues;
+    storm::storage::SparseMatrix<double> matrix = buildRandomTransitionMatrix(numberOfStates, 4, targetValues);
+    std::vector<storm::storage::sparse::state_type> statesToEliminate;
+    for (storm::storage::sparse::state_type state = 0; state < numberOfStates; ++state) {
+        statesToEliminate.push_back(state);
+    }
+    uint64_t fastestTime = std::numeric_limits<uint64_t>::max();
+    for (uint64_t run = 0; run < 5; ++run) {
+        storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+        storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+        std::vector<double> values = targetValues;
+        storm::utility::Stopwatch eliminationWatch(true);
+        storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, statesToEliminate,
+                                                                                       values);
+        eliminator.eliminateAll(true);
+        eliminationWatch.stop();
+        fastestTime = std::min<uint64_t>(fastestTime, eliminationWatch.getTimeInMilliseconds());
+    }
+    std::cout << "Eliminating " << numberOfStates << " states: " << fastestTime << "ms\n";
+}